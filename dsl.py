@@ -7,6 +7,9 @@ DSL_RETURN_SUCCESS = 0
 DSL_PAD_SINK = 0
 DSL_PAD_SRC = 1
 
+DSL_KITTI_OUTPUT_MODE_FRAME_FILES = 0
+DSL_KITTI_OUTPUT_MODE_SOURCE_FILES = 1
+
 DSL_RTP_TCP = 4
 DSL_RTP_ALL = 7
 
@@ -33,6 +36,10 @@ DSL_STATE_IN_TRANSITION = 5
 DSL_CAPTURE_TYPE_OBJECT = 0
 DSL_CAPTURE_TYPE_FRAME = 1
 
+DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST = 0
+DSL_ODE_ACTION_OVERFLOW_DROP_OLDEST = 1
+DSL_ODE_ACTION_OVERFLOW_BLOCK = 2
+
 DSL_ODE_TRIGGER_LIMIT_NONE = 0
 DSL_ODE_TRIGGER_LIMIT_ONE = 1
 
@@ -40,10 +47,140 @@ DSL_ODE_TRIGGER_LIMIT_ONE = 1
 DSL_ODE_ANY_SOURCE = int('7FFFFFFF',16)
 DSL_ODE_ANY_CLASS = int('7FFFFFFF',16)
 
+DSL_ODE_METRICS_HISTOGRAM_BUCKETS = 16
+
+DSL_ODE_WINDOW_AGGREGATE_SUM = 0
+DSL_ODE_WINDOW_AGGREGATE_AVERAGE = 1
+DSL_ODE_WINDOW_AGGREGATE_MIN = 2
+DSL_ODE_WINDOW_AGGREGATE_MAX = 3
+
+DSL_ODE_WINDOW_CROSSING_ABOVE = 0
+DSL_ODE_WINDOW_CROSSING_BELOW = 1
+
+DSL_ODE_WINDOW_TIMESTAMP_PTS = 0
+DSL_ODE_WINDOW_TIMESTAMP_NTP = 1
+
+DSL_ODE_WINDOW_BUCKETS_MAX = 4096
+
+DSL_ODE_LINE_DIRECTION_ANY = 0
+DSL_ODE_LINE_DIRECTION_LEFT_TO_RIGHT = 1
+DSL_ODE_LINE_DIRECTION_RIGHT_TO_LEFT = 2
+
+DSL_ODE_LINE_POINT_BOTTOM_CENTER = 0
+DSL_ODE_LINE_POINT_CENTER = 1
+
+DSL_META_RECORDING_MAX_LABEL_SIZE = 128
+DSL_RESULT_META_RECORDING_END = int('00120009',16)
+
+##
+## Fixed-layout ODE occurrence record, see dsl_ode_occurrence_record in DslApi.h
+##
+class dsl_ode_occurrence_record(Structure):
+    _fields_ = [
+        ('event_id', c_uint64),
+        ('ntp_timestamp', c_uint64),
+        ('object_id', c_uint64),
+        ('trigger_index', c_uint),
+        ('source_id', c_uint),
+        ('frame_num', c_uint),
+        ('class_id', c_int),
+        ('confidence', c_float),
+        ('left', c_float),
+        ('top', c_float),
+        ('width', c_float),
+        ('height', c_float),
+        ('is_object', c_uint)]
+
+##
+## ODE Trigger performance counters, see dsl_ode_trigger_metrics in DslApi.h
+##
+class dsl_ode_trigger_metrics(Structure):
+    _fields_ = [
+        ('batches', c_uint64),
+        ('objects_evaluated', c_uint64),
+        ('objects_passed', c_uint64),
+        ('occurrences', c_uint64),
+        ('evaluation_time_ns', c_uint64),
+        ('evaluation_time_histogram', c_uint64 * DSL_ODE_METRICS_HISTOGRAM_BUCKETS)]
+
+##
+## ODE Action performance counters, see dsl_ode_action_metrics in DslApi.h
+##
+class dsl_ode_action_metrics(Structure):
+    _fields_ = [
+        ('invocations', c_uint64),
+        ('execution_time_ns', c_uint64),
+        ('max_execution_time_ns', c_uint64),
+        ('async_dropped', c_uint64)]
+
+##
+## Pipeline component latency stats, see dsl_latency_stats in DslApi.h
+##
+class dsl_latency_stats(Structure):
+    _fields_ = [
+        ('component', c_wchar_p),
+        ('count', c_uint64),
+        ('dropped', c_uint64),
+        ('p50_ns', c_uint64),
+        ('p90_ns', c_uint64),
+        ('p99_ns', c_uint64),
+        ('max_ns', c_uint64)]
+
+##
+## Recorded classifier label, see dsl_meta_recording_label in DslApi.h
+##
+class dsl_meta_recording_label(Structure):
+    _fields_ = [
+        ('unique_component_id', c_int),
+        ('result_class_id', c_uint),
+        ('label_id', c_uint),
+        ('result_prob', c_float),
+        ('result_label', c_char * DSL_META_RECORDING_MAX_LABEL_SIZE)]
+
+##
+## Recorded Object, see dsl_meta_recording_object in DslApi.h
+##
+class dsl_meta_recording_object(Structure):
+    _fields_ = [
+        ('object_id', c_uint64),
+        ('class_id', c_int),
+        ('unique_component_id', c_int),
+        ('confidence', c_float),
+        ('tracker_confidence', c_float),
+        ('left', c_float),
+        ('top', c_float),
+        ('width', c_float),
+        ('height', c_float),
+        ('label', c_char * DSL_META_RECORDING_MAX_LABEL_SIZE),
+        ('label_count', c_uint),
+        ('labels', POINTER(dsl_meta_recording_label))]
+
+##
+## Recorded Frame, see dsl_meta_recording_frame in DslApi.h
+##
+class dsl_meta_recording_frame(Structure):
+    _fields_ = [
+        ('source_id', c_uint),
+        ('batch_id', c_uint),
+        ('frame_num', c_int),
+        ('buf_pts', c_uint64),
+        ('ntp_timestamp', c_uint64),
+        ('source_frame_width', c_uint),
+        ('source_frame_height', c_uint),
+        ('display_meta_count', c_uint),
+        ('display_rect_count', c_uint),
+        ('display_label_count', c_uint),
+        ('display_line_count', c_uint),
+        ('display_arrow_count', c_uint),
+        ('display_circle_count', c_uint),
+        ('object_count', c_uint),
+        ('objects', POINTER(dsl_meta_recording_object))]
+
 ##
 ## Pointer Typedefs
 ##
 DSL_UINT_P = POINTER(c_uint)
+DSL_UINT64_P = POINTER(c_uint64)
 DSL_BOOL_P = POINTER(c_bool)
 DSL_WCHAR_PP = POINTER(c_wchar_p)
 DSL_DOUBLE_P = POINTER(c_double)
@@ -57,7 +194,9 @@ DSL_EOS_LISTENER = CFUNCTYPE(None, c_void_p)
 DSL_XWINDOW_KEY_EVENT_HANDLER = CFUNCTYPE(None, c_wchar_p, c_void_p)
 DSL_XWINDOW_BUTTON_EVENT_HANDLER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_XWINDOW_DELETE_EVENT_HANDLER = CFUNCTYPE(None, c_void_p)
+DSL_LATENCY_STATS_HANDLER = CFUNCTYPE(None, POINTER(dsl_latency_stats), c_uint, c_void_p)
 DSL_ODE_HANDLE_OCCURRENCE = CFUNCTYPE(None, c_uint, c_wchar_p, c_void_p, c_void_p, c_void_p, c_void_p)
+DSL_ODE_HANDLE_OCCURRENCES = CFUNCTYPE(None, POINTER(dsl_ode_occurrence_record), c_uint, c_void_p)
 DSL_ODE_CHECK_FOR_OCCURRENCE = CFUNCTYPE(c_bool, c_void_p, c_void_p, c_void_p, c_void_p)
 
 ##
@@ -79,6 +218,34 @@ def dsl_ode_action_callback_new(name, client_handler, client_data):
     result = _dsl.dsl_ode_action_callback_new(name, handler_cb, client_data)
     return int(result)
     
+##
+## dsl_ode_action_callback_batch_new()
+## The client_handler is called with a NumPy structured array that views the 
+## records in place. The array is only valid for the duration of the callback.
+##
+_dsl.dsl_ode_action_callback_batch_new.argtypes = [c_wchar_p, DSL_ODE_HANDLE_OCCURRENCES, c_void_p]
+_dsl.dsl_ode_action_callback_batch_new.restype = c_uint
+def dsl_ode_action_callback_batch_new(name, client_handler, client_data):
+    global _dsl
+    import numpy.ctypeslib
+    def records_handler(records, count, client_data):
+        client_handler(numpy.ctypeslib.as_array(records, shape=(count,)), client_data)
+    handler_cb = DSL_ODE_HANDLE_OCCURRENCES(records_handler)
+    callbacks.append(handler_cb)
+    result = _dsl.dsl_ode_action_callback_batch_new(name, handler_cb, client_data)
+    return int(result)
+    
+##
+## dsl_ode_action_callback_batch_trigger_name_get()
+##
+_dsl.dsl_ode_action_callback_batch_trigger_name_get.argtypes = [c_wchar_p, c_uint, POINTER(c_wchar_p)]
+_dsl.dsl_ode_action_callback_batch_trigger_name_get.restype = c_uint
+def dsl_ode_action_callback_batch_trigger_name_get(name, trigger_index):
+    global _dsl
+    trigger = c_wchar_p(0)
+    result = _dsl.dsl_ode_action_callback_batch_trigger_name_get(name, trigger_index, DSL_WCHAR_PP(trigger))
+    return int(result), trigger.value 
+    
 ##
 ## dsl_ode_action_capture_frame_new()
 ##
@@ -159,6 +326,16 @@ def dsl_ode_action_hide_new(name, text, border):
     result =_dsl.dsl_ode_action_hide_new(name, text, border)
     return int(result)
 
+##
+## dsl_ode_action_journal_new()
+##
+_dsl.dsl_ode_action_journal_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_action_journal_new.restype = c_uint
+def dsl_ode_action_journal_new(name, file_path, max_size_mb, max_files):
+    global _dsl
+    result =_dsl.dsl_ode_action_journal_new(name, file_path, max_size_mb, max_files)
+    return int(result)
+
 ##
 ## dsl_ode_action_log_new()
 ##
@@ -309,6 +486,60 @@ def dsl_ode_action_trigger_enable_new(name, trigger):
     result =_dsl.dsl_ode_action_trigger_enable_new(name, trigger)
     return int(result)
 
+##
+## dsl_ode_action_async_get()
+##
+_dsl.dsl_ode_action_async_get.argtypes = [c_wchar_p, POINTER(c_bool), POINTER(c_uint)]
+_dsl.dsl_ode_action_async_get.restype = c_uint
+def dsl_ode_action_async_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    overflow_policy = c_uint(0)
+    result =_dsl.dsl_ode_action_async_get(name, DSL_BOOL_P(enabled), DSL_UINT_P(overflow_policy))
+    return int(result), enabled.value, overflow_policy.value
+
+##
+## dsl_ode_action_async_set()
+##
+_dsl.dsl_ode_action_async_set.argtypes = [c_wchar_p, c_bool, c_uint]
+_dsl.dsl_ode_action_async_set.restype = c_uint
+def dsl_ode_action_async_set(name, enabled, overflow_policy):
+    global _dsl
+    result =_dsl.dsl_ode_action_async_set(name, enabled, overflow_policy)
+    return int(result)
+
+##
+## dsl_ode_action_async_dropped_get()
+##
+_dsl.dsl_ode_action_async_dropped_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_ode_action_async_dropped_get.restype = c_uint
+def dsl_ode_action_async_dropped_get(name):
+    global _dsl
+    dropped = c_uint64(0)
+    result =_dsl.dsl_ode_action_async_dropped_get(name, pointer(dropped))
+    return int(result), dropped.value
+
+##
+## dsl_ode_action_metrics_get()
+##
+_dsl.dsl_ode_action_metrics_get.argtypes = [c_wchar_p, POINTER(dsl_ode_action_metrics)]
+_dsl.dsl_ode_action_metrics_get.restype = c_uint
+def dsl_ode_action_metrics_get(name):
+    global _dsl
+    metrics = dsl_ode_action_metrics()
+    result =_dsl.dsl_ode_action_metrics_get(name, pointer(metrics))
+    return int(result), metrics
+
+##
+## dsl_ode_action_metrics_reset()
+##
+_dsl.dsl_ode_action_metrics_reset.argtypes = [c_wchar_p]
+_dsl.dsl_ode_action_metrics_reset.restype = c_uint
+def dsl_ode_action_metrics_reset(name):
+    global _dsl
+    result =_dsl.dsl_ode_action_metrics_reset(name)
+    return int(result)
+
 ##
 ## dsl_ode_action_delete()
 ##
@@ -350,6 +581,40 @@ def dsl_ode_action_list_size():
     result =_dsl.dsl_ode_action_list_size()
     return int(result)
 
+##
+## dsl_ode_journal_scan()
+## As with dsl_ode_action_callback_batch_new, the client_handler is called with
+## a NumPy structured array that is only valid for the duration of the callback.
+##
+_dsl.dsl_ode_journal_scan.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint64, c_uint64,
+    DSL_ODE_HANDLE_OCCURRENCES, c_void_p, POINTER(c_uint64)]
+_dsl.dsl_ode_journal_scan.restype = c_uint
+def dsl_ode_journal_scan(file_path, trigger, source_id, start_time, end_time, client_handler, client_data):
+    global _dsl
+    handler_cb = None
+    if client_handler:
+        import numpy.ctypeslib
+        def records_handler(records, count, client_data):
+            client_handler(numpy.ctypeslib.as_array(records, shape=(count,)), client_data)
+        handler_cb = DSL_ODE_HANDLE_OCCURRENCES(records_handler)
+    count = c_uint64(0)
+    result =_dsl.dsl_ode_journal_scan(file_path, trigger, source_id, start_time, end_time,
+        handler_cb, client_data, pointer(count))
+    return int(result), count.value
+
+##
+## dsl_ode_journal_csv_write()
+##
+_dsl.dsl_ode_journal_csv_write.argtypes = [c_wchar_p, c_wchar_p, c_wchar_p, c_uint, 
+    c_uint64, c_uint64, POINTER(c_uint64)]
+_dsl.dsl_ode_journal_csv_write.restype = c_uint
+def dsl_ode_journal_csv_write(file_path, csv_file_path, trigger, source_id, start_time, end_time):
+    global _dsl
+    count = c_uint64(0)
+    result =_dsl.dsl_ode_journal_csv_write(file_path, csv_file_path, trigger, source_id, 
+        start_time, end_time, pointer(count))
+    return int(result), count.value
+
 ##
 ## dsl_ode_area_new()
 ##
@@ -452,6 +717,98 @@ def dsl_ode_area_list_size():
     result =_dsl.dsl_ode_area_list_size()
     return int(result)
 
+##
+## dsl_ode_line_new()
+##
+_dsl.dsl_ode_line_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_bool]
+_dsl.dsl_ode_line_new.restype = c_uint
+def dsl_ode_line_new(name, x1, y1, x2, y2, display):
+    global _dsl
+    result =_dsl.dsl_ode_line_new(name, x1, y1, x2, y2, display)
+    return int(result)
+
+##
+## dsl_ode_line_get()
+##
+_dsl.dsl_ode_line_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint), 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_bool)]
+_dsl.dsl_ode_line_get.restype = c_uint
+def dsl_ode_line_get(name):
+    global _dsl
+    x1 = c_uint(0)
+    y1 = c_uint(0)
+    x2 = c_uint(0)
+    y2 = c_uint(0)
+    display = c_bool(0)
+    result = _dsl.dsl_ode_line_get(name, DSL_UINT_P(x1), 
+        DSL_UINT_P(y1), DSL_UINT_P(x2), DSL_UINT_P(y2), DSL_BOOL_P(display))
+    return int(result), x1.value, y1.value, x2.value, y2.value, display.value 
+
+##
+## dsl_ode_line_set()
+##
+_dsl.dsl_ode_line_set.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_bool]
+_dsl.dsl_ode_line_set.restype = c_uint
+def dsl_ode_line_set(name, x1, y1, x2, y2, display):
+    global _dsl
+    result =_dsl.dsl_ode_line_set(name, x1, y1, x2, y2, display)
+    return int(result)
+
+##
+## dsl_ode_line_color_get()
+##
+_dsl.dsl_ode_line_color_get.argtypes = [c_wchar_p, POINTER(c_double), POINTER(c_double), 
+    POINTER(c_double), POINTER(c_double)]
+_dsl.dsl_ode_line_color_get.restype = c_uint
+def dsl_ode_line_color_get(name):
+    global _dsl
+    red = c_double(0)
+    green = c_double(0)
+    blue = c_double(0)
+    alpha = c_double(0)
+    result = _dsl.dsl_ode_line_color_get(name, 
+        DSL_DOUBLE_P(red), DSL_DOUBLE_P(green), DSL_DOUBLE_P(blue), DSL_DOUBLE_P(alpha))
+    return int(result), red.value, green.value, blue.value, alpha.value 
+
+##
+## dsl_ode_line_color_set()
+##
+_dsl.dsl_ode_line_color_set.argtypes = [c_wchar_p, c_double, c_double, c_double, c_double]
+_dsl.dsl_ode_line_color_set.restype = c_uint
+def dsl_ode_line_color_set(name, red, green, blue, alpha):
+    global _dsl
+    result =_dsl.dsl_ode_line_color_set(name, red, green, blue, alpha)
+    return int(result)
+
+##
+## dsl_ode_line_delete()
+##
+_dsl.dsl_ode_line_delete.argtypes = [c_wchar_p]
+_dsl.dsl_ode_line_delete.restype = c_uint
+def dsl_ode_line_delete(name):
+    global _dsl
+    result =_dsl.dsl_ode_line_delete(name)
+    return int(result)
+
+##
+## dsl_ode_line_delete_all()
+##
+_dsl.dsl_ode_line_delete_all.argtypes = []
+_dsl.dsl_ode_line_delete_all.restype = c_uint
+def dsl_ode_line_delete_all():
+    global _dsl
+    result =_dsl.dsl_ode_line_delete_all()
+    return int(result)
+
+##
+## dsl_ode_line_list_size()
+##
+_dsl.dsl_ode_line_list_size.restype = c_uint
+def dsl_ode_line_list_size():
+    global _dsl
+    result =_dsl.dsl_ode_line_list_size()
+    return int(result)
+
 ##
 ## dsl_ode_trigger_absence_new()
 ##
@@ -534,6 +891,56 @@ def dsl_ode_trigger_range_new(name, class_id, limit, lower, upper):
     result =_dsl.dsl_ode_trigger_range_new(name, class_id, limit, lower, upper)
     return int(result)
 
+##
+## dsl_ode_trigger_window_new()
+##
+_dsl.dsl_ode_trigger_window_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_float, c_uint, c_uint]
+_dsl.dsl_ode_trigger_window_new.restype = c_uint
+def dsl_ode_trigger_window_new(name, class_id, limit, aggregate, crossing, threshold, window, bucket):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_window_new(name, class_id, limit, aggregate, crossing, threshold, window, bucket)
+    return int(result)
+
+##
+## dsl_ode_trigger_new_track_new()
+##
+_dsl.dsl_ode_trigger_new_track_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_new_track_new.restype = c_uint
+def dsl_ode_trigger_new_track_new(name, class_id, limit, lost_frames):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_new_track_new(name, class_id, limit, lost_frames)
+    return int(result)
+
+##
+## dsl_ode_trigger_lost_track_new()
+##
+_dsl.dsl_ode_trigger_lost_track_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_lost_track_new.restype = c_uint
+def dsl_ode_trigger_lost_track_new(name, class_id, limit, lost_frames):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_lost_track_new(name, class_id, limit, lost_frames)
+    return int(result)
+
+##
+## dsl_ode_trigger_dwell_new()
+##
+_dsl.dsl_ode_trigger_dwell_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_dwell_new.restype = c_uint
+def dsl_ode_trigger_dwell_new(name, class_id, limit, min_dwell_time, lost_frames):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_dwell_new(name, class_id, limit, min_dwell_time, lost_frames)
+    return int(result)
+
+##
+## dsl_ode_trigger_line_crossing_new()
+##
+_dsl.dsl_ode_trigger_line_crossing_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_line_crossing_new.restype = c_uint
+def dsl_ode_trigger_line_crossing_new(name, class_id, limit, direction, reference_point, lost_frames):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_line_crossing_new(name, class_id, limit, direction, reference_point, lost_frames)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_reset()
 ##
@@ -544,6 +951,27 @@ def dsl_ode_trigger_reset(name):
     result =_dsl.dsl_ode_trigger_reset(name)
     return int(result)
 
+##
+## dsl_ode_trigger_metrics_get()
+##
+_dsl.dsl_ode_trigger_metrics_get.argtypes = [c_wchar_p, POINTER(dsl_ode_trigger_metrics)]
+_dsl.dsl_ode_trigger_metrics_get.restype = c_uint
+def dsl_ode_trigger_metrics_get(name):
+    global _dsl
+    metrics = dsl_ode_trigger_metrics()
+    result =_dsl.dsl_ode_trigger_metrics_get(name, pointer(metrics))
+    return int(result), metrics
+
+##
+## dsl_ode_trigger_metrics_reset()
+##
+_dsl.dsl_ode_trigger_metrics_reset.argtypes = [c_wchar_p]
+_dsl.dsl_ode_trigger_metrics_reset.restype = c_uint
+def dsl_ode_trigger_metrics_reset(name):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_metrics_reset(name)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_enabled_get()
 ##
@@ -693,6 +1121,71 @@ def dsl_ode_trigger_infer_done_only_set(name, infer_done_only):
     result =_dsl.dsl_ode_trigger_infer_done_only_set(name, infer_done_only)
     return int(result)
 
+##
+## dsl_ode_trigger_window_timestamp_get()
+##
+_dsl.dsl_ode_trigger_window_timestamp_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_window_timestamp_get.restype = c_uint
+def dsl_ode_trigger_window_timestamp_get(name):
+    global _dsl
+    timestamp = c_uint(0)
+    result =_dsl.dsl_ode_trigger_window_timestamp_get(name, DSL_UINT_P(timestamp))
+    return int(result), timestamp.value
+
+##
+## dsl_ode_trigger_window_timestamp_set()
+##
+_dsl.dsl_ode_trigger_window_timestamp_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_window_timestamp_set.restype = c_uint
+def dsl_ode_trigger_window_timestamp_set(name, timestamp):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_window_timestamp_set(name, timestamp)
+    return int(result)
+
+##
+## dsl_ode_trigger_line_crossing_line_add()
+##
+_dsl.dsl_ode_trigger_line_crossing_line_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_line_crossing_line_add.restype = c_uint
+def dsl_ode_trigger_line_crossing_line_add(name, line):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_line_crossing_line_add(name, line)
+    return int(result)
+
+##
+## dsl_ode_trigger_line_crossing_line_remove()
+##
+_dsl.dsl_ode_trigger_line_crossing_line_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_line_crossing_line_remove.restype = c_uint
+def dsl_ode_trigger_line_crossing_line_remove(name, line):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_line_crossing_line_remove(name, line)
+    return int(result)
+
+##
+## dsl_ode_trigger_line_crossing_counts_get()
+##
+_dsl.dsl_ode_trigger_line_crossing_counts_get.argtypes = [c_wchar_p, c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_ode_trigger_line_crossing_counts_get.restype = c_uint
+def dsl_ode_trigger_line_crossing_counts_get(name, line):
+    global _dsl
+    left_to_right = c_uint64(0)
+    right_to_left = c_uint64(0)
+    result =_dsl.dsl_ode_trigger_line_crossing_counts_get(name, line, 
+        DSL_UINT64_P(left_to_right), DSL_UINT64_P(right_to_left))
+    return int(result), left_to_right.value, right_to_left.value
+
+##
+## dsl_ode_trigger_line_crossing_counts_reset()
+##
+_dsl.dsl_ode_trigger_line_crossing_counts_reset.argtypes = [c_wchar_p]
+_dsl.dsl_ode_trigger_line_crossing_counts_reset.restype = c_uint
+def dsl_ode_trigger_line_crossing_counts_reset(name):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_line_crossing_counts_reset(name)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_action_add()
 ##
@@ -820,6 +1313,27 @@ def dsl_ode_handler_new(name):
     result =_dsl.dsl_ode_handler_new(name)
     return int(result)
 
+##
+## dsl_ode_handler_worker_count_get()
+##
+_dsl.dsl_ode_handler_worker_count_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_handler_worker_count_get.restype = c_uint
+def dsl_ode_handler_worker_count_get(name):
+    global _dsl
+    count = c_uint(0)
+    result =_dsl.dsl_ode_handler_worker_count_get(name, DSL_UINT_P(count))
+    return int(result), count.value
+
+##
+## dsl_ode_handler_worker_count_set()
+##
+_dsl.dsl_ode_handler_worker_count_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_handler_worker_count_set.restype = c_uint
+def dsl_ode_handler_worker_count_set(name, count):
+    global _dsl
+    result =_dsl.dsl_ode_handler_worker_count_set(name, count)
+    return int(result)
+
 ##
 ## dsl_ode_handler_trigger_add()
 ##
@@ -882,6 +1396,37 @@ def dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, dro
     result = _dsl.dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, drop_frame_interval)
     return int(result)
 
+##
+## dsl_source_replay_new()
+##
+_dsl.dsl_source_replay_new.argtypes = [c_wchar_p, c_wchar_p, c_bool]
+_dsl.dsl_source_replay_new.restype = c_uint
+def dsl_source_replay_new(name, file_path, real_time):
+    global _dsl
+    result = _dsl.dsl_source_replay_new(name, file_path, real_time)
+    return int(result)
+
+##
+## dsl_source_replay_scenario_new()
+##
+_dsl.dsl_source_replay_scenario_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint64, c_bool]
+_dsl.dsl_source_replay_scenario_new.restype = c_uint
+def dsl_source_replay_scenario_new(name, source_count, objects_per_frame, class_count, batch_count, real_time):
+    global _dsl
+    result = _dsl.dsl_source_replay_scenario_new(name, source_count, objects_per_frame, class_count, batch_count, real_time)
+    return int(result)
+
+##
+## dsl_source_replay_batches_get()
+##
+_dsl.dsl_source_replay_batches_get.argtypes = [c_wchar_p, DSL_UINT64_P]
+_dsl.dsl_source_replay_batches_get.restype = c_uint
+def dsl_source_replay_batches_get(name):
+    global _dsl
+    batches = c_uint64(0)
+    result = _dsl.dsl_source_replay_batches_get(name, DSL_UINT64_P(batches))
+    return int(result), batches.value
+
 ##
 ## dsl_source_dimensions_get()
 ##
@@ -1036,6 +1581,28 @@ def dsl_gie_primary_kitti_output_enabled_set(name, enabled, path):
     result = _dsl.dsl_gie_primary_kitti_output_enabled_set(name, enabled, path)
     return int(result)
 
+##
+## dsl_gie_primary_kitti_output_mode_get()
+##
+_dsl.dsl_gie_primary_kitti_output_mode_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_gie_primary_kitti_output_mode_get.restype = c_uint
+def dsl_gie_primary_kitti_output_mode_get(name):
+    global _dsl
+    mode = c_uint(0)
+    max_file_size = c_uint(0)
+    result = _dsl.dsl_gie_primary_kitti_output_mode_get(name, DSL_UINT_P(mode), DSL_UINT_P(max_file_size))
+    return int(result), mode.value, max_file_size.value
+
+##
+## dsl_gie_primary_kitti_output_mode_set()
+##
+_dsl.dsl_gie_primary_kitti_output_mode_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_gie_primary_kitti_output_mode_set.restype = c_uint
+def dsl_gie_primary_kitti_output_mode_set(name, mode, max_file_size):
+    global _dsl
+    result = _dsl.dsl_gie_primary_kitti_output_mode_set(name, mode, max_file_size)
+    return int(result)
+
 ##
 ## dsl_gie_secondary_new()
 ##
@@ -1172,6 +1739,91 @@ def dsl_tracker_kitti_output_enabled_set(name, enabled, path):
     result = _dsl.dsl_tracker_kitti_output_enabled_set(name, enabled, path)
     return int(result)
 
+##
+## dsl_tracker_kitti_output_mode_get()
+##
+_dsl.dsl_tracker_kitti_output_mode_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_tracker_kitti_output_mode_get.restype = c_uint
+def dsl_tracker_kitti_output_mode_get(name):
+    global _dsl
+    mode = c_uint(0)
+    max_file_size = c_uint(0)
+    result = _dsl.dsl_tracker_kitti_output_mode_get(name, DSL_UINT_P(mode), DSL_UINT_P(max_file_size))
+    return int(result), mode.value, max_file_size.value
+
+##
+## dsl_tracker_kitti_output_mode_set()
+##
+_dsl.dsl_tracker_kitti_output_mode_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_tracker_kitti_output_mode_set.restype = c_uint
+def dsl_tracker_kitti_output_mode_set(name, mode, max_file_size):
+    global _dsl
+    result = _dsl.dsl_tracker_kitti_output_mode_set(name, mode, max_file_size)
+    return int(result)
+
+##
+## dsl_meta_recorder_new()
+##
+_dsl.dsl_meta_recorder_new.argtypes = [c_wchar_p, c_wchar_p, c_uint]
+_dsl.dsl_meta_recorder_new.restype = c_uint
+def dsl_meta_recorder_new(name, file_path, max_size_mb):
+    global _dsl
+    result =_dsl.dsl_meta_recorder_new(name, file_path, max_size_mb)
+    return int(result)
+
+##
+## dsl_meta_recorder_metrics_get()
+##
+_dsl.dsl_meta_recorder_metrics_get.argtypes = [c_wchar_p, DSL_UINT64_P, DSL_UINT64_P]
+_dsl.dsl_meta_recorder_metrics_get.restype = c_uint
+def dsl_meta_recorder_metrics_get(name):
+    global _dsl
+    recorded = c_uint64(0)
+    dropped = c_uint64(0)
+    result =_dsl.dsl_meta_recorder_metrics_get(name, DSL_UINT64_P(recorded), DSL_UINT64_P(dropped))
+    return int(result), recorded.value, dropped.value
+
+##
+## dsl_meta_recording_open()
+##
+_dsl.dsl_meta_recording_open.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_meta_recording_open.restype = c_uint
+def dsl_meta_recording_open(name, file_path):
+    global _dsl
+    result =_dsl.dsl_meta_recording_open(name, file_path)
+    return int(result)
+
+##
+## dsl_meta_recording_frame_next()
+##
+_dsl.dsl_meta_recording_frame_next.argtypes = [c_wchar_p, POINTER(dsl_meta_recording_frame)]
+_dsl.dsl_meta_recording_frame_next.restype = c_uint
+def dsl_meta_recording_frame_next(name):
+    global _dsl
+    frame = dsl_meta_recording_frame()
+    result =_dsl.dsl_meta_recording_frame_next(name, pointer(frame))
+    return int(result), frame
+
+##
+## dsl_meta_recording_close()
+##
+_dsl.dsl_meta_recording_close.argtypes = [c_wchar_p]
+_dsl.dsl_meta_recording_close.restype = c_uint
+def dsl_meta_recording_close(name):
+    global _dsl
+    result =_dsl.dsl_meta_recording_close(name)
+    return int(result)
+
+##
+## dsl_meta_recording_close_all()
+##
+_dsl.dsl_meta_recording_close_all.argtypes = []
+_dsl.dsl_meta_recording_close_all.restype = c_uint
+def dsl_meta_recording_close_all():
+    global _dsl
+    result =_dsl.dsl_meta_recording_close_all()
+    return int(result)
+
 ##
 ## dsl_osd_new()
 ##
@@ -1716,6 +2368,33 @@ def dsl_sink_image_object_capture_class_remove(name, class_id):
     result = _dsl.dsl_sink_image_object_capture_class_remove(name, class_id)
     return int(result)
 
+##
+## dsl_sink_image_capture_metrics_get()
+##
+_dsl.dsl_sink_image_capture_metrics_get.argtypes = [POINTER(c_uint), 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_sink_image_capture_metrics_get.restype = c_uint
+def dsl_sink_image_capture_metrics_get():
+    global _dsl
+    queue_depth = c_uint(0)
+    encoded = c_uint64(0)
+    dropped = c_uint64(0)
+    average_latency = c_uint64(0)
+    max_latency = c_uint64(0)
+    result = _dsl.dsl_sink_image_capture_metrics_get(DSL_UINT_P(queue_depth), 
+        pointer(encoded), pointer(dropped), pointer(average_latency), pointer(max_latency))
+    return int(result), queue_depth.value, encoded.value, dropped.value, \
+        average_latency.value, max_latency.value
+
+##
+## dsl_sink_image_capture_metrics_reset()
+##
+_dsl.dsl_sink_image_capture_metrics_reset.restype = c_uint
+def dsl_sink_image_capture_metrics_reset():
+    global _dsl
+    result = _dsl.dsl_sink_image_capture_metrics_reset()
+    return int(result)
+
 ##
 ## dsl_sink_num_in_use_get()
 ##
@@ -2295,6 +2974,76 @@ def dsl_pipeline_xwindow_delete_event_handler_remove(name, handler):
     result = _dsl.dsl_pipeline_xwindow_delete_event_handler_remove(name, client_handler)
     return int(result)
 
+##
+## dsl_pipeline_latency_tracing_enabled_get()
+##
+_dsl.dsl_pipeline_latency_tracing_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_latency_tracing_enabled_get.restype = c_uint
+def dsl_pipeline_latency_tracing_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_latency_tracing_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pipeline_latency_tracing_enabled_set()
+##
+_dsl.dsl_pipeline_latency_tracing_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_latency_tracing_enabled_set.restype = c_uint
+def dsl_pipeline_latency_tracing_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_tracing_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_latency_stats_get()
+## component = None for the Pipeline's end-to-end stats
+##
+_dsl.dsl_pipeline_latency_stats_get.argtypes = [c_wchar_p, c_wchar_p, POINTER(dsl_latency_stats)]
+_dsl.dsl_pipeline_latency_stats_get.restype = c_uint
+def dsl_pipeline_latency_stats_get(name, component):
+    global _dsl
+    stats = dsl_latency_stats()
+    result = _dsl.dsl_pipeline_latency_stats_get(name, component, pointer(stats))
+    return int(result), stats
+
+##
+## dsl_pipeline_latency_stats_reset()
+##
+_dsl.dsl_pipeline_latency_stats_reset.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_latency_stats_reset.restype = c_uint
+def dsl_pipeline_latency_stats_reset(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_stats_reset(name)
+    return int(result)
+
+##
+## dsl_pipeline_latency_stats_handler_add()
+## The handler is called with a list of dsl_latency_stats copied from the 
+## array, end-to-end first with a component of None.
+##
+_dsl.dsl_pipeline_latency_stats_handler_add.argtypes = [c_wchar_p, DSL_LATENCY_STATS_HANDLER, c_uint, c_void_p]
+_dsl.dsl_pipeline_latency_stats_handler_add.restype = c_uint
+def dsl_pipeline_latency_stats_handler_add(name, handler, interval, user_data):
+    global _dsl
+    def stats_handler(stats, count, user_data):
+        handler([stats[i] for i in range(count)], user_data)
+    client_handler = DSL_LATENCY_STATS_HANDLER(stats_handler)
+    callbacks.append(client_handler)
+    result = _dsl.dsl_pipeline_latency_stats_handler_add(name, client_handler, interval, user_data)
+    return int(result)
+
+##
+## dsl_pipeline_latency_stats_handler_remove()
+##
+_dsl.dsl_pipeline_latency_stats_handler_remove.argtypes = [c_wchar_p, DSL_LATENCY_STATS_HANDLER]
+_dsl.dsl_pipeline_latency_stats_handler_remove.restype = c_uint
+def dsl_pipeline_latency_stats_handler_remove(name, handler):
+    global _dsl
+    client_handler = DSL_LATENCY_STATS_HANDLER(handler)
+    result = _dsl.dsl_pipeline_latency_stats_handler_remove(name, client_handler)
+    return int(result)
+
 ##
 ## dsl_main_loop_run()
 ##
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #define _DSL_H
 
 #include <cstdlib>
+#include <cmath>
 
 #include <gst/gst.h>
 #include <gst/video/videooverlay.h>
@@ -34,6 +35,7 @@ THE SOFTWARE.
 #include <X11/Xutil.h>
 
 #include <queue>
+#include <deque>
 #include <iostream> 
 #include <sstream>
 #include <vector>
@@ -41,10 +43,12 @@ THE SOFTWARE.
 #include <memory> 
 #include <fstream>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
 #include <algorithm>
+#include <utility>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -37,6 +37,26 @@ DslReturnType dsl_ode_action_callback_new(const wchar_t* name,
     return DSL::Services::GetServices()->OdeActionCallbackNew(cstrName.c_str(), client_hanlder, client_data);
 }
 
+DslReturnType dsl_ode_action_callback_batch_new(const wchar_t* name, 
+    dsl_ode_handle_occurrences_cb client_handler, void* client_data)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionCallbackBatchNew(cstrName.c_str(), 
+        client_handler, client_data);
+}
+
+DslReturnType dsl_ode_action_callback_batch_trigger_name_get(const wchar_t* name, 
+    uint trigger_index, const wchar_t** trigger)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionCallbackBatchTriggerNameGet(cstrName.c_str(), 
+        trigger_index, trigger);
+}
+
 DslReturnType dsl_ode_action_capture_frame_new(const wchar_t* name, const wchar_t* outdir)
 {
     std::wstring wstrName(name);
@@ -118,6 +138,18 @@ DslReturnType dsl_ode_action_fill_object_new(const wchar_t* name,
         red, green, blue, alpha);
 }
 
+DslReturnType dsl_ode_action_journal_new(const wchar_t* name, 
+    const wchar_t* file_path, uint max_size_mb, uint max_files)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->OdeActionJournalNew(cstrName.c_str(), 
+        cstrFilePath.c_str(), max_size_mb, max_files);
+}
+
 DslReturnType dsl_ode_action_log_new(const wchar_t* name)
 {
     std::wstring wstrName(name);
@@ -308,6 +340,50 @@ DslReturnType dsl_ode_action_enabled_set(const wchar_t* name, boolean enabled)
     return DSL::Services::GetServices()->OdeActionEnabledSet(cstrName.c_str(), enabled);
 }
 
+DslReturnType dsl_ode_action_async_get(const wchar_t* name, 
+    boolean* enabled, uint* overflow_policy)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncGet(cstrName.c_str(), 
+        enabled, overflow_policy);
+}
+
+DslReturnType dsl_ode_action_async_set(const wchar_t* name, 
+    boolean enabled, uint overflow_policy)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncSet(cstrName.c_str(), 
+        enabled, overflow_policy);
+}
+
+DslReturnType dsl_ode_action_async_dropped_get(const wchar_t* name, uint64_t* dropped)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncDroppedGet(cstrName.c_str(), dropped);
+}
+
+DslReturnType dsl_ode_action_metrics_get(const wchar_t* name, dsl_ode_action_metrics* metrics)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionMetricsGet(cstrName.c_str(), metrics);
+}
+
+DslReturnType dsl_ode_action_metrics_reset(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionMetricsReset(cstrName.c_str());
+}
+
 DslReturnType dsl_ode_action_delete(const wchar_t* name)
 {
     std::wstring wstrName(name);
@@ -342,6 +418,35 @@ uint dsl_ode_action_list_size()
     return DSL::Services::GetServices()->OdeActionListSize();
 }
 
+DslReturnType dsl_ode_journal_scan(const wchar_t* file_path, const wchar_t* trigger,
+    uint source_id, uint64_t start_time, uint64_t end_time, 
+    dsl_ode_handle_occurrences_cb client_handler, void* client_data, uint64_t* count)
+{
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+    std::wstring wstrTrigger((trigger) ? trigger : L"");
+    std::string cstrTrigger(wstrTrigger.begin(), wstrTrigger.end());
+
+    return DSL::Services::GetServices()->OdeJournalScan(cstrFilePath.c_str(), 
+        (trigger) ? cstrTrigger.c_str() : NULL, source_id, start_time, end_time, 
+        client_handler, client_data, count);
+}
+
+DslReturnType dsl_ode_journal_csv_write(const wchar_t* file_path, const wchar_t* csv_file_path,
+    const wchar_t* trigger, uint source_id, uint64_t start_time, uint64_t end_time, uint64_t* count)
+{
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+    std::wstring wstrCsvFilePath(csv_file_path);
+    std::string cstrCsvFilePath(wstrCsvFilePath.begin(), wstrCsvFilePath.end());
+    std::wstring wstrTrigger((trigger) ? trigger : L"");
+    std::string cstrTrigger(wstrTrigger.begin(), wstrTrigger.end());
+
+    return DSL::Services::GetServices()->OdeJournalCsvWrite(cstrFilePath.c_str(), 
+        cstrCsvFilePath.c_str(), (trigger) ? cstrTrigger.c_str() : NULL, 
+        source_id, start_time, end_time, count);
+}
+
 DslReturnType dsl_ode_area_new(const wchar_t* name, 
     uint left, uint top, uint width, uint height, boolean display)
 {
@@ -426,6 +531,74 @@ uint dsl_ode_area_list_size()
     return DSL::Services::GetServices()->OdeAreaListSize();
 }
 
+DslReturnType dsl_ode_line_new(const wchar_t* name, 
+    uint x1, uint y1, uint x2, uint y2, boolean display)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineNew(cstrName.c_str(), 
+        x1, y1, x2, y2, display);
+}
+
+DslReturnType dsl_ode_line_get(const wchar_t* name, 
+    uint* x1, uint* y1, uint* x2, uint* y2, boolean* display)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineGet(cstrName.c_str(), 
+        x1, y1, x2, y2, display);
+}
+    
+DslReturnType dsl_ode_line_set(const wchar_t* name, 
+    uint x1, uint y1, uint x2, uint y2, boolean display)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineSet(cstrName.c_str(), 
+        x1, y1, x2, y2, display);
+}
+
+DslReturnType dsl_ode_line_color_get(const wchar_t* name, 
+    double* red, double* green, double* blue, double* alpha)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineColorGet(cstrName.c_str(), 
+        red, green, blue, alpha);
+}
+
+DslReturnType dsl_ode_line_color_set(const wchar_t* name, 
+    double red, double green, double blue, double alpha)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineColorSet(cstrName.c_str(), 
+        red, green, blue, alpha);
+}
+
+DslReturnType dsl_ode_line_delete(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeLineDelete(cstrName.c_str());
+}
+
+DslReturnType dsl_ode_line_delete_all()
+{
+    return DSL::Services::GetServices()->OdeLineDeleteAll();
+}
+
+uint dsl_ode_line_list_size()
+{
+    return DSL::Services::GetServices()->OdeLineListSize();
+}
+
 DslReturnType dsl_ode_trigger_occurrence_new(const wchar_t* name, uint class_id, uint limit)
 {
     std::wstring wstrName(name);
@@ -498,6 +671,56 @@ DslReturnType dsl_ode_trigger_range_new(const wchar_t* name,
         class_id, limit, lower, upper);
 }
 
+DslReturnType dsl_ode_trigger_window_new(const wchar_t* name, uint class_id, uint limit, 
+    uint aggregate, uint crossing, float threshold, uint window, uint bucket)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerWindowNew(cstrName.c_str(), 
+        class_id, limit, aggregate, crossing, threshold, window, bucket);
+}
+
+DslReturnType dsl_ode_trigger_new_track_new(const wchar_t* name, 
+    uint class_id, uint limit, uint lost_frames)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerNewTrackNew(cstrName.c_str(), 
+        class_id, limit, lost_frames);
+}
+
+DslReturnType dsl_ode_trigger_lost_track_new(const wchar_t* name, 
+    uint class_id, uint limit, uint lost_frames)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLostTrackNew(cstrName.c_str(), 
+        class_id, limit, lost_frames);
+}
+
+DslReturnType dsl_ode_trigger_dwell_new(const wchar_t* name, uint class_id, uint limit, 
+    uint min_dwell_time, uint lost_frames)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDwellNew(cstrName.c_str(), 
+        class_id, limit, min_dwell_time, lost_frames);
+}
+
+DslReturnType dsl_ode_trigger_line_crossing_new(const wchar_t* name, uint class_id, uint limit, 
+    uint direction, uint reference_point, uint lost_frames)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLineCrossingNew(cstrName.c_str(), 
+        class_id, limit, direction, reference_point, lost_frames);
+}
+
 DslReturnType dsl_ode_trigger_reset(const wchar_t* name)
 {
     std::wstring wstrName(name);
@@ -506,6 +729,22 @@ DslReturnType dsl_ode_trigger_reset(const wchar_t* name)
     return DSL::Services::GetServices()->OdeTriggerReset(cstrName.c_str());
 }
 
+DslReturnType dsl_ode_trigger_metrics_get(const wchar_t* name, dsl_ode_trigger_metrics* metrics)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerMetricsGet(cstrName.c_str(), metrics);
+}
+
+DslReturnType dsl_ode_trigger_metrics_reset(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerMetricsReset(cstrName.c_str());
+}
+
 DslReturnType dsl_ode_trigger_enabled_get(const wchar_t* name, boolean* enabled)
 {
     std::wstring wstrName(name);
@@ -634,6 +873,64 @@ DslReturnType dsl_ode_trigger_frame_count_min_set(const wchar_t* name, uint min_
     return DSL::Services::GetServices()->OdeTriggerFrameCountMinSet(cstrName.c_str(), min_count_n, min_count_d);
 }
 
+DslReturnType dsl_ode_trigger_window_timestamp_get(const wchar_t* name, uint* timestamp)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerWindowTimestampGet(cstrName.c_str(), timestamp);
+}
+
+DslReturnType dsl_ode_trigger_window_timestamp_set(const wchar_t* name, uint timestamp)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerWindowTimestampSet(cstrName.c_str(), timestamp);
+}
+
+DslReturnType dsl_ode_trigger_line_crossing_line_add(const wchar_t* name, const wchar_t* line)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrLine(line);
+    std::string cstrLine(wstrLine.begin(), wstrLine.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLineCrossingLineAdd(cstrName.c_str(), 
+        cstrLine.c_str());
+}
+
+DslReturnType dsl_ode_trigger_line_crossing_line_remove(const wchar_t* name, const wchar_t* line)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrLine(line);
+    std::string cstrLine(wstrLine.begin(), wstrLine.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLineCrossingLineRemove(cstrName.c_str(), 
+        cstrLine.c_str());
+}
+
+DslReturnType dsl_ode_trigger_line_crossing_counts_get(const wchar_t* name, 
+    const wchar_t* line, uint64_t* left_to_right, uint64_t* right_to_left)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrLine(line);
+    std::string cstrLine(wstrLine.begin(), wstrLine.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLineCrossingCountsGet(cstrName.c_str(), 
+        cstrLine.c_str(), left_to_right, right_to_left);
+}
+
+DslReturnType dsl_ode_trigger_line_crossing_counts_reset(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerLineCrossingCountsReset(cstrName.c_str());
+}
+
 DslReturnType dsl_ode_trigger_action_add(const wchar_t* name, const wchar_t* action)
 {
     std::wstring wstrName(name);
@@ -847,6 +1144,36 @@ DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri,
         protocol, cudadec_mem_type, intra_decode, dropFrameInterval);
 }
 
+DslReturnType dsl_source_replay_new(const wchar_t* name, 
+    const wchar_t* file_path, boolean real_time)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->SourceReplayNew(cstrName.c_str(), 
+        cstrFilePath.c_str(), real_time);
+}
+
+DslReturnType dsl_source_replay_scenario_new(const wchar_t* name, uint source_count,
+    uint objects_per_frame, uint class_count, uint64_t batch_count, boolean real_time)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceReplayScenarioNew(cstrName.c_str(), 
+        source_count, objects_per_frame, class_count, batch_count, real_time);
+}
+
+DslReturnType dsl_source_replay_batches_get(const wchar_t* name, uint64_t* batches)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceReplayBatchesGet(cstrName.c_str(), batches);
+}
+
 DslReturnType dsl_source_dimensions_get(const wchar_t* name, uint* width, uint* height)
 {
     std::wstring wstrName(name);
@@ -983,6 +1310,26 @@ DslReturnType dsl_gie_primary_kitti_output_enabled_set(const wchar_t* name, bool
     return DSL::Services::GetServices()->PrimaryGieKittiOutputEnabledSet(cstrName.c_str(), enabled, cstrFile.c_str());
 }
 
+DslReturnType dsl_gie_primary_kitti_output_mode_get(const wchar_t* name, 
+    uint* mode, uint* max_file_size)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PrimaryGieKittiOutputModeGet(cstrName.c_str(), 
+        mode, max_file_size);
+}
+
+DslReturnType dsl_gie_primary_kitti_output_mode_set(const wchar_t* name, 
+    uint mode, uint max_file_size)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PrimaryGieKittiOutputModeSet(cstrName.c_str(), 
+        mode, max_file_size);
+}
+
 DslReturnType dsl_gie_primary_batch_meta_handler_add(const wchar_t* name, uint pad, 
     dsl_batch_meta_handler_cb handler, void* user_data)
 {
@@ -1163,6 +1510,26 @@ DslReturnType dsl_tracker_kitti_output_enabled_set(const wchar_t* name, boolean
 
     return DSL::Services::GetServices()->TrackerKittiOutputEnabledSet(cstrName.c_str(), enabled, cstrFile.c_str());
 }
+
+DslReturnType dsl_tracker_kitti_output_mode_get(const wchar_t* name, 
+    uint* mode, uint* max_file_size)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TrackerKittiOutputModeGet(cstrName.c_str(), 
+        mode, max_file_size);
+}
+
+DslReturnType dsl_tracker_kitti_output_mode_set(const wchar_t* name, 
+    uint mode, uint max_file_size)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TrackerKittiOutputModeSet(cstrName.c_str(), 
+        mode, max_file_size);
+}
     
 DslReturnType dsl_ode_handler_new(const wchar_t* name)
 {
@@ -1188,6 +1555,22 @@ DslReturnType dsl_ode_handler_enabled_set(const wchar_t* name, boolean enabled)
     return DSL::Services::GetServices()->OdeHandlerEnabledSet(cstrName.c_str(), enabled);
 }
 
+DslReturnType dsl_ode_handler_worker_count_get(const wchar_t* name, uint* count)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHandlerWorkerCountGet(cstrName.c_str(), count);
+}
+
+DslReturnType dsl_ode_handler_worker_count_set(const wchar_t* name, uint count)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHandlerWorkerCountSet(cstrName.c_str(), count);
+}
+
 DslReturnType dsl_ode_handler_trigger_add(const wchar_t* handler, const wchar_t* trigger)
 {
     std::wstring wstrOdeHandler(handler);
@@ -1253,6 +1636,61 @@ DslReturnType dsl_ode_handler_trigger_remove_all(const wchar_t* handler)
     return DSL::Services::GetServices()->OdeHandlerTriggerRemoveAll(cstrOdeHandler.c_str());
 }
 
+DslReturnType dsl_meta_recorder_new(const wchar_t* name, 
+    const wchar_t* file_path, uint max_size_mb)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->MetaRecorderNew(cstrName.c_str(), 
+        cstrFilePath.c_str(), max_size_mb);
+}
+
+DslReturnType dsl_meta_recorder_metrics_get(const wchar_t* name, 
+    uint64_t* recorded, uint64_t* dropped)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->MetaRecorderMetricsGet(cstrName.c_str(), 
+        recorded, dropped);
+}
+
+DslReturnType dsl_meta_recording_open(const wchar_t* name, const wchar_t* file_path)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->MetaRecordingOpen(cstrName.c_str(), 
+        cstrFilePath.c_str());
+}
+
+DslReturnType dsl_meta_recording_frame_next(const wchar_t* name, 
+    dsl_meta_recording_frame* frame)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->MetaRecordingFrameNext(cstrName.c_str(), frame);
+}
+
+DslReturnType dsl_meta_recording_close(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->MetaRecordingClose(cstrName.c_str());
+}
+
+DslReturnType dsl_meta_recording_close_all()
+{
+    return DSL::Services::GetServices()->MetaRecordingCloseAll();
+}
+
 DslReturnType dsl_ofv_new(const wchar_t* name)
 {
     std::wstring wstrName(name);
@@ -1812,6 +2250,18 @@ DslReturnType dsl_sink_image_object_capture_class_remove(const wchar_t* name, ui
 
     return DSL::Services::GetServices()->SinkImageObjectCaptureClassRemove(cstrName.c_str(), classId);
 }
+
+DslReturnType dsl_sink_image_capture_metrics_get(uint* queue_depth, uint64_t* encoded, 
+    uint64_t* dropped, uint64_t* average_latency, uint64_t* max_latency)
+{
+    return DSL::Services::GetServices()->SinkImageCaptureMetricsGet(queue_depth, 
+        encoded, dropped, average_latency, max_latency);
+}
+
+DslReturnType dsl_sink_image_capture_metrics_reset()
+{
+    return DSL::Services::GetServices()->SinkImageCaptureMetricsReset();
+}
     
 uint dsl_sink_num_in_use_get()
 {
@@ -2387,13 +2837,87 @@ DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pi
         PipelineXWindowDeleteEventHandlerRemove(cstrPipeline.c_str(), handler);
 }
 
+DslReturnType dsl_pipeline_latency_tracing_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineLatencyTracingEnabledGet(cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_latency_tracing_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineLatencyTracingEnabledSet(cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_latency_stats_get(const wchar_t* pipeline, 
+    const wchar_t* component, dsl_latency_stats* stats)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    // NULL component for end-to-end, traced as the unnamed stage
+    std::string cstrComponent;
+    if (component)
+    {
+        std::wstring wstrComponent(component);
+        cstrComponent.assign(wstrComponent.begin(), wstrComponent.end());
+    }
+    DslReturnType retval = DSL::Services::GetServices()->
+        PipelineLatencyStatsGet(cstrPipeline.c_str(), cstrComponent.c_str(), stats);
+    stats->component = component;
+    
+    return retval;
+}
+
+DslReturnType dsl_pipeline_latency_stats_reset(const wchar_t* pipeline)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineLatencyStatsReset(cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_latency_stats_handler_add(const wchar_t* pipeline, 
+    dsl_latency_stats_handler_cb handler, uint interval, void* client_data)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineLatencyStatsHandlerAdd(cstrPipeline.c_str(), handler, interval, client_data);
+}    
+
+DslReturnType dsl_pipeline_latency_stats_handler_remove(const wchar_t* pipeline, 
+    dsl_latency_stats_handler_cb handler)    
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineLatencyStatsHandlerRemove(cstrPipeline.c_str(), handler);
+}
+
 void dsl_delete_all()
 {
     dsl_pipeline_delete_all();
     dsl_component_delete_all();
     dsl_ode_trigger_delete_all();
     dsl_ode_area_delete_all();
+    dsl_ode_line_delete_all();
     dsl_ode_action_delete_all();
+    
+    // Nothing left to submit images, so the Capture Service can be stopped 
+    // while the CUDA runtime is still up.
+    DSL::Services::GetServices()->SinkImageCaptureServiceShutdown();
 }
 
 
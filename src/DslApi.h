@@ -70,6 +70,8 @@ THE SOFTWARE.
 #define DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED                       0x0002000B
 #define DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED                    0x0002000C
 #define DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE                   0x0002000D
+#define DSL_RESULT_SOURCE_RECORDING_INVALID                        0x0002000E
+#define DSL_RESULT_SOURCE_SCENARIO_INVALID                         0x0002000F
 
 /**
  * Dewarper API Return Values
@@ -219,6 +221,8 @@ THE SOFTWARE.
 #define DSL_RESULT_PIPELINE_FAILED_TO_STOP                          0x00080011
 #define DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED               0x00080012
 #define DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED                 0x00080013
+#define DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED                0x00080014
+#define DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND                 0x00080015
 
 #define DSL_RESULT_BRANCH_RESULT                                    0x000B0000
 #define DSL_RESULT_BRANCH_NAME_NOT_UNIQUE                           0x000B0001
@@ -262,6 +266,11 @@ THE SOFTWARE.
 #define DSL_RESULT_ODE_TRIGGER_AREA_REMOVE_FAILED                   0x000E000B
 #define DSL_RESULT_ODE_TRIGGER_AREA_NOT_IN_USE                      0x000E000C
 #define DSL_RESULT_ODE_TRIGGER_CLIENT_CALLBACK_INVALID              0x000E000D
+#define DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE                 0x000E000E
+#define DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID                    0x000E000F
+#define DSL_RESULT_ODE_TRIGGER_LINE_ADD_FAILED                      0x000E0010
+#define DSL_RESULT_ODE_TRIGGER_LINE_REMOVE_FAILED                   0x000E0011
+#define DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE                      0x000E0012
 
 /**
  * ODE Action API Return Values
@@ -276,6 +285,7 @@ THE SOFTWARE.
 #define DSL_RESULT_ODE_ACTION_IS_NOT_ACTION                         0x000F0007
 #define DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND                   0x000F0008
 #define DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE                  0x000F0009
+#define DSL_RESULT_ODE_ACTION_PARAMETER_INVALID                     0x000F000A
 
 /**
  * ODE Area API Return Values
@@ -287,6 +297,30 @@ THE SOFTWARE.
 #define DSL_RESULT_ODE_AREA_IN_USE                                  0x00100004
 #define DSL_RESULT_ODE_AREA_SET_FAILED                              0x00100005
 
+/**
+ * ODE Line API Return Values
+ */
+#define DSL_RESULT_ODE_LINE_RESULT                                  0x00110000
+#define DSL_RESULT_ODE_LINE_NAME_NOT_UNIQUE                         0x00110001
+#define DSL_RESULT_ODE_LINE_NAME_NOT_FOUND                          0x00110002
+#define DSL_RESULT_ODE_LINE_THREW_EXCEPTION                         0x00110003
+#define DSL_RESULT_ODE_LINE_IN_USE                                  0x00110004
+#define DSL_RESULT_ODE_LINE_SET_FAILED                              0x00110005
+
+/**
+ * Meta Recorder API Return Values
+ */
+#define DSL_RESULT_META_RECORDER_RESULT                             0x00120000
+#define DSL_RESULT_META_RECORDER_NAME_NOT_UNIQUE                    0x00120001
+#define DSL_RESULT_META_RECORDER_NAME_NOT_FOUND                     0x00120002
+#define DSL_RESULT_META_RECORDER_THREW_EXCEPTION                    0x00120003
+#define DSL_RESULT_META_RECORDER_COMPONENT_IS_NOT_META_RECORDER     0x00120004
+#define DSL_RESULT_META_RECORDER_FILE_PATH_INVALID                  0x00120005
+#define DSL_RESULT_META_RECORDING_NAME_NOT_UNIQUE                   0x00120006
+#define DSL_RESULT_META_RECORDING_NAME_NOT_FOUND                    0x00120007
+#define DSL_RESULT_META_RECORDING_FILE_INVALID                      0x00120008
+#define DSL_RESULT_META_RECORDING_END                               0x00120009
+
 /**
  *
  */
@@ -314,12 +348,43 @@ THE SOFTWARE.
 #define DSL_PAD_SINK                                                0
 #define DSL_PAD_SRC                                                 1
 
+#define DSL_KITTI_OUTPUT_MODE_FRAME_FILES                           0
+#define DSL_KITTI_OUTPUT_MODE_SOURCE_FILES                          1
+
 #define DSL_RTP_TCP                                                 0x04
 #define DSL_RTP_ALL                                                 0x07
 
 #define DSL_CAPTURE_TYPE_OBJECT                                     0
 #define DSL_CAPTURE_TYPE_FRAME                                      1
 
+#define DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST                         0
+#define DSL_ODE_ACTION_OVERFLOW_DROP_OLDEST                         1
+#define DSL_ODE_ACTION_OVERFLOW_BLOCK                               2
+
+#define DSL_ODE_METRICS_HISTOGRAM_BUCKETS                           16
+
+#define DSL_ODE_WINDOW_AGGREGATE_SUM                                0
+#define DSL_ODE_WINDOW_AGGREGATE_AVERAGE                            1
+#define DSL_ODE_WINDOW_AGGREGATE_MIN                                2
+#define DSL_ODE_WINDOW_AGGREGATE_MAX                                3
+
+#define DSL_ODE_WINDOW_CROSSING_ABOVE                               0
+#define DSL_ODE_WINDOW_CROSSING_BELOW                               1
+
+#define DSL_ODE_WINDOW_TIMESTAMP_PTS                                0
+#define DSL_ODE_WINDOW_TIMESTAMP_NTP                                1
+
+#define DSL_ODE_WINDOW_BUCKETS_MAX                                  4096
+
+#define DSL_ODE_LINE_DIRECTION_ANY                                  0
+#define DSL_ODE_LINE_DIRECTION_LEFT_TO_RIGHT                        1
+#define DSL_ODE_LINE_DIRECTION_RIGHT_TO_LEFT                        2
+
+#define DSL_ODE_LINE_POINT_BOTTOM_CENTER                            0
+#define DSL_ODE_LINE_POINT_CENTER                                   1
+
+#define DSL_META_RECORDING_MAX_LABEL_SIZE                           128
+
 #define DSL_ODE_ANY_SOURCE                                          INT32_MAX
 #define DSL_ODE_ANY_CLASS                                           INT32_MAX
 
@@ -353,6 +418,322 @@ typedef uint boolean;
 typedef void (*dsl_ode_handle_occurrence_cb)(uint64_t event_id, const wchar_t* trigger,
     void* buffer, void* frame_meta, void* object_meta, void* client_data);
 
+/**
+ * @brief Fixed-layout record for a single ODE occurrence, as delivered to a
+ * client batch handler. The layout is 64 bytes with no implicit padding.
+ */
+typedef struct _dsl_ode_occurrence_record
+{
+    /**
+     * @brief unique ODE occurrence ID, numerically ordered by occurrence
+     */
+    uint64_t event_id;
+    
+    /**
+     * @brief NTP timestamp of the frame that triggered the occurrence
+     */
+    uint64_t ntp_timestamp;
+    
+    /**
+     * @brief tracking id of the Object, or UINT64_MAX if untracked or frame level
+     */
+    uint64_t object_id;
+    
+    /**
+     * @brief index of the Trigger, see dsl_ode_action_callback_batch_trigger_name_get
+     */
+    uint trigger_index;
+    
+    /**
+     * @brief source id of the frame that triggered the occurrence
+     */
+    uint source_id;
+    
+    /**
+     * @brief frame number of the frame that triggered the occurrence
+     */
+    uint frame_num;
+    
+    /**
+     * @brief class id of the Object, or -1 for frame level occurrences
+     */
+    int class_id;
+    
+    /**
+     * @brief inference confidence of the Object, 0 for frame level occurrences
+     */
+    float confidence;
+    
+    /**
+     * @brief bounding box of the Object, all 0 for frame level occurrences
+     */
+    float left;
+    float top;
+    float width;
+    float height;
+    
+    /**
+     * @brief true if the occurrence was triggered by an Object, false if frame level
+     */
+    uint is_object;
+} dsl_ode_occurrence_record;
+
+/**
+ * @brief callback typedef for a client batched ODE occurrence handler function. Once 
+ * registered, the function will be called once for each batch with one or more occurrences
+ * @param[in] records pointer to a contiguous array of occurrence records, valid
+ * for the duration of the callback only
+ * @param[in] count number of records in the array
+ * @param[in] client_data opaque pointer to client's user data
+ */
+typedef void (*dsl_ode_handle_occurrences_cb)(const dsl_ode_occurrence_record* records,
+    uint count, void* client_data);
+
+/**
+ * @brief Performance counters for a single ODE Trigger, accumulated since the 
+ * Trigger was created or its metrics were last reset.
+ */
+typedef struct _dsl_ode_trigger_metrics
+{
+    /**
+     * @brief number of batches processed by the Trigger's parent ODE Handler
+     */
+    uint64_t batches;
+    
+    /**
+     * @brief number of Objects evaluated against the Trigger's minimum criteria
+     */
+    uint64_t objects_evaluated;
+    
+    /**
+     * @brief number of Objects that passed all of the Trigger's criteria
+     */
+    uint64_t objects_passed;
+    
+    /**
+     * @brief number of ODE occurrences triggered
+     */
+    uint64_t occurrences;
+    
+    /**
+     * @brief total time spent evaluating the Trigger on the streaming thread,
+     * including the time spent in its synchronous ODE Actions, in nanoseconds.
+     */
+    uint64_t evaluation_time_ns;
+    
+    /**
+     * @brief histogram of the per-batch evaluation time. Bucket 0 counts batches
+     * under 1 microsecond, bucket n counts batches from 2^(n-1) up to 2^n 
+     * microseconds, and the last bucket counts all longer batches.
+     */
+    uint64_t evaluation_time_histogram[DSL_ODE_METRICS_HISTOGRAM_BUCKETS];
+} dsl_ode_trigger_metrics;
+
+/**
+ * @brief Performance counters for a single ODE Action, accumulated since the 
+ * Action was created or its metrics were last reset.
+ */
+typedef struct _dsl_ode_action_metrics
+{
+    /**
+     * @brief number of ODE occurrences handled by the Action
+     */
+    uint64_t invocations;
+    
+    /**
+     * @brief total time spent handling occurrences, in nanoseconds, on the 
+     * streaming thread if synchronous or on the shared executor if asynchronous.
+     */
+    uint64_t execution_time_ns;
+    
+    /**
+     * @brief longest time spent handling a single occurrence, in nanoseconds
+     */
+    uint64_t max_execution_time_ns;
+    
+    /**
+     * @brief number of occurrences dropped by the asynchronous overflow policy
+     */
+    uint64_t async_dropped;
+} dsl_ode_action_metrics;
+
+/**
+ * @brief Latency statistics for a single traced Pipeline component, or for the 
+ * Pipeline end-to-end, accumulated since the Pipeline was last played or its 
+ * latency stats were last reset. Percentiles are accurate to within 1/16th.
+ */
+typedef struct _dsl_latency_stats
+{
+    /**
+     * @brief unique name of the traced component, NULL for end-to-end
+     */
+    const wchar_t* component;
+    
+    /**
+     * @brief number of frames measured
+     */
+    uint64_t count;
+    
+    /**
+     * @brief number of frame timestamps dropped while the tracer was behind
+     */
+    uint64_t dropped;
+    
+    /**
+     * @brief median latency in nanoseconds
+     */
+    uint64_t p50_ns;
+    
+    /**
+     * @brief 90th percentile latency in nanoseconds
+     */
+    uint64_t p90_ns;
+    
+    /**
+     * @brief 99th percentile latency in nanoseconds
+     */
+    uint64_t p99_ns;
+    
+    /**
+     * @brief largest latency measured in nanoseconds
+     */
+    uint64_t max_ns;
+} dsl_latency_stats;
+
+/**
+ * @brief A single classifier label of a recorded Object, as read from a recording
+ * written by a Meta Recorder.
+ */
+typedef struct _dsl_meta_recording_label
+{
+    /**
+     * @brief unique id of the classifier that added the label
+     */
+    int unique_component_id;
+    
+    /**
+     * @brief class id of the classifier's result
+     */
+    uint result_class_id;
+    
+    /**
+     * @brief id of the label within the classifier's output
+     */
+    uint label_id;
+    
+    /**
+     * @brief probability of the classifier's result
+     */
+    float result_prob;
+    
+    /**
+     * @brief text of the classifier's result, null terminated and truncated if needed
+     */
+    char result_label[DSL_META_RECORDING_MAX_LABEL_SIZE];
+} dsl_meta_recording_label;
+
+/**
+ * @brief A single recorded Object, as read from a recording written by a Meta Recorder.
+ */
+typedef struct _dsl_meta_recording_object
+{
+    /**
+     * @brief tracking id of the Object, or UINT64_MAX if untracked
+     */
+    uint64_t object_id;
+    
+    /**
+     * @brief class id of the Object
+     */
+    int class_id;
+    
+    /**
+     * @brief unique id of the inference component that detected the Object
+     */
+    int unique_component_id;
+    
+    /**
+     * @brief inference and tracker confidence of the Object
+     */
+    float confidence;
+    float tracker_confidence;
+    
+    /**
+     * @brief bounding box of the Object
+     */
+    float left;
+    float top;
+    float width;
+    float height;
+    
+    /**
+     * @brief label of the Object, null terminated and truncated if needed
+     */
+    char label[DSL_META_RECORDING_MAX_LABEL_SIZE];
+    
+    /**
+     * @brief number of classifier labels in labels
+     */
+    uint label_count;
+    
+    /**
+     * @brief classifier labels of the Object, in classifier order
+     */
+    const dsl_meta_recording_label* labels;
+} dsl_meta_recording_object;
+
+/**
+ * @brief A single recorded Frame, as read from a recording written by a Meta Recorder.
+ * The Objects and labels are owned by the recording, and are valid until the next call 
+ * to dsl_meta_recording_frame_next or dsl_meta_recording_close for the recording.
+ */
+typedef struct _dsl_meta_recording_frame
+{
+    /**
+     * @brief source id and batch id of the Frame
+     */
+    uint source_id;
+    uint batch_id;
+    
+    /**
+     * @brief frame number of the Frame within its source
+     */
+    int frame_num;
+    
+    /**
+     * @brief presentation and NTP timestamps of the Frame
+     */
+    uint64_t buf_pts;
+    uint64_t ntp_timestamp;
+    
+    /**
+     * @brief dimensions of the source's frames
+     */
+    uint source_frame_width;
+    uint source_frame_height;
+    
+    /**
+     * @brief number of display metas attached to the Frame, 
+     * and the total number of each type of display element they hold
+     */
+    uint display_meta_count;
+    uint display_rect_count;
+    uint display_label_count;
+    uint display_line_count;
+    uint display_arrow_count;
+    uint display_circle_count;
+    
+    /**
+     * @brief number of Objects in objects
+     */
+    uint object_count;
+    
+    /**
+     * @brief Objects of the Frame, in the Frame's object meta order
+     */
+    const dsl_meta_recording_object* objects;
+} dsl_meta_recording_frame;
+
 /**
  * @brief callback typedef for a client ODE Custom Trigger check-for-occurrence function. Once 
  * registered, the function will be called on every object detected that meets the minimum
@@ -408,6 +789,18 @@ typedef void (*dsl_xwindow_key_event_handler_cb)(const wchar_t* key, void* user_
  */
 typedef void (*dsl_xwindow_button_event_handler_cb)(uint xpos, uint ypos, void* user_data);
 
+/**
+ * @brief callback typedef for a client latency stats handler function. Once added to a 
+ * Pipeline with latency tracing enabled, the function will be called at the interval 
+ * given while the Pipeline has traced components.
+ * @param[in] stats pointer to a contiguous array of stats, end-to-end first followed by
+ * each traced component in stream order, valid for the duration of the callback only
+ * @param[in] count number of stats in the array
+ * @param[in] client_data opaque pointer to client's user data
+ */
+typedef void (*dsl_latency_stats_handler_cb)(const dsl_latency_stats* stats, 
+    uint count, void* client_data);
+
 /**
  * @brief callback typedef for a client XWindow Delete Message event handler function. Once added to a Pipeline, 
  * the function will be called when the Pipeline receives XWindow Delete Message event.
@@ -425,6 +818,27 @@ typedef void (*dsl_xwindow_delete_event_handler_cb)(void* user_data);
 DslReturnType dsl_ode_action_callback_new(const wchar_t* name, 
     dsl_ode_handle_occurrence_cb client_handler, void* client_data);
 
+/**
+ * @brief Creates a uniquely named ODE Batch Callback Action. Occurrences are accumulated 
+ * for each batch and the client handler is called once per batch with all records.
+ * @param[in] name unique name for the ODE Batch Callback Action 
+ * @param[in] client_handler function to call once per batch with ODE occurrences
+ * @param[in] client_data opaue pointer to client's user data, returned on callback
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_callback_batch_new(const wchar_t* name, 
+    dsl_ode_handle_occurrences_cb client_handler, void* client_data);
+
+/**
+ * @brief Gets the name of the ODE Trigger for a trigger_index reported by an ODE Batch Callback Action 
+ * @param[in] name unique name of the ODE Batch Callback Action to query
+ * @param[in] trigger_index trigger_index reported in a dsl_ode_occurrence_record
+ * @param[out] trigger name of the ODE Trigger, valid for the life of the Action
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_callback_batch_trigger_name_get(const wchar_t* name, 
+    uint trigger_index, const wchar_t** trigger);
+
 /**
  * @brief Creates a uniquely named Capture Frame ODE Action
  * @param[in] name unique name for the Capture Frame ODE Action 
@@ -511,6 +925,20 @@ DslReturnType dsl_ode_action_handler_disable_new(const wchar_t* name, const wcha
  */
 DslReturnType dsl_ode_action_hide_new(const wchar_t* name, boolean text, boolean border);
 
+/**
+ * @brief Creates a uniquely named Journal ODE Action. Each occurrence is appended as a
+ * fixed-size binary dsl_ode_occurrence_record to a memory-mapped, preallocated journal file.
+ * When full, the journal is rotated to a new file named <file_path>.<n>, n = 1, 2, ...
+ * @param[in] name unique name for the Journal ODE Action 
+ * @param[in] file_path path of the first journal file to create, existing files are overwritten
+ * @param[in] max_size_mb maximum size of each journal file in megabytes
+ * @param[in] max_files maximum number of journal files to keep, the oldest file is 
+ * deleted on rotation when exceeded. 0 for no limit, otherwise 2 or more.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_journal_new(const wchar_t* name, 
+    const wchar_t* file_path, uint max_size_mb, uint max_files);
+
 /**
  * @brief Creates a uniquely named Log ODE Action
  * @param[in] name unique name for the Log ODE Action 
@@ -668,6 +1096,58 @@ DslReturnType dsl_ode_action_enabled_get(const wchar_t* name, boolean* enabled);
  */
 DslReturnType dsl_ode_action_enabled_set(const wchar_t* name, boolean enabled);
 
+/**
+ * @brief Gets the current asynchronous execution settings for the ODE Action
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] enabled true if the ODE Action is executed asynchronously, false otherwise
+ * @param[out] overflow_policy one of the DSL_ODE_ACTION_OVERFLOW constants
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_get(const wchar_t* name, 
+    boolean* enabled, uint* overflow_policy);
+
+/**
+ * @brief Sets the asynchronous execution settings for the ODE Action. When enabled,
+ * each occurrence is copied into a preallocated event record and the Action is 
+ * executed on a shared worker thread, off of the streaming thread. Asynchronous
+ * Actions receive copies of the Frame and Object meta, with all list pointers 
+ * cleared, and a NULL buffer. Capture, Display, Fill, Hide and Redact Actions 
+ * must run synchronously and will fail with DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE.
+ * @param[in] name unique name of the ODE Action to update
+ * @param[in] enabled set to true to execute the Action asynchronously
+ * @param[in] overflow_policy one of the DSL_ODE_ACTION_OVERFLOW constants, the 
+ * policy to apply when an occurrence arrives and the Action's queue is full.
+ * DSL_ODE_ACTION_OVERFLOW_BLOCK blocks the streaming thread for at most one second,
+ * after which the occurrence is dropped.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_set(const wchar_t* name, 
+    boolean enabled, uint overflow_policy);
+
+/**
+ * @brief Gets the number of occurrences dropped by the ODE Action's overflow policy
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] dropped total number of dropped occurrences
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_dropped_get(const wchar_t* name, uint64_t* dropped);
+
+/**
+ * @brief Gets the performance counters for a named ODE Action
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] metrics counters accumulated since the Action was created or last reset
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_metrics_get(const wchar_t* name, dsl_ode_action_metrics* metrics);
+
+/**
+ * @brief Resets the performance counters for a named ODE Action to zero, 
+ * including the count returned by dsl_ode_action_async_dropped_get
+ * @param[in] name unique name of the ODE Action to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_metrics_reset(const wchar_t* name);
+
 /**
  * @brief Deletes an ODE Action of any type
  * This service will fail with DSL_RESULT_ODE_ACTION_IN_USE if the Action is currently
@@ -700,6 +1180,38 @@ DslReturnType dsl_ode_action_delete_all();
  */
 uint dsl_ode_action_list_size();
 
+/**
+ * @brief Scans a journal file written by a Journal ODE Action for all records that 
+ * match the filter criteria. The matching records are returned to the client in one 
+ * or more calls to the client handler.
+ * @param[in] file_path path of the journal file to scan
+ * @param[in] trigger unique name of the ODE Trigger to match, NULL for any Trigger
+ * @param[in] source_id source id to match, DSL_ODE_ANY_SOURCE for any source
+ * @param[in] start_time minimum NTP timestamp to match
+ * @param[in] end_time maximum NTP timestamp to match
+ * @param[in] client_handler function to call with the matching records, may be NULL
+ * @param[in] client_data opaque pointer to client's user data, returned on callback
+ * @param[out] count total number of matching records
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_journal_scan(const wchar_t* file_path, const wchar_t* trigger,
+    uint source_id, uint64_t start_time, uint64_t end_time, 
+    dsl_ode_handle_occurrences_cb client_handler, void* client_data, uint64_t* count);
+
+/**
+ * @brief Converts the records in a journal file that match the filter criteria to CSV
+ * @param[in] file_path path of the journal file to convert
+ * @param[in] csv_file_path path of the CSV file to create
+ * @param[in] trigger unique name of the ODE Trigger to match, NULL for any Trigger
+ * @param[in] source_id source id to match, DSL_ODE_ANY_SOURCE for any source
+ * @param[in] start_time minimum NTP timestamp to match
+ * @param[in] end_time maximum NTP timestamp to match
+ * @param[out] count total number of records written
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_journal_csv_write(const wchar_t* file_path, const wchar_t* csv_file_path,
+    const wchar_t* trigger, uint source_id, uint64_t start_time, uint64_t end_time, uint64_t* count);
+
 /**
  * @brief Creates a uniquely named ODE Area
  * @param[in] name unique name of the ODE area to create
@@ -792,6 +1304,92 @@ DslReturnType dsl_ode_area_delete_all();
  */
 uint dsl_ode_area_list_size();
 
+/**
+ * @brief Creates a uniquely named ODE Line, a line segment for Line Crossing Triggers
+ * @param[in] name unique name of the ODE Line to create
+ * @param[in] x1 x coordinate of the line's start point in pixels
+ * @param[in] y1 y coordinate of the line's start point in pixels
+ * @param[in] x2 x coordinate of the line's end point in pixels
+ * @param[in] y2 y coordinate of the line's end point in pixels
+ * @param[in] display if true, the line is displayed by each Trigger using it
+ * @return DSL_RESULT_SUCCESS on successful create, DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_new(const wchar_t* name, 
+    uint x1, uint y1, uint x2, uint y2, boolean display);
+
+/**
+ * @brief Gets the current line segment for the named ODE Line.
+ * @param[in] name unique name of the ODE Line to query
+ * @param[out] x1 x coordinate of the line's start point in pixels
+ * @param[out] y1 y coordinate of the line's start point in pixels
+ * @param[out] x2 x coordinate of the line's end point in pixels
+ * @param[out] y2 y coordinate of the line's end point in pixels
+ * @param[out] display true if the line is displayed
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_get(const wchar_t* name, 
+    uint* x1, uint* y1, uint* x2, uint* y2, boolean* display);
+
+/**
+ * @brief Sets the current line segment for the named ODE Line.
+ * @param[in] name unique name of the ODE Line to update
+ * @param[in] x1 x coordinate of the line's start point in pixels
+ * @param[in] y1 y coordinate of the line's start point in pixels
+ * @param[in] x2 x coordinate of the line's end point in pixels
+ * @param[in] y2 y coordinate of the line's end point in pixels
+ * @param[in] display if true, the line is displayed by each Trigger using it
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_set(const wchar_t* name, 
+    uint x1, uint y1, uint x2, uint y2, boolean display);
+
+/**
+ * @brief Gets the current line color values
+ * @param[in] name unique name of the ODE Line to query
+ * @param[out] red red level for the line color [0..1]
+ * @param[out] blue blue level for the line color [0..1]
+ * @param[out] green green level for the line color [0..1]
+ * @param[out] alpha alpha level for the line color [0..1]
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_color_get(const wchar_t* name, 
+    double* red, double* green, double* blue, double* alpha);
+
+/**
+ * @brief Sets the current line color values
+ * @param[in] name unique name of the ODE Line to update
+ * @param[in] red red level for the line color [0..1]
+ * @param[in] blue blue level for the line color [0..1]
+ * @param[in] green green level for the line color [0..1]
+ * @param[in] alpha alpha level for the line color [0..1]
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_color_set(const wchar_t* name, 
+    double red, double green, double blue, double alpha);
+
+/**
+ * @brief Deletes an ODE Line
+ * This service will fail with DSL_RESULT_ODE_LINE_IN_USE if the Line is currently
+ * owned by a ODE Trigger.
+ * @param[in] name unique name of the ODE Line to delete
+ * @return DSL_RESULT_SUCCESS on success, on of DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_delete(const wchar_t* name);
+
+/**
+ * @brief Deletes all ODE Lines
+ * This service will fail with DSL_RESULT_ODE_LINE_IN_USE if any of the Lines 
+ * are currently owned by a ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, on of DSL_RESULT_ODE_LINE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_line_delete_all();
+
+/**
+ * @brief Returns the size of the list of ODE Lines
+ * @return the number of ODE Lines in the list
+ */
+uint dsl_ode_line_list_size();
+
 /**
  * @brief Occurence trigger that checks for the occurrence of Objects within a frame for a 
  * @param[in] name unique name for the ODE Trigger
@@ -884,6 +1482,82 @@ DslReturnType dsl_ode_trigger_maximum_new(const wchar_t* name,
 DslReturnType dsl_ode_trigger_range_new(const wchar_t* name, 
     uint class_id, uint limit, uint lower, uint upper);
 
+/**
+ * @brief Window trigger that keeps the per-frame count of Objects, for each source, over a 
+ * sliding time window, and generates an ODE occurence each time a windowed aggregate of 
+ * the counts crosses a threshold. Frames are grouped into fixed interval buckets by timestamp, 
+ * and the window spans the most recent ceil(window / bucket) buckets. 
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] aggregate one of the DSL_ODE_WINDOW_AGGREGATE constants
+ * @param[in] crossing one of the DSL_ODE_WINDOW_CROSSING constants
+ * @param[in] threshold the threshold for the windowed aggregate
+ * @param[in] window duration of the window in milliseconds
+ * @param[in] bucket duration of each bucket in milliseconds, at most 
+ * DSL_ODE_WINDOW_BUCKETS_MAX buckets per window.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_window_new(const wchar_t* name, uint class_id, uint limit, 
+    uint aggregate, uint crossing, float threshold, uint window, uint bucket);
+
+/**
+ * @brief New Track trigger that generates an ODE occurrence on the first frame a tracked 
+ * Object meets the trigger's criteria. The Object is tracked, by Object Id, until it has 
+ * not met the criteria for lost_frames consecutive frames. Requires a Tracker, 
+ * untracked Objects are ignored.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] lost_frames number of frames an Object can go unseen before it is lost, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_new_track_new(const wchar_t* name, 
+    uint class_id, uint limit, uint lost_frames);
+
+/**
+ * @brief Lost Track trigger that generates an ODE occurrence, with no Object, each time a 
+ * tracked Object has not met the trigger's criteria for lost_frames consecutive frames.
+ * Requires a Tracker.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] lost_frames number of frames an Object can go unseen before it is lost, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_lost_track_new(const wchar_t* name, 
+    uint class_id, uint limit, uint lost_frames);
+
+/**
+ * @brief Dwell trigger that generates an ODE occurrence, once per tracked Object, on the 
+ * first frame the Object has met the trigger's criteria for at least min_dwell_time, 
+ * measured from the frame timestamps. Requires a Tracker.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] min_dwell_time minimum dwell time in milliseconds
+ * @param[in] lost_frames number of frames an Object can go unseen before it is lost, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dwell_new(const wchar_t* name, uint class_id, uint limit, 
+    uint min_dwell_time, uint lost_frames);
+
+/**
+ * @brief Line Crossing trigger that follows the reference point of each tracked Object, 
+ * and generates an ODE occurrence each time the point crosses one of the trigger's ODE 
+ * Lines in the trigger's direction. Crossings in both directions are counted for each 
+ * Line. Requires a Tracker.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] direction one of the DSL_ODE_LINE_DIRECTION constants
+ * @param[in] reference_point one of the DSL_ODE_LINE_POINT constants
+ * @param[in] lost_frames number of frames an Object can go unseen before it is lost, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_line_crossing_new(const wchar_t* name, uint class_id, uint limit, 
+    uint direction, uint reference_point, uint lost_frames);
+
 /**
  * @brief Resets the a named ODE Trigger, setting it's triggered count to 0
  * This affects Triggers with fixed limits, whether they have reached their limit or not.
@@ -892,6 +1566,22 @@ DslReturnType dsl_ode_trigger_range_new(const wchar_t* name,
  */
 DslReturnType dsl_ode_trigger_reset(const wchar_t* name);
 
+/**
+ * @brief Gets the performance counters for a named ODE Trigger
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] metrics counters accumulated since the Trigger was created or last reset
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_metrics_get(const wchar_t* name, dsl_ode_trigger_metrics* metrics);
+
+/**
+ * @brief Resets the performance counters for a named ODE Trigger to zero.
+ * The Trigger's triggered count and limit are unaffected, see dsl_ode_trigger_reset
+ * @param[in] name unique name of the ODE Trigger to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_metrics_reset(const wchar_t* name);
+
 /**
  * @brief Gets the current enabled setting for the ODE Trigger
  * @param[in] name unique name of the ODE Trigger to query
@@ -1027,7 +1717,9 @@ DslReturnType dsl_ode_trigger_frame_count_min_get(const wchar_t* name, uint* min
 
 /**
  * @brief Sets the current min frame count (detected in last N out of D frames) for the ODE Trigger
- * A value of 0 = no minimum
+ * A value of 0 = no minimum. Objects are followed by their tracked Object Id, per source,
+ * and a Tracker is required. Untracked Objects are not filtered by the minimum.
+ * D can be no larger than 64.
  * @param[in] name unique name of the ODE Trigger to query
  * @param[out] min_count_n sets the current minimun frame count numerator to use
  * @param[out] min_count_d sets the current minimun frame count denomintor to use
@@ -1035,6 +1727,59 @@ DslReturnType dsl_ode_trigger_frame_count_min_get(const wchar_t* name, uint* min
  */
 DslReturnType dsl_ode_trigger_frame_count_min_set(const wchar_t* name, uint min_count_n, uint min_count_d);
 
+/**
+ * @brief Gets the timestamp used to assign frames to buckets by a Window ODE Trigger
+ * @param[in] name unique name of the Window ODE Trigger to query
+ * @param[out] timestamp one of the DSL_ODE_WINDOW_TIMESTAMP constants
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_window_timestamp_get(const wchar_t* name, uint* timestamp);
+
+/**
+ * @brief Sets the timestamp used to assign frames to buckets by a Window ODE Trigger.
+ * The windows for all sources are cleared on change. 
+ * @param[in] name unique name of the Window ODE Trigger to update
+ * @param[in] timestamp one of the DSL_ODE_WINDOW_TIMESTAMP constants. 
+ * DSL_ODE_WINDOW_TIMESTAMP_NTP requires the Streammux to attach NTP timestamps.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_window_timestamp_set(const wchar_t* name, uint timestamp);
+
+/**
+ * @brief Adds a named ODE Line to a named Line Crossing Trigger
+ * @param[in] name unique name of the Line Crossing Trigger to update
+ * @param[in] line unique name of the ODE Line to add
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_line_crossing_line_add(const wchar_t* name, const wchar_t* line);
+
+/**
+ * @brief Removes a named ODE Line from a named Line Crossing Trigger
+ * @param[in] name unique name of the Line Crossing Trigger to update
+ * @param[in] line unique name of the ODE Line to remove
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_line_crossing_line_remove(const wchar_t* name, const wchar_t* line);
+
+/**
+ * @brief Gets the number of crossings, in each direction, of one of a Line Crossing 
+ * Trigger's Lines, since the Line was added or the counts were last reset.
+ * @param[in] name unique name of the Line Crossing Trigger to query
+ * @param[in] line unique name of the ODE Line to query
+ * @param[out] left_to_right number of crossings from the Line's left side to its right
+ * @param[out] right_to_left number of crossings from the Line's right side to its left
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_line_crossing_counts_get(const wchar_t* name, 
+    const wchar_t* line, uint64_t* left_to_right, uint64_t* right_to_left);
+
+/**
+ * @brief Resets the crossing counts for all of a Line Crossing Trigger's Lines
+ * @param[in] name unique name of the Line Crossing Trigger to update
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_line_crossing_counts_reset(const wchar_t* name);
+
 /**
  * @brief Adds a named ODE Action to a named ODE Trigger
  * @param[in] name unique name of the ODE Trigger to update
@@ -1187,6 +1932,47 @@ DslReturnType dsl_source_uri_new(const wchar_t* name, const wchar_t* uri, boolea
 DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri, uint protocol,
     uint cudadec_mem_type, uint intra_decode, uint drop_frame_interval);
 
+/**
+ * @brief creates a new, uniquely named Replay Source component that replays a 
+ * recording written by a Meta Recorder. Each recorded batch is pushed as a zero sized
+ * buffer with its batch meta rebuilt, bypassing the Pipeline's Stream Muxer, so the
+ * ODE Handler and Sinks can be run without a GPU. A Replay Source must be the only
+ * Source in its Pipeline, and can only be followed by components that use the batch 
+ * meta alone, e.g. the ODE Handler, Meta Recorder and Fake Sink.
+ * @param[in] name unique name for the new Source
+ * @param[in] file_path path of the first file of the recording
+ * @param[in] real_time if true, batches are pushed in real time according to their
+ * recorded timestamps, otherwise as fast as possible
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_replay_new(const wchar_t* name, 
+    const wchar_t* file_path, boolean real_time);
+
+/**
+ * @brief creates a new, uniquely named Replay Source component that replays a 
+ * synthetic scenario of tracked Objects moving across each 1920x1080 frame at 30 fps.
+ * The same parameters always replay the same batches. See dsl_source_replay_new.
+ * @param[in] name unique name for the new Source
+ * @param[in] source_count number of sources, i.e. frames in each batch, at least 1
+ * @param[in] objects_per_frame number of Objects in each frame
+ * @param[in] class_count number of Class Ids, evenly spread over the Objects
+ * @param[in] batch_count number of batches to replay, 0 for no end
+ * @param[in] real_time if true, batches are pushed in real time at 30 fps,
+ * otherwise as fast as possible
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_replay_scenario_new(const wchar_t* name, uint source_count,
+    uint objects_per_frame, uint class_count, uint64_t batch_count, boolean real_time);
+
+/**
+ * @brief gets the number of batches pushed by a Replay Source since its Pipeline
+ * was last linked, e.g. to compute batches per second once the Pipeline is stopped.
+ * @param[in] name unique name of the Replay Source to query
+ * @param[out] batches number of batches pushed
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_replay_batches_get(const wchar_t* name, uint64_t* batches);
+
 /**
  * @brief returns the frame rate of the name source as a fraction
  * Camera sources will return the value used on source creation
@@ -1336,6 +2122,29 @@ DslReturnType dsl_gie_primary_batch_meta_handler_remove(const wchar_t* name,
  */
 DslReturnType dsl_gie_primary_kitti_output_enabled_set(const wchar_t* name, boolean enabled, const wchar_t* file);
 
+/**
+ * @brief Gets the current kitti output mode and maximum file size for the named GIE
+ * @param[in] name name of the Primary GIE to query
+ * @param[out] mode one of the DSL_KITTI_OUTPUT_MODE constants
+ * @param[out] max_file_size maximum size of each per-source file in bytes, 0 = no rotation
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_kitti_output_mode_get(const wchar_t* name, 
+    uint* mode, uint* max_file_size);
+
+/**
+ * @brief Sets the kitti output mode and maximum file size for the named GIE. If kitti
+ * output is currently enabled, the existing per-source files are appended to with the
+ * new settings.
+ * @param[in] name name of the Primary GIE to update
+ * @param[in] mode one of the DSL_KITTI_OUTPUT_MODE constants. One file per frame, the
+ * default, or one file per source rotated once it reaches max_file_size.
+ * @param[in] max_file_size maximum size of each per-source file in bytes, 0 = no rotation
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_kitti_output_mode_set(const wchar_t* name, 
+    uint mode, uint max_file_size);
+
 /**
  * @brief creates a new, uniquely named Secondary GIE object
  * @param[in] name unique name for the new GIE object
@@ -1488,6 +2297,29 @@ DslReturnType dsl_tracker_iou_config_file_set(const wchar_t* name, const wchar_t
  */
 DslReturnType dsl_tracker_kitti_output_enabled_set(const wchar_t* name, boolean enabled, const wchar_t* file);
 
+/**
+ * @brief Gets the current kitti output mode and maximum file size for the named Tracker
+ * @param[in] name name of the Tracker to query
+ * @param[out] mode one of the DSL_KITTI_OUTPUT_MODE constants
+ * @param[out] max_file_size maximum size of each per-source file in bytes, 0 = no rotation
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRACKER_RESULT otherwise.
+ */
+DslReturnType dsl_tracker_kitti_output_mode_get(const wchar_t* name, 
+    uint* mode, uint* max_file_size);
+
+/**
+ * @brief Sets the kitti output mode and maximum file size for the named Tracker. If kitti
+ * output is currently enabled, the existing per-source files are appended to with the
+ * new settings.
+ * @param[in] name name of the Tracker to update
+ * @param[in] mode one of the DSL_KITTI_OUTPUT_MODE constants. One file per frame, the
+ * default, or one file per source rotated once it reaches max_file_size.
+ * @param[in] max_file_size maximum size of each per-source file in bytes, 0 = no rotation
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRACKER_RESULT otherwise.
+ */
+DslReturnType dsl_tracker_kitti_output_mode_set(const wchar_t* name, 
+    uint mode, uint max_file_size);
+
 /**
  * @brief creates a new, uniquely named Optical Flow Visualizer (OFV) obj
  * @param[in] name unique name for the new OFV
@@ -1520,6 +2352,23 @@ DslReturnType dsl_ode_handler_enabled_get(const wchar_t* name, boolean* enabled)
  */
 DslReturnType dsl_ode_handler_enabled_set(const wchar_t* name, boolean enabled);
 
+/**
+ * @brief Gets the number of workers the ODE Handler uses to evaluate the frames of each batch
+ * @param[in] name unique name of the ODE Handler to query
+ * @param[out] count current worker count, including the streaming thread. Default = 1
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_HANDLER_RESULT otherwise
+ */
+DslReturnType dsl_ode_handler_worker_count_get(const wchar_t* name, uint* count);
+
+/**
+ * @brief Sets the number of workers the ODE Handler uses to evaluate the frames of each batch.
+ * Frames are evaluated concurrently, with all Triggers and Actions then invoked in batch order.
+ * @param[in] name unique name of the ODE Handler to update
+ * @param[in] count new worker count, including the streaming thread, in the range [1, 64]
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_HANDLER_RESULT otherwise
+ */
+DslReturnType dsl_ode_handler_worker_count_set(const wchar_t* name, uint count);
+
 /**
  * @brief Adds a named ODE Trigger to a named ODE Handler Component
  * @param[in] handler unique name of the ODE Handler to update
@@ -1559,6 +2408,61 @@ DslReturnType dsl_ode_handler_trigger_remove_many(const wchar_t* handler, const
  */
 DslReturnType dsl_ode_handler_trigger_remove_all(const wchar_t* handler);
 
+/**
+ * @brief Creates a new, uniquely named Meta Recorder component. The Recorder writes the
+ * frame, object, classifier and display meta counts of each batch to a compact binary 
+ * recording. When full, the recording is continued in a new file named <file_path>.<n>
+ * @param[in] name unique name for the new Meta Recorder
+ * @param[in] file_path path of the first recording file, existing files are overwritten
+ * @param[in] max_size_mb maximum size of each recording file in megabytes, 0 for no limit
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recorder_new(const wchar_t* name, 
+    const wchar_t* file_path, uint max_size_mb);
+
+/**
+ * @brief Gets the current metrics for a named Meta Recorder
+ * @param[in] name unique name of the Meta Recorder to query
+ * @param[out] recorded number of frames written to the recording
+ * @param[out] dropped number of frames dropped because the writer fell behind, 
+ * or because a file could not be written
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recorder_metrics_get(const wchar_t* name, 
+    uint64_t* recorded, uint64_t* dropped);
+
+/**
+ * @brief Opens a recording written by a Meta Recorder, for reading. The Frames of the 
+ * recording are read in order, continuing through all files of a rotated recording.
+ * @param[in] name unique name for the open recording
+ * @param[in] file_path path of the first file of the recording
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recording_open(const wchar_t* name, const wchar_t* file_path);
+
+/**
+ * @brief Reads the next Frame from an open recording
+ * @param[in] name unique name of the open recording to read
+ * @param[out] frame the next Frame in the recording
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDING_END once all 
+ * Frames have been read, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recording_frame_next(const wchar_t* name, 
+    dsl_meta_recording_frame* frame);
+
+/**
+ * @brief Closes an open recording
+ * @param[in] name unique name of the open recording to close
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recording_close(const wchar_t* name);
+
+/**
+ * @brief Closes all open recordings
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_META_RECORDER_RESULT otherwise
+ */
+DslReturnType dsl_meta_recording_close_all();
+
 /**
  * @brief creates a new, uniquely named OSD obj
  * @param[in] name unique name for the new OSD
@@ -2063,6 +2967,27 @@ DslReturnType dsl_sink_image_object_capture_class_add(const wchar_t* name, uint
  */
 DslReturnType dsl_sink_image_object_capture_class_remove(const wchar_t* name, uint class_id);
 
+/**
+ * @brief Gets the metrics for the capture service shared by all Image Sinks 
+ * and Capture ODE Actions. Images are encoded and written to file by the
+ * service's worker threads, off of the streaming threads.
+ * @param[out] queue_depth number of images waiting to be, or being, encoded
+ * @param[out] encoded total number of images encoded and written to file
+ * @param[out] dropped total number of captures dropped because the queue was
+ * full, or that failed to transform, encode or write
+ * @param[out] average_latency average time to encode and write in microseconds
+ * @param[out] max_latency maximum time to encode and write in microseconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_image_capture_metrics_get(uint* queue_depth, uint64_t* encoded, 
+    uint64_t* dropped, uint64_t* average_latency, uint64_t* max_latency);
+
+/**
+ * @brief Resets the encoded, dropped and latency metrics for the shared capture service
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_image_capture_metrics_reset();
+
 /**
  * @brief returns the number of Sinks currently in use by 
  * all Pipelines in memory. 
@@ -2524,6 +3449,68 @@ DslReturnType dsl_pipeline_xwindow_delete_event_handler_add(const wchar_t* pipel
 DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pipeline, 
     dsl_xwindow_delete_event_handler_cb handler);
 
+/**
+ * @brief gets the current latency tracing enabled setting for the named Pipeline
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if latency tracing is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_tracing_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled);
+
+/**
+ * @brief sets the latency tracing enabled setting for the named Pipeline. When enabled,
+ * buffer probes are installed on the sink and source pads of each linked component 
+ * while the Pipeline is playing. When disabled, no probes are installed and all
+ * stats and latency stats handlers are removed.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to enable latency tracing, false to disable
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_tracing_enabled_set(const wchar_t* pipeline, 
+    boolean enabled);
+
+/**
+ * @brief gets the latency stats for a single traced component of the named Pipeline,
+ * or for the Pipeline end-to-end, measured since the Pipeline was last played.
+ * Stats remain available after the Pipeline is stopped.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[in] component name of the component to query, NULL for end-to-end
+ * @param[out] stats latency stats for the component, with stats.component set
+ * to the component parameter
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_stats_get(const wchar_t* pipeline, 
+    const wchar_t* component, dsl_latency_stats* stats);
+
+/**
+ * @brief resets the latency stats for all traced components of the named Pipeline
+ * @param[in] pipeline name of the pipeline to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_stats_reset(const wchar_t* pipeline);
+
+/**
+ * @brief adds a callback to be called periodically, from the main loop, with the 
+ * latency stats for all traced components of the named Pipeline.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] handler pointer to the client's function to call with the stats
+ * @param[in] interval reporting interval in milliseconds
+ * @param[in] client_data opaque pointer to client data passed into the handler function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_stats_handler_add(const wchar_t* pipeline, 
+    dsl_latency_stats_handler_cb handler, uint interval, void* client_data);
+
+/**
+ * @brief removes a callback previously added with dsl_pipeline_latency_stats_handler_add
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] handler pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_latency_stats_handler_remove(const wchar_t* pipeline, 
+    dsl_latency_stats_handler_cb handler);
+
 /**
  * @brief entry point to the GST Main Loop
  * Note: This is a blocking call - executes an endless loop
@@ -2557,7 +3544,8 @@ const wchar_t* dsl_state_value_to_string(uint state);
 const wchar_t* dsl_version_get();
 
 /**
- * @brief Releases/deletes all DSL/GST resources
+ * @brief Releases/deletes all DSL/GST resources, and stops the shared Capture Service
+ * once all images queued by the Image Sinks and Capture Actions have been written.
  */
 void dsl_delete_all();
 
@@ -321,6 +321,31 @@ namespace DSL
             return m_pSrcPadProbe->SetKittiOutputEnabled(enabled, file);
         }
         
+        /**
+         * @brief Gets the current kitti output mode and maximum file size
+         * @param[out] mode one of the DSL_KITTI_OUTPUT_MODE constants
+         * @param[out] maxFileSize maximum size of each source file in bytes
+         */
+        void GetKittiOutputMode(uint* mode, uint* maxFileSize)
+        {
+            LOG_FUNC();
+            
+            m_pSrcPadProbe->GetKittiOutputMode(mode, maxFileSize);
+        }
+        
+        /**
+         * @brief Sets the kitti output mode and maximum file size
+         * @param[in] mode one of the DSL_KITTI_OUTPUT_MODE constants
+         * @param[in] maxFileSize maximum size of each source file in bytes, 0 = no rotation
+         * @return true if successful, false otherwise.
+         */
+        bool SetKittiOutputMode(uint mode, uint maxFileSize)
+        {
+            LOG_FUNC();
+            
+            return m_pSrcPadProbe->SetKittiOutputMode(mode, maxFileSize);
+        }
+        
         /**
          * @brief Gets the current GPU ID used by this Bintr
          * @return the ID for the current GPU in use.
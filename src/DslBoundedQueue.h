@@ -0,0 +1,235 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_BOUNDED_QUEUE_H
+#define _DSL_BOUNDED_QUEUE_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @class BoundedQueue
+     * @brief Fixed capacity, lock-free, multi-producer multi-consumer queue.
+     * All elements are allocated once on construction and reused. Each cell
+     * carries a sequence number that tells producers and consumers whether the
+     * cell is free to write or ready to read, so neither side ever blocks.
+     */
+    template<typename T>
+    class BoundedQueue
+    {
+    public:
+    
+        /**
+         * @brief ctor for the BoundedQueue class
+         * @param[in] capacity minimum number of elements the queue can hold,
+         * rounded up to the next power of two.
+         */
+        BoundedQueue(uint capacity)
+            : m_cells(roundUpCapacity(capacity))
+            , m_mask(m_cells.size() - 1)
+            , m_enqueuePos(0)
+            , m_dequeuePos(0)
+        {
+            for (uint i = 0; i < m_cells.size(); i++)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        
+        /**
+         * @brief Gets the fixed capacity of the queue
+         * @return number of elements the queue can hold
+         */
+        uint Capacity() const
+        {
+            return m_mask + 1;
+        }
+        
+        /**
+         * @brief Gets the approximate number of queued elements. The value
+         * may be stale by the time it is returned if other threads are active.
+         * @return number of queued elements
+         */
+        uint Size() const
+        {
+            uint64_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+            uint64_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+            
+            return (enqueuePos > dequeuePos) ? (uint)(enqueuePos - dequeuePos) : 0;
+        }
+        
+        /**
+         * @brief Claims the next free element and fills it in place.
+         * @param[in] fill callable invoked as fill(T& element) to write the
+         * element before it is made visible to consumers.
+         * @return false if the queue is full, true otherwise.
+         */
+        template<typename F>
+        bool TryPushWith(F fill)
+        {
+            Cell* pCell(NULL);
+            uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            
+            while (true)
+            {
+                pCell = &m_cells[pos & m_mask];
+                uint64_t sequence = pCell->sequence.load(std::memory_order_acquire);
+                int64_t diff = (int64_t)sequence - (int64_t)pos;
+                
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos+1, 
+                        std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            fill(pCell->value);
+            pCell->sequence.store(pos+1, std::memory_order_release);
+            return true;
+        }
+        
+        /**
+         * @brief Copies an element onto the queue
+         * @param[in] value element to copy
+         * @return false if the queue is full, true otherwise.
+         */
+        bool TryPush(const T& value)
+        {
+            return TryPushWith([&value](T& element){element = value;});
+        }
+        
+        /**
+         * @brief Claims the oldest element and consumes it in place. The element's 
+         * cell is not returned to producers until the consume call returns.
+         * @param[in] consume callable invoked as consume(T& element).
+         * @return false if the queue is empty, true otherwise.
+         */
+        template<typename F>
+        bool TryPopWith(F consume)
+        {
+            Cell* pCell(NULL);
+            uint64_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            
+            while (true)
+            {
+                pCell = &m_cells[pos & m_mask];
+                uint64_t sequence = pCell->sequence.load(std::memory_order_acquire);
+                int64_t diff = (int64_t)sequence - (int64_t)(pos+1);
+                
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos+1, 
+                        std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            consume(pCell->value);
+            pCell->sequence.store(pos+m_mask+1, std::memory_order_release);
+            return true;
+        }
+        
+        /**
+         * @brief Moves the oldest element off of the queue
+         * @param[out] value receives the element
+         * @return false if the queue is empty, true otherwise.
+         */
+        bool TryPop(T& value)
+        {
+            return TryPopWith([&value](T& element){value = std::move(element);});
+        }
+        
+    private:
+    
+        /**
+         * @brief rounds a requested capacity up to the next power of two.
+         * @param[in] capacity requested capacity
+         * @return actual capacity, minimum of two.
+         */
+        static uint roundUpCapacity(uint capacity)
+        {
+            uint size(2);
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            return size;
+        }
+    
+        /**
+         * @brief a single preallocated element and its sequence number.
+         */
+        struct Cell
+        {
+            Cell() : sequence(0), value{} {};
+        
+            std::atomic<uint64_t> sequence;
+            T value;
+        };
+    
+        /**
+         * @brief preallocated cells, size is always a power of two.
+         */
+        std::vector<Cell> m_cells;
+        
+        /**
+         * @brief capacity - 1, used to map positions onto cells.
+         */
+        uint64_t m_mask;
+        
+        /**
+         * @brief next position to write, on its own cache line to avoid
+         * false sharing between producers and consumers.
+         */
+        alignas(64) std::atomic<uint64_t> m_enqueuePos;
+        
+        /**
+         * @brief next position to read.
+         */
+        alignas(64) std::atomic<uint64_t> m_dequeuePos;
+    };
+}
+
+#endif // _DSL_BOUNDED_QUEUE_H
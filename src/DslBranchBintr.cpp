@@ -170,6 +170,22 @@ namespace DSL
         return AddChild(pOdeHandlerBintr);
     }
 
+    bool BranchBintr::AddMetaRecorderBintr(DSL_BASE_PTR pMetaRecorderBintr)
+    {
+        LOG_FUNC();
+        
+        if (m_pMetaRecorderBintr)
+        {
+            LOG_ERROR("Branch '" << GetName() << "' has an exisiting Meta Recorder '" 
+                << m_pMetaRecorderBintr->GetName());
+            return false;
+        }
+        m_pMetaRecorderBintr = 
+            std::dynamic_pointer_cast<MetaRecorderBintr>(pMetaRecorderBintr);
+        
+        return AddChild(pMetaRecorderBintr);
+    }
+
     bool BranchBintr::AddOsdBintr(DSL_BASE_PTR pOsdBintr)
     {
         LOG_FUNC();
@@ -339,6 +355,21 @@ namespace DSL
                 m_pOdeHandlerBintr->GetName() << "' successfully");
         }
 
+        if (m_pMetaRecorderBintr)
+        {
+            // Link All Meta Recorder Elementrs and add as the next component in the Branch
+            m_pMetaRecorderBintr->SetBatchSize(m_batchSize);
+            if (!m_pMetaRecorderBintr->LinkAll() or
+                (m_linkedComponents.size() and 
+                    !m_linkedComponents.back()->LinkToSink(m_pMetaRecorderBintr)))
+            {
+                return false;
+            }
+            m_linkedComponents.push_back(m_pMetaRecorderBintr);
+            LOG_INFO("Branch '" << GetName() << "' Linked up Meta Recorder '" << 
+                m_pMetaRecorderBintr->GetName() << "' successfully");
+        }
+
         // mutually exclusive with Demuxer
         if (m_pTilerBintr)
         {
@@ -32,6 +32,7 @@ THE SOFTWARE.
 #include "DslOfvBintr.h"
 #include "DslOsdBintr.h"
 #include "DslOdeHandlerBintr.h"
+#include "DslMetaRecorderBintr.h"
 #include "DslTilerBintr.h"
 #include "DslPipelineSGiesBintr.h"
 #include "DslMultiComponentsBintr.h"
@@ -95,6 +96,12 @@ namespace DSL
          */
         bool AddOdeHandlerBintr(DSL_BASE_PTR pOdeHandlerBintr);
         
+        /**
+         * @brief adds a single MetaRecorderBintr to this Branch 
+         * @param[in] pMetaRecorderBintr shared pointer to the Meta Recorder Bintr to add
+         */
+        bool AddMetaRecorderBintr(DSL_BASE_PTR pMetaRecorderBintr);
+        
         /**
          * @brief adds a single OsdBintr to this Branch 
          * @param[in] pOsdBintr shared pointer to OSD Bintr to add
@@ -199,6 +206,11 @@ namespace DSL
          */
         DSL_ODE_HANDLER_PTR m_pOdeHandlerBintr;
 
+        /**
+         * @brief optional, one at most Meta Recorder for this Branch
+         */
+        DSL_META_RECORDER_BINTR_PTR m_pMetaRecorderBintr;
+
         /**
          * @brief optional, one at most OSD for this Branch
          */
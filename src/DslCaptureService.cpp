@@ -0,0 +1,365 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "opencv2/imgproc/imgproc.hpp"
+#include "opencv2/imgproc/types_c.h"
+#include "opencv2/highgui/highgui.hpp"
+
+#include "Dsl.h"
+#include "DslCaptureService.h"
+
+namespace DSL
+{
+    std::atomic<CaptureService*> CaptureService::s_pInstance(NULL);
+    
+    // statically allocated GMutex, zero initialized, requires no init or clear
+    GMutex CaptureService::s_instanceMutex;
+
+    CaptureService* CaptureService::GetService()
+    {
+        CaptureService* pInstance = s_pInstance.load();
+        if (pInstance)
+        {
+            return pInstance;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&s_instanceMutex);
+        
+        // The instance is created on the heap, and not as a function-local static,
+        // so that it is not destroyed at exit after the CUDA runtime.
+        if (!s_pInstance.load())
+        {
+            s_pInstance.store(new CaptureService());
+        }
+        return s_pInstance.load();
+    }
+    
+    void CaptureService::Shutdown()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&s_instanceMutex);
+        
+        CaptureService* pInstance = s_pInstance.exchange(NULL);
+        if (pInstance)
+        {
+            delete pInstance;
+        }
+    }
+    
+    CaptureService::CaptureService()
+        : m_images(DSL_CAPTURE_SERVICE_POOL_SIZE)
+        , m_freeImages(DSL_CAPTURE_SERVICE_POOL_SIZE)
+        , m_pEncodeQueue(g_async_queue_new())
+        , m_surfaces(DSL_CAPTURE_SERVICE_SURFACE_POOL_SIZE, 
+            CaptureSurface{NULL, 0, NULL, 0, 0, false})
+        , m_queueDepth(0)
+        , m_encoded(0)
+        , m_dropped(0)
+        , m_totalLatency(0)
+        , m_maxLatency(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_surfaceMutex);
+        
+        for (auto& image: m_images)
+        {
+            m_freeImages.TryPush(&image);
+        }
+        for (uint i = 0; i < DSL_CAPTURE_SERVICE_WORKERS; i++)
+        {
+            std::string threadName = "dsl-capture-" + std::to_string(i);
+            m_workers.push_back(g_thread_new(threadName.c_str(), 
+                CaptureServiceWorkerThread, this));
+        }
+    }
+    
+    CaptureService::~CaptureService()
+    {
+        LOG_FUNC();
+        
+        // the service's own address is used as the stop signal, one per worker,
+        // queued behind any images still waiting to be encoded.
+        for (uint i = 0; i < m_workers.size(); i++)
+        {
+            g_async_queue_push(m_pEncodeQueue, this);
+        }
+        for (auto const& ithread: m_workers)
+        {
+            g_thread_join(ithread);
+        }
+        g_async_queue_unref(m_pEncodeQueue);
+        
+        for (auto& surface: m_surfaces)
+        {
+            if (surface.pSurface)
+            {
+                NvBufSurfaceDestroy(surface.pSurface);
+                cudaStreamDestroy(surface.cudaStream);
+            }
+        }
+        g_mutex_clear(&m_surfaceMutex);
+    }
+    
+    bool CaptureService::SubmitSurface(NvBufSurface* pSurface, uint batchIndex, 
+        const NvBufSurfTransformRect& srcRect, const std::string& filespec)
+    {
+        if (batchIndex >= pSurface->numFilled or !srcRect.width or !srcRect.height)
+        {
+            LOG_ERROR("Invalid frame or region for capture to '" << filespec << "'");
+            m_dropped++;
+            return false;
+        }
+        int surfaceIndex = acquireSurface(pSurface->gpuId, srcRect.width, srcRect.height);
+        if (surfaceIndex < 0)
+        {
+            m_dropped++;
+            return false;
+        }
+        NvBufSurface* pDstSurface = m_surfaces[surfaceIndex].pSurface;
+        cudaStream_t cudaStream = m_surfaces[surfaceIndex].cudaStream;
+        
+        // single frame view of the batched surface
+        NvBufSurface frameSurface = *pSurface;
+        frameSurface.surfaceList = &pSurface->surfaceList[batchIndex];
+        frameSurface.batchSize = 1;
+        frameSurface.numFilled = 1;
+        
+        NvBufSurfTransformRect src_rect = srcRect;
+        NvBufSurfTransformRect dst_rect = {0, 0, srcRect.width, srcRect.height};
+
+        NvBufSurfTransformParams bufSurfTransform = {0};
+        bufSurfTransform.src_rect = &src_rect;
+        bufSurfTransform.dst_rect = &dst_rect;
+        bufSurfTransform.transform_flag = NVBUFSURF_TRANSFORM_CROP_SRC |
+            NVBUFSURF_TRANSFORM_CROP_DST;
+        bufSurfTransform.transform_filter = NvBufSurfTransformInter_Default;
+
+        // session parameters are per thread, the stream is persistent per surface
+        NvBufSurfTransformConfigParams bufSurfTransformConfigParams = {};
+        bufSurfTransformConfigParams.compute_mode = NvBufSurfTransformCompute_Default;
+        bufSurfTransformConfigParams.gpu_id = pSurface->gpuId;
+        bufSurfTransformConfigParams.cuda_stream = cudaStream;
+        NvBufSurfTransformSetSessionParams(&bufSurfTransformConfigParams);
+
+        bool retval(false);
+        NvBufSurfTransform_Error err = NvBufSurfTransform(&frameSurface, 
+            pDstSurface, &bufSurfTransform);
+        if (err != NvBufSurfTransformError_Success)
+        {
+            LOG_ERROR("NvBufSurfTransform failed with error " << err 
+                << " while capturing to '" << filespec << "'");
+            m_dropped++;
+        }
+        else if (NvBufSurfaceMap(pDstSurface, 0, 0, NVBUF_MAP_READ) != 0)
+        {
+            LOG_ERROR("Failed to map capture surface for '" << filespec << "'");
+            m_dropped++;
+        }
+        else
+        {
+            NvBufSurfaceSyncForCpu(pDstSurface, 0, 0);
+            
+            retval = SubmitImage((uint8_t*)pDstSurface->surfaceList[0].mappedAddr.addr[0],
+                srcRect.width, srcRect.height, pDstSurface->surfaceList[0].pitch, filespec);
+                
+            NvBufSurfaceUnMap(pDstSurface, 0, 0);
+        }
+        releaseSurface(surfaceIndex);
+        return retval;
+    }
+    
+    bool CaptureService::SubmitImage(const uint8_t* pRgba, uint width, uint height,
+        uint pitch, const std::string& filespec)
+    {
+        CaptureImage* pImage(NULL);
+        if (!m_freeImages.TryPop(pImage))
+        {
+            LOG_WARN("Capture queue is full, dropping capture to '" << filespec << "'");
+            m_dropped++;
+            return false;
+        }
+        uint rowSize = width*4;
+        
+        // only grows, so no allocation once the largest image size has been seen
+        if (pImage->pixels.size() < (size_t)rowSize*height)
+        {
+            pImage->pixels.resize((size_t)rowSize*height);
+        }
+        for (uint row = 0; row < height; row++)
+        {
+            memcpy(&pImage->pixels[(size_t)row*rowSize], pRgba + (size_t)row*pitch, rowSize);
+        }
+        pImage->width = width;
+        pImage->height = height;
+        pImage->filespec = filespec;
+        
+        m_queueDepth++;
+        g_async_queue_push(m_pEncodeQueue, pImage);
+        return true;
+    }
+    
+    void CaptureService::GetMetrics(uint* queueDepth, uint64_t* encoded, 
+        uint64_t* dropped, uint64_t* averageLatency, uint64_t* maxLatency)
+    {
+        LOG_FUNC();
+        
+        *queueDepth = m_queueDepth;
+        *encoded = m_encoded;
+        *dropped = m_dropped;
+        *averageLatency = (*encoded) ? m_totalLatency / (*encoded) : 0;
+        *maxLatency = m_maxLatency;
+    }
+    
+    void CaptureService::ResetMetrics()
+    {
+        LOG_FUNC();
+        
+        m_encoded = 0;
+        m_dropped = 0;
+        m_totalLatency = 0;
+        m_maxLatency = 0;
+    }
+    
+    void CaptureService::RunWorker()
+    {
+        // conversion buffer reused by this worker for all images
+        cv::Mat bgrImage;
+        
+        while (true)
+        {
+            gpointer pItem = g_async_queue_pop(m_pEncodeQueue);
+            if (pItem == this)
+            {
+                return;
+            }
+            CaptureImage* pImage = static_cast<CaptureImage*>(pItem);
+            
+            gint64 startTime = g_get_monotonic_time();
+            
+            bool encoded(false);
+            try
+            {
+                cv::Mat rgbaImage(pImage->height, pImage->width, CV_8UC4, 
+                    pImage->pixels.data(), pImage->width*4);
+                cv::cvtColor(rgbaImage, bgrImage, CV_RGBA2BGR);
+                
+                encoded = cv::imwrite(pImage->filespec.c_str(), bgrImage);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Exception encoding capture to '" << pImage->filespec << "'");
+            }
+            if (encoded)
+            {
+                uint64_t latency = g_get_monotonic_time() - startTime;
+                m_totalLatency += latency;
+                
+                uint64_t maxLatency = m_maxLatency.load();
+                while (latency > maxLatency and 
+                    !m_maxLatency.compare_exchange_weak(maxLatency, latency));
+                    
+                m_encoded++;
+            }
+            else
+            {
+                LOG_ERROR("Failed to write capture to '" << pImage->filespec << "'");
+                m_dropped++;
+            }
+            m_queueDepth--;
+            m_freeImages.TryPush(pImage);
+        }
+    }
+    
+    int CaptureService::acquireSurface(uint gpuId, uint width, uint height)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_surfaceMutex);
+        
+        for (uint i = 0; i < m_surfaces.size(); i++)
+        {
+            CaptureSurface& surface = m_surfaces[i];
+            if (surface.inUse)
+            {
+                continue;
+            }
+            if (!surface.pSurface or surface.gpuId != gpuId or 
+                surface.width < width or surface.height < height)
+            {
+                if (surface.pSurface)
+                {
+                    NvBufSurfaceDestroy(surface.pSurface);
+                    cudaStreamDestroy(surface.cudaStream);
+                    surface.pSurface = NULL;
+                }
+                cudaSetDevice(gpuId);
+                if (cudaStreamCreate(&surface.cudaStream) != cudaSuccess)
+                {
+                    LOG_ERROR("Failed to create CUDA stream for capture on GPU " << gpuId);
+                    surface.width = surface.height = 0;
+                    return -1;
+                }
+                NvBufSurfaceCreateParams bufSurfaceCreateParams = {0};
+                bufSurfaceCreateParams.gpuId = gpuId;
+                bufSurfaceCreateParams.width = std::max(width, surface.width);
+                bufSurfaceCreateParams.height = std::max(height, surface.height);
+                bufSurfaceCreateParams.size = 0;
+                bufSurfaceCreateParams.colorFormat = NVBUF_COLOR_FORMAT_RGBA;
+                bufSurfaceCreateParams.layout = NVBUF_LAYOUT_PITCH;
+                bufSurfaceCreateParams.memType = NVBUF_MEM_DEFAULT;
+                
+                if (NvBufSurfaceCreate(&surface.pSurface, 1, &bufSurfaceCreateParams) != 0)
+                {
+                    LOG_ERROR("Failed to allocate capture surface of width " << width 
+                        << " and height " << height);
+                    cudaStreamDestroy(surface.cudaStream);
+                    surface.pSurface = NULL;
+                    surface.width = surface.height = 0;
+                    return -1;
+                }
+                surface.pSurface->numFilled = 1;
+                surface.gpuId = gpuId;
+                surface.width = bufSurfaceCreateParams.width;
+                surface.height = bufSurfaceCreateParams.height;
+            }
+            surface.inUse = true;
+            return i;
+        }
+        LOG_WARN("All capture surfaces are in use");
+        return -1;
+    }
+    
+    void CaptureService::releaseSurface(int index)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_surfaceMutex);
+        
+        m_surfaces[index].inUse = false;
+    }
+    
+    static gpointer CaptureServiceWorkerThread(gpointer pService)
+    {
+        static_cast<CaptureService*>(pService)->RunWorker();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,280 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_CAPTURE_SERVICE_H
+#define _DSL_CAPTURE_SERVICE_H
+
+#include <nvbufsurftransform.h>
+
+#include "Dsl.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of preallocated host image records. Submissions made 
+     * while all records are queued or being encoded are dropped.
+     */
+    #define DSL_CAPTURE_SERVICE_POOL_SIZE 16
+    
+    /**
+     * @brief number of preallocated RGBA destination surfaces shared by all
+     * threads submitting NvBufSurfaces for capture.
+     */
+    #define DSL_CAPTURE_SERVICE_SURFACE_POOL_SIZE 2
+    
+    /**
+     * @brief number of encoder worker threads.
+     */
+    #define DSL_CAPTURE_SERVICE_WORKERS 2
+
+    /**
+     * @struct CaptureImage
+     * @brief Preallocated host record for a single RGBA image waiting to be 
+     * encoded and written to file. The pixel buffer grows to the largest
+     * image submitted and is reused.
+     */
+    struct CaptureImage
+    {
+        /**
+         * @brief tightly packed RGBA pixels, width * 4 bytes per row.
+         */
+        std::vector<uint8_t> pixels;
+        
+        /**
+         * @brief width of the image in pixels.
+         */
+        uint width;
+        
+        /**
+         * @brief height of the image in pixels.
+         */
+        uint height;
+        
+        /**
+         * @brief path to write the image to, the extension selects the encoder.
+         */
+        std::string filespec;
+    };
+    
+    /**
+     * @struct CaptureSurface
+     * @brief Preallocated RGBA destination surface for the transform.
+     */
+    struct CaptureSurface
+    {
+        /**
+         * @brief the destination surface, NULL until first used.
+         */
+        NvBufSurface* pSurface;
+        
+        /**
+         * @brief GPU the surface was allocated on.
+         */
+        uint gpuId;
+        
+        /**
+         * @brief persistent CUDA stream for transforms into the surface.
+         */
+        cudaStream_t cudaStream;
+        
+        /**
+         * @brief allocated width and height, reallocated if a larger 
+         * transform is requested.
+         */
+        uint width;
+        uint height;
+        
+        /**
+         * @brief true while the surface is acquired by a submitting thread.
+         */
+        bool inUse;
+    };
+    
+    /**
+     * @class CaptureService
+     * @brief Shared capture service for the Capture ODE Actions and the Image Sink.
+     * Submitting threads transform from the batched surface into a pooled RGBA 
+     * surface, each with its own persistent CUDA stream, and copy the pixels into a pooled host 
+     * record. The record is then queued for a small pool of worker threads that 
+     * convert, encode - JPEG or PNG based on file extension - and write the image.
+     */
+    class CaptureService
+    {
+    public:
+    
+        /**
+         * @brief Returns the single service instance, starting the workers on first call,
+         * or on the first call after Shutdown.
+         * @return pointer to the capture service.
+         */
+        static CaptureService* GetService();
+        
+        /**
+         * @brief Stops the single service instance, if started, once all queued images
+         * have been written, and frees its surfaces and CUDA streams. Called from
+         * dsl_delete_all so that the service is never destroyed after the CUDA runtime
+         * has shut down. There must be no Pipelines playing.
+         */
+        static void Shutdown();
+        
+        /**
+         * @brief Transforms a region of one frame in a batched surface and queues 
+         * it to be encoded and saved. Called on the streaming thread, returns
+         * once the pixels have been copied to host memory.
+         * @param[in] pSurface batched surface mapped from the Gst Buffer
+         * @param[in] batchIndex index of the frame within the batch to capture
+         * @param[in] srcRect region of the frame to capture
+         * @param[in] filespec path to write the image to, ".png" for PNG, JPEG otherwise
+         * @return true if queued, false if dropped or the transform failed.
+         */
+        bool SubmitSurface(NvBufSurface* pSurface, uint batchIndex, 
+            const NvBufSurfTransformRect& srcRect, const std::string& filespec);
+            
+        /**
+         * @brief Copies an RGBA image in host memory and queues it to be encoded
+         * and saved. Used for the second half of SubmitSurface and directly
+         * by clients with images already in host memory.
+         * @param[in] pRgba pointer to the first pixel of the image
+         * @param[in] width width of the image in pixels
+         * @param[in] height height of the image in pixels
+         * @param[in] pitch number of bytes between the start of each row
+         * @param[in] filespec path to write the image to, ".png" for PNG, JPEG otherwise
+         * @return true if queued, false if dropped.
+         */
+        bool SubmitImage(const uint8_t* pRgba, uint width, uint height,
+            uint pitch, const std::string& filespec);
+        
+        /**
+         * @brief Gets the current metrics for the service
+         * @param[out] queueDepth number of images waiting to be, or being, encoded
+         * @param[out] encoded total number of images encoded and written to file
+         * @param[out] dropped total number of submissions dropped or failed
+         * @param[out] averageLatency average time to encode and write in microseconds
+         * @param[out] maxLatency maximum time to encode and write in microseconds
+         */
+        void GetMetrics(uint* queueDepth, uint64_t* encoded, uint64_t* dropped,
+            uint64_t* averageLatency, uint64_t* maxLatency);
+            
+        /**
+         * @brief Resets the encoded, dropped and latency metrics to 0.
+         */
+        void ResetMetrics();
+        
+        /**
+         * @brief Worker loop, encodes and writes queued images until stopped.
+         */
+        void RunWorker();
+        
+    private:
+    
+        CaptureService();
+        
+        ~CaptureService();
+        
+        /**
+         * @brief Acquires a destination surface from the pool, (re)allocating it
+         * if it is too small or on the wrong GPU.
+         * @return pool index of the acquired surface, or -1 if none are free.
+         */
+        int acquireSurface(uint gpuId, uint width, uint height);
+        
+        /**
+         * @brief Returns a destination surface to the pool.
+         * @param[in] index pool index returned by acquireSurface
+         */
+        void releaseSurface(int index);
+        
+        /**
+         * @brief the single service instance, NULL until first used or after Shutdown.
+         */
+        static std::atomic<CaptureService*> s_pInstance;
+        
+        /**
+         * @brief mutex to guard the creation and shutdown of the single instance.
+         */
+        static GMutex s_instanceMutex;
+        
+        /**
+         * @brief all preallocated host image records.
+         */
+        std::vector<CaptureImage> m_images;
+        
+        /**
+         * @brief free host image records, lock-free for the streaming threads.
+         */
+        BoundedQueue<CaptureImage*> m_freeImages;
+        
+        /**
+         * @brief queue of images waiting to be encoded, popped by the workers.
+         */
+        GAsyncQueue* m_pEncodeQueue;
+        
+        /**
+         * @brief worker threads, started on construction.
+         */
+        std::vector<GThread*> m_workers;
+        
+        /**
+         * @brief pool of destination surfaces, guarded by m_surfaceMutex.
+         */
+        std::vector<CaptureSurface> m_surfaces;
+        
+        /**
+         * @brief mutex to guard the destination surface pool.
+         */
+        GMutex m_surfaceMutex;
+        
+        /**
+         * @brief number of images queued or being encoded.
+         */
+        std::atomic<uint> m_queueDepth;
+        
+        /**
+         * @brief number of images encoded and written to file.
+         */
+        std::atomic<uint64_t> m_encoded;
+        
+        /**
+         * @brief number of submissions dropped for lack of a free record
+         * or surface, or that failed to transform, encode or write.
+         */
+        std::atomic<uint64_t> m_dropped;
+        
+        /**
+         * @brief sum and maximum of all encode and write times in microseconds.
+         */
+        std::atomic<uint64_t> m_totalLatency;
+        std::atomic<uint64_t> m_maxLatency;
+    };
+    
+    /**
+     * @brief Thread function for each of the capture service's workers
+     * @param[in] pService pointer to the service that owns the worker.
+     */
+    static gpointer CaptureServiceWorkerThread(gpointer pService);
+}
+
+#endif // _DSL_CAPTURE_SERVICE_H
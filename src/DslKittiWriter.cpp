@@ -0,0 +1,462 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslKittiWriter.h"
+
+#include <climits>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace DSL
+{
+    /**
+     * @brief all two digit decimal numbers, 00 to 99, for converting two digits at a time.
+     */
+    static const char DIGIT_PAIRS[] = 
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    /**
+     * @brief Appends an unsigned integer in decimal
+     * @return pointer to the next character
+     */
+    static inline char* appendUint(char* pText, uint64_t value)
+    {
+        char digits[20];
+        char* pDigits = digits + sizeof(digits);
+        while (value >= 100)
+        {
+            uint pair = (uint)(value % 100);
+            value /= 100;
+            *--pDigits = DIGIT_PAIRS[pair*2+1];
+            *--pDigits = DIGIT_PAIRS[pair*2];
+        }
+        if (value >= 10)
+        {
+            *--pDigits = DIGIT_PAIRS[value*2+1];
+            *--pDigits = DIGIT_PAIRS[value*2];
+        }
+        else
+        {
+            *--pDigits = '0' + value;
+        }
+        size_t count = digits + sizeof(digits) - pDigits;
+        memcpy(pText, pDigits, count);
+        return pText + count;
+    }
+    
+    /**
+     * @brief Appends a float in fixed point with a given number of decimal places,
+     * without the locale handling and parsing overhead of printf. Values are 
+     * limited to +/- 1e9 which is well beyond any frame coordinate.
+     * @return pointer to the next character
+     */
+    template<uint decimals, uint64_t scale>
+    static inline char* appendFixed(char* pText, float value)
+    {
+        static_assert(decimals % 2 == 0, "decimals must be even");
+
+        if (!(value == value))
+        {
+            value = 0;
+        }
+        if (value < 0)
+        {
+            *pText++ = '-';
+            value = -value;
+        }
+        value = std::min(value, 1e9f);
+        
+        uint64_t scaled = (uint64_t)((double)value*scale + 0.5);
+        
+        pText = appendUint(pText, scaled/scale);
+        *pText++ = '.';
+        
+        // decimals is even, so the fraction is converted two digits at a time
+        uint fraction = (uint)(scaled % scale);
+        for (int i = (int)decimals-2; i >= 0; i -= 2)
+        {
+            uint pair = fraction % 100;
+            fraction /= 100;
+            pText[i] = DIGIT_PAIRS[pair*2];
+            pText[i+1] = DIGIT_PAIRS[pair*2+1];
+        }
+        return pText + decimals;
+    }
+    
+    /**
+     * @brief the unused KITTI fields between the bounding box and the score,
+     * dimensions, location and rotation_y, which are 3D only.
+     */
+    static const char KITTI_3D_FIELDS[] = " 0.00 0.00 0.00 0.00 0.00 0.00 0.00 ";
+    
+    KittiWriter::KittiWriter(const char* name, const char* path, uint mode, uint maxFileSize)
+        : m_name(name)
+        , m_path(path)
+        , m_mode(mode)
+        , m_maxFileSize(maxFileSize)
+        , m_batches(DSL_KITTI_WRITER_POOL_SIZE)
+        , m_freeBatches(DSL_KITTI_WRITER_POOL_SIZE)
+        , m_pWriteQueue(g_async_queue_new())
+        , m_pWriter(NULL)
+        , m_written(0)
+        , m_dropped(0)
+    {
+        LOG_FUNC();
+        
+        for (auto& batch: m_batches)
+        {
+            m_freeBatches.TryPush(&batch);
+        }
+        std::string threadName = "dsl-kitti-" + m_name;
+        m_pWriter = g_thread_new(threadName.c_str(), KittiWriterThread, this);
+    }
+    
+    KittiWriter::~KittiWriter()
+    {
+        LOG_FUNC();
+        
+        // the writer's own address is used as the stop signal, 
+        // queued behind any batches still waiting to be written.
+        g_async_queue_push(m_pWriteQueue, this);
+        g_thread_join(m_pWriter);
+        g_async_queue_unref(m_pWriteQueue);
+    }
+    
+    size_t KittiWriter::FormatObject(char* pText, const NvDsObjectMeta* pObjectMeta, 
+        bool tracking, uint64_t frameNum)
+    {
+        char* pNext(pText);
+        
+        if (tracking)
+        {
+            pNext = appendUint(pNext, frameNum);
+            *pNext++ = ' ';
+            if (pObjectMeta->object_id == UNTRACKED_OBJECT_ID)
+            {
+                *pNext++ = '-';
+                *pNext++ = '1';
+            }
+            else
+            {
+                pNext = appendUint(pNext, pObjectMeta->object_id);
+            }
+            *pNext++ = ' ';
+        }
+        
+        // KITTI lines are space delimited, so spaces in the label are replaced 
+        // and an empty label is replaced with the class id.
+        const char* pLabel = pObjectMeta->obj_label;
+        if (*pLabel)
+        {
+            for (uint i = 0; i < DSL_KITTI_WRITER_MAX_LABEL_SIZE and pLabel[i]; i++)
+            {
+                *pNext++ = (pLabel[i] == ' ') ? '_' : pLabel[i];
+            }
+        }
+        else
+        {
+            pNext = appendUint(pNext, (uint)pObjectMeta->class_id);
+        }
+        
+        // truncation, occlusion, and observation angle are unknown
+        memcpy(pNext, " 0.00 0 0.00 ", 13);
+        pNext += 13;
+        
+        const NvOSD_RectParams& rect = pObjectMeta->rect_params;
+        pNext = appendFixed<2, 100>(pNext, rect.left);
+        *pNext++ = ' ';
+        pNext = appendFixed<2, 100>(pNext, rect.top);
+        *pNext++ = ' ';
+        pNext = appendFixed<2, 100>(pNext, rect.left + rect.width);
+        *pNext++ = ' ';
+        pNext = appendFixed<2, 100>(pNext, rect.top + rect.height);
+        
+        memcpy(pNext, KITTI_3D_FIELDS, sizeof(KITTI_3D_FIELDS)-1);
+        pNext += sizeof(KITTI_3D_FIELDS)-1;
+        
+        pNext = appendFixed<6, 1000000>(pNext, pObjectMeta->confidence);
+        *pNext++ = '\n';
+        
+        return pNext - pText;
+    }
+    
+    bool KittiWriter::WriteBatch(NvDsBatchMeta* pBatchMeta)
+    {
+        if (!pBatchMeta)
+        {
+            return false;
+        }
+        KittiBatchText* pBatch(NULL);
+        if (!m_freeBatches.TryPop(pBatch))
+        {
+            LOG_WARN("KITTI write queue is full for '" << m_name 
+                << "', dropping " << pBatchMeta->num_frames_in_batch << " frames");
+            m_dropped += pBatchMeta->num_frames_in_batch;
+            return false;
+        }
+        pBatch->size = 0;
+        pBatch->frames.clear();
+        
+        bool tracking(m_mode == DSL_KITTI_OUTPUT_MODE_SOURCE_FILES);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            if (!pFrameMeta)
+            {
+                continue;
+            }
+            // only grows, so no allocation once the largest batch has been seen
+            size_t maxFrameSize = (size_t)pFrameMeta->num_obj_meta*DSL_KITTI_WRITER_MAX_LINE_SIZE;
+            if (pBatch->text.size() < pBatch->size + maxFrameSize)
+            {
+                pBatch->text.resize(pBatch->size + maxFrameSize);
+            }
+            KittiFrameText frame{pFrameMeta->source_id, 
+                (uint64_t)pFrameMeta->frame_num, pBatch->size, 0};
+            
+            uint objectCount(0);
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList and objectCount < pFrameMeta->num_obj_meta; 
+                pObjectMetaList = pObjectMetaList->next, objectCount++)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                if (pObjectMeta)
+                {
+                    pBatch->size += FormatObject(&pBatch->text[pBatch->size], 
+                        pObjectMeta, tracking, frame.frameNum);
+                }
+            }
+            frame.length = pBatch->size - frame.offset;
+            pBatch->frames.push_back(frame);
+        }
+        g_async_queue_push(m_pWriteQueue, pBatch);
+        return true;
+    }
+    
+    void KittiWriter::GetMetrics(uint64_t* written, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *written = m_written;
+        *dropped = m_dropped;
+    }
+    
+    void KittiWriter::RunWriter()
+    {
+        bool stopped(false);
+        while (!stopped)
+        {
+            // wait for the next batch, then take all others already queued so that
+            // the text of many batches is written with a single write per source.
+            gpointer pItem = g_async_queue_pop(m_pWriteQueue);
+            do
+            {
+                if (pItem == this)
+                {
+                    stopped = true;
+                    continue;
+                }
+                KittiBatchText* pBatch = static_cast<KittiBatchText*>(pItem);
+                if (m_mode == DSL_KITTI_OUTPUT_MODE_SOURCE_FILES)
+                {
+                    appendSourceText(pBatch);
+                }
+                else
+                {
+                    writeFrameFiles(pBatch);
+                }
+                m_freeBatches.TryPush(pBatch);
+                
+            } while ((pItem = g_async_queue_try_pop(m_pWriteQueue)));
+            
+            for (auto& imap: m_sourceFiles)
+            {
+                flushSourceFile(imap.first, imap.second);
+            }
+        }
+        for (auto const& imap: m_sourceFiles)
+        {
+            if (imap.second.fd >= 0)
+            {
+                close(imap.second.fd);
+            }
+        }
+        m_sourceFiles.clear();
+    }
+    
+    void KittiWriter::writeFrameFiles(const KittiBatchText* pBatch)
+    {
+        char filePath[PATH_MAX];
+        for (auto const& frame: pBatch->frames)
+        {
+            snprintf(filePath, sizeof(filePath), "%s/%02u_%06lu.txt", 
+                m_path.c_str(), frame.sourceId, (unsigned long)frame.frameNum);
+            
+            int fd = open(filePath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0)
+            {
+                LOG_ERROR("Failed to create KITTI file '" << filePath << "'");
+                m_dropped++;
+                continue;
+            }
+            if (writeAll(fd, &pBatch->text[frame.offset], frame.length))
+            {
+                m_written++;
+            }
+            else
+            {
+                LOG_ERROR("Failed to write KITTI file '" << filePath << "'");
+                m_dropped++;
+            }
+            close(fd);
+        }
+    }
+    
+    void KittiWriter::appendSourceText(const KittiBatchText* pBatch)
+    {
+        for (auto const& frame: pBatch->frames)
+        {
+            auto ifile = m_sourceFiles.find(frame.sourceId);
+            if (ifile == m_sourceFiles.end())
+            {
+                ifile = m_sourceFiles.emplace(frame.sourceId, 
+                    KittiSourceFile{-1, 0, 0, std::vector<char>()}).first;
+            }
+            KittiSourceFile& sourceFile = ifile->second;
+            
+            if (sourceFile.fd < 0 and !openSourceFile(frame.sourceId, sourceFile))
+            {
+                m_dropped++;
+                continue;
+            }
+            
+            // rotate at frame boundaries, once the frame no longer fits in the current 
+            // file, skipping any existing files that are too full for the frame
+            bool opened(true);
+            uint64_t fileSize = sourceFile.size + sourceFile.pending.size();
+            while (m_maxFileSize and fileSize and fileSize + frame.length > m_maxFileSize)
+            {
+                flushSourceFile(frame.sourceId, sourceFile);
+                close(sourceFile.fd);
+                sourceFile.fd = -1;
+                sourceFile.size = 0;
+                sourceFile.index++;
+                
+                if (!(opened = openSourceFile(frame.sourceId, sourceFile)))
+                {
+                    break;
+                }
+                fileSize = sourceFile.size;
+            }
+            if (!opened)
+            {
+                m_dropped++;
+                continue;
+            }
+            sourceFile.pending.insert(sourceFile.pending.end(), 
+                pBatch->text.begin() + frame.offset, 
+                pBatch->text.begin() + frame.offset + frame.length);
+            m_written++;
+            
+            if (sourceFile.pending.size() >= DSL_KITTI_WRITER_FLUSH_SIZE)
+            {
+                flushSourceFile(frame.sourceId, sourceFile);
+            }
+        }
+    }
+    
+    bool KittiWriter::openSourceFile(uint sourceId, KittiSourceFile& sourceFile)
+    {
+        char filePath[PATH_MAX];
+        if (sourceFile.index)
+        {
+            snprintf(filePath, sizeof(filePath), "%s/%02u.txt.%u", 
+                m_path.c_str(), sourceId, sourceFile.index);
+        }
+        else
+        {
+            snprintf(filePath, sizeof(filePath), "%s/%02u.txt", m_path.c_str(), sourceId);
+        }
+        // Existing files, from a previous Writer for the same path, are continued
+        sourceFile.fd = open(filePath, O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (sourceFile.fd < 0)
+        {
+            LOG_ERROR("Failed to open KITTI file '" << filePath << "'");
+            return false;
+        }
+        off_t fileSize = lseek(sourceFile.fd, 0, SEEK_END);
+        sourceFile.size = (fileSize > 0) ? fileSize : 0;
+        return true;
+    }
+    
+    void KittiWriter::flushSourceFile(uint sourceId, KittiSourceFile& sourceFile)
+    {
+        if (sourceFile.pending.empty() or sourceFile.fd < 0)
+        {
+            return;
+        }
+        if (writeAll(sourceFile.fd, sourceFile.pending.data(), sourceFile.pending.size()))
+        {
+            sourceFile.size += sourceFile.pending.size();
+        }
+        else
+        {
+            LOG_ERROR("Failed to write KITTI file for source " << sourceId 
+                << " of '" << m_name << "'");
+            m_dropped++;
+        }
+        sourceFile.pending.clear();
+    }
+    
+    bool KittiWriter::writeAll(int fd, const char* pData, size_t size)
+    {
+        while (size)
+        {
+            ssize_t written = write(fd, pData, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            pData += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    static gpointer KittiWriterThread(gpointer pWriter)
+    {
+        static_cast<KittiWriter*>(pWriter)->RunWriter();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,306 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_KITTI_WRITER_H
+#define _DSL_KITTI_WRITER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_KITTI_WRITER_PTR std::shared_ptr<KittiWriter>
+    #define DSL_KITTI_WRITER_NEW(name, path, mode, maxFileSize) \
+        std::shared_ptr<KittiWriter>(new KittiWriter(name, path, mode, maxFileSize))
+
+    /**
+     * @brief number of preallocated batch text records. Batches submitted
+     * while all records are queued or being written are dropped.
+     */
+    #define DSL_KITTI_WRITER_POOL_SIZE 32
+    
+    /**
+     * @brief maximum number of bytes formatted for a single object, the label
+     * is truncated to fit if necessary.
+     */
+    #define DSL_KITTI_WRITER_MAX_LINE_SIZE 256
+    
+    /**
+     * @brief maximum number of label characters written for a single object.
+     */
+    #define DSL_KITTI_WRITER_MAX_LABEL_SIZE 64
+    
+    /**
+     * @brief number of bytes pending for a source file that forces a write
+     * before the writer has emptied its queue.
+     */
+    #define DSL_KITTI_WRITER_FLUSH_SIZE (1024*1024)
+
+    /**
+     * @struct KittiFrameText
+     * @brief Location of one frame's lines within a batch text record.
+     */
+    struct KittiFrameText
+    {
+        /**
+         * @brief unique source id of the frame.
+         */
+        uint sourceId;
+        
+        /**
+         * @brief frame number of the frame within its source.
+         */
+        uint64_t frameNum;
+        
+        /**
+         * @brief offset of the frame's first line within the record's text.
+         */
+        size_t offset;
+        
+        /**
+         * @brief number of bytes of text for the frame, 0 if no objects.
+         */
+        size_t length;
+    };
+
+    /**
+     * @struct KittiBatchText
+     * @brief Preallocated record holding the KITTI text for all frames in one
+     * batch. The text buffer grows to the largest batch formatted and is reused.
+     */
+    struct KittiBatchText
+    {
+        /**
+         * @brief formatted text for all frames, only the first size bytes are valid.
+         */
+        std::vector<char> text;
+        
+        /**
+         * @brief number of valid bytes in text.
+         */
+        size_t size;
+        
+        /**
+         * @brief location of each frame's text, in batch order.
+         */
+        std::vector<KittiFrameText> frames;
+    };
+
+    /**
+     * @struct KittiSourceFile
+     * @brief Writer thread state for one source's combined output file.
+     */
+    struct KittiSourceFile
+    {
+        /**
+         * @brief file descriptor of the current file, -1 if not open.
+         */
+        int fd;
+        
+        /**
+         * @brief number of bytes written to the current file.
+         */
+        uint64_t size;
+        
+        /**
+         * @brief rotation index of the current file, 0 for the first file.
+         */
+        uint index;
+        
+        /**
+         * @brief text waiting to be written with a single write call.
+         */
+        std::vector<char> pending;
+    };
+
+    /**
+     * @class KittiWriter
+     * @brief Writes the object metadata of each batch to file in KITTI format.
+     * The streaming thread formats each batch into a pooled text record and queues 
+     * it for a background writer thread, so no file I/O is done while streaming.
+     * In DSL_KITTI_OUTPUT_MODE_FRAME_FILES mode each frame is written to its own file
+     * <path>/<source>_<frame>.txt in the KITTI object detection format. 
+     * In DSL_KITTI_OUTPUT_MODE_SOURCE_FILES mode all frames of a source are appended
+     * to <path>/<source>.txt in the KITTI tracking format, with the frame number and
+     * tracking id leading each line. The writer collects the text of all queued batches
+     * and writes it with one write call per source, rotating to <path>/<source>.txt.<index>
+     * once the current file reaches its maximum size. Existing files are appended to,
+     * so a new Writer for the same path continues the files of the previous Writer.
+     */
+    class KittiWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the KittiWriter class, starts the writer thread.
+         * @param[in] name name of the owner, used for logging and the thread name
+         * @param[in] path absolute or relative path to an existing directory
+         * @param[in] mode one of the DSL_KITTI_OUTPUT_MODE constants
+         * @param[in] maxFileSize maximum size of each source file in bytes before
+         * rotating to a new file, 0 for no rotation. Unused for frame files.
+         */
+        KittiWriter(const char* name, const char* path, uint mode, uint maxFileSize);
+        
+        /**
+         * @brief dtor for the KittiWriter class. Writes all queued batches, 
+         * stops the writer thread, and closes all files. 
+         */
+        ~KittiWriter();
+        
+        /**
+         * @brief Formats the object metadata for all frames in a batch and queues
+         * the text to be written. Called on the streaming thread.
+         * @param[in] pBatchMeta batch meta of the current buffer
+         * @return true if queued, false if dropped.
+         */
+        bool WriteBatch(NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Formats a single object as one line of KITTI text
+         * @param[in] pText buffer to write to, at least DSL_KITTI_WRITER_MAX_LINE_SIZE bytes
+         * @param[in] pObjectMeta object to format
+         * @param[in] tracking if true, prefix the line with the frame number and tracking id
+         * @param[in] frameNum frame number of the object's frame, used for tracking lines
+         * @return number of bytes written, including the terminating newline.
+         */
+        static size_t FormatObject(char* pText, const NvDsObjectMeta* pObjectMeta, 
+            bool tracking, uint64_t frameNum);
+        
+        /**
+         * @brief Gets the current metrics for the writer
+         * @param[out] written number of frames written to file
+         * @param[out] dropped number of frames dropped plus the number of failed writes
+         */
+        void GetMetrics(uint64_t* written, uint64_t* dropped);
+        
+        /**
+         * @brief Writer loop, writes queued batches until stopped.
+         */
+        void RunWriter();
+        
+    private:
+    
+        /**
+         * @brief Writes each frame of a batch to its own file.
+         * @param[in] pBatch batch text record to write
+         */
+        void writeFrameFiles(const KittiBatchText* pBatch);
+        
+        /**
+         * @brief Appends each frame of a batch to its source's pending text, 
+         * flushing and rotating the source's file at frame boundaries as needed.
+         * @param[in] pBatch batch text record to append
+         */
+        void appendSourceText(const KittiBatchText* pBatch);
+        
+        /**
+         * @brief Opens the current file of a source for appending, creating it if needed.
+         * @param[in] sourceId unique source id of the file
+         * @param[in,out] sourceFile source file to open, fd and size are updated
+         * @return true if the file was opened, false otherwise.
+         */
+        bool openSourceFile(uint sourceId, KittiSourceFile& sourceFile);
+        
+        /**
+         * @brief Writes the pending text of a source file with a single write call
+         * @param[in] sourceId unique source id of the file
+         * @param[in] sourceFile source file to flush
+         */
+        void flushSourceFile(uint sourceId, KittiSourceFile& sourceFile);
+        
+        /**
+         * @brief Writes a buffer to a file, retrying on partial writes
+         * @return true if all bytes were written, false otherwise.
+         */
+        bool writeAll(int fd, const char* pData, size_t size);
+        
+        /**
+         * @brief unique name of the owner of this KittiWriter
+         */
+        std::string m_name;
+        
+        /**
+         * @brief path to the output directory.
+         */
+        std::string m_path;
+        
+        /**
+         * @brief one of the DSL_KITTI_OUTPUT_MODE constants.
+         */
+        uint m_mode;
+        
+        /**
+         * @brief maximum size of each source file in bytes, 0 for no rotation.
+         */
+        uint m_maxFileSize;
+        
+        /**
+         * @brief all preallocated batch text records.
+         */
+        std::vector<KittiBatchText> m_batches;
+        
+        /**
+         * @brief free batch text records, lock-free for the streaming thread.
+         */
+        BoundedQueue<KittiBatchText*> m_freeBatches;
+        
+        /**
+         * @brief queue of batch text records waiting to be written.
+         */
+        GAsyncQueue* m_pWriteQueue;
+        
+        /**
+         * @brief writer thread, started on construction.
+         */
+        GThread* m_pWriter;
+        
+        /**
+         * @brief open source files by unique source id, writer thread only.
+         */
+        std::map<uint, KittiSourceFile> m_sourceFiles;
+        
+        /**
+         * @brief number of frames written to file.
+         */
+        std::atomic<uint64_t> m_written;
+        
+        /**
+         * @brief number of frames dropped for lack of a free record, 
+         * plus the number of failed file writes.
+         */
+        std::atomic<uint64_t> m_dropped;
+    };
+    
+    /**
+     * @brief Thread function for the KittiWriter's writer thread
+     * @param[in] pWriter pointer to the KittiWriter that owns the thread.
+     */
+    static gpointer KittiWriterThread(gpointer pWriter);
+}
+
+#endif // _DSL_KITTI_WRITER_H
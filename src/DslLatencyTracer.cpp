@@ -0,0 +1,542 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslLatencyTracer.h"
+
+namespace DSL
+{
+    LatencyHistogram::LatencyHistogram()
+        : m_buckets(DSL_LATENCY_HISTOGRAM_BUCKETS, 0)
+        , m_count(0)
+        , m_max(0)
+    {
+    }
+    
+    void LatencyHistogram::Add(uint64_t latencyNs)
+    {
+        m_buckets[BucketIndex(latencyNs)]++;
+        m_count++;
+        m_max = std::max(m_max, latencyNs);
+    }
+    
+    void LatencyHistogram::Reset()
+    {
+        std::fill(m_buckets.begin(), m_buckets.end(), 0);
+        m_count = 0;
+        m_max = 0;
+    }
+    
+    uint64_t LatencyHistogram::GetPercentile(double percent)
+    {
+        if (!m_count)
+        {
+            return 0;
+        }
+        uint64_t rank = std::max((uint64_t)std::ceil(percent * m_count / 100), (uint64_t)1);
+        uint64_t counted(0);
+        
+        for (uint i = 0; i < m_buckets.size(); i++)
+        {
+            counted += m_buckets[i];
+            if (counted >= rank)
+            {
+                return std::min(BucketUpperBound(i), m_max);
+            }
+        }
+        return m_max;
+    }
+    
+    uint LatencyHistogram::BucketIndex(uint64_t latencyNs)
+    {
+        if (latencyNs < DSL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return latencyNs;
+        }
+        // position of the most significant bit, at least 4 from here
+        uint msb = 63 - __builtin_clzll(latencyNs);
+        uint shift = msb - 4;
+        
+        return DSL_LATENCY_HISTOGRAM_SUB_BUCKETS*(shift + 1) + 
+            ((latencyNs >> shift) & (DSL_LATENCY_HISTOGRAM_SUB_BUCKETS - 1));
+    }
+    
+    uint64_t LatencyHistogram::BucketUpperBound(uint index)
+    {
+        if (index < DSL_LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return index;
+        }
+        uint shift = index / DSL_LATENCY_HISTOGRAM_SUB_BUCKETS - 1;
+        uint64_t subBucket = DSL_LATENCY_HISTOGRAM_SUB_BUCKETS + 
+            index % DSL_LATENCY_HISTOGRAM_SUB_BUCKETS;
+        
+        return ((subBucket + 1) << shift) - 1;
+    }
+    
+    LatencyTracePoint::LatencyTracePoint(int sourceId)
+        : m_dropped(0)
+        , m_sourceId(sourceId)
+        , m_ring(DSL_LATENCY_TRACER_RING_SIZE)
+        , m_pPad(NULL)
+        , m_probeId(0)
+    {
+        m_drained.reserve(DSL_LATENCY_TRACER_RING_SIZE);
+    }
+    
+    bool LatencyTracePoint::AddProbe(GstPad* pPad)
+    {
+        LOG_FUNC();
+        
+        // the probe's reference is released by the pad once the probe 
+        // is removed and any callback in progress has returned
+        m_probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER,
+            LatencyTracePointProbeCB, new DSL_LATENCY_TRACE_POINT_PTR(shared_from_this()),
+            LatencyTracePointProbeRelease);
+        if (!m_probeId)
+        {
+            return false;
+        }
+        m_pPad = pPad;
+        gst_object_ref(m_pPad);
+        return true;
+    }
+    
+    void LatencyTracePoint::RemoveProbe()
+    {
+        if (m_pPad)
+        {
+            gst_pad_remove_probe(m_pPad, m_probeId);
+            gst_object_unref(m_pPad);
+            m_pPad = NULL;
+            m_probeId = 0;
+        }
+    }
+    
+    void LatencyTracePoint::Record(GstBuffer* pBuffer, uint64_t timeNs)
+    {
+        uint64_t pts = GST_BUFFER_PTS(pBuffer);
+        
+        if (m_sourceId >= 0)
+        {
+            if (!m_ring.TryPush({pts, (uint)m_sourceId, timeNs}))
+            {
+                m_dropped++;
+            }
+            return;
+        }
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            if (!m_ring.TryPush({pFrameMeta->buf_pts, pFrameMeta->pad_index, timeNs}))
+            {
+                m_dropped++;
+            }
+        }
+    }
+    
+    uint LatencyTracePoint::Drain()
+    {
+        m_drained.clear();
+        
+        LatencyStamp stamp;
+        while (m_ring.TryPop(stamp))
+        {
+            m_drained.push_back(stamp);
+        }
+        return m_drained.size();
+    }
+    
+    LatencyTraceStage::LatencyTraceStage(const char* name, 
+        const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& entries,
+        const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& exits)
+        : m_name(name)
+        , m_wstrName(m_name.begin(), m_name.end())
+        , m_entries(entries)
+        , m_exits(exits)
+    {
+        LOG_FUNC();
+    }
+    
+    void LatencyTraceStage::Update(uint64_t nowNs)
+    {
+        for (auto const& iEntry: m_entries)
+        {
+            for (auto const& stamp: iEntry->m_drained)
+            {
+                m_pending.emplace(LatencyStampKey(stamp.pts, stamp.sourceId), stamp.timeNs);
+            }
+        }
+        for (auto const& iExit: m_exits)
+        {
+            for (auto const& stamp: iExit->m_drained)
+            {
+                auto iPending = m_pending.find(LatencyStampKey(stamp.pts, stamp.sourceId));
+                
+                // frames already matched, or whose entry was dropped, are ignored
+                if (iPending != m_pending.end())
+                {
+                    m_histogram.Add((stamp.timeNs > iPending->second) 
+                        ? stamp.timeNs - iPending->second : 0);
+                    m_pending.erase(iPending);
+                }
+            }
+        }
+        for (auto iPending = m_pending.begin(); iPending != m_pending.end();)
+        {
+            if (nowNs - iPending->second > DSL_LATENCY_TRACER_PENDING_TIMEOUT)
+            {
+                iPending = m_pending.erase(iPending);
+                continue;
+            }
+            iPending++;
+        }
+    }
+    
+    void LatencyTraceStage::GetStats(dsl_latency_stats* pStats)
+    {
+        pStats->count = m_histogram.GetCount();
+        pStats->dropped = 0;
+        for (auto const& iEntry: m_entries)
+        {
+            pStats->dropped += iEntry->m_dropped;
+        }
+        for (auto const& iExit: m_exits)
+        {
+            pStats->dropped += iExit->m_dropped;
+        }
+        pStats->p50_ns = m_histogram.GetPercentile(50);
+        pStats->p90_ns = m_histogram.GetPercentile(90);
+        pStats->p99_ns = m_histogram.GetPercentile(99);
+        pStats->max_ns = m_histogram.GetMax();
+    }
+    
+    void LatencyTraceStage::Reset()
+    {
+        m_histogram.Reset();
+        m_pending.clear();
+    }
+    
+    LatencyTracer::LatencyTracer(const char* name)
+        : m_name(name)
+        , m_stop(false)
+        , m_pTracer(NULL)
+        , m_stagesRemoved(false)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_tracerMutex);
+        g_mutex_init(&m_stopMutex);
+        g_cond_init(&m_stopCond);
+        
+        std::string threadName = "dsl-latency-" + m_name;
+        m_pTracer = g_thread_new(threadName.c_str(), LatencyTracerThread, this);
+    }
+    
+    LatencyTracer::~LatencyTracer()
+    {
+        LOG_FUNC();
+        
+        // detach the handlers first, waiting for any timer reading the stats
+        for (auto const& imap: m_statsHandlers)
+        {
+            removeStatsTimer(imap.second);
+        }
+        m_statsHandlers.clear();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stopMutex);
+            m_stop = true;
+            g_cond_signal(&m_stopCond);
+        }
+        g_thread_join(m_pTracer);
+        
+        RemoveAll();
+        
+        g_cond_clear(&m_stopCond);
+        g_mutex_clear(&m_stopMutex);
+        g_mutex_clear(&m_tracerMutex);
+    }
+    
+    DSL_LATENCY_TRACE_POINT_PTR LatencyTracer::AddPoint(GstPad* pPad, int sourceId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        DSL_LATENCY_TRACE_POINT_PTR pPoint = DSL_LATENCY_TRACE_POINT_NEW(sourceId);
+        
+        // a point without a probe records nothing, leaving its stages empty
+        if (pPad and !pPoint->AddProbe(pPad))
+        {
+            LOG_ERROR("Latency Tracer '" << m_name << "' failed to add probe to pad '" 
+                << GST_PAD_NAME(pPad) << "'");
+        }
+        m_points.push_back(pPoint);
+        return pPoint;
+    }
+    
+    void LatencyTracer::AddStage(const char* name, 
+        const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& entries,
+        const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& exits)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        if (m_stagesRemoved)
+        {
+            m_stages.clear();
+            m_stagesRemoved = false;
+        }
+        DSL_LATENCY_TRACE_STAGE_PTR pStage = DSL_LATENCY_TRACE_STAGE_NEW(name, entries, exits);
+        
+        // end-to-end is always reported first
+        if (pStage->m_name.empty())
+        {
+            m_stages.insert(m_stages.begin(), pStage);
+            return;
+        }
+        m_stages.push_back(pStage);
+    }
+    
+    void LatencyTracer::RemoveAll()
+    {
+        LOG_FUNC();
+        
+        // pick up the frames recorded since the tracer thread last polled
+        Poll(LatencyTracerTimeNs());
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        for (auto const& iPoint: m_points)
+        {
+            iPoint->RemoveProbe();
+        }
+        m_points.clear();
+        m_stagesRemoved = true;
+    }
+    
+    bool LatencyTracer::GetStats(const char* name, dsl_latency_stats* pStats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        for (auto const& iStage: m_stages)
+        {
+            if (iStage->m_name == name)
+            {
+                iStage->GetStats(pStats);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void LatencyTracer::ResetStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        for (auto const& iStage: m_stages)
+        {
+            iStage->Reset();
+        }
+    }
+    
+    bool LatencyTracer::AddStatsHandler(dsl_latency_stats_handler_cb handler, 
+        uint interval, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        if (m_statsHandlers.find(handler) != m_statsHandlers.end())
+        {   
+            LOG_ERROR("Latency stats handler is not unique");
+            return false;
+        }
+        DSL_LATENCY_STATS_HANDLER_PTR pHandler = 
+            DSL_LATENCY_STATS_HANDLER_NEW(this, handler, clientData);
+        
+        // the timer holds its own reference, released when the timer is removed
+        pHandler->timerId = g_timeout_add_full(G_PRIORITY_DEFAULT, interval, 
+            LatencyStatsHandlerTimerCB, new DSL_LATENCY_STATS_HANDLER_PTR(pHandler),
+            LatencyStatsHandlerTimerRelease);
+        m_statsHandlers[handler] = pHandler;
+        
+        return true;
+    }
+    
+    bool LatencyTracer::RemoveStatsHandler(dsl_latency_stats_handler_cb handler)
+    {
+        LOG_FUNC();
+        
+        DSL_LATENCY_STATS_HANDLER_PTR pHandler;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+            
+            auto iHandler = m_statsHandlers.find(handler);
+            if (iHandler == m_statsHandlers.end())
+            {   
+                LOG_ERROR("Latency stats handler was not found");
+                return false;
+            }
+            pHandler = iHandler->second;
+            m_statsHandlers.erase(iHandler);
+        }
+        // the timer takes the handler's mutex before m_tracerMutex, so the 
+        // handler is detached only once m_tracerMutex has been released
+        removeStatsTimer(pHandler);
+        
+        return true;
+    }
+    
+    void LatencyTracer::removeStatsTimer(DSL_LATENCY_STATS_HANDLER_PTR pHandler)
+    {
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pHandler->mutex);
+            pHandler->pTracer = NULL;
+        }
+        g_source_remove(pHandler->timerId);
+    }
+    
+    void LatencyTracer::Poll(uint64_t nowNs)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        if (m_stagesRemoved)
+        {
+            return;
+        }
+        uint drained(0);
+        for (auto iPoint = m_points.rbegin(); iPoint != m_points.rend(); iPoint++)
+        {
+            drained += (*iPoint)->Drain();
+        }
+        if (!drained)
+        {
+            return;
+        }
+        for (auto const& iStage: m_stages)
+        {
+            iStage->Update(nowNs);
+        }
+    }
+    
+    void LatencyTracer::CollectStats(std::vector<DSL_LATENCY_TRACE_STAGE_PTR>& stages,
+        std::vector<dsl_latency_stats>& stats)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracerMutex);
+        
+        // the stages are held by the caller, keeping their names valid
+        stages = m_stages;
+        for (auto const& iStage: stages)
+        {
+            dsl_latency_stats stageStats{0};
+            iStage->GetStats(&stageStats);
+            stageStats.component = (iStage->m_name.empty()) 
+                ? NULL : iStage->m_wstrName.c_str();
+            stats.push_back(stageStats);
+        }
+    }
+    
+    void LatencyTracer::RunTracer()
+    {
+        LOG_FUNC();
+        
+        while (true)
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stopMutex);
+                
+                gint64 endTime = g_get_monotonic_time() + 
+                    DSL_LATENCY_TRACER_POLL_INTERVAL * G_TIME_SPAN_MILLISECOND;
+                while (!m_stop and g_cond_wait_until(&m_stopCond, &m_stopMutex, endTime));
+                if (m_stop)
+                {
+                    return;
+                }
+            }
+            Poll(LatencyTracerTimeNs());
+        }
+    }
+    
+    static GstPadProbeReturn LatencyTracePointProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pPoint)
+    {
+        (*(DSL_LATENCY_TRACE_POINT_PTR*)pPoint)->Record(
+            GST_PAD_PROBE_INFO_BUFFER(pInfo), LatencyTracerTimeNs());
+        
+        return GST_PAD_PROBE_OK;
+    }
+    
+    static void LatencyTracePointProbeRelease(gpointer pPoint)
+    {
+        delete (DSL_LATENCY_TRACE_POINT_PTR*)pPoint;
+    }
+
+    static int LatencyStatsHandlerTimerCB(gpointer pHandler)
+    {
+        DSL_LATENCY_STATS_HANDLER_PTR pStatsHandler = 
+            *(DSL_LATENCY_STATS_HANDLER_PTR*)pHandler;
+        
+        std::vector<DSL_LATENCY_TRACE_STAGE_PTR> stages;
+        std::vector<dsl_latency_stats> stats;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pStatsHandler->mutex);
+            
+            // removed while the timer was pending, the tracer may be deleted
+            if (!pStatsHandler->pTracer)
+            {
+                return true;
+            }
+            pStatsHandler->pTracer->CollectStats(stages, stats);
+        }
+        // the client is called without the handler's mutex, so it can remove the
+        // handler, or delete the tracer, from the callback
+        if (stats.size())
+        {
+            pStatsHandler->handler(stats.data(), stats.size(), pStatsHandler->clientData);
+        }
+        return true;
+    }
+    
+    static void LatencyStatsHandlerTimerRelease(gpointer pHandler)
+    {
+        delete (DSL_LATENCY_STATS_HANDLER_PTR*)pHandler;
+    }
+    
+    static gpointer LatencyTracerThread(gpointer pTracer)
+    {
+        static_cast<LatencyTracer*>(pTracer)->RunTracer();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,539 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_LATENCY_TRACER_H
+#define _DSL_LATENCY_TRACER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_LATENCY_TRACE_POINT_PTR std::shared_ptr<LatencyTracePoint>
+    #define DSL_LATENCY_TRACE_POINT_NEW(sourceId) \
+        std::shared_ptr<LatencyTracePoint>(new LatencyTracePoint(sourceId))
+
+    #define DSL_LATENCY_TRACE_STAGE_PTR std::shared_ptr<LatencyTraceStage>
+    #define DSL_LATENCY_TRACE_STAGE_NEW(name, entries, exits) \
+        std::shared_ptr<LatencyTraceStage>(new LatencyTraceStage(name, entries, exits))
+
+    #define DSL_LATENCY_STATS_HANDLER_PTR std::shared_ptr<LatencyStatsHandler>
+    #define DSL_LATENCY_STATS_HANDLER_NEW(pTracer, handler, clientData) \
+        std::shared_ptr<LatencyStatsHandler>(new LatencyStatsHandler(pTracer, handler, clientData))
+
+    #define DSL_LATENCY_TRACER_PTR std::shared_ptr<LatencyTracer>
+    #define DSL_LATENCY_TRACER_NEW(name) \
+        std::shared_ptr<LatencyTracer>(new LatencyTracer(name))
+
+    /**
+     * @brief number of timestamps each traced pad can hold until drained
+     * by the tracer thread. Timestamps recorded while the ring is full are dropped.
+     */
+    #define DSL_LATENCY_TRACER_RING_SIZE 1024
+
+    /**
+     * @brief interval, in milliseconds, at which the tracer thread drains
+     * the pad rings and updates the latency histograms.
+     */
+    #define DSL_LATENCY_TRACER_POLL_INTERVAL 100
+
+    /**
+     * @brief time, in nanoseconds, a frame may wait for its exit timestamp
+     * before it's considered dropped by the component and forgotten.
+     */
+    #define DSL_LATENCY_TRACER_PENDING_TIMEOUT (5*GST_SECOND)
+
+    /**
+     * @brief number of linear sub-buckets per power of two in a latency
+     * histogram, bounding the reported percentiles to within 1/16th.
+     */
+    #define DSL_LATENCY_HISTOGRAM_SUB_BUCKETS 16
+    #define DSL_LATENCY_HISTOGRAM_BUCKETS (DSL_LATENCY_HISTOGRAM_SUB_BUCKETS*61)
+
+    /**
+     * @brief Gets the current monotonic time for latency tracing
+     * @return current time in nanoseconds
+     */
+    inline uint64_t LatencyTracerTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @struct LatencyStamp
+     * @brief Time at which a single frame passed a traced pad.
+     */
+    struct LatencyStamp
+    {
+        /**
+         * @brief presentation timestamp of the frame.
+         */
+        uint64_t pts;
+        
+        /**
+         * @brief unique id of the frame's source.
+         */
+        uint sourceId;
+        
+        /**
+         * @brief monotonic time the frame passed the pad, in nanoseconds.
+         */
+        uint64_t timeNs;
+    };
+
+    /**
+     * @brief identifies a frame from its source id and presentation timestamp,
+     * which is the only identity a frame keeps from its source to the Sinks.
+     */
+    typedef std::pair<uint64_t, uint> LatencyStampKey;
+    
+    struct LatencyStampKeyHash
+    {
+        size_t operator()(const LatencyStampKey& key) const
+        {
+            return std::hash<uint64_t>()(key.first * 31 + key.second);
+        }
+    };
+    
+    /**
+     * @class LatencyHistogram
+     * @brief Log-linear histogram of latencies in nanoseconds. Values under 16ns
+     * are counted exactly, larger values in 16 linear sub-buckets per power of two.
+     */
+    class LatencyHistogram
+    {
+    public:
+    
+        LatencyHistogram();
+        
+        /**
+         * @brief Adds a single latency to the histogram.
+         * @param[in] latencyNs latency to add in nanoseconds.
+         */
+        void Add(uint64_t latencyNs);
+        
+        /**
+         * @brief Clears all latencies added to the histogram.
+         */
+        void Reset();
+        
+        /**
+         * @brief Gets the number of latencies added since the last reset.
+         */
+        uint64_t GetCount()
+        {
+            return m_count;
+        }
+        
+        /**
+         * @brief Gets the largest latency added since the last reset.
+         */
+        uint64_t GetMax()
+        {
+            return m_max;
+        }
+        
+        /**
+         * @brief Gets the latency at or below which the given percentage of
+         * latencies fall, reported as the upper bound of its bucket.
+         * @param[in] percent percentile to get, from 0 to 100.
+         * @return latency in nanoseconds, 0 if the histogram is empty.
+         */
+        uint64_t GetPercentile(double percent);
+        
+        /**
+         * @brief Maps a latency to the index of the bucket that counts it.
+         */
+        static uint BucketIndex(uint64_t latencyNs);
+        
+        /**
+         * @brief Gets the largest latency counted by a bucket.
+         */
+        static uint64_t BucketUpperBound(uint index);
+        
+    private:
+    
+        std::vector<uint64_t> m_buckets;
+        
+        uint64_t m_count;
+        
+        uint64_t m_max;
+    };
+    
+    /**
+     * @class LatencyTracePoint
+     * @brief A single traced pad. The pad's buffer probe records a timestamp 
+     * for each frame into a lock-free ring that is drained by the tracer thread.
+     * The probe holds a reference to the point until it is removed from the pad.
+     */
+    class LatencyTracePoint : public std::enable_shared_from_this<LatencyTracePoint>
+    {
+    public:
+    
+        /**
+         * @brief ctor for the LatencyTracePoint class
+         * @param[in] sourceId unique id of the source for all buffers passing
+         * the pad, or -1 if the buffers are batched and the frames are read
+         * from the buffer's batch meta.
+         */
+        LatencyTracePoint(int sourceId);
+        
+        /**
+         * @brief Installs the point's buffer probe on a pad.
+         * @param[in] pPad pad to trace, the point holds a reference until removed.
+         * @return true if the probe was installed.
+         */
+        bool AddProbe(GstPad* pPad);
+        
+        /**
+         * @brief Removes the point's buffer probe if installed.
+         */
+        void RemoveProbe();
+        
+        /**
+         * @brief Records a timestamp for each frame in a buffer, called by
+         * the buffer probe on the streaming thread.
+         * @param[in] pBuffer buffer passing the traced pad.
+         * @param[in] timeNs monotonic time the buffer passed the pad.
+         */
+        void Record(GstBuffer* pBuffer, uint64_t timeNs);
+        
+        /**
+         * @brief Moves all recorded timestamps from the ring to the drained
+         * list, replacing the timestamps drained previously.
+         * @return number of timestamps drained.
+         */
+        uint Drain();
+        
+        /**
+         * @brief timestamps moved out of the ring by the last call to Drain.
+         */
+        std::vector<LatencyStamp> m_drained;
+        
+        /**
+         * @brief number of timestamps dropped while the ring was full.
+         */
+        std::atomic<uint64_t> m_dropped;
+        
+    private:
+    
+        /**
+         * @brief unique source id, or -1 for batched buffers.
+         */
+        int m_sourceId;
+        
+        /**
+         * @brief ring of timestamps waiting for the tracer thread.
+         */
+        BoundedQueue<LatencyStamp> m_ring;
+        
+        /**
+         * @brief traced pad, NULL if no probe is installed.
+         */
+        GstPad* m_pPad;
+        
+        /**
+         * @brief id of the installed buffer probe.
+         */
+        gulong m_probeId;
+    };
+    
+    /**
+     * @class LatencyTraceStage
+     * @brief A traced section of a Pipeline, a single component or end-to-end.
+     * Frames are matched from the points where they enter the stage to the
+     * points where they leave it.
+     */
+    class LatencyTraceStage
+    {
+    public:
+    
+        LatencyTraceStage(const char* name, 
+            const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& entries,
+            const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& exits);
+        
+        /**
+         * @brief Matches the timestamps last drained from the stage's exit points
+         * to those waiting from its entry points, adding each latency to the histogram.
+         * @param[in] nowNs current monotonic time, used to forget frames
+         * that never leave the stage.
+         */
+        void Update(uint64_t nowNs);
+        
+        /**
+         * @brief Fills in a client stats structure from the histogram.
+         * @param[out] pStats stats structure to fill in, the component name excluded.
+         */
+        void GetStats(dsl_latency_stats* pStats);
+
+        /**
+         * @brief Clears the histogram and all frames waiting to leave the stage.
+         */
+        void Reset();
+
+        /**
+         * @brief unique name of the traced component, empty for end-to-end.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief wide string copy of m_name for client callbacks.
+         */
+        std::wstring m_wstrName;
+        
+    private:
+    
+        std::vector<DSL_LATENCY_TRACE_POINT_PTR> m_entries;
+        
+        std::vector<DSL_LATENCY_TRACE_POINT_PTR> m_exits;
+        
+        /**
+         * @brief entry time of each frame waiting to leave the stage.
+         */
+        std::unordered_map<LatencyStampKey, uint64_t, LatencyStampKeyHash> m_pending;
+        
+        LatencyHistogram m_histogram;
+    };
+    
+    class LatencyTracer;
+    
+    /**
+     * @struct LatencyStatsHandler
+     * @brief Client callback invoked on the main loop at a fixed interval. The 
+     * handler is shared by its tracer and its timer, so that a timer callback 
+     * already running when the handler is removed never uses a deleted handler.
+     */
+    struct LatencyStatsHandler
+    {
+        LatencyStatsHandler(LatencyTracer* tracer, 
+            dsl_latency_stats_handler_cb clientHandler, void* data)
+            : pTracer(tracer)
+            , handler(clientHandler)
+            , clientData(data)
+            , timerId(0)
+        {
+            g_mutex_init(&mutex);
+        };
+        
+        ~LatencyStatsHandler()
+        {
+            g_mutex_clear(&mutex);
+        };
+        
+        /**
+         * @brief tracer to report, NULL once the handler has been removed.
+         */
+        LatencyTracer* pTracer;
+        
+        dsl_latency_stats_handler_cb handler;
+        
+        void* clientData;
+        
+        guint timerId;
+        
+        /**
+         * @brief protects pTracer, held by the timer while reading the tracer's
+         * stats so that the tracer can't be deleted until the read completes.
+         */
+        GMutex mutex;
+    };
+
+    /**
+     * @class LatencyTracer
+     * @brief Measures per-component and end-to-end latency of a Pipeline from 
+     * timestamps recorded on the pads of its components. The pads only carry
+     * probes while the tracer is attached, and all matching is done on the 
+     * tracer's own thread so the streaming threads only push to a ring.
+     */
+    class LatencyTracer
+    {
+    public:
+    
+        /**
+         * @brief ctor for the LatencyTracer class
+         * @param[in] name unique name of the Pipeline being traced.
+         */
+        LatencyTracer(const char* name);
+        
+        ~LatencyTracer();
+        
+        /**
+         * @brief Adds a new trace point, installing its probe on a pad.
+         * @param[in] pPad pad to trace, NULL to record timestamps directly.
+         * @param[in] sourceId unique source id of the pad's buffers, -1 if batched.
+         * @return shared pointer to the new point. Points must be added in 
+         * upstream-to-downstream order.
+         */
+        DSL_LATENCY_TRACE_POINT_PTR AddPoint(GstPad* pPad, int sourceId);
+        
+        /**
+         * @brief Adds a new stage between points previously added.
+         * @param[in] name unique name of the traced component, empty for end-to-end.
+         * @param[in] entries points where frames enter the stage.
+         * @param[in] exits points where frames leave the stage.
+         */
+        void AddStage(const char* name, 
+            const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& entries,
+            const std::vector<DSL_LATENCY_TRACE_POINT_PTR>& exits);
+        
+        /**
+         * @brief Removes all probes and points after a final poll, keeping the 
+         * stages and their stats until the next stage is added.
+         */
+        void RemoveAll();
+        
+        /**
+         * @brief Gets the stats for a single stage.
+         * @param[in] name name of the traced component, empty for end-to-end.
+         * @param[out] pStats stats structure to fill in, the component name excluded.
+         * @return false if the stage was not found.
+         */
+        bool GetStats(const char* name, dsl_latency_stats* pStats);
+        
+        /**
+         * @brief Clears the stats for all stages.
+         */
+        void ResetStats();
+        
+        /**
+         * @brief Adds a client handler to be called with all stats at an interval.
+         * @param[in] handler client callback function.
+         * @param[in] interval reporting interval in milliseconds.
+         * @param[in] clientData opaque pointer to the client's data.
+         * @return false if the handler is not unique.
+         */
+        bool AddStatsHandler(dsl_latency_stats_handler_cb handler, 
+            uint interval, void* clientData);
+        
+        /**
+         * @brief Removes a client handler previously added. A report already in 
+         * progress on the main loop may complete after the handler is removed.
+         * @return false if the handler was not found.
+         */
+        bool RemoveStatsHandler(dsl_latency_stats_handler_cb handler);
+        
+        /**
+         * @brief Drains all points, downstream first so that every exit timestamp
+         * is drained after its entry, and updates all stages.
+         * @param[in] nowNs current monotonic time in nanoseconds.
+         */
+        void Poll(uint64_t nowNs);
+        
+        /**
+         * @brief Gets the stats for all stages, end-to-end first, called by a
+         * handler's timer on the main loop.
+         * @param[out] stages the stages reported, holding their names valid.
+         * @param[out] stats the stats for each stage.
+         */
+        void CollectStats(std::vector<DSL_LATENCY_TRACE_STAGE_PTR>& stages,
+            std::vector<dsl_latency_stats>& stats);
+        
+        /**
+         * @brief Runs the tracer thread, polling until the tracer is deleted.
+         */
+        void RunTracer();
+        
+    private:
+    
+        std::string m_name;
+        
+        /**
+         * @brief protects the points, stages and handlers.
+         */
+        GMutex m_tracerMutex;
+        
+        /**
+         * @brief protects the stop flag, signalled by m_stopCond.
+         */
+        GMutex m_stopMutex;
+        
+        GCond m_stopCond;
+        
+        bool m_stop;
+        
+        GThread* m_pTracer;
+        
+        /**
+         * @brief all trace points in upstream-to-downstream order.
+         */
+        std::vector<DSL_LATENCY_TRACE_POINT_PTR> m_points;
+        
+        /**
+         * @brief all traced stages, end-to-end included.
+         */
+        std::vector<DSL_LATENCY_TRACE_STAGE_PTR> m_stages;
+        
+        /**
+         * @brief set on RemoveAll, the stages are cleared on the next AddStage.
+         */
+        bool m_stagesRemoved;
+        
+        /**
+         * @brief Detaches a handler from this tracer and removes its timer.
+         * Must be called without holding m_tracerMutex.
+         */
+        void removeStatsTimer(DSL_LATENCY_STATS_HANDLER_PTR pHandler);
+        
+        std::map<dsl_latency_stats_handler_cb, DSL_LATENCY_STATS_HANDLER_PTR> m_statsHandlers;
+    };
+
+    /**
+     * @brief buffer probe callback for a LatencyTracePoint.
+     * @param[in] pPad traced pad.
+     * @param[in] pInfo probe info holding the buffer.
+     * @param[in] pPoint pointer to a shared pointer to the trace point.
+     */
+    static GstPadProbeReturn LatencyTracePointProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pPoint);
+    
+    /**
+     * @brief releases the trace point reference held by a buffer probe.
+     */
+    static void LatencyTracePointProbeRelease(gpointer pPoint);
+
+    /**
+     * @brief timer callback for a client latency stats handler.
+     * @param[in] pHandler pointer to a shared pointer to the LatencyStatsHandler to call.
+     * @return true to keep the timer running, the timer is removed by the tracer.
+     */
+    static int LatencyStatsHandlerTimerCB(gpointer pHandler);
+    
+    /**
+     * @brief releases the handler reference held by a stats handler timer.
+     */
+    static void LatencyStatsHandlerTimerRelease(gpointer pHandler);
+
+    /**
+     * @brief thread function for the LatencyTracer's polling thread.
+     */
+    static gpointer LatencyTracerThread(gpointer pTracer);
+}
+
+#endif // _DSL_LATENCY_TRACER_H
@@ -29,54 +29,119 @@ GST_DEBUG_CATEGORY_EXTERN(GST_CAT_DSL);
 
 #include "Dsl.h"
 
+/**
+ * Logging levels, matching GstDebugLevel, for use with DSL_LOG_MIN_LEVEL.
+ */
+#define DSL_LOG_LEVEL_NONE      0
+#define DSL_LOG_LEVEL_ERROR     1
+#define DSL_LOG_LEVEL_WARN      2
+#define DSL_LOG_LEVEL_INFO      4
+#define DSL_LOG_LEVEL_DEBUG     5
+
+/**
+ * The least severe level compiled in. Calls below this level are stripped 
+ * entirely, and their message arguments are not evaluated. 
+ * e.g. -DDSL_LOG_MIN_LEVEL=DSL_LOG_LEVEL_WARN keeps only WARN and ERROR.
+ */
+#ifndef DSL_LOG_MIN_LEVEL
+    #ifdef GST_DISABLE_GST_DEBUG
+        #define DSL_LOG_MIN_LEVEL DSL_LOG_LEVEL_NONE
+    #else
+        #define DSL_LOG_MIN_LEVEL DSL_LOG_LEVEL_DEBUG
+    #endif
+#endif
+
 namespace DSL
 {
 
 /**
- * Logs the Entry and Exit of a Function with the DEBUG level.
- * Add macro as the first statement to each function of interest.
- * Consider the intrussion/penalty of this call when adding.
+ * Runtime check of a level against the DSL category's threshold. The global 
+ * minimum is checked first, so a disabled level costs a single branch.
+ * The message is only formatted if the level is enabled.
  */
-#define LOG_FUNC() LogFunc lf(__METHOD_NAME__)
+#define LOG_ENABLED(level) \
+    (G_UNLIKELY((level) <= _gst_debug_min) and G_LIKELY(GST_CAT_DSL != NULL) and \
+    (level) <= gst_debug_category_get_threshold(GST_CAT_DSL))
 
 #define LOG(message, level) \
     do \
     { \
-        std::stringstream logMessage; \
-        logMessage  << " : " << message; \
-        GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, logMessage.str().c_str(), NULL); \
+        if (LOG_ENABLED(level)) \
+        { \
+            std::stringstream logMessage; \
+            logMessage  << " : " << message; \
+            GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, "%s", logMessage.str().c_str()); \
+        } \
     } while (0)
 
+#if DSL_LOG_MIN_LEVEL >= DSL_LOG_LEVEL_DEBUG
+
+/**
+ * Logs the Entry and Exit of a Function with the DEBUG level.
+ * Add macro as the first statement to each function of interest.
+ * The method name is only formatted if the DEBUG level is enabled.
+ */
+#define LOG_FUNC() LogFunc lf(__PRETTY_FUNCTION__)
+
 #define LOG_DEBUG(message) LOG(message, GST_LEVEL_DEBUG)
 
+#else
+
+#define LOG_FUNC()
+
+#define LOG_DEBUG(message)
+
+#endif
+
+#if DSL_LOG_MIN_LEVEL >= DSL_LOG_LEVEL_INFO
 #define LOG_INFO(message) LOG(message, GST_LEVEL_INFO)
+#else
+#define LOG_INFO(message)
+#endif
 
+#if DSL_LOG_MIN_LEVEL >= DSL_LOG_LEVEL_WARN
 #define LOG_WARN(message) LOG(message, GST_LEVEL_WARNING)
+#else
+#define LOG_WARN(message)
+#endif
 
+#if DSL_LOG_MIN_LEVEL >= DSL_LOG_LEVEL_ERROR
 #define LOG_ERROR(message) LOG(message, GST_LEVEL_ERROR)
+#else
+#define LOG_ERROR(message)
+#endif
  
     /**
      * @class LogFunc
-     * @brief Used to log entry and exit of a function.
+     * @brief Used to log entry and exit of a function. The level is checked 
+     * once on entry, and the method name formatted only if enabled.
      */
     class LogFunc
     {
     public:
-        LogFunc(const std::string& method) 
+        LogFunc(const char* prettyFunction) 
+            : m_enabled(LOG_ENABLED(GST_LEVEL_DEBUG))
         {
-            m_logMessage  << method;
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (G_UNLIKELY(m_enabled))
+            {
+                m_method = methodName(prettyFunction);
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%s", m_method.c_str());
+            }
         };
         
         ~LogFunc()
         {
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (G_UNLIKELY(m_enabled))
+            {
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%s", m_method.c_str());
+            }
         };
         
     private:
-        std::stringstream m_logMessage; 
+        bool m_enabled;
+        std::string m_method; 
     };
 
 } // namespace 
@@ -0,0 +1,753 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslMetaRecorder.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace DSL
+{
+    /**
+     * @brief maximum number of bytes for a single varint.
+     */
+    static const size_t MAX_VARINT_SIZE = 10;
+    
+    /**
+     * @brief maximum number of bytes encoded for the fixed parts of a record, 
+     * frame, object, classifier and label, including a truncated label string.
+     */
+    static const size_t MAX_ENCODED_RECORD_HEADER = 5 + MAX_VARINT_SIZE;
+    static const size_t MAX_ENCODED_FRAME = 14*MAX_VARINT_SIZE;
+    static const size_t MAX_ENCODED_STRING = MAX_VARINT_SIZE + DSL_META_RECORDING_MAX_LABEL_SIZE;
+    static const size_t MAX_ENCODED_OBJECT = 4*MAX_VARINT_SIZE + 6*sizeof(float) + MAX_ENCODED_STRING;
+    static const size_t MAX_ENCODED_CLASSIFIER = 2*MAX_VARINT_SIZE;
+    static const size_t MAX_ENCODED_LABEL = 2*MAX_VARINT_SIZE + sizeof(float) + MAX_ENCODED_STRING;
+    
+    static inline uint64_t zigzagEncode(int64_t value)
+    {
+        return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+    }
+    
+    static inline int64_t zigzagDecode(uint64_t value)
+    {
+        return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+    }
+    
+    /**
+     * @brief Appends an unsigned integer as a little-endian base 128 varint
+     * @return pointer to the next byte
+     */
+    static inline uint8_t* putVarint(uint8_t* pData, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            *pData++ = (uint8_t)value | 0x80;
+            value >>= 7;
+        }
+        *pData++ = (uint8_t)value;
+        return pData;
+    }
+    
+    static inline uint8_t* putFloat(uint8_t* pData, float value)
+    {
+        memcpy(pData, &value, sizeof(value));
+        return pData + sizeof(value);
+    }
+    
+    /**
+     * @brief Appends a string as a varint length followed by its characters, 
+     * truncated to fit a DSL_META_RECORDING_MAX_LABEL_SIZE buffer when read.
+     * @return pointer to the next byte
+     */
+    static inline uint8_t* putString(uint8_t* pData, const char* pString)
+    {
+        size_t length = strnlen(pString, DSL_META_RECORDING_MAX_LABEL_SIZE-1);
+        pData = putVarint(pData, length);
+        memcpy(pData, pString, length);
+        return pData + length;
+    }
+    
+    /**
+     * @brief Reads a varint, clearing ok if it overruns the end of the data
+     */
+    static inline uint64_t getVarint(const uint8_t*& pData, const uint8_t* pEnd, bool& ok)
+    {
+        uint64_t value(0);
+        for (uint shift = 0; shift < 64; shift += 7)
+        {
+            if (pData >= pEnd)
+            {
+                break;
+            }
+            uint8_t byte = *pData++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+    
+    static inline float getFloat(const uint8_t*& pData, const uint8_t* pEnd, bool& ok)
+    {
+        float value(0);
+        if (pEnd - pData < (ptrdiff_t)sizeof(value))
+        {
+            ok = false;
+            return value;
+        }
+        memcpy(&value, pData, sizeof(value));
+        pData += sizeof(value);
+        return value;
+    }
+    
+    static inline void getString(const uint8_t*& pData, const uint8_t* pEnd, bool& ok, 
+        char* pString)
+    {
+        uint64_t length = getVarint(pData, pEnd, ok);
+        if (!ok or length >= DSL_META_RECORDING_MAX_LABEL_SIZE or 
+            (uint64_t)(pEnd - pData) < length)
+        {
+            ok = false;
+            *pString = 0;
+            return;
+        }
+        memcpy(pString, pData, length);
+        pString[length] = 0;
+        pData += length;
+    }
+    
+    /**
+     * @brief Reserves space at the end of a buffer's valid data, growing the 
+     * buffer if needed. 
+     * @return pointer to the first reserved byte
+     */
+    static inline uint8_t* reserveBytes(MetaRecorderBuffer* pBuffer, size_t count)
+    {
+        if (pBuffer->size + count > pBuffer->data.size())
+        {
+            pBuffer->data.resize(std::max(pBuffer->size + count, pBuffer->data.size()*2));
+        }
+        return &pBuffer->data[pBuffer->size];
+    }
+    
+    MetaRecorder::MetaRecorder(const char* name, const char* filePath, uint64_t maxFileSize)
+        : m_name(name)
+        , m_filePath(filePath)
+        , m_maxFileSize(maxFileSize)
+        , m_buffers(DSL_META_RECORDER_BUFFER_COUNT)
+        , m_freeBuffers(DSL_META_RECORDER_BUFFER_COUNT)
+        , m_pBuffer(NULL)
+        , m_newFilePending(true)
+        , m_nextFileIndex(0)
+        , m_fileSize(0)
+        , m_pWriteQueue(g_async_queue_new())
+        , m_pWriter(NULL)
+        , m_fd(-1)
+        , m_writeFailed(false)
+        , m_recorded(0)
+        , m_dropped(0)
+    {
+        LOG_FUNC();
+        
+        for (auto& buffer: m_buffers)
+        {
+            // headroom for the batch that takes a buffer past its hand-off size
+            buffer.data.resize(DSL_META_RECORDER_BUFFER_SIZE + DSL_META_RECORDER_BUFFER_SIZE/4);
+            m_freeBuffers.TryPush(&buffer);
+        }
+        std::string threadName = "dsl-recorder-" + m_name;
+        m_pWriter = g_thread_new(threadName.c_str(), MetaRecorderWriterThread, this);
+    }
+    
+    MetaRecorder::~MetaRecorder()
+    {
+        LOG_FUNC();
+        
+        Flush();
+        
+        // the recorder's own address is used as the stop signal, 
+        // queued behind any buffers still waiting to be written.
+        g_async_queue_push(m_pWriteQueue, this);
+        g_thread_join(m_pWriter);
+        g_async_queue_unref(m_pWriteQueue);
+    }
+    
+    bool MetaRecorder::RecordBatch(NvDsBatchMeta* pBatchMeta)
+    {
+        gint64 now = g_get_monotonic_time();
+        
+        if (m_writeFailed.exchange(false) or 
+            (m_maxFileSize and m_fileSize >= m_maxFileSize))
+        {
+            m_newFilePending = true;
+        }
+        if (m_pBuffer and (m_newFilePending or 
+            m_pBuffer->size >= DSL_META_RECORDER_BUFFER_SIZE or
+            now - m_pBuffer->startTime >= DSL_META_RECORDER_FLUSH_INTERVAL))
+        {
+            handOff();
+        }
+        if (!m_pBuffer)
+        {
+            if (!m_freeBuffers.TryPop(m_pBuffer))
+            {
+                m_pBuffer = NULL;
+                m_dropped += pBatchMeta->num_frames_in_batch;
+                return false;
+            }
+            m_pBuffer->size = 0;
+            m_pBuffer->frameCount = 0;
+            m_pBuffer->newFile = false;
+            m_pBuffer->startTime = now;
+            
+            if (m_newFilePending)
+            {
+                startFile();
+            }
+        }
+        size_t startSize = m_pBuffer->size;
+        m_pBuffer->frameCount += encodeBatch(pBatchMeta);
+        m_fileSize += m_pBuffer->size - startSize;
+        
+        return true;
+    }
+    
+    void MetaRecorder::Flush()
+    {
+        LOG_FUNC();
+        
+        handOff();
+    }
+    
+    void MetaRecorder::GetMetrics(uint64_t* recorded, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *recorded = m_recorded;
+        *dropped = m_dropped;
+    }
+    
+    void MetaRecorder::startFile()
+    {
+        MetaRecordingHeader header = {};
+        strncpy(header.magic, DSL_META_RECORDING_MAGIC, sizeof(header.magic));
+        header.version = DSL_META_RECORDING_VERSION;
+        header.headerSize = sizeof(header);
+        header.fileIndex = m_nextFileIndex;
+        header.createdTime = g_get_real_time();
+        
+        memcpy(reserveBytes(m_pBuffer, sizeof(header)), &header, sizeof(header));
+        m_pBuffer->size += sizeof(header);
+        m_pBuffer->newFile = true;
+        m_pBuffer->fileIndex = m_nextFileIndex++;
+        
+        m_fileSize = sizeof(header);
+        m_sources.clear();
+        m_newFilePending = false;
+    }
+    
+    uint MetaRecorder::encodeBatch(NvDsBatchMeta* pBatchMeta)
+    {
+        uint frameCount(0);
+        for (NvDsMetaList* pFrameList = pBatchMeta->frame_meta_list; 
+            pFrameList; pFrameList = pFrameList->next)
+        {
+            frameCount++;
+        }
+        
+        // the record's size is written once the record has been encoded
+        size_t recordOffset = m_pBuffer->size;
+        uint8_t* pData = reserveBytes(m_pBuffer, MAX_ENCODED_RECORD_HEADER) + sizeof(uint32_t);
+        *pData++ = DSL_META_RECORD_TYPE_BATCH;
+        pData = putVarint(pData, frameCount);
+        m_pBuffer->size = pData - &m_pBuffer->data[0];
+        
+        for (NvDsMetaList* pFrameList = pBatchMeta->frame_meta_list; 
+            pFrameList; pFrameList = pFrameList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameList->data);
+            
+            uint displayCounts[6] = {0};
+            for (NvDsMetaList* pDisplayList = pFrameMeta->display_meta_list; 
+                pDisplayList; pDisplayList = pDisplayList->next)
+            {
+                NvDsDisplayMeta* pDisplayMeta = (NvDsDisplayMeta*)(pDisplayList->data);
+                displayCounts[0]++;
+                displayCounts[1] += pDisplayMeta->num_rects;
+                displayCounts[2] += pDisplayMeta->num_labels;
+                displayCounts[3] += pDisplayMeta->num_lines;
+                displayCounts[4] += pDisplayMeta->num_arrows;
+                displayCounts[5] += pDisplayMeta->num_circles;
+            }
+            uint objectCount(0);
+            for (NvDsMetaList* pObjectList = pFrameMeta->obj_meta_list; 
+                pObjectList; pObjectList = pObjectList->next)
+            {
+                objectCount++;
+            }
+            
+            // frame numbers and timestamps as the difference from the source's
+            // previous frame in this file, all zero for the source's first frame.
+            MetaRecordingSource& source = m_sources[pFrameMeta->source_id];
+            
+            pData = reserveBytes(m_pBuffer, MAX_ENCODED_FRAME);
+            pData = putVarint(pData, pFrameMeta->source_id);
+            pData = putVarint(pData, pFrameMeta->batch_id);
+            pData = putVarint(pData, zigzagEncode(pFrameMeta->frame_num - source.frameNum));
+            pData = putVarint(pData, zigzagEncode((int64_t)(pFrameMeta->buf_pts - source.bufPts)));
+            pData = putVarint(pData, 
+                zigzagEncode((int64_t)(pFrameMeta->ntp_timestamp - source.ntpTimestamp)));
+            pData = putVarint(pData, pFrameMeta->source_frame_width);
+            pData = putVarint(pData, pFrameMeta->source_frame_height);
+            for (uint count: displayCounts)
+            {
+                pData = putVarint(pData, count);
+            }
+            pData = putVarint(pData, objectCount);
+            m_pBuffer->size = pData - &m_pBuffer->data[0];
+            
+            source.frameNum = pFrameMeta->frame_num;
+            source.bufPts = pFrameMeta->buf_pts;
+            source.ntpTimestamp = pFrameMeta->ntp_timestamp;
+            
+            for (NvDsMetaList* pObjectList = pFrameMeta->obj_meta_list; 
+                pObjectList; pObjectList = pObjectList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectList->data);
+
+                uint classifierCount(0);
+                for (NvDsMetaList* pClassifierList = pObjectMeta->classifier_meta_list;
+                    pClassifierList; pClassifierList = pClassifierList->next)
+                {
+                    classifierCount++;
+                }
+                
+                pData = reserveBytes(m_pBuffer, MAX_ENCODED_OBJECT);
+                pData = putVarint(pData, zigzagEncode(pObjectMeta->class_id));
+                
+                // untracked objects, UINT64_MAX, wrap to 0 in a single byte
+                pData = putVarint(pData, pObjectMeta->object_id + 1);
+                pData = putVarint(pData, zigzagEncode(pObjectMeta->unique_component_id));
+                pData = putFloat(pData, pObjectMeta->confidence);
+                pData = putFloat(pData, pObjectMeta->tracker_confidence);
+                pData = putFloat(pData, pObjectMeta->rect_params.left);
+                pData = putFloat(pData, pObjectMeta->rect_params.top);
+                pData = putFloat(pData, pObjectMeta->rect_params.width);
+                pData = putFloat(pData, pObjectMeta->rect_params.height);
+                pData = putString(pData, pObjectMeta->obj_label);
+                pData = putVarint(pData, classifierCount);
+                m_pBuffer->size = pData - &m_pBuffer->data[0];
+                
+                for (NvDsMetaList* pClassifierList = pObjectMeta->classifier_meta_list;
+                    pClassifierList; pClassifierList = pClassifierList->next)
+                {
+                    NvDsClassifierMeta* pClassifierMeta = 
+                        (NvDsClassifierMeta*)(pClassifierList->data);
+                        
+                    uint labelCount(0);
+                    for (NvDsMetaList* pLabelList = pClassifierMeta->label_info_list;
+                        pLabelList; pLabelList = pLabelList->next)
+                    {
+                        labelCount++;
+                    }
+                    pData = reserveBytes(m_pBuffer, MAX_ENCODED_CLASSIFIER);
+                    pData = putVarint(pData, zigzagEncode(pClassifierMeta->unique_component_id));
+                    pData = putVarint(pData, labelCount);
+                    m_pBuffer->size = pData - &m_pBuffer->data[0];
+                    
+                    for (NvDsMetaList* pLabelList = pClassifierMeta->label_info_list;
+                        pLabelList; pLabelList = pLabelList->next)
+                    {
+                        NvDsLabelInfo* pLabelInfo = (NvDsLabelInfo*)(pLabelList->data);
+                        
+                        // labels too long for result_label are only in pResult_label
+                        const char* pLabel = pLabelInfo->result_label;
+                        if (!*pLabel and pLabelInfo->pResult_label)
+                        {
+                            pLabel = pLabelInfo->pResult_label;
+                        }
+                        pData = reserveBytes(m_pBuffer, MAX_ENCODED_LABEL);
+                        pData = putVarint(pData, pLabelInfo->result_class_id);
+                        pData = putVarint(pData, pLabelInfo->label_id);
+                        pData = putFloat(pData, pLabelInfo->result_prob);
+                        pData = putString(pData, pLabel);
+                        m_pBuffer->size = pData - &m_pBuffer->data[0];
+                    }
+                }
+            }
+        }
+        uint32_t recordSize = m_pBuffer->size - recordOffset - sizeof(uint32_t);
+        memcpy(&m_pBuffer->data[recordOffset], &recordSize, sizeof(recordSize));
+        
+        return frameCount;
+    }
+    
+    void MetaRecorder::handOff()
+    {
+        if (!m_pBuffer)
+        {
+            return;
+        }
+        if (m_pBuffer->size)
+        {
+            g_async_queue_push(m_pWriteQueue, m_pBuffer);
+        }
+        else
+        {
+            m_freeBuffers.TryPush(m_pBuffer);
+        }
+        m_pBuffer = NULL;
+    }
+    
+    void MetaRecorder::RunWriter()
+    {
+        while (true)
+        {
+            gpointer pItem = g_async_queue_pop(m_pWriteQueue);
+            if (pItem == this)
+            {
+                break;
+            }
+            MetaRecorderBuffer* pBuffer = static_cast<MetaRecorderBuffer*>(pItem);
+            
+            if (pBuffer->newFile)
+            {
+                if (m_fd >= 0)
+                {
+                    close(m_fd);
+                }
+                std::string filePath(m_filePath);
+                if (pBuffer->fileIndex)
+                {
+                    filePath += "." + std::to_string(pBuffer->fileIndex);
+                }
+                m_fd = open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if (m_fd < 0)
+                {
+                    LOG_ERROR("MetaRecorder '" << m_name 
+                        << "' failed to create recording file '" << filePath << "'");
+                    m_writeFailed = true;
+                }
+            }
+            if (m_fd < 0)
+            {
+                // discarded until the streaming thread starts a new file
+                m_dropped += pBuffer->frameCount;
+            }
+            else if (writeAll(m_fd, &pBuffer->data[0], pBuffer->size))
+            {
+                m_recorded += pBuffer->frameCount;
+            }
+            else
+            {
+                LOG_ERROR("MetaRecorder '" << m_name << "' failed to write recording file");
+                close(m_fd);
+                m_fd = -1;
+                m_dropped += pBuffer->frameCount;
+                m_writeFailed = true;
+            }
+            m_freeBuffers.TryPush(pBuffer);
+        }
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+    }
+    
+    bool MetaRecorder::writeAll(int fd, const uint8_t* pData, size_t size)
+    {
+        while (size)
+        {
+            ssize_t written = write(fd, pData, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            pData += written;
+            size -= written;
+        }
+        return true;
+    }
+    
+    static gpointer MetaRecorderWriterThread(gpointer pRecorder)
+    {
+        static_cast<MetaRecorder*>(pRecorder)->RunWriter();
+        
+        return NULL;
+    }
+    
+    MetaRecordingReader::MetaRecordingReader(const char* filePath)
+        : m_filePath(filePath)
+        , m_isValid(false)
+        , m_fileIndex(0)
+        , m_fd(-1)
+        , m_pData(NULL)
+        , m_size(0)
+        , m_offset(0)
+        , m_nextFrame(0)
+    {
+        LOG_FUNC();
+        
+        m_isValid = openFile(m_filePath, true);
+    }
+    
+    MetaRecordingReader::~MetaRecordingReader()
+    {
+        LOG_FUNC();
+        
+        closeFile();
+    }
+    
+    bool MetaRecordingReader::NextFrame(dsl_meta_recording_frame* pFrame)
+    {
+        if (!fillFrames())
+        {
+            return false;
+        }
+        *pFrame = m_frames[m_nextFrame++];
+        return true;
+    }
+    
+    bool MetaRecordingReader::NextBatch(const dsl_meta_recording_frame** ppFrames, 
+        uint* pFrameCount)
+    {
+        if (!fillFrames())
+        {
+            return false;
+        }
+        *ppFrames = &m_frames[m_nextFrame];
+        *pFrameCount = m_frames.size() - m_nextFrame;
+        m_nextFrame = m_frames.size();
+        return true;
+    }
+    
+    bool MetaRecordingReader::fillFrames()
+    {
+        while (m_nextFrame >= m_frames.size())
+        {
+            if (!m_pData)
+            {
+                return false;
+            }
+            if (!decodeBatch())
+            {
+                // every file can be read on its own, so a damaged file
+                // only ends its own part of the recording
+                closeFile();
+                std::string nextFilePath = m_filePath + "." + std::to_string(m_fileIndex+1);
+                if (openFile(nextFilePath, false))
+                {
+                    m_fileIndex++;
+                }
+            }
+        }
+        return true;
+    }
+    
+    bool MetaRecordingReader::openFile(const std::string& filePath, bool required)
+    {
+        m_fd = open(filePath.c_str(), O_RDONLY);
+        if (m_fd < 0)
+        {
+            if (required)
+            {
+                LOG_ERROR("Failed to open Meta Recording file '" << filePath << "'");
+            }
+            return false;
+        }
+        struct stat info;
+        if (fstat(m_fd, &info) != 0 or (size_t)info.st_size < sizeof(MetaRecordingHeader))
+        {
+            LOG_ERROR("File '" << filePath << "' is not a Meta Recording file");
+            closeFile();
+            return false;
+        }
+        void* pMap = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, m_fd, 0);
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map Meta Recording file '" << filePath << "'");
+            closeFile();
+            return false;
+        }
+        m_pData = (const uint8_t*)pMap;
+        m_size = info.st_size;
+        
+        const MetaRecordingHeader* pHeader = (const MetaRecordingHeader*)m_pData;
+        if (strncmp(pHeader->magic, DSL_META_RECORDING_MAGIC, sizeof(pHeader->magic)) or 
+            pHeader->version != DSL_META_RECORDING_VERSION or
+            pHeader->headerSize < sizeof(MetaRecordingHeader) or 
+            pHeader->headerSize > m_size)
+        {
+            LOG_ERROR("File '" << filePath << "' is not a compatible Meta Recording file");
+            closeFile();
+            return false;
+        }
+        m_offset = pHeader->headerSize;
+        m_sources.clear();
+        
+        madvise(pMap, m_size, MADV_SEQUENTIAL);
+        return true;
+    }
+    
+    void MetaRecordingReader::closeFile()
+    {
+        if (m_pData)
+        {
+            munmap((void*)m_pData, m_size);
+            m_pData = NULL;
+        }
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+        m_size = 0;
+        m_offset = 0;
+    }
+    
+    bool MetaRecordingReader::decodeBatch()
+    {
+        m_frames.clear();
+        m_objects.clear();
+        m_labels.clear();
+        m_nextFrame = 0;
+        
+        while (m_offset + sizeof(uint32_t) < m_size)
+        {
+            uint32_t recordSize;
+            memcpy(&recordSize, m_pData + m_offset, sizeof(recordSize));
+            if (!recordSize or recordSize > m_size - m_offset - sizeof(uint32_t))
+            {
+                LOG_WARN("Meta Recording '" << m_filePath 
+                    << "' ends with a truncated record in file " << m_fileIndex);
+                return false;
+            }
+            const uint8_t* pData = m_pData + m_offset + sizeof(uint32_t);
+            const uint8_t* pEnd = pData + recordSize;
+            m_offset += sizeof(uint32_t) + recordSize;
+            
+            if (*pData++ != DSL_META_RECORD_TYPE_BATCH)
+            {
+                continue;
+            }
+            bool ok(true);
+            uint64_t frameCount = getVarint(pData, pEnd, ok);
+            for (uint64_t i = 0; ok and i < frameCount; i++)
+            {
+                dsl_meta_recording_frame frame = {0};
+                frame.source_id = getVarint(pData, pEnd, ok);
+                frame.batch_id = getVarint(pData, pEnd, ok);
+                
+                MetaRecordingSource& source = m_sources[frame.source_id];
+                source.frameNum += zigzagDecode(getVarint(pData, pEnd, ok));
+                source.bufPts += (uint64_t)zigzagDecode(getVarint(pData, pEnd, ok));
+                source.ntpTimestamp += (uint64_t)zigzagDecode(getVarint(pData, pEnd, ok));
+                frame.frame_num = source.frameNum;
+                frame.buf_pts = source.bufPts;
+                frame.ntp_timestamp = source.ntpTimestamp;
+                
+                frame.source_frame_width = getVarint(pData, pEnd, ok);
+                frame.source_frame_height = getVarint(pData, pEnd, ok);
+                frame.display_meta_count = getVarint(pData, pEnd, ok);
+                frame.display_rect_count = getVarint(pData, pEnd, ok);
+                frame.display_label_count = getVarint(pData, pEnd, ok);
+                frame.display_line_count = getVarint(pData, pEnd, ok);
+                frame.display_arrow_count = getVarint(pData, pEnd, ok);
+                frame.display_circle_count = getVarint(pData, pEnd, ok);
+                frame.object_count = getVarint(pData, pEnd, ok);
+                
+                for (uint j = 0; ok and j < frame.object_count; j++)
+                {
+                    dsl_meta_recording_object object;
+                    object.class_id = zigzagDecode(getVarint(pData, pEnd, ok));
+                    object.object_id = getVarint(pData, pEnd, ok) - 1;
+                    object.unique_component_id = zigzagDecode(getVarint(pData, pEnd, ok));
+                    object.confidence = getFloat(pData, pEnd, ok);
+                    object.tracker_confidence = getFloat(pData, pEnd, ok);
+                    object.left = getFloat(pData, pEnd, ok);
+                    object.top = getFloat(pData, pEnd, ok);
+                    object.width = getFloat(pData, pEnd, ok);
+                    object.height = getFloat(pData, pEnd, ok);
+                    getString(pData, pEnd, ok, object.label);
+                    object.label_count = 0;
+                    object.labels = NULL;
+                    
+                    uint64_t classifierCount = getVarint(pData, pEnd, ok);
+                    for (uint64_t k = 0; ok and k < classifierCount; k++)
+                    {
+                        int uniqueComponentId = zigzagDecode(getVarint(pData, pEnd, ok));
+                        uint64_t labelCount = getVarint(pData, pEnd, ok);
+                        for (uint64_t l = 0; ok and l < labelCount; l++)
+                        {
+                            dsl_meta_recording_label label;
+                            label.unique_component_id = uniqueComponentId;
+                            label.result_class_id = getVarint(pData, pEnd, ok);
+                            label.label_id = getVarint(pData, pEnd, ok);
+                            label.result_prob = getFloat(pData, pEnd, ok);
+                            getString(pData, pEnd, ok, label.result_label);
+                            m_labels.push_back(label);
+                            object.label_count++;
+                        }
+                    }
+                    m_objects.push_back(object);
+                }
+                m_frames.push_back(frame);
+            }
+            if (!ok)
+            {
+                LOG_ERROR("Meta Recording '" << m_filePath 
+                    << "' has a corrupt record in file " << m_fileIndex);
+                m_frames.clear();
+                return false;
+            }
+            
+            // objects and labels are stored in order, so can now be assigned
+            uint nextObject(0), nextLabel(0);
+            for (auto& frame: m_frames)
+            {
+                frame.objects = (frame.object_count) ? &m_objects[nextObject] : NULL;
+                for (uint j = 0; j < frame.object_count; j++)
+                {
+                    dsl_meta_recording_object& object = m_objects[nextObject++];
+                    object.labels = (object.label_count) ? &m_labels[nextLabel] : NULL;
+                    nextLabel += object.label_count;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+}
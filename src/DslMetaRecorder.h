@@ -0,0 +1,462 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_META_RECORDER_H
+#define _DSL_META_RECORDER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_RECORDER_PTR std::shared_ptr<MetaRecorder>
+    #define DSL_META_RECORDER_NEW(name, filePath, maxFileSize) \
+        std::shared_ptr<MetaRecorder>(new MetaRecorder(name, filePath, maxFileSize))
+
+    #define DSL_META_RECORDING_READER_PTR std::shared_ptr<MetaRecordingReader>
+    #define DSL_META_RECORDING_READER_NEW(filePath) \
+        std::shared_ptr<MetaRecordingReader>(new MetaRecordingReader(filePath))
+
+    /**
+     * @brief identifies a file as a Meta Recording, followed by the format version.
+     */
+    #define DSL_META_RECORDING_MAGIC "DSLMREC"
+    #define DSL_META_RECORDING_VERSION 1
+    
+    /**
+     * @brief record types. Readers skip records of an unknown type.
+     */
+    #define DSL_META_RECORD_TYPE_BATCH 1
+    
+    /**
+     * @brief number of preallocated recorder buffers. The streaming thread encodes
+     * into one buffer while the writer thread writes the others. Batches recorded 
+     * while all other buffers are waiting to be written are dropped.
+     */
+    #define DSL_META_RECORDER_BUFFER_COUNT 4
+    
+    /**
+     * @brief number of encoded bytes that hands a buffer to the writer thread.
+     */
+    #define DSL_META_RECORDER_BUFFER_SIZE (1024*1024)
+    
+    /**
+     * @brief age of the oldest encoded batch, in microseconds, that hands a buffer
+     * to the writer thread, checked as each batch is recorded.
+     */
+    #define DSL_META_RECORDER_FLUSH_INTERVAL 1000000
+
+    /**
+     * @struct MetaRecordingHeader
+     * @brief Fixed size header at the start of every Meta Recording file. The header 
+     * is followed by records, each a little-endian uint32 size, a uint8 record type, 
+     * and size-1 bytes of record data. Every file can be read on its own.
+     */
+    struct MetaRecordingHeader
+    {
+        /**
+         * @brief DSL_META_RECORDING_MAGIC, null terminated.
+         */
+        char magic[8];
+        
+        /**
+         * @brief DSL_META_RECORDING_VERSION of the writer.
+         */
+        uint32_t version;
+        
+        /**
+         * @brief size of this header, records start at this offset.
+         */
+        uint32_t headerSize;
+        
+        /**
+         * @brief rotation index of the file, 0 for the first file.
+         */
+        uint32_t fileIndex;
+        
+        /**
+         * @brief reserved for future use, 0.
+         */
+        uint32_t reserved;
+        
+        /**
+         * @brief wall clock time the file was started, in microseconds since the epoch.
+         */
+        uint64_t createdTime;
+    };
+    
+    /**
+     * @struct MetaRecorderBuffer
+     * @brief Preallocated buffer of encoded batch records, written by the writer thread
+     * with a single write call.
+     */
+    struct MetaRecorderBuffer
+    {
+        /**
+         * @brief encoded data, only the first size bytes are valid.
+         */
+        std::vector<uint8_t> data;
+        
+        /**
+         * @brief number of valid bytes in data.
+         */
+        size_t size;
+        
+        /**
+         * @brief number of frames encoded in data.
+         */
+        uint frameCount;
+        
+        /**
+         * @brief if true, data starts a new file with index fileIndex.
+         */
+        bool newFile;
+        uint fileIndex;
+        
+        /**
+         * @brief monotonic time the first batch was encoded, in microseconds.
+         */
+        gint64 startTime;
+    };
+    
+    /**
+     * @struct MetaRecordingSource
+     * @brief Previous timestamps of a source, for delta encoding and decoding. 
+     * Reset at the start of each file.
+     */
+    struct MetaRecordingSource
+    {
+        int64_t frameNum;
+        uint64_t bufPts;
+        uint64_t ntpTimestamp;
+    };
+
+    /**
+     * @class MetaRecorder
+     * @brief Records the metadata of each batch to a compact binary recording. The 
+     * streaming thread encodes each batch into the current buffer, with frame numbers and 
+     * timestamps delta encoded per source and all integers as varints, and hands the buffer
+     * to a background writer thread once full or aged, so no file I/O is done while 
+     * streaming. The recording is rotated to <filePath>.<n> at the first batch after the 
+     * current file reaches its maximum size, or after a failed write.
+     */
+    class MetaRecorder
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaRecorder class, starts the writer thread.
+         * @param[in] name name of the owner, used for logging and the thread name
+         * @param[in] filePath path of the first recording file
+         * @param[in] maxFileSize maximum size of each file in bytes, 0 for no limit
+         */
+        MetaRecorder(const char* name, const char* filePath, uint64_t maxFileSize);
+        
+        /**
+         * @brief dtor for the MetaRecorder class. Writes all encoded batches, 
+         * stops the writer thread, and closes the current file. 
+         */
+        ~MetaRecorder();
+        
+        /**
+         * @brief Encodes all frames in a batch into the current buffer. Called on 
+         * the streaming thread, and never concurrently with Flush.
+         * @param[in] pBatchMeta batch meta of the current buffer
+         * @return true if encoded, false if dropped.
+         */
+        bool RecordBatch(NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Hands the current buffer to the writer thread, if not empty. 
+         * Called once streaming has stopped, and never concurrently with RecordBatch.
+         */
+        void Flush();
+        
+        /**
+         * @brief Gets the current metrics for the recorder
+         * @param[out] recorded number of frames written to file
+         * @param[out] dropped number of frames dropped plus the number of frames lost
+         * to failed writes
+         */
+        void GetMetrics(uint64_t* recorded, uint64_t* dropped);
+        
+        /**
+         * @brief Writer loop, writes queued buffers until stopped.
+         */
+        void RunWriter();
+        
+    private:
+    
+        /**
+         * @brief Starts a new file in the current buffer, writing the file header
+         * and resetting the delta encoding state of all sources.
+         */
+        void startFile();
+    
+        /**
+         * @brief Encodes all frames in a batch as one record in the current buffer
+         * @param[in] pBatchMeta batch meta to encode
+         * @return number of frames encoded
+         */
+        uint encodeBatch(NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Hands the current buffer to the writer thread if not empty,
+         * otherwise returns it to the free list.
+         */
+        void handOff();
+    
+        /**
+         * @brief Writes a buffer to a file, retrying on partial writes
+         * @return true if all bytes were written, false otherwise.
+         */
+        bool writeAll(int fd, const uint8_t* pData, size_t size);
+        
+        /**
+         * @brief unique name of the owner of this MetaRecorder
+         */
+        std::string m_name;
+        
+        /**
+         * @brief path of the first recording file.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief maximum size of each file in bytes, 0 for no limit.
+         */
+        uint64_t m_maxFileSize;
+        
+        /**
+         * @brief all preallocated buffers.
+         */
+        std::vector<MetaRecorderBuffer> m_buffers;
+        
+        /**
+         * @brief free buffers, lock-free for the streaming thread.
+         */
+        BoundedQueue<MetaRecorderBuffer*> m_freeBuffers;
+        
+        /**
+         * @brief buffer currently being encoded into, streaming thread only.
+         */
+        MetaRecorderBuffer* m_pBuffer;
+        
+        /**
+         * @brief true if the next buffer must start a new file, streaming thread only.
+         */
+        bool m_newFilePending;
+        
+        /**
+         * @brief index of the next file to start, streaming thread only.
+         */
+        uint m_nextFileIndex;
+        
+        /**
+         * @brief number of bytes encoded for the current file, streaming thread only.
+         */
+        uint64_t m_fileSize;
+        
+        /**
+         * @brief delta encoding state by source id, streaming thread only.
+         */
+        std::unordered_map<uint, MetaRecordingSource> m_sources;
+        
+        /**
+         * @brief queue of buffers waiting to be written.
+         */
+        GAsyncQueue* m_pWriteQueue;
+        
+        /**
+         * @brief writer thread, started on construction.
+         */
+        GThread* m_pWriter;
+        
+        /**
+         * @brief file descriptor of the current file, writer thread only.
+         */
+        int m_fd;
+        
+        /**
+         * @brief set by the writer thread when a file can't be written, buffers are 
+         * then discarded until the streaming thread starts a new file.
+         */
+        std::atomic<bool> m_writeFailed;
+        
+        /**
+         * @brief number of frames written to file.
+         */
+        std::atomic<uint64_t> m_recorded;
+        
+        /**
+         * @brief number of frames dropped for lack of a free buffer, 
+         * plus the number of frames lost to failed writes.
+         */
+        std::atomic<uint64_t> m_dropped;
+    };
+    
+    /**
+     * @brief Thread function for the MetaRecorder's writer thread
+     * @param[in] pRecorder pointer to the MetaRecorder that owns the thread.
+     */
+    static gpointer MetaRecorderWriterThread(gpointer pRecorder);
+    
+    /**
+     * @class MetaRecordingReader
+     * @brief Maps the files of a recording read-only, one at a time, to read its 
+     * frames in order. Continues with <filePath>.<n> once a file has been read. 
+     */
+    class MetaRecordingReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Meta Recording Reader class. The Reader is left
+         * invalid if the first file can not be mapped or is not a recording.
+         * @param[in] filePath path of the first file of the recording
+         */
+        MetaRecordingReader(const char* filePath);
+        
+        /**
+         * @brief dtor for the Meta Recording Reader class
+         */
+        ~MetaRecordingReader();
+        
+        /**
+         * @brief Gets the valid state of the Reader, must be checked before use
+         * @return true if the first file was mapped and is a compatible recording
+         */
+        bool IsValid()
+        {
+            return m_isValid;
+        }
+        
+        /**
+         * @brief Reads the next frame of the recording. The frame's objects and 
+         * labels are valid until the next call.
+         * @param[out] pFrame the next frame
+         * @return true if read, false once all frames have been read, or if the
+         * remainder of the recording is truncated or corrupt.
+         */
+        bool NextFrame(dsl_meta_recording_frame* pFrame);
+        
+        /**
+         * @brief Reads the remaining frames of the current batch, or of the next
+         * batch once all frames of the current batch have been read. The frames, 
+         * objects and labels are valid until the next call.
+         * @param[out] ppFrames the frames of the batch
+         * @param[out] pFrameCount number of frames in ppFrames
+         * @return true if read, false once all batches have been read, or if the
+         * remainder of the recording is truncated or corrupt.
+         */
+        bool NextBatch(const dsl_meta_recording_frame** ppFrames, uint* pFrameCount);
+        
+    private:
+    
+        /**
+         * @brief Decodes batches, continuing with the next file as needed, 
+         * until there is at least one unread frame.
+         * @return true if a frame is ready, false at the end of the recording.
+         */
+        bool fillFrames();
+    
+        /**
+         * @brief Maps a recording file and checks its header
+         * @param[in] filePath path of the file to map
+         * @param[in] required if false, a missing file is not logged as an error
+         * @return true if mapped and compatible, false otherwise.
+         */
+        bool openFile(const std::string& filePath, bool required);
+        
+        /**
+         * @brief Unmaps and closes the current file
+         */
+        void closeFile();
+        
+        /**
+         * @brief Decodes the next batch record of the current file
+         * @return true if decoded, false at the end of the file or on error.
+         */
+        bool decodeBatch();
+        
+        /**
+         * @brief path of the first file of the recording.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief true if the first file was mapped and is a compatible recording.
+         */
+        bool m_isValid;
+        
+        /**
+         * @brief rotation index of the current file.
+         */
+        uint m_fileIndex;
+        
+        /**
+         * @brief file descriptor of the current file.
+         */
+        int m_fd;
+        
+        /**
+         * @brief mapped contents of the current file, NULL if none.
+         */
+        const uint8_t* m_pData;
+        
+        /**
+         * @brief size of the current file in bytes.
+         */
+        size_t m_size;
+        
+        /**
+         * @brief offset of the next record in the current file.
+         */
+        size_t m_offset;
+        
+        /**
+         * @brief delta decoding state by source id, reset for each file.
+         */
+        std::unordered_map<uint, MetaRecordingSource> m_sources;
+        
+        /**
+         * @brief decoded frames of the current batch, and the index of the next to return.
+         */
+        std::vector<dsl_meta_recording_frame> m_frames;
+        uint m_nextFrame;
+        
+        /**
+         * @brief decoded objects and labels of the current batch.
+         */
+        std::vector<dsl_meta_recording_object> m_objects;
+        std::vector<dsl_meta_recording_label> m_labels;
+    };
+}
+
+#endif // _DSL_META_RECORDER_H
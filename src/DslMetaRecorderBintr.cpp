@@ -0,0 +1,132 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslMetaRecorderBintr.h"
+#include "DslBranchBintr.h"
+
+namespace DSL
+{
+
+    MetaRecorderBintr::MetaRecorderBintr(const char* name, 
+        const char* filePath, uint64_t maxFileSize)
+        : Bintr(name)
+    {
+        LOG_FUNC();
+
+        m_pRecorder = DSL_META_RECORDER_NEW(name, filePath, maxFileSize);
+        
+        m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "meta-recorder-queue");
+        
+        Bintr::AddChild(m_pQueue);
+
+        m_pQueue->AddGhostPadToParent("sink");
+        m_pQueue->AddGhostPadToParent("src");
+
+        m_pSrcPadProbe = DSL_PAD_PROBE_NEW("meta-recorder-src-pad-probe", "src", m_pQueue);
+        
+        if (!AddBatchMetaHandler(DSL_PAD_SRC, MetaRecorderPadBufferHandler, this))
+        {
+            LOG_ERROR("MetaRecorderBintr '" << m_name 
+                << "' failed to add probe buffer handler on create");
+            throw;
+        }
+    }
+
+    MetaRecorderBintr::~MetaRecorderBintr()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {    
+            UnlinkAll();
+        }
+    }
+
+    bool MetaRecorderBintr::AddToParent(DSL_BASE_PTR pParentBintr)
+    {
+        LOG_FUNC();
+        
+        // add 'this' meta-recorder to the Parent Pipeline 
+        return std::dynamic_pointer_cast<BranchBintr>(pParentBintr)->
+            AddMetaRecorderBintr(shared_from_this());
+    }
+    
+    bool MetaRecorderBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("MetaRecorderBintr '" << m_name << "' is already linked");
+            return false;
+        }
+
+        // single element, nothing to link
+        m_isLinked = true;
+        
+        return true;
+    }
+    
+    void MetaRecorderBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("MetaRecorderBintr '" << m_name << "' is not linked");
+            return;
+        }
+        // streaming has stopped, so the recorded batches can be written 
+        // without waiting for the next batch or the flush interval.
+        m_pRecorder->Flush();
+        
+        // single element, nothing to unlink
+        m_isLinked = false;
+    }
+    
+    void MetaRecorderBintr::GetMetrics(uint64_t* recorded, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        m_pRecorder->GetMetrics(recorded, dropped);
+    }
+    
+    bool MetaRecorderBintr::HandlePadBuffer(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (pBatchMeta)
+        {
+            m_pRecorder->RecordBatch(pBatchMeta);
+        }
+        return true;
+    }
+    
+    static boolean MetaRecorderPadBufferHandler(void* pBuffer, void* user_data)
+    {
+        return static_cast<MetaRecorderBintr*>(user_data)->
+            HandlePadBuffer((GstBuffer*)pBuffer);
+    }
+}
@@ -0,0 +1,111 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_META_RECORDER_BINTR_H
+#define _DSL_META_RECORDER_BINTR_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslElementr.h"
+#include "DslBintr.h"
+#include "DslMetaRecorder.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_RECORDER_BINTR_PTR std::shared_ptr<MetaRecorderBintr>
+    #define DSL_META_RECORDER_BINTR_NEW(name, filePath, maxFileSize) \
+        std::shared_ptr<MetaRecorderBintr>(new MetaRecorderBintr(name, filePath, maxFileSize))
+
+    /**
+     * @class MetaRecorderBintr
+     * @brief Records the metadata of each batch passing through the Branch, 
+     * as it is after all upstream components, including any ODE Handler.
+     */
+    class MetaRecorderBintr : public Bintr
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the MetaRecorderBintr class
+         * @param[in] name unique name for the Meta Recorder
+         * @param[in] filePath path of the first recording file
+         * @param[in] maxFileSize maximum size of each recording file in bytes, 0 for no limit
+         */
+        MetaRecorderBintr(const char* name, const char* filePath, uint64_t maxFileSize);
+
+        ~MetaRecorderBintr();
+
+        /**
+         * @brief Adds the MetaRecorderBintr to a Parent Pipeline Bintr
+         * @param[in] pParentBintr Parent Pipeline to add this Bintr to
+         */
+        bool AddToParent(DSL_BASE_PTR pParentBintr);
+
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr, and hands all
+         * recorded batches to the writer thread.
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Gets the current metrics for the Recorder
+         * @param[out] recorded number of frames written to the recording
+         * @param[out] dropped number of frames dropped
+         */
+        void GetMetrics(uint64_t* recorded, uint64_t* dropped);
+        
+        /**
+         * @brief Handles a Pad buffer by recording its batch meta
+         * @param pBuffer Pad buffer
+         * @return true to continue handling
+         */
+        bool HandlePadBuffer(GstBuffer* pBuffer);
+
+    private:
+    
+        /**
+         * @brief Queue Elementr as both Sink and Source for this MetaRecorderBintr
+         */
+        DSL_ELEMENT_PTR m_pQueue;
+        
+        /**
+         * @brief encodes and writes the recording.
+         */
+        DSL_META_RECORDER_PTR m_pRecorder;
+    };
+    
+    static boolean MetaRecorderPadBufferHandler(void* pBuffer, void* user_data);
+}
+
+#endif // _DSL_META_RECORDER_BINTR_H
@@ -0,0 +1,226 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslMetaReplay.h"
+
+#include <random>
+
+namespace DSL
+{
+    /**
+     * @brief release function for the batch meta attached to a replay buffer
+     */
+    static void MetaReplayBatchMetaRelease(gpointer data, gpointer user_data)
+    {
+        nvds_destroy_batch_meta((NvDsBatchMeta*)data);
+    }
+    
+    GstBuffer* MetaReplayBufferNew(const dsl_meta_recording_frame* pFrames, 
+        uint frameCount, uint maxBatchSize)
+    {
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsBatchMeta* pBatchMeta = 
+            nvds_create_batch_meta(std::max(maxBatchSize, frameCount));
+        
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL, 
+            NULL, MetaReplayBatchMetaRelease);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        for (uint i = 0; i < frameCount; i++)
+        {
+            const dsl_meta_recording_frame& frame = pFrames[i];
+            
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = frame.source_id;
+            pFrameMeta->pad_index = frame.source_id;
+            pFrameMeta->batch_id = frame.batch_id;
+            pFrameMeta->frame_num = frame.frame_num;
+            pFrameMeta->buf_pts = frame.buf_pts;
+            pFrameMeta->ntp_timestamp = frame.ntp_timestamp;
+            pFrameMeta->source_frame_width = frame.source_frame_width;
+            pFrameMeta->source_frame_height = frame.source_frame_height;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            
+            for (uint j = 0; j < frame.object_count; j++)
+            {
+                const dsl_meta_recording_object& object = frame.objects[j];
+                
+                NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+                pObjectMeta->object_id = object.object_id;
+                pObjectMeta->class_id = object.class_id;
+                pObjectMeta->unique_component_id = object.unique_component_id;
+                pObjectMeta->confidence = object.confidence;
+                pObjectMeta->tracker_confidence = object.tracker_confidence;
+                pObjectMeta->rect_params.left = object.left;
+                pObjectMeta->rect_params.top = object.top;
+                pObjectMeta->rect_params.width = object.width;
+                pObjectMeta->rect_params.height = object.height;
+                strncpy(pObjectMeta->obj_label, object.label, 
+                    sizeof(pObjectMeta->obj_label)-1);
+                
+                // labels are recorded in classifier order, so each run of labels
+                // with the same component id is the output of one classifier
+                NvDsClassifierMeta* pClassifierMeta(NULL);
+                for (uint k = 0; k < object.label_count; k++)
+                {
+                    const dsl_meta_recording_label& label = object.labels[k];
+                    
+                    if (!pClassifierMeta or 
+                        pClassifierMeta->unique_component_id != label.unique_component_id)
+                    {
+                        pClassifierMeta = nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+                        pClassifierMeta->unique_component_id = label.unique_component_id;
+                        nvds_add_classifier_meta_to_object(pObjectMeta, pClassifierMeta);
+                    }
+                    NvDsLabelInfo* pLabelInfo = nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+                    pLabelInfo->result_class_id = label.result_class_id;
+                    pLabelInfo->label_id = label.label_id;
+                    pLabelInfo->result_prob = label.result_prob;
+                    strncpy(pLabelInfo->result_label, label.result_label, 
+                        sizeof(pLabelInfo->result_label)-1);
+                    nvds_add_label_info_meta_to_classifier(pClassifierMeta, pLabelInfo);
+                }
+                nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+            }
+        }
+        return pBuffer;
+    }
+    
+    //*********************************************************************************
+
+    MetaReplayScenario::MetaReplayScenario(uint sourceCount, uint objectsPerFrame, 
+        uint classCount, uint64_t batchCount)
+        : m_sourceCount(sourceCount)
+        , m_objectsPerFrame(objectsPerFrame)
+        , m_classCount(std::max(classCount, 1U))
+        , m_batchCount(batchCount)
+        , m_batchNum(0)
+    {
+        LOG_FUNC();
+        
+        m_frames.resize(m_sourceCount);
+        m_objects.resize(m_sourceCount*m_objectsPerFrame);
+        m_speeds.resize(m_objects.size());
+        
+        Reset();
+    }
+    
+    MetaReplayScenario::~MetaReplayScenario()
+    {
+        LOG_FUNC();
+    }
+    
+    void MetaReplayScenario::Reset()
+    {
+        LOG_FUNC();
+        
+        // fixed seed, so every run of the scenario generates the same batches
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> size(20, 200);
+        std::uniform_real_distribution<float> speed(-8, 8);
+        std::uniform_real_distribution<float> confidence(0.2, 1.0);
+        
+        for (uint i = 0; i < m_objects.size(); i++)
+        {
+            dsl_meta_recording_object& object = m_objects[i];
+            
+            object = {0};
+            object.object_id = i;
+            object.class_id = (i % m_objectsPerFrame) % m_classCount;
+            object.confidence = confidence(random);
+            object.tracker_confidence = object.confidence;
+            object.width = size(random);
+            object.height = size(random);
+            object.left = std::uniform_real_distribution<float>(0,
+                DSL_META_REPLAY_SCENARIO_WIDTH - object.width)(random);
+            object.top = std::uniform_real_distribution<float>(0,
+                DSL_META_REPLAY_SCENARIO_HEIGHT - object.height)(random);
+            m_speeds[i] = std::make_pair(speed(random), speed(random));
+        }
+        m_batchNum = 0;
+    }
+    
+    bool MetaReplayScenario::NextBatch(const dsl_meta_recording_frame** ppFrames, 
+        uint* pFrameCount)
+    {
+        if (m_batchCount and m_batchNum >= m_batchCount)
+        {
+            return false;
+        }
+        uint64_t pts = m_batchNum * GST_SECOND * 
+            DSL_META_REPLAY_SCENARIO_FPS_D / DSL_META_REPLAY_SCENARIO_FPS_N;
+            
+        for (uint source = 0; source < m_sourceCount; source++)
+        {
+            dsl_meta_recording_frame& frame = m_frames[source];
+            
+            frame = {0};
+            frame.source_id = source;
+            frame.batch_id = source;
+            frame.frame_num = m_batchNum;
+            frame.buf_pts = pts;
+            frame.ntp_timestamp = pts;
+            frame.source_frame_width = DSL_META_REPLAY_SCENARIO_WIDTH;
+            frame.source_frame_height = DSL_META_REPLAY_SCENARIO_HEIGHT;
+            frame.object_count = m_objectsPerFrame;
+            frame.objects = (m_objectsPerFrame) 
+                ? &m_objects[source*m_objectsPerFrame] : NULL;
+            
+            // objects are first seen where Reset placed them
+            if (m_batchNum)
+            {
+                for (uint i = source*m_objectsPerFrame; 
+                    i < (source+1)*m_objectsPerFrame; i++)
+                {
+                    moveObject(m_objects[i], m_speeds[i].first, m_speeds[i].second);
+                }
+            }
+        }
+        m_batchNum++;
+        
+        *ppFrames = m_frames.data();
+        *pFrameCount = m_frames.size();
+        return true;
+    }
+    
+    void MetaReplayScenario::moveObject(dsl_meta_recording_object& object, 
+        float& dx, float& dy)
+    {
+        if (object.left + dx < 0 or 
+            object.left + object.width + dx > DSL_META_REPLAY_SCENARIO_WIDTH)
+        {
+            dx = -dx;
+        }
+        if (object.top + dy < 0 or 
+            object.top + object.height + dy > DSL_META_REPLAY_SCENARIO_HEIGHT)
+        {
+            dy = -dy;
+        }
+        object.left += dx;
+        object.top += dy;
+    }
+}
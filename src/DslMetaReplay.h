@@ -0,0 +1,151 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_META_REPLAY_H
+#define _DSL_META_REPLAY_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_REPLAY_SCENARIO_PTR std::shared_ptr<MetaReplayScenario>
+    #define DSL_META_REPLAY_SCENARIO_NEW(sourceCount, objectsPerFrame, classCount, batchCount) \
+        std::shared_ptr<MetaReplayScenario>(new MetaReplayScenario( \
+            sourceCount, objectsPerFrame, classCount, batchCount))
+
+    /**
+     * @brief frame dimensions and frame rate of all synthetic scenario frames.
+     */
+    #define DSL_META_REPLAY_SCENARIO_WIDTH 1920
+    #define DSL_META_REPLAY_SCENARIO_HEIGHT 1080
+    #define DSL_META_REPLAY_SCENARIO_FPS_N 30
+    #define DSL_META_REPLAY_SCENARIO_FPS_D 1
+    
+    /**
+     * @brief Creates a new, zero sized GstBuffer with an NvDsBatchMeta rebuilt
+     * from recorded frames, allocated in host memory. The frame, object and classifier 
+     * meta are rebuilt as recorded; display meta, which is only recorded as counts,
+     * is not. No GPU is required to create or use the buffer.
+     * @param[in] pFrames recorded frames of one batch, in batch order
+     * @param[in] frameCount number of frames in pFrames
+     * @param[in] maxBatchSize maximum number of frames in a batch of the recording
+     * @return new GstBuffer, to be released by the caller with gst_buffer_unref
+     */
+    GstBuffer* MetaReplayBufferNew(const dsl_meta_recording_frame* pFrames, 
+        uint frameCount, uint maxBatchSize);
+
+    /**
+     * @class MetaReplayScenario
+     * @brief Generates a synthetic recording in memory, one batch at a time, with 
+     * tracked Objects that move across each frame of every Source. The same 
+     * parameters always generate the same batches.
+     */
+    class MetaReplayScenario
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaReplayScenario class
+         * @param[in] sourceCount number of Sources, i.e. frames in each batch
+         * @param[in] objectsPerFrame number of Objects in each frame
+         * @param[in] classCount number of Class Ids, evenly spread over the Objects
+         * @param[in] batchCount number of batches to generate, 0 for no end
+         */
+        MetaReplayScenario(uint sourceCount, uint objectsPerFrame, 
+            uint classCount, uint64_t batchCount);
+        
+        ~MetaReplayScenario();
+        
+        /**
+         * @brief Restarts the scenario from its first batch
+         */
+        void Reset();
+        
+        /**
+         * @brief Generates the next batch. The frames and objects are valid until 
+         * the next call, with the same lifetime as MetaRecordingReader::NextBatch.
+         * @param[out] ppFrames the frames of the batch
+         * @param[out] pFrameCount number of frames in ppFrames
+         * @return true if generated, false once all batches have been generated.
+         */
+        bool NextBatch(const dsl_meta_recording_frame** ppFrames, uint* pFrameCount);
+        
+        /**
+         * @brief Gets the number of Sources, i.e. frames in each batch.
+         */
+        uint GetSourceCount()
+        {
+            return m_sourceCount;
+        }
+        
+    private:
+    
+        /**
+         * @brief moves an Object, bouncing off the edges of the frame
+         * @param[in,out] object the Object to move
+         * @param[in] dx distance to move in x, negated on a bounce
+         * @param[in] dy distance to move in y, negated on a bounce
+         */
+        void moveObject(dsl_meta_recording_object& object, float& dx, float& dy);
+        
+        uint m_sourceCount;
+        
+        uint m_objectsPerFrame;
+        
+        uint m_classCount;
+        
+        /**
+         * @brief number of batches to generate, 0 for no end.
+         */
+        uint64_t m_batchCount;
+        
+        /**
+         * @brief number of batches generated since the last Reset.
+         */
+        uint64_t m_batchNum;
+        
+        /**
+         * @brief frames of the current batch.
+         */
+        std::vector<dsl_meta_recording_frame> m_frames;
+        
+        /**
+         * @brief objects of all Sources, m_objectsPerFrame for each Source in order, 
+         * moved on each batch.
+         */
+        std::vector<dsl_meta_recording_object> m_objects;
+        
+        /**
+         * @brief the distance each Object in m_objects moves in x and y per batch.
+         */
+        std::vector<std::pair<float, float>> m_speeds;
+    };
+}
+
+#endif // _DSL_META_REPLAY_H
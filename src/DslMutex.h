@@ -56,6 +56,59 @@ namespace DSL
         GMutex* m_pMutex; 
     };
 
+    /**
+     * @class SeqLockSnapshot
+     * @brief Publishes a trivially copyable value from a writer to reader threads
+     * using a sequence lock. Readers never block or take a lock, they simply retry
+     * the copy if a write was in progress. Writers must be serialized by the caller.
+     */
+    template<typename T>
+    class SeqLockSnapshot
+    {
+    public:
+        SeqLockSnapshot() : m_sequence(0), m_value{} {};
+        
+        /**
+         * @brief Publishes a new value. Must not be called concurrently with itself.
+         * @param[in] value new value to publish
+         */
+        void Store(const T& value)
+        {
+            uint sequence = m_sequence.load(std::memory_order_relaxed);
+            
+            // odd sequence number indicates a write in progress
+            m_sequence.store(sequence+1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            
+            m_value = value;
+            
+            m_sequence.store(sequence+2, std::memory_order_release);
+        };
+        
+        /**
+         * @brief Reads a consistent copy of the last published value
+         * @return copy of the value
+         */
+        T Load() const
+        {
+            T value;
+            uint before(0), after(0);
+            do
+            {
+                before = m_sequence.load(std::memory_order_acquire);
+                value = m_value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = m_sequence.load(std::memory_order_relaxed);
+            } while ((before & 1) or (before != after));
+            
+            return value;
+        };
+        
+    private:
+        std::atomic<uint> m_sequence;
+        T m_value;
+    };
+
     #define UNREF_MESSAGE_ON_RETURN(message) UnrefMessageOnReturn ref(message)
 
     /**
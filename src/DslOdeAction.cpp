@@ -22,13 +22,9 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
-#include <nvbufsurftransform.h>
-#include "opencv2/imgproc/imgproc.hpp"
-#include "opencv2/imgproc/types_c.h"
-#include "opencv2/highgui/highgui.hpp"
-
 #include "Dsl.h"
 #include "DslServices.h"
+#include "DslCaptureService.h"
 #include "DslOdeTrigger.h"
 #include "DslOdeAction.h"
 
@@ -36,9 +32,15 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    thread_local uint64_t OdeAction::s_asyncEventId = 0;
+
     OdeAction::OdeAction(const char* name)
         : Base(name)
         , m_enabled(true)
+        , m_asyncEnabled(false)
+        , m_overflowPolicy(DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST)
+        , m_asyncScheduled(false)
+        , m_asyncDropped(0)
     {
     }
 
@@ -59,6 +61,198 @@ namespace DSL
         
         m_enabled = enabled;
     }
+    
+    void OdeAction::GetAsyncSettings(bool* enabled, uint* overflowPolicy)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_asyncEnabled.load();
+        *overflowPolicy = m_overflowPolicy.load();
+    }
+    
+    bool OdeAction::SetAsyncSettings(bool enabled, uint overflowPolicy)
+    {
+        LOG_FUNC();
+        
+        if (enabled and !IsAsyncCapable())
+        {
+            LOG_ERROR("ODE Action '" << GetName() << "' can not be executed asynchronously");
+            return false;
+        }
+        if (overflowPolicy > DSL_ODE_ACTION_OVERFLOW_BLOCK)
+        {
+            LOG_ERROR("Invalid overflow policy " << overflowPolicy 
+                << " for ODE Action '" << GetName() << "'");
+            return false;
+        }
+        // The queue is created once and never released while the Action lives,
+        // so the streaming thread can use it without a lock once enabled is seen.
+        if (enabled and !m_pAsyncQueue)
+        {
+            m_pAsyncQueue = std::unique_ptr<BoundedQueue<OdeActionEvent>>(
+                new BoundedQueue<OdeActionEvent>(DSL_ODE_ACTION_ASYNC_QUEUE_SIZE));
+        }
+        m_overflowPolicy.store(overflowPolicy);
+        m_asyncEnabled.store(enabled, std::memory_order_release);
+        return true;
+    }
+    
+    uint64_t OdeAction::GetAsyncDropped()
+    {
+        LOG_FUNC();
+        
+        return m_asyncDropped.load();
+    }
+    
+    void OdeAction::GetMetrics(dsl_ode_action_metrics* metrics)
+    {
+        LOG_FUNC();
+        
+        m_metrics.Get(metrics);
+        metrics->async_dropped = m_asyncDropped.load();
+    }
+    
+    void OdeAction::ResetMetrics()
+    {
+        LOG_FUNC();
+        
+        m_metrics.Reset();
+        m_asyncDropped.store(0);
+    }
+    
+    uint64_t OdeAction::getEventId()
+    {
+        return (s_asyncEventId) ? s_asyncEventId : OdeTrigger::s_eventId;
+    }
+    
+    void OdeAction::DispatchOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_asyncEnabled.load(std::memory_order_acquire))
+        {
+            uint64_t startTimeNs = OdeMetricsTimeNs();
+            HandleOccurrence(pOdeTrigger, pBuffer, pFrameMeta, pObjectMeta);
+            m_metrics.AddInvocation(OdeMetricsTimeNs() - startTimeNs);
+            return;
+        }
+        // no need to copy and queue the occurrence only to do nothing with it
+        if (m_enabled)
+        {
+            queueOccurrence(pOdeTrigger, pFrameMeta, pObjectMeta);
+        }
+    }
+    
+    void OdeAction::queueOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        uint64_t eventId = OdeTrigger::s_eventId;
+        
+        // copies the occurrence directly into the queue's preallocated record
+        auto fillEvent = [&](OdeActionEvent& event)
+        {
+            event.pOdeTrigger = pOdeTrigger;
+            event.eventId = eventId;
+            
+            event.frameMeta = *pFrameMeta;
+            event.frameMeta.base_meta.batch_meta = NULL;
+            event.frameMeta.obj_meta_list = NULL;
+            event.frameMeta.display_meta_list = NULL;
+            event.frameMeta.frame_user_meta_list = NULL;
+            
+            event.hasObjectMeta = (pObjectMeta != NULL);
+            if (pObjectMeta)
+            {
+                event.objectMeta = *pObjectMeta;
+                event.objectMeta.base_meta.batch_meta = NULL;
+                event.objectMeta.parent = NULL;
+                event.objectMeta.classifier_meta_list = NULL;
+                event.objectMeta.obj_user_meta_list = NULL;
+                event.objectMeta.text_params.display_text = NULL;
+            }
+        };
+        
+        uint64_t blockedUs(0);
+        while (!m_pAsyncQueue->TryPushWith(fillEvent))
+        {
+            uint overflowPolicy = m_overflowPolicy.load(std::memory_order_relaxed);
+            
+            if (overflowPolicy == DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST)
+            {
+                m_asyncDropped++;
+                return;
+            }
+            if (overflowPolicy == DSL_ODE_ACTION_OVERFLOW_DROP_OLDEST)
+            {
+                // the pop can fail if a worker emptied the slot first, retry regardless
+                if (m_pAsyncQueue->TryPopWith([](OdeActionEvent& event)
+                    {event.pOdeTrigger = nullptr;}))
+                {
+                    m_asyncDropped++;
+                }
+                continue;
+            }
+            // DSL_ODE_ACTION_OVERFLOW_BLOCK - the Action is already scheduled
+            // if its queue is full, so wait for a worker to free a record. The 
+            // wait is bounded, as the worker may be waiting on this thread.
+            if (blockedUs >= DSL_ODE_ACTION_ASYNC_BLOCK_TIMEOUT_US)
+            {
+                LOG_WARN("ODE Action '" << GetName() 
+                    << "' dropped an occurrence after blocking on a full queue");
+                m_asyncDropped++;
+                return;
+            }
+            g_usleep(DSL_ODE_ACTION_ASYNC_BLOCK_WAIT_US);
+            blockedUs += DSL_ODE_ACTION_ASYNC_BLOCK_WAIT_US;
+        }
+        scheduleAsyncEvents();
+    }
+    
+    void OdeAction::scheduleAsyncEvents()
+    {
+        bool scheduled(false);
+        if (m_asyncScheduled.compare_exchange_strong(scheduled, true))
+        {
+            OdeActionExecutor::GetExecutor()->Schedule(shared_from_this());
+        }
+    }
+    
+    void OdeAction::ExecuteAsyncEvents()
+    {
+        // Events are moved out of the queue before execution so that a slow
+        // Action frees its queue record immediately for the next occurrence.
+        for (uint i = 0; i < DSL_ODE_ACTION_ASYNC_MAX_BATCH; i++)
+        {
+            if (!m_pAsyncQueue->TryPop(m_asyncEvent))
+            {
+                break;
+            }
+            s_asyncEventId = m_asyncEvent.eventId;
+            uint64_t startTimeNs = OdeMetricsTimeNs();
+            try
+            {
+                HandleOccurrence(m_asyncEvent.pOdeTrigger, NULL, &m_asyncEvent.frameMeta,
+                    (m_asyncEvent.hasObjectMeta) ? &m_asyncEvent.objectMeta : NULL);
+            }
+            catch(...)
+            {
+                LOG_ERROR("ODE Action '" << GetName() << "' threw exception handling async event");
+            }
+            m_metrics.AddInvocation(OdeMetricsTimeNs() - startTimeNs);
+            s_asyncEventId = 0;
+            
+            // release the Trigger now rather than when the record is reused
+            m_asyncEvent.pOdeTrigger = nullptr;
+        }
+        m_asyncScheduled.store(false);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        
+        // reschedule if events remain, or were queued after the last pop
+        // but before the scheduled flag was cleared.
+        if (m_pAsyncQueue->Size())
+        {
+            scheduleAsyncEvents();
+        }
+    }
 
     // ********************************************************************
 
@@ -86,7 +280,7 @@ namespace DSL
         try
         {
             DSL_ODE_TRIGGER_PTR pTrigger = std::dynamic_pointer_cast<OdeTrigger>(pBase);
-            m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), pBuffer,
+            m_clientHandler(getEventId(), pTrigger->m_wName.c_str(), pBuffer,
                 pFrameMeta, pObjectMeta, m_clientData);
         }
         catch(...)
@@ -97,6 +291,152 @@ namespace DSL
 
     // ********************************************************************
 
+    /**
+     * @brief Fills a fixed-layout occurrence record from the meta that triggered the event
+     */
+    static void fillOccurrenceRecord(dsl_ode_occurrence_record& record, uint64_t eventId,
+        uint triggerIndex, NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        record.event_id = eventId;
+        record.ntp_timestamp = pFrameMeta->ntp_timestamp;
+        record.trigger_index = triggerIndex;
+        record.source_id = pFrameMeta->source_id;
+        record.frame_num = pFrameMeta->frame_num;
+        
+        if (pObjectMeta)
+        {
+            record.object_id = pObjectMeta->object_id;
+            record.class_id = pObjectMeta->class_id;
+            record.confidence = pObjectMeta->confidence;
+            record.left = pObjectMeta->rect_params.left;
+            record.top = pObjectMeta->rect_params.top;
+            record.width = pObjectMeta->rect_params.width;
+            record.height = pObjectMeta->rect_params.height;
+            record.is_object = true;
+        }
+        else
+        {
+            record.object_id = UINT64_MAX;
+            record.class_id = -1;
+            record.confidence = 0;
+            record.left = record.top = record.width = record.height = 0;
+            record.is_object = false;
+        }
+    }
+
+    OdeTriggerIndexTable::OdeTriggerIndexTable()
+        : m_lastTriggerIndex(0)
+    {
+        g_mutex_init(&m_tableMutex);
+    }
+
+    OdeTriggerIndexTable::~OdeTriggerIndexTable()
+    {
+        g_mutex_clear(&m_tableMutex);
+    }
+    
+    uint OdeTriggerIndexTable::Get(DSL_BASE_PTR pOdeTrigger, bool& added)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tableMutex);
+        
+        added = false;
+        
+        // Occurrences typically arrive in runs from the same Trigger
+        if (!m_pLastTrigger.owner_before(pOdeTrigger) and 
+            !pOdeTrigger.owner_before(m_pLastTrigger))
+        {
+            return m_lastTriggerIndex;
+        }
+        auto ientry = m_triggerIndices.find(pOdeTrigger->GetName());
+        if (ientry == m_triggerIndices.end())
+        {
+            std::string name(pOdeTrigger->GetName());
+            ientry = m_triggerIndices.emplace(name, m_triggerNames.size()).first;
+            m_triggerNames.emplace_back(name.begin(), name.end());
+            added = true;
+        }
+        m_pLastTrigger = pOdeTrigger;
+        m_lastTriggerIndex = ientry->second;
+        return m_lastTriggerIndex;
+    }
+    
+    const wchar_t* OdeTriggerIndexTable::GetName(uint triggerIndex)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tableMutex);
+        
+        if (triggerIndex >= m_triggerNames.size())
+        {
+            return NULL;
+        }
+        return m_triggerNames[triggerIndex].c_str();
+    }
+
+    // ********************************************************************
+
+    BatchCallbackOdeAction::BatchCallbackOdeAction(const char* name, 
+        dsl_ode_handle_occurrences_cb clientHandler, void* clientData)
+        : OdeAction(name)
+        , m_clientHandler(clientHandler)
+        , m_clientData(clientData)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_recordsMutex);
+        m_records.reserve(DSL_ODE_ACTION_CALLBACK_BATCH_INITIAL_SIZE);
+    }
+
+    BatchCallbackOdeAction::~BatchCallbackOdeAction()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_recordsMutex);
+    }
+    
+    void BatchCallbackOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_recordsMutex);
+        
+        bool added(false);
+        uint triggerIndex = m_triggerIndices.Get(pOdeTrigger, added);
+        
+        m_records.emplace_back();
+        fillOccurrenceRecord(m_records.back(), getEventId(), 
+            triggerIndex, pFrameMeta, pObjectMeta);
+    }
+    
+    void BatchCallbackOdeAction::PostProcessBatch()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_recordsMutex);
+        
+        if (m_records.empty())
+        {
+            return;
+        }
+        try
+        {
+            m_clientHandler(&m_records[0], m_records.size(), m_clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Batch Callback ODE Action '" << GetName() << "' threw exception calling client callback");
+        }
+        m_records.clear();
+    }
+    
+    const wchar_t* BatchCallbackOdeAction::GetTriggerName(uint triggerIndex)
+    {
+        LOG_FUNC();
+        
+        return m_triggerIndices.GetName(triggerIndex);
+    }
+
+    // ********************************************************************
+
     CaptureOdeAction::CaptureOdeAction(const char* name, 
         uint captureType, const char* outdir)
         : OdeAction(name)
@@ -137,89 +477,28 @@ namespace DSL
         DSL_ODE_TRIGGER_PTR pTrigger = std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
         std::string filespec = m_outdir + "/" + pTrigger->GetName() + "-" +
-            std::to_string(pTrigger->s_eventCount) + ".jpeg";
+            std::to_string(getEventId()) + ".jpeg";
 
-        NvBufSurfTransformRect src_rect = {0};
-        NvBufSurfTransformRect dst_rect = {0};
+        NvBufSurfTransformRect srcRect = {0};
 
         // capturing full frame or object only?
         if (m_captureType == DSL_CAPTURE_TYPE_FRAME)
         {
-            src_rect.width = surface->surfaceList[0].width;
-            src_rect.height = surface->surfaceList[0].height;
-            dst_rect.width = surface->surfaceList[0].width;
-            dst_rect.height = surface->surfaceList[0].height;
+            srcRect.width = surface->surfaceList[pFrameMeta->batch_id].width;
+            srcRect.height = surface->surfaceList[pFrameMeta->batch_id].height;
         }
         else
         {
-            src_rect.top = pObjectMeta->rect_params.top;
-            src_rect.left = pObjectMeta->rect_params.left;
-            src_rect.width = pObjectMeta->rect_params.width; 
-            src_rect.height = pObjectMeta->rect_params.height;
-            dst_rect.width = pObjectMeta->rect_params.width; 
-            dst_rect.height = pObjectMeta->rect_params.height;
+            srcRect.top = pObjectMeta->rect_params.top;
+            srcRect.left = pObjectMeta->rect_params.left;
+            srcRect.width = pObjectMeta->rect_params.width; 
+            srcRect.height = pObjectMeta->rect_params.height;
         }
-        NvBufSurfTransformParams bufSurfTransform;
-        bufSurfTransform.src_rect = &src_rect;
-        bufSurfTransform.dst_rect = &dst_rect;
-        bufSurfTransform.transform_flag = NVBUFSURF_TRANSFORM_CROP_SRC |
-            NVBUFSURF_TRANSFORM_CROP_DST;
-        bufSurfTransform.transform_filter = NvBufSurfTransformInter_Default;
-
-        NvBufSurface *dstSurface = NULL;
+        // The transform and copy to host memory are done before returning, 
+        // the encode and write are done by the Capture Service's workers.
+        CaptureService::GetService()->SubmitSurface(surface, 
+            pFrameMeta->batch_id, srcRect, filespec);
 
-        NvBufSurfaceCreateParams bufSurfaceCreateParams;
-
-        // An intermediate buffer for NV12/RGBA to BGR conversion
-        bufSurfaceCreateParams.gpuId = surface->gpuId;
-        bufSurfaceCreateParams.width = dst_rect.width;
-        bufSurfaceCreateParams.height = dst_rect.height;
-        bufSurfaceCreateParams.size = 0;
-        bufSurfaceCreateParams.colorFormat = NVBUF_COLOR_FORMAT_RGBA;
-        bufSurfaceCreateParams.layout = NVBUF_LAYOUT_PITCH;
-        bufSurfaceCreateParams.memType = NVBUF_MEM_DEFAULT;
-
-        cudaError_t cudaError = cudaSetDevice(surface->gpuId);
-        cudaStream_t cudaStream;
-        cudaError = cudaStreamCreate(&cudaStream);
-
-        int retval = NvBufSurfaceCreate(&dstSurface, surface->batchSize,
-            &bufSurfaceCreateParams);	
-
-        NvBufSurfTransformConfigParams bufSurfTransformConfigParams;
-        NvBufSurfTransform_Error err;
-
-        bufSurfTransformConfigParams.compute_mode = NvBufSurfTransformCompute_Default;
-        bufSurfTransformConfigParams.gpu_id = surface->gpuId;
-        bufSurfTransformConfigParams.cuda_stream = cudaStream;
-        err = NvBufSurfTransformSetSessionParams (&bufSurfTransformConfigParams);
-
-        NvBufSurfaceMemSet(dstSurface, 0, 0, 0);
-
-        err = NvBufSurfTransform (surface, dstSurface, &bufSurfTransform);
-        if (err != NvBufSurfTransformError_Success)
-        {
-            g_print ("NvBufSurfTransform failed with error %d while converting buffer\n", err);
-        }
-
-        NvBufSurfaceMap(dstSurface, 0, 0, NVBUF_MAP_READ);
-        NvBufSurfaceSyncForCpu(dstSurface, 0, 0);
-
-        cv::Mat bgr_frame = cv::Mat(cv::Size(bufSurfaceCreateParams.width,
-            bufSurfaceCreateParams.height), CV_8UC3);
-
-        cv::Mat in_mat = cv::Mat(bufSurfaceCreateParams.height, 
-            bufSurfaceCreateParams.width, CV_8UC4, 
-            dstSurface->surfaceList[0].mappedAddr.addr[0],
-            dstSurface->surfaceList[0].pitch);
-
-        cv::cvtColor (in_mat, bgr_frame, CV_RGBA2BGR);
-
-        cv::imwrite(filespec.c_str(), bgr_frame);
-
-        NvBufSurfaceUnMap(dstSurface, 0, 0);
-        NvBufSurfaceDestroy(dstSurface);
-        cudaStreamDestroy(cudaStream);
         gst_buffer_unmap(pBuffer, &inMapInfo);
     }
 
@@ -255,8 +534,28 @@ namespace DSL
         , m_offsetX(offsetX)
         , m_offsetY(offsetY)
         , m_offsetYWithClassId(offsetYWithClassId)
+        , m_textParams{0}
     {
         LOG_FUNC();
+        
+        // Setup X and Y display offsets
+        m_textParams.x_offset = m_offsetX;
+        m_textParams.y_offset = m_offsetY;
+
+        // Font, font-size, font-color
+        m_textParams.font_params.font_name = (gchar *) "Serif";
+        m_textParams.font_params.font_size = 10;
+        m_textParams.font_params.font_color.red = 1.0;
+        m_textParams.font_params.font_color.green = 1.0;
+        m_textParams.font_params.font_color.blue = 1.0;
+        m_textParams.font_params.font_color.alpha = 1.0;
+
+        // Text background color
+        m_textParams.set_bg_clr = 1;
+        m_textParams.text_bg_clr.red = 0.0;
+        m_textParams.text_bg_clr.green = 0.0;
+        m_textParams.text_bg_clr.blue = 0.0;
+        m_textParams.text_bg_clr.alpha = 1.0;
     }
 
     DisplayOdeAction::~DisplayOdeAction()
@@ -269,45 +568,23 @@ namespace DSL
     {
         if (m_enabled)
         {
-            NvDsBatchMeta* batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
-            
             DSL_ODE_TRIGGER_PTR pTrigger = std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
             
-            NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(batchMeta);
-            pDisplayMeta->num_labels = 1;
-
-            NvOSD_TextParams *pTextParams = &pDisplayMeta->text_params[0];
-            pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-            
-            std::string test = pTrigger->GetName() + " = " + std::to_string(pTrigger->m_occurrences);
-            test.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
-
-            // Setup X and Y display offsets
-            pTextParams->x_offset = m_offsetX;
-            pTextParams->y_offset = m_offsetY;
+            NvOSD_TextParams textParams = m_textParams;
             
             // Typically set if action is shared by multiple ODE Triggers/ClassId's 
             if (m_offsetYWithClassId)
             {
-                pTextParams->y_offset += pTrigger->m_classId * 30 + 2;
+                textParams.y_offset += pTrigger->m_classId * 30 + 2;
             }
-
-            // Font, font-size, font-color
-            pTextParams->font_params.font_name = (gchar *) "Serif";
-            pTextParams->font_params.font_size = 10;
-            pTextParams->font_params.font_color.red = 1.0;
-            pTextParams->font_params.font_color.green = 1.0;
-            pTextParams->font_params.font_color.blue = 1.0;
-            pTextParams->font_params.font_color.alpha = 1.0;
-
-            // Text background color
-            pTextParams->set_bg_clr = 1;
-            pTextParams->text_bg_clr.red = 0.0;
-            pTextParams->text_bg_clr.green = 0.0;
-            pTextParams->text_bg_clr.blue = 0.0;
-            pTextParams->text_bg_clr.alpha = 1.0;
             
-            nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+            // Formatted on the stack, the text is copied once by the display meta builder
+            char text[MAX_DISPLAY_LEN];
+            int length = snprintf(text, MAX_DISPLAY_LEN, "%s = %u", 
+                pTrigger->GetCStrName(), pTrigger->m_occurrences);
+                
+            OdeDisplayMetaBuilder::AddLabel(pBuffer, pFrameMeta, textParams, text, 
+                std::min(std::max(length, 0), MAX_DISPLAY_LEN-1));
         }
     }
 
@@ -355,12 +632,7 @@ namespace DSL
             {
                 return;
             }
-            NvDsBatchMeta* batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
-            NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(batchMeta);
-            
-            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = m_rectangleParams;
-            
-            nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+            OdeDisplayMetaBuilder::AddRect(pBuffer, pFrameMeta, m_rectangleParams);
         }
     }
 
@@ -393,14 +665,10 @@ namespace DSL
     {
         if (m_enabled)
         {
-            NvDsBatchMeta* batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
-            NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(batchMeta);
-            
             m_rectangleParams.width = pFrameMeta->source_frame_width;
             m_rectangleParams.height = pFrameMeta->source_frame_height;
-            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = m_rectangleParams;
             
-            nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+            OdeDisplayMetaBuilder::AddRect(pBuffer, pFrameMeta, m_rectangleParams);
         }
     }
 
@@ -467,6 +735,53 @@ namespace DSL
 
     // ********************************************************************
 
+    JournalOdeAction::JournalOdeAction(const char* name, 
+        const char* filePath, uint64_t maxSize, uint maxFiles)
+        : OdeAction(name)
+        , m_journalWriter(filePath, maxSize, maxFiles)
+    {
+        LOG_FUNC();
+    }
+
+    JournalOdeAction::~JournalOdeAction()
+    {
+        LOG_FUNC();
+    }
+    
+    void JournalOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        bool added(false);
+        uint triggerIndex = m_triggerIndices.Get(pOdeTrigger, added);
+        if (added)
+        {
+            m_journalWriter.AddTriggerName(triggerIndex, pOdeTrigger->GetName());
+        }
+        
+        // NULL only if a rotated file failed to be created, in which case the
+        // record is dropped. The error is logged once on rotation.
+        dsl_ode_occurrence_record* pRecord = m_journalWriter.ClaimRecord();
+        if (pRecord)
+        {
+            fillOccurrenceRecord(*pRecord, getEventId(), 
+                triggerIndex, pFrameMeta, pObjectMeta);
+            m_journalWriter.CommitRecord();
+        }
+    }
+    
+    uint JournalOdeAction::GetFileCount()
+    {
+        LOG_FUNC();
+        
+        return m_journalWriter.GetFileCount();
+    }
+
+    // ********************************************************************
+
     LogOdeAction::LogOdeAction(const char* name)
         : OdeAction(name)
     {
@@ -486,7 +801,7 @@ namespace DSL
             DSL_ODE_TRIGGER_PTR pTrigger = std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
             
             LOG_INFO("Trigger Name    : " << pTrigger->GetName());
-            LOG_INFO("  Unique ODE Id : " << pTrigger->s_eventCount);
+            LOG_INFO("  Unique ODE Id : " << getEventId());
             LOG_INFO("  NTP Timestamp : " << pFrameMeta->ntp_timestamp);
             LOG_INFO("  Source Data   : ------------------------");
             
@@ -579,7 +894,7 @@ namespace DSL
             DSL_ODE_TRIGGER_PTR pTrigger = std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
             
             std::cout << "Trigger Name    : " << pTrigger->GetName() << "\n";
-            std::cout << "  Unique ODE Id : " << pTrigger->s_eventCount << "\n";
+            std::cout << "  Unique ODE Id : " << getEventId() << "\n";
             std::cout << "  NTP Timestamp : " << pFrameMeta->ntp_timestamp << "\n";
             std::cout << "  Source Data   : ------------------------" << "\n";
             if (pFrameMeta->bInferDone)
@@ -28,10 +28,19 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslOdeActionExecutor.h"
+#include "DslOdeJournal.h"
+#include "DslOdeMetrics.h"
 //#include "DslOdeOccurrence.h"
 
 namespace DSL
 {
+    /**
+     * @brief initial number of records reserved by each Batch Callback Action.
+     * The record array grows as needed and is retained between batches.
+     */
+    #define DSL_ODE_ACTION_CALLBACK_BATCH_INITIAL_SIZE 256
+
     /**
      * @brief convenience macros for shared pointer abstraction
      */
@@ -41,6 +50,10 @@ namespace DSL
     #define DSL_ODE_ACTION_CALLBACK_NEW(name, clientHandler, clientData) \
         std::shared_ptr<CallbackOdeAction>(new CallbackOdeAction(name, clientHandler, clientData))
         
+    #define DSL_ODE_ACTION_CALLBACK_BATCH_PTR std::shared_ptr<BatchCallbackOdeAction>
+    #define DSL_ODE_ACTION_CALLBACK_BATCH_NEW(name, clientHandler, clientData) \
+        std::shared_ptr<BatchCallbackOdeAction>(new BatchCallbackOdeAction(name, clientHandler, clientData))
+        
     #define DSL_ODE_ACTION_CAPTURE_FRAME_PTR std::shared_ptr<CaptureFrameOdeAction>
     #define DSL_ODE_ACTION_CAPTURE_FRAME_NEW(name, outdir) \
         std::shared_ptr<CaptureFrameOdeAction>(new CaptureFrameOdeAction(name, outdir))
@@ -73,6 +86,10 @@ namespace DSL
     #define DSL_ODE_ACTION_HIDE_NEW(name, text, border) \
         std::shared_ptr<HideOdeAction>(new HideOdeAction(name, text, border))
         
+    #define DSL_ODE_ACTION_JOURNAL_PTR std::shared_ptr<JournalOdeAction>
+    #define DSL_ODE_ACTION_JOURNAL_NEW(name, filePath, maxSize, maxFiles) \
+        std::shared_ptr<JournalOdeAction>(new JournalOdeAction(name, filePath, maxSize, maxFiles))
+        
     #define DSL_ODE_ACTION_LOG_PTR std::shared_ptr<LogOdeAction>
     #define DSL_ODE_ACTION_LOG_NEW(name) \
         std::shared_ptr<LogOdeAction>(new LogOdeAction(name))
@@ -135,6 +152,71 @@ namespace DSL
         
     // ********************************************************************
 
+    /**
+     * @class OdeTriggerIndexTable
+     * @brief Assigns a fixed index to each Trigger an Action receives occurrences
+     * from, in the order first seen. An Action can be added to Triggers in more
+     * than one Pipeline, so indices may be assigned and looked up from any thread.
+     */
+    class OdeTriggerIndexTable
+    {
+    public:
+    
+        OdeTriggerIndexTable();
+        
+        ~OdeTriggerIndexTable();
+        
+        /**
+         * @brief Gets the index for a given Trigger, assigning the next 
+         * index the first time the Trigger is seen.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger to look up
+         * @param[out] added set to true if the index was assigned by this call
+         * @return the Trigger's index
+         */
+        uint Get(DSL_BASE_PTR pOdeTrigger, bool& added);
+        
+        /**
+         * @brief Gets the name of the Trigger for a given index
+         * @param[in] triggerIndex index to look up
+         * @return name of the Trigger, or NULL if the index has not been assigned.
+         * The string remains valid for the life of the table.
+         */
+        const wchar_t* GetName(uint triggerIndex);
+        
+    private:
+    
+        /**
+         * @brief mutex to protect the table, and the last Trigger seen, 
+         * from concurrent assignment and lookup
+         */
+        GMutex m_tableMutex;
+        
+        /**
+         * @brief the Trigger last seen, used to avoid the map lookup for 
+         * consecutive occurrences from the same Trigger. A weak pointer is 
+         * used so the Action does not keep its parent Trigger in use.
+         */
+        std::weak_ptr<Base> m_pLastTrigger;
+        
+        /**
+         * @brief index of m_pLastTrigger
+         */
+        uint m_lastTriggerIndex;
+        
+        /**
+         * @brief map of Trigger name to assigned index
+         */
+        std::map<std::string, uint> m_triggerIndices;
+        
+        /**
+         * @brief Trigger names by index. A deque is used so 
+         * the strings returned to the client are never relocated.
+         */
+        std::deque<std::wstring> m_triggerNames;
+    };
+
+    // ********************************************************************
+
     class OdeAction : public Base
     {
     public: 
@@ -170,13 +252,146 @@ namespace DSL
          */
         virtual void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
+            
+        /**
+         * @brief Dispatches the occurrence of an ODE to the Action. The occurrence 
+         * is handled inline if the Action is synchronous, or copied and queued for
+         * the shared executor if asynchronous.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void DispatchOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Returns whether the Action can be executed off of the streaming
+         * thread. Actions that read the buffer or update its meta must override.
+         * @return true if the Action can be executed asynchronously.
+         */
+        virtual bool IsAsyncCapable()
+        {
+            return true;
+        }
+        
+        /**
+         * @brief Called by each parent Trigger once all frames in the current
+         * batch have been processed. Actions that accumulate occurrences must override.
+         */
+        virtual void PostProcessBatch(){};
+        
+        /**
+         * @brief Gets the current asynchronous execution settings
+         * @param[out] enabled true if the Action is executed asynchronously
+         * @param[out] overflowPolicy one of the DSL_ODE_ACTION_OVERFLOW constants
+         */
+        void GetAsyncSettings(bool* enabled, uint* overflowPolicy);
+        
+        /**
+         * @brief Sets the asynchronous execution settings. Events already queued
+         * are still executed if asynchronous execution is disabled.
+         * @param[in] enabled set to true to execute the Action asynchronously
+         * @param[in] overflowPolicy one of the DSL_ODE_ACTION_OVERFLOW constants
+         * @return false if the Action is not async capable or the policy is invalid
+         */
+        bool SetAsyncSettings(bool enabled, uint overflowPolicy);
+        
+        /**
+         * @brief Gets the number of events dropped by the overflow policy
+         * @return total number of dropped events
+         */
+        uint64_t GetAsyncDropped();
+        
+        /**
+         * @brief Gets the Action's performance counters, including the async dropped count
+         * @param[out] metrics client structure to fill
+         */
+        void GetMetrics(dsl_ode_action_metrics* metrics);
+        
+        /**
+         * @brief Resets the Action's performance counters, 
+         * including the async dropped count, to zero
+         */
+        void ResetMetrics();
+        
+        /**
+         * @brief Executes up to DSL_ODE_ACTION_ASYNC_MAX_BATCH queued events. 
+         * Called by the shared executor's workers only.
+         */
+        void ExecuteAsyncEvents();
         
     protected:
 
+        /**
+         * @brief Gets the unique id of the event being handled, either the current
+         * event count for synchronous Actions or the queued event's id.
+         * @return unique ODE event id
+         */
+        static uint64_t getEventId();
+
         /**
          * @brief enabled flag.
          */
         bool m_enabled;
+        
+    private:
+    
+        /**
+         * @brief Queues a copy of the occurrence, applying the overflow policy
+         * if the queue is full, and schedules the Action with the executor.
+         */
+        void queueOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Schedules the Action with the executor if not already scheduled.
+         */
+        void scheduleAsyncEvents();
+        
+        /**
+         * @brief true if the Action is executed asynchronously.
+         */
+        std::atomic<bool> m_asyncEnabled;
+        
+        /**
+         * @brief policy to apply when the queue is full, 
+         * one of the DSL_ODE_ACTION_OVERFLOW constants.
+         */
+        std::atomic<uint> m_overflowPolicy;
+        
+        /**
+         * @brief true while the Action is scheduled with, or executing on, the executor.
+         */
+        std::atomic<bool> m_asyncScheduled;
+        
+        /**
+         * @brief number of events dropped by the overflow policy.
+         */
+        std::atomic<uint64_t> m_asyncDropped;
+        
+        /**
+         * @brief performance counters, added to on every occurrence handled
+         */
+        OdeActionMetrics m_metrics;
+        
+        /**
+         * @brief preallocated event records, created once on first enable
+         * and kept for the life of the Action.
+         */
+        std::unique_ptr<BoundedQueue<OdeActionEvent>> m_pAsyncQueue;
+        
+        /**
+         * @brief record the scheduled worker executes each event from.
+         */
+        OdeActionEvent m_asyncEvent;
+        
+        /**
+         * @brief id of the queued event being executed by the current 
+         * worker thread, 0 when not executing asynchronously.
+         */
+        static thread_local uint64_t s_asyncEventId;
     };
 
     // ********************************************************************
@@ -229,6 +444,93 @@ namespace DSL
     
     // ********************************************************************
 
+    /**
+     * @class BatchCallbackOdeAction
+     * @brief Batch Callback ODE Action class. Occurrences are accumulated as fixed-layout
+     * records and the client handler is called once per batch with all records.
+     */
+    class BatchCallbackOdeAction : public OdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Batch Callback ODE Action class
+         * @param[in] name unique name for the ODE Action
+         * @param[in] clientHandler client callback function to call once per batch
+         * @param[in] clientData opaque pointer to client data to return on callback
+         */
+        BatchCallbackOdeAction(const char* name, 
+            dsl_ode_handle_occurrences_cb clientHandler, void* clientData);
+        
+        /**
+         * @brief dtor for the ODE Batch Callback Action class
+         */
+        ~BatchCallbackOdeAction();
+
+        /**
+         * @brief Handles the ODE occurrence by appending a record for the current batch
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Calls the client handler with all records accumulated for the 
+         * current batch, if any. Subsequent calls for the same batch are a no-op.
+         */
+        void PostProcessBatch();
+        
+        /**
+         * @brief Records are accumulated in batch order on the streaming thread.
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
+        
+        /**
+         * @brief Gets the name of the Trigger for a trigger_index reported in a record
+         * @param[in] triggerIndex index to look up
+         * @return name of the Trigger, or NULL if the index has not been assigned.
+         * The string remains valid for the life of the Action.
+         */
+        const wchar_t* GetTriggerName(uint triggerIndex);
+        
+    private:
+    
+        /**
+         * @brief Client Callback function to call once per batch
+         */
+        dsl_ode_handle_occurrences_cb m_clientHandler;
+        
+        /**
+         * @brief pointer to client's data returned on callback
+         */ 
+        void* m_clientData;
+        
+        /**
+         * @brief mutex to protect the records
+         */
+        GMutex m_recordsMutex;
+        
+        /**
+         * @brief records accumulated for the current batch. Cleared, but not 
+         * released, after each callback so steady state requires no allocation.
+         */
+        std::vector<dsl_ode_occurrence_record> m_records;
+        
+        /**
+         * @brief trigger_index assigned to each Trigger
+         */
+        OdeTriggerIndexTable m_triggerIndices;
+    };
+    
+    // ********************************************************************
+
     /**
      * @class CaptureOdeAction
      * @brief ODE Capture Action class
@@ -261,6 +563,15 @@ namespace DSL
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
+        /**
+         * @brief The Action reads the frame from the batched buffer and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
+        
     protected:
     
         /**
@@ -350,6 +661,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action adds display meta to the batched buffer and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
             
     private:
     
@@ -366,6 +686,11 @@ namespace DSL
          * @brief Adds an additional offset based on ODE class Id if set true
          */
         bool m_offsetYWithClassId;
+        
+        /**
+         * @brief Label position, font and colors, set on construction
+         */
+        NvOSD_TextParams m_textParams;
     
     };
 
@@ -413,6 +738,63 @@ namespace DSL
     };
     // ********************************************************************
 
+    /**
+     * @class JournalOdeAction
+     * @brief Journal ODE Action class. Appends a fixed-size binary record for each 
+     * occurrence to a memory-mapped, preallocated and size-rotated journal file.
+     */
+    class JournalOdeAction : public OdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Journal ODE Action class
+         * @param[in] name unique name for the ODE Action
+         * @param[in] filePath path of the first journal file to create
+         * @param[in] maxSize maximum size of each journal file in bytes
+         * @param[in] maxFiles maximum number of journal files to keep, 0 for no limit
+         */
+        JournalOdeAction(const char* name, const char* filePath, 
+            uint64_t maxSize, uint maxFiles);
+        
+        /**
+         * @brief dtor for the Journal ODE Action class
+         */
+        ~JournalOdeAction();
+        
+        /**
+         * @brief Handles the ODE occurrence by appending a record to the journal
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Gets the number of journal files created, including the current file
+         * @return number of files created
+         */
+        uint GetFileCount();
+
+    private:
+    
+        /**
+         * @brief writer for the journal files
+         */
+        OdeJournalWriter m_journalWriter;
+        
+        /**
+         * @brief trigger_index assigned to each Trigger, the names
+         * are stored in the header of each journal file.
+         */
+        OdeTriggerIndexTable m_triggerIndices;
+    };
+    
+    // ********************************************************************
+
     /**
      * @class LogOdeAction
      * @brief Log Ode Action class
@@ -486,6 +868,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action adds display meta to the batched buffer and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
             
     private:
     
@@ -537,6 +928,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action adds display meta to the batched buffer and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
             
     private:
     
@@ -583,6 +983,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action updates the Object's meta in place and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
             
     private:
     
@@ -625,6 +1034,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action updates the Object's meta in place and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
 
     private:
     
@@ -748,6 +1166,15 @@ namespace DSL
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief The Action updates the Object's meta in place and must run synchronously
+         * @return false always
+         */
+        bool IsAsyncCapable()
+        {
+            return false;
+        }
             
     private:
     
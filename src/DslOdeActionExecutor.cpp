@@ -0,0 +1,113 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeActionExecutor.h"
+#include "DslOdeAction.h"
+
+namespace DSL
+{
+    OdeActionExecutor* OdeActionExecutor::GetExecutor()
+    {
+        // thread safe one time initialization, stopped on exit.
+        static OdeActionExecutor executor;
+        
+        return &executor;
+    }
+    
+    OdeActionExecutor::OdeActionExecutor()
+        : m_pRunQueue(g_async_queue_new())
+    {
+        LOG_FUNC();
+        
+        uint workerCount = std::min(std::max(g_get_num_processors()/2, 1u),
+            (uint)DSL_ODE_ACTION_EXECUTOR_MAX_WORKERS);
+        
+        for (uint i = 0; i < workerCount; i++)
+        {
+            std::string threadName = "dsl-ode-action-" + std::to_string(i);
+            m_workers.push_back(g_thread_new(threadName.c_str(), 
+                OdeActionExecutorWorkerThread, this));
+        }
+        LOG_INFO("ODE Action executor started with " << workerCount << " workers");
+    }
+    
+    OdeActionExecutor::~OdeActionExecutor()
+    {
+        LOG_FUNC();
+        
+        // the executor's own address is used as the stop signal, one per worker.
+        for (uint i = 0; i < m_workers.size(); i++)
+        {
+            g_async_queue_push(m_pRunQueue, this);
+        }
+        for (auto const& ithread: m_workers)
+        {
+            g_thread_join(ithread);
+        }
+        // release any Actions still scheduled
+        gpointer pItem(NULL);
+        while ((pItem = g_async_queue_try_pop(m_pRunQueue)))
+        {
+            delete static_cast<DSL_BASE_PTR*>(pItem);
+        }
+        g_async_queue_unref(m_pRunQueue);
+    }
+    
+    void OdeActionExecutor::Schedule(DSL_BASE_PTR pOdeAction)
+    {
+        g_async_queue_push(m_pRunQueue, new DSL_BASE_PTR(pOdeAction));
+    }
+    
+    uint OdeActionExecutor::GetWorkerCount()
+    {
+        LOG_FUNC();
+        
+        return m_workers.size();
+    }
+    
+    void OdeActionExecutor::RunWorker()
+    {
+        while (true)
+        {
+            gpointer pItem = g_async_queue_pop(m_pRunQueue);
+            if (pItem == this)
+            {
+                return;
+            }
+            DSL_BASE_PTR* pOdeAction = static_cast<DSL_BASE_PTR*>(pItem);
+
+            std::dynamic_pointer_cast<OdeAction>(*pOdeAction)->ExecuteAsyncEvents();
+            delete pOdeAction;
+        }
+    }
+    
+    static gpointer OdeActionExecutorWorkerThread(gpointer pExecutor)
+    {
+        static_cast<OdeActionExecutor*>(pExecutor)->RunWorker();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_ACTION_EXECUTOR_H
+#define _DSL_ODE_ACTION_EXECUTOR_H
+
+#include "Dsl.h"
+#include "DslBase.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of preallocated event records per asynchronous ODE Action
+     */
+    #define DSL_ODE_ACTION_ASYNC_QUEUE_SIZE 256
+    
+    /**
+     * @brief maximum number of events a worker executes for one ODE Action
+     * before yielding to other scheduled Actions.
+     */
+    #define DSL_ODE_ACTION_ASYNC_MAX_BATCH 32
+    
+    /**
+     * @brief time to wait between retries when a producer is blocked 
+     * by a full queue with the DSL_ODE_ACTION_OVERFLOW_BLOCK policy.
+     */
+    #define DSL_ODE_ACTION_ASYNC_BLOCK_WAIT_US 100
+    
+    /**
+     * @brief maximum time a producer is blocked by a full queue with the
+     * DSL_ODE_ACTION_OVERFLOW_BLOCK policy before the occurrence is dropped.
+     * Bounds the wait when a worker is itself waiting on the streaming thread.
+     */
+    #define DSL_ODE_ACTION_ASYNC_BLOCK_TIMEOUT_US 1000000
+    
+    /**
+     * @brief upper limit on the number of shared executor worker threads.
+     */
+    #define DSL_ODE_ACTION_EXECUTOR_MAX_WORKERS 4
+
+    /**
+     * @struct OdeActionEvent
+     * @brief Copy of an ODE occurrence that can outlive the batched buffer. 
+     * The Frame and Object meta are copied by value with all pointers into
+     * the batch meta - lists, parent and display text - cleared.
+     */
+    struct OdeActionEvent
+    {
+        /**
+         * @brief ODE Trigger that triggered the event.
+         */
+        DSL_BASE_PTR pOdeTrigger;
+        
+        /**
+         * @brief unique ODE event id at the time of occurrence.
+         */
+        uint64_t eventId;
+        
+        /**
+         * @brief true if objectMeta holds a valid copy, false for Frame level events.
+         */
+        bool hasObjectMeta;
+        
+        /**
+         * @brief copy of the Frame meta that triggered the event.
+         */
+        NvDsFrameMeta frameMeta;
+        
+        /**
+         * @brief copy of the Object meta that triggered the event.
+         */
+        NvDsObjectMeta objectMeta;
+    };
+    
+    /**
+     * @class OdeActionExecutor
+     * @brief Shared pool of worker threads that execute asynchronous ODE Actions.
+     * ODE Actions queue their own events and schedule themselves with the executor
+     * when their queue becomes non-empty. A scheduled Action is executed by one
+     * worker at a time, so an Action's events are always handled in order.
+     */
+    class OdeActionExecutor
+    {
+    public:
+    
+        /**
+         * @brief Returns the single executor instance, starting the workers on first call.
+         * @return pointer to the executor.
+         */
+        static OdeActionExecutor* GetExecutor();
+        
+        /**
+         * @brief Schedules an ODE Action to execute its queued events on the next
+         * free worker. The executor holds a reference to the Action until executed.
+         * @param[in] pOdeAction shared pointer to the ODE Action to schedule.
+         */
+        void Schedule(DSL_BASE_PTR pOdeAction);
+        
+        /**
+         * @brief Gets the number of worker threads in the pool.
+         * @return number of workers.
+         */
+        uint GetWorkerCount();
+        
+        /**
+         * @brief Worker loop, executes scheduled ODE Actions until stopped.
+         */
+        void RunWorker();
+        
+    private:
+    
+        OdeActionExecutor();
+        
+        ~OdeActionExecutor();
+        
+        /**
+         * @brief queue of scheduled ODE Actions, each item is a heap allocated
+         * DSL_BASE_PTR owned by the queue until popped by a worker.
+         */
+        GAsyncQueue* m_pRunQueue;
+        
+        /**
+         * @brief worker threads, started on construction.
+         */
+        std::vector<GThread*> m_workers;
+    };
+    
+    /**
+     * @brief Thread function for each of the executor's workers
+     * @param[in] pExecutor pointer to the executor that owns the worker.
+     */
+    static gpointer OdeActionExecutorWorkerThread(gpointer pExecutor);
+}
+
+#endif // _DSL_ODE_ACTION_EXECUTOR_H
@@ -27,12 +27,15 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    // Initialize static Area update counter
+    std::atomic<uint64_t> OdeArea::s_updateCount(0);
 
     OdeArea::OdeArea(const char* name, 
         uint left, uint top, uint width, uint height, bool display)
         : Base(name)
         , m_rectParams{0}
         , m_display(display)
+        , m_pSourceTable(NULL)
     {
         LOG_FUNC();
         
@@ -49,6 +52,8 @@ namespace DSL
         m_rectParams.bg_color.alpha = 0.2;
 
         g_mutex_init(&m_propertyMutex);
+        
+        ReserveSources(DSL_ODE_AREA_INITIAL_SOURCES);
     }
     
     OdeArea::~OdeArea()
@@ -79,6 +84,8 @@ namespace DSL
         m_rectParams.width = width;
         m_rectParams.height = height;
         m_display = display;
+        
+        s_updateCount++;
     }
     
     void OdeArea::GetColor(double* red, double* green, double* blue, double* alpha)
@@ -100,4 +107,188 @@ namespace DSL
         m_rectParams.bg_color.blue = blue;
         m_rectParams.bg_color.alpha = alpha;
     }
-}
\ No newline at end of file
+
+    bool OdeArea::ClaimFrameDisplay(uint sourceId, int64_t frameNum)
+    {
+        OdeAreaSourceTable* pSourceTable = m_pSourceTable.load(std::memory_order_acquire);
+        if (sourceId >= pSourceTable->size)
+        {
+            ReserveSources(sourceId+1);
+            pSourceTable = m_pSourceTable.load(std::memory_order_acquire);
+        }
+        std::atomic<int64_t>& frameNumDisplayed = 
+            pSourceTable->states[sourceId].frameNumDisplayed;
+        
+        // Only the Trigger that moves the frame number forward displays the Area
+        int64_t lastFrameNum = frameNumDisplayed.load(std::memory_order_relaxed);
+        while (lastFrameNum < frameNum)
+        {
+            if (frameNumDisplayed.compare_exchange_weak(lastFrameNum, frameNum,
+                std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void OdeArea::ReserveSources(uint sourceCount)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        OdeAreaSourceTable* pCurrentTable = m_pSourceTable.load();
+        uint currentSize = pCurrentTable ? pCurrentTable->size : 0;
+        if (sourceCount <= currentSize)
+        {
+            return;
+        }
+        // Double at a minimum, so that Source Ids seen out of order grow the table once
+        uint newSize = std::max(sourceCount, currentSize*2);
+        
+        OdeAreaSourceTable* pNewTable = new OdeAreaSourceTable(newSize);
+        for (uint i = 0; i < currentSize; i++)
+        {
+            pNewTable->states[i].frameNumDisplayed.store(
+                pCurrentTable->states[i].frameNumDisplayed.load());
+        }
+        m_sourceTables.push_back(std::unique_ptr<OdeAreaSourceTable>(pNewTable));
+        
+        // A claim made on the replaced table while copying may be lost, 
+        // at worst displaying the Area twice for a single frame.
+        m_pSourceTable.store(pNewTable, std::memory_order_release);
+    }
+    
+    // *****************************************************************************
+
+    OdeAreaIndex::OdeAreaIndex()
+        : m_queryCount(0)
+        , m_columns(1)
+        , m_rows(1)
+        , m_cellWidth(1)
+        , m_cellHeight(1)
+    {
+        m_cells.resize(1);
+    }
+    
+    void OdeAreaIndex::Build(const std::vector<NvOSD_RectParams>& areas)
+    {
+        m_areas = areas;
+        m_queryStamps.assign(m_areas.size(), 0);
+        m_queryCount = 0;
+        
+        // Size the grid to the extent of all Areas, roughly two cells per Area
+        // in each dimension up to the maximum grid size.
+        uint maxRight(1), maxBottom(1);
+        for (const auto& ivec: m_areas)
+        {
+            maxRight = std::max(maxRight, (uint)std::max(0.0f, ceilf(ivec.left + ivec.width)) + 1);
+            maxBottom = std::max(maxBottom, (uint)std::max(0.0f, ceilf(ivec.top + ivec.height)) + 1);
+        }
+        uint gridSize = std::min((uint)DSL_ODE_AREA_INDEX_MAX_GRID_SIZE,
+            (uint)ceil(sqrt((double)m_areas.size())) * 2);
+            
+        m_columns = std::max(1U, std::min(gridSize, maxRight));
+        m_rows = std::max(1U, std::min(gridSize, maxBottom));
+        m_cellWidth = (maxRight + m_columns - 1) / m_columns;
+        m_cellHeight = (maxBottom + m_rows - 1) / m_rows;
+        
+        m_cells.clear();
+        m_cells.resize(m_columns*m_rows);
+        
+        for (uint i = 0; i < m_areas.size(); i++)
+        {
+            uint firstColumn, lastColumn, firstRow, lastRow;
+            getCellRange(m_areas[i], &firstColumn, &lastColumn, &firstRow, &lastRow);
+            
+            for (uint row = firstRow; row <= lastRow; row++)
+            {
+                for (uint column = firstColumn; column <= lastColumn; column++)
+                {
+                    m_cells[row*m_columns + column].push_back(i);
+                }
+            }
+        }
+    }
+    
+    bool OdeAreaIndex::Overlaps(const NvOSD_RectParams& rect)
+    {
+        // New query stamp, clearing all stamps on wrap-around
+        if (++m_queryCount == 0)
+        {
+            std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+            m_queryCount = 1;
+        }
+        
+        uint firstColumn, lastColumn, firstRow, lastRow;
+        getCellRange(rect, &firstColumn, &lastColumn, &firstRow, &lastRow);
+        
+        for (uint row = firstRow; row <= lastRow; row++)
+        {
+            for (uint column = firstColumn; column <= lastColumn; column++)
+            {
+                for (const auto& iArea: m_cells[row*m_columns + column])
+                {
+                    if (m_queryStamps[iArea] == m_queryCount)
+                    {
+                        continue;
+                    }
+                    m_queryStamps[iArea] = m_queryCount;
+                    
+                    if (DoesOverlap(rect, m_areas[iArea]))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+    
+    bool OdeAreaIndex::ConcurrentOverlaps(const NvOSD_RectParams& rect)
+    {
+        uint firstColumn, lastColumn, firstRow, lastRow;
+        getCellRange(rect, &firstColumn, &lastColumn, &firstRow, &lastRow);
+        
+        for (uint row = firstRow; row <= lastRow; row++)
+        {
+            for (uint column = firstColumn; column <= lastColumn; column++)
+            {
+                for (const auto& iArea: m_cells[row*m_columns + column])
+                {
+                    if (DoesOverlap(rect, m_areas[iArea]))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+    
+    bool OdeAreaIndex::DoesOverlap(const NvOSD_RectParams& a, const NvOSD_RectParams& b)
+    {
+        bool xOverlap = valueInRange(a.left, b.left, b.left + b.width) ||
+                        valueInRange(b.left, a.left, a.left + a.width);
+
+        bool yOverlap = valueInRange(a.top, b.top, b.top + b.height) ||
+                        valueInRange(b.top, a.top, a.top + a.height);
+
+        return xOverlap && yOverlap;
+    }
+    
+    void OdeAreaIndex::getCellRange(const NvOSD_RectParams& rect, 
+        uint* firstColumn, uint* lastColumn, uint* firstRow, uint* lastRow)
+    {
+        // normalized, a rect with a negative width or height still matches
+        // in DoesOverlap at its left and top edges
+        float left = floorf(std::min(rect.left, rect.left + rect.width)) - 1;
+        float right = ceilf(std::max(rect.left, rect.left + rect.width)) + 1;
+        float top = floorf(std::min(rect.top, rect.top + rect.height)) - 1;
+        float bottom = ceilf(std::max(rect.top, rect.top + rect.height)) + 1;
+        
+        *firstColumn = (uint)std::min((float)(m_columns - 1), std::max(0.0f, left / m_cellWidth));
+        *lastColumn = (uint)std::min((float)(m_columns - 1), std::max(0.0f, right / m_cellWidth));
+        *firstRow = (uint)std::min((float)(m_rows - 1), std::max(0.0f, top / m_cellHeight));
+        *lastRow = (uint)std::min((float)(m_rows - 1), std::max(0.0f, bottom / m_cellHeight));
+    }
+}
@@ -38,6 +38,51 @@ namespace DSL
     #define DSL_ODE_AREA_NEW(name, left, top, width, height, display) \
         std::shared_ptr<OdeArea>(new OdeArea(name, left, top, width, height, display))
 
+    /**
+     * @brief maximum number of grid columns and rows used by an OdeAreaIndex
+     */
+    #define DSL_ODE_AREA_INDEX_MAX_GRID_SIZE 32
+    
+    /**
+     * @brief initial number of Sources with per-source state in an OdeArea, 
+     * until reserved to the Stream-muxer batch size by the parent ODE Handler
+     */
+    #define DSL_ODE_AREA_INITIAL_SOURCES 8
+    
+    /**
+     * @struct OdeAreaSourceState
+     * @brief State kept by an OdeArea for each Source, indexed by Source Id.
+     * Updated by the parent Triggers from the system (callback) context.
+     */
+    struct OdeAreaSourceState
+    {
+        /**
+         * @brief most recent frame number the Area was displayed on, -1 if none
+         */
+        std::atomic<int64_t> frameNumDisplayed;
+    };
+    
+    /**
+     * @struct OdeAreaSourceTable
+     * @brief Fixed size array of per-source state, replaced with a larger copy
+     * when a Source Id is out of range.
+     */
+    struct OdeAreaSourceTable
+    {
+        OdeAreaSourceTable(uint size)
+            : size(size)
+            , states(new OdeAreaSourceState[size])
+        {
+            for (uint i = 0; i < size; i++)
+            {
+                states[i].frameNumDisplayed.store(-1);
+            }
+        };
+        
+        uint size;
+        std::unique_ptr<OdeAreaSourceState[]> states;
+    };
+
     class OdeArea : public Base
     {
     public: 
@@ -96,6 +141,28 @@ namespace DSL
          */
         void SetColor(double red, double green, double blue, double alpha);
         
+        /**
+         * @brief total count of all Area updates, incremented on every call to
+         * SetArea. Allows the parent Triggers to know when to rebuild their index.
+         */
+        static std::atomic<uint64_t> s_updateCount;
+        
+        /**
+         * @brief Claims the display of the Area on a Source's frame, so that a 
+         * shared Area is added to the display meta by only the first of its 
+         * Triggers to process the frame. Called from the system (callback) context.
+         * @param[in] sourceId Source Id of the frame
+         * @param[in] frameNum frame number of the frame
+         * @return true if claimed, false if already claimed for this or a later frame
+         */
+        bool ClaimFrameDisplay(uint sourceId, int64_t frameNum);
+        
+        /**
+         * @brief Reserves per-source state for a number of Sources, 
+         * i.e. the batch size of the Stream-muxer
+         * @param[in] sourceCount number of Sources to reserve for
+         */
+        void ReserveSources(uint sourceCount);
         
        /**
          * @brief Area rectangle parameters for object detection 
@@ -107,23 +174,123 @@ namespace DSL
          */
         bool m_display;
         
+    private:
+
+        /**
+         * @brief Mutex to ensure mutual exlusion for propery get/sets
+         */
+        GMutex m_propertyMutex;
+        
+        /**
+         * @brief current per-source state table, indexed by Source Id. Shared Areas 
+         * can be updated by Triggers in different Pipelines, and so threads, at once.
+         */
+        std::atomic<OdeAreaSourceTable*> m_pSourceTable;
+        
         /**
-         * @brief updated by parent Triggers for each source/frame. Allows multiple Triggers 
-         * to know if they are the first to use the shared Area for the current source/frame, 
-         * or not. If true, i.e. m_currentFrame < FrameNumber. The Trigger can do a 
-         * once-per-frame-per-source (add area as display data) and then update the variable to 
-         * m_currentFrame = FrameNumber. Other Triggers reading the value can skip doing 
-         * the same once-per-frame operations in OdeTrigger::PreProcessFrame()
+         * @brief all source tables created, including the current. Replaced tables
+         * are kept until destruction as they may still be read by another thread.
          */
-        std::map<uint, uint64_t> m_frameNumPerSource;
+        std::vector<std::unique_ptr<OdeAreaSourceTable>> m_sourceTables;
+        
+    };
+
+    /**
+     * @class OdeAreaIndex
+     * @brief Uniform grid index, in frame coordinates, of a set of Area rectangles.
+     * Overlap queries only test the Areas registered with the grid cells covered
+     * by the query rectangle. The index is owned and queried by a single Trigger
+     * and is rebuilt by that Trigger whenever its set of Areas changes.
+     */
+    class OdeAreaIndex
+    {
+    public:
     
+        OdeAreaIndex();
+        
+        /**
+         * @brief rebuilds the index from a new set of Area rectangles
+         * @param[in] areas rectangles to index
+         */
+        void Build(const std::vector<NvOSD_RectParams>& areas);
+        
+        /**
+         * @brief returns the number of Area rectangles in the index
+         */
+        uint Size(){return m_areas.size();};
+        
+        /**
+         * @brief Determines if a rectangle overlaps with any of the indexed Areas
+         * @param[in] rect rectangle to test
+         * @return true if the rectangle overlaps at least one Area, false otherwise
+         */
+        bool Overlaps(const NvOSD_RectParams& rect);
+        
+        /**
+         * @brief Version of Overlaps that does not update the query stamps, so 
+         * it can be called from multiple threads at once. Areas spanning more
+         * than one cell may be tested more than once.
+         * @param[in] rect rectangle to test
+         * @return true if the rectangle overlaps at least one Area, false otherwise
+         */
+        bool ConcurrentOverlaps(const NvOSD_RectParams& rect);
+        
+        /**
+         * @brief Determines if two rectangles overlap, edges inclusive
+         * @param[in] a rectangle A for test
+         * @param[in] b rectangle B for test
+         * @return true if the rectangles overlap, false otherwise
+         */
+        static bool DoesOverlap(const NvOSD_RectParams& a, const NvOSD_RectParams& b);
+        
     private:
+    
+        /**
+         * @brief helper function for DoesOverlap
+         * @return true if value in range of min-max
+         */
+        static bool valueInRange(int value, int min, int max)
+        {
+            return (value >= min) && (value <= max);
+        };
 
         /**
-         * @brief Mutex to ensure mutual exlusion for propery get/sets
+         * @brief Gets the range of grid cells covered by a rectangle. The range is
+         * padded by a pixel on each side so that it always includes every cell 
+         * DoesOverlap could match with, and is clamped to the grid. Rectangles
+         * with a negative width or height are normalized first.
          */
-        GMutex m_propertyMutex;
+        void getCellRange(const NvOSD_RectParams& rect, 
+            uint* firstColumn, uint* lastColumn, uint* firstRow, uint* lastRow);
+        
+        /**
+         * @brief indexed Area rectangles
+         */
+        std::vector<NvOSD_RectParams> m_areas;
+        
+        /**
+         * @brief for each grid cell, row major, the indices of the overlapping Areas
+         */
+        std::vector<std::vector<uint>> m_cells;
+        
+        /**
+         * @brief per Area stamp of the last query to test it, so that Areas 
+         * spanning multiple cells are tested once per query
+         */
+        std::vector<uint> m_queryStamps;
+        
+        /**
+         * @brief current query number
+         */
+        uint m_queryCount;
+        
+        uint m_columns;
+        
+        uint m_rows;
+        
+        uint m_cellWidth;
         
+        uint m_cellHeight;
     };
 
 }
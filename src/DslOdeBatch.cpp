@@ -0,0 +1,328 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeBatch.h"
+#include "DslOdeTrigger.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace DSL
+{
+    OdeObjectBatch::OdeObjectBatch()
+        : m_objectCount(0)
+    {
+        LOG_FUNC();
+        
+        m_frameFirstObject.push_back(0);
+    }
+    
+    OdeObjectBatch::~OdeObjectBatch()
+    {
+        LOG_FUNC();
+    }
+
+    void OdeObjectBatch::Gather(NvDsBatchMeta* pBatchMeta)
+    {
+        Clear();
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; pFrameMetaList != NULL; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+            if (pFrameMeta != NULL)
+            {
+                AddFrame(pFrameMeta);
+                
+                for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta != NULL; pMeta = pMeta->next)
+                {
+                    NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pMeta->data);
+                    if (pObjectMeta != NULL)
+                    {
+                        AddObject(pObjectMeta);
+                    }
+                }
+            }
+        }
+    }
+    
+    void OdeObjectBatch::Clear()
+    {
+        m_objectCount = 0;
+        m_frameMetas.clear();
+        m_frameFirstObject.assign(1, 0);
+        m_objectMetas.clear();
+    }
+    
+    void OdeObjectBatch::AddFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        m_frameMetas.push_back(pFrameMeta);
+        m_frameFirstObject.push_back(m_objectCount);
+    }
+    
+    void OdeObjectBatch::AddObject(NvDsObjectMeta* pObjectMeta)
+    {
+        if (m_frameMetas.empty())
+        {
+            LOG_ERROR("Unable to add an Object to an OdeObjectBatch without a Frame");
+            return;
+        }
+        NvDsFrameMeta* pFrameMeta = m_frameMetas.back();
+        
+        if (m_objectCount >= m_classIds.size())
+        {
+            pad();
+        }
+        uint i = m_objectCount++;
+        
+        m_objectMetas.push_back(pObjectMeta);
+        m_classIds[i] = pObjectMeta->class_id;
+        m_sourceIds[i] = pFrameMeta->source_id;
+        m_frameIndices[i] = m_frameMetas.size() - 1;
+        m_inferDone[i] = pFrameMeta->bInferDone ? 1 : 0;
+        m_confidences[i] = pObjectMeta->confidence;
+        m_lefts[i] = pObjectMeta->rect_params.left;
+        m_tops[i] = pObjectMeta->rect_params.top;
+        m_widths[i] = pObjectMeta->rect_params.width;
+        m_heights[i] = pObjectMeta->rect_params.height;
+        
+        m_frameFirstObject.back() = m_objectCount;
+    }
+    
+    void OdeObjectBatch::pad()
+    {
+        uint size = m_classIds.size() + DSL_ODE_BATCH_KERNEL_WIDTH;
+        
+        m_classIds.resize(size, 0);
+        m_sourceIds.resize(size, 0);
+        m_frameIndices.resize(size, 0);
+        m_inferDone.resize(size, 0);
+        m_confidences.resize(size, 0);
+        m_lefts.resize(size, 0);
+        m_tops.resize(size, 0);
+        m_widths.resize(size, 0);
+        m_heights.resize(size, 0);
+    }
+    
+    void OdeObjectBatch::EvaluateCriteriaScalar(const OdeTriggerCriteria& criteria, 
+        std::vector<uint64_t>& mask)
+    {
+        mask.assign((m_objectCount + 63) / 64, 0);
+        
+        // Same tests, in the same types, as OdeTrigger::checkForMinCriteria
+        for (uint i = 0; i < m_objectCount; i++)
+        {
+            if ((criteria.classId != DSL_ODE_ANY_CLASS) and (criteria.classId != (uint)m_classIds[i]))
+            {
+                continue;
+            }
+            if ((criteria.sourceId != DSL_ODE_ANY_SOURCE) and (criteria.sourceId != m_sourceIds[i]))
+            {
+                continue;
+            }
+            if ((m_confidences[i] > 0) and (m_confidences[i] < criteria.minConfidence))
+            {
+                continue;
+            }
+            if ((criteria.minWidth and m_widths[i] < criteria.minWidth) or
+                (criteria.minHeight and m_heights[i] < criteria.minHeight))
+            {
+                continue;
+            }
+            if ((criteria.maxWidth and m_widths[i] > criteria.maxWidth) or
+                (criteria.maxHeight and m_heights[i] > criteria.maxHeight))
+            {
+                continue;
+            }
+            if (criteria.inferDoneOnly and !m_inferDone[i])
+            {
+                continue;
+            }
+            mask[i >> 6] |= (uint64_t)1 << (i & 63);
+        }
+    }
+    
+    void OdeObjectBatch::EvaluateCriteria(const OdeTriggerCriteria& criteria, 
+        std::vector<uint64_t>& mask)
+    {
+#if defined(__AVX2__) || defined(__SSE2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+
+        mask.assign((m_objectCount + 63) / 64, 0);
+        
+        // Disabled criteria are folded into the constants so that the kernels have no 
+        // branches. An unset min/max dimension can never fail its comparison, and
+        // the "any" filters are OR'ed into the equality tests.
+        uint anyClass = (criteria.classId == DSL_ODE_ANY_CLASS) ? UINT32_MAX : 0;
+        uint anySource = (criteria.sourceId == DSL_ODE_ANY_SOURCE) ? UINT32_MAX : 0;
+        uint inferDoneOnly = criteria.inferDoneOnly ? UINT32_MAX : 0;
+        float minWidth = criteria.minWidth ? (float)criteria.minWidth : -INFINITY;
+        float minHeight = criteria.minHeight ? (float)criteria.minHeight : -INFINITY;
+        float maxWidth = criteria.maxWidth ? (float)criteria.maxWidth : INFINITY;
+        float maxHeight = criteria.maxHeight ? (float)criteria.maxHeight : INFINITY;
+        
+#if defined(__AVX2__)
+
+        const uint width(8);
+        
+        __m256i vClassId = _mm256_set1_epi32(criteria.classId);
+        __m256i vAnyClass = _mm256_set1_epi32(anyClass);
+        __m256i vSourceId = _mm256_set1_epi32(criteria.sourceId);
+        __m256i vAnySource = _mm256_set1_epi32(anySource);
+        __m256i vInferDoneOnly = _mm256_set1_epi32(inferDoneOnly);
+        __m256i vZeroInt = _mm256_setzero_si256();
+        __m256 vZero = _mm256_setzero_ps();
+        __m256 vMinConfidence = _mm256_set1_ps(criteria.minConfidence);
+        __m256 vMinWidth = _mm256_set1_ps(minWidth);
+        __m256 vMinHeight = _mm256_set1_ps(minHeight);
+        __m256 vMaxWidth = _mm256_set1_ps(maxWidth);
+        __m256 vMaxHeight = _mm256_set1_ps(maxHeight);
+        
+        for (uint i = 0; i < m_objectCount; i += width)
+        {
+            __m256i pass = _mm256_and_si256(
+                _mm256_or_si256(vAnyClass, _mm256_cmpeq_epi32(vClassId,
+                    _mm256_loadu_si256((const __m256i*)&m_classIds[i]))),
+                _mm256_or_si256(vAnySource, _mm256_cmpeq_epi32(vSourceId,
+                    _mm256_loadu_si256((const __m256i*)&m_sourceIds[i]))));
+            pass = _mm256_andnot_si256(_mm256_and_si256(vInferDoneOnly, _mm256_cmpeq_epi32(vZeroInt,
+                _mm256_loadu_si256((const __m256i*)&m_inferDone[i]))), pass);
+                
+            __m256 confidence = _mm256_loadu_ps(&m_confidences[i]);
+            __m256 widths = _mm256_loadu_ps(&m_widths[i]);
+            __m256 heights = _mm256_loadu_ps(&m_heights[i]);
+            
+            __m256 fail = _mm256_and_ps(_mm256_cmp_ps(confidence, vZero, _CMP_GT_OQ),
+                _mm256_cmp_ps(confidence, vMinConfidence, _CMP_LT_OQ));
+            fail = _mm256_or_ps(fail, _mm256_cmp_ps(widths, vMinWidth, _CMP_LT_OQ));
+            fail = _mm256_or_ps(fail, _mm256_cmp_ps(heights, vMinHeight, _CMP_LT_OQ));
+            fail = _mm256_or_ps(fail, _mm256_cmp_ps(widths, vMaxWidth, _CMP_GT_OQ));
+            fail = _mm256_or_ps(fail, _mm256_cmp_ps(heights, vMaxHeight, _CMP_GT_OQ));
+            
+            uint64_t bits = _mm256_movemask_ps(_mm256_andnot_ps(fail, _mm256_castsi256_ps(pass)));
+            mask[i >> 6] |= bits << (i & 63);
+        }
+        
+#elif defined(__SSE2__)
+
+        const uint width(4);
+        
+        __m128i vClassId = _mm_set1_epi32(criteria.classId);
+        __m128i vAnyClass = _mm_set1_epi32(anyClass);
+        __m128i vSourceId = _mm_set1_epi32(criteria.sourceId);
+        __m128i vAnySource = _mm_set1_epi32(anySource);
+        __m128i vInferDoneOnly = _mm_set1_epi32(inferDoneOnly);
+        __m128i vZeroInt = _mm_setzero_si128();
+        __m128 vZero = _mm_setzero_ps();
+        __m128 vMinConfidence = _mm_set1_ps(criteria.minConfidence);
+        __m128 vMinWidth = _mm_set1_ps(minWidth);
+        __m128 vMinHeight = _mm_set1_ps(minHeight);
+        __m128 vMaxWidth = _mm_set1_ps(maxWidth);
+        __m128 vMaxHeight = _mm_set1_ps(maxHeight);
+        
+        for (uint i = 0; i < m_objectCount; i += width)
+        {
+            __m128i pass = _mm_and_si128(
+                _mm_or_si128(vAnyClass, _mm_cmpeq_epi32(vClassId,
+                    _mm_loadu_si128((const __m128i*)&m_classIds[i]))),
+                _mm_or_si128(vAnySource, _mm_cmpeq_epi32(vSourceId,
+                    _mm_loadu_si128((const __m128i*)&m_sourceIds[i]))));
+            pass = _mm_andnot_si128(_mm_and_si128(vInferDoneOnly, _mm_cmpeq_epi32(vZeroInt,
+                _mm_loadu_si128((const __m128i*)&m_inferDone[i]))), pass);
+                
+            __m128 confidence = _mm_loadu_ps(&m_confidences[i]);
+            __m128 widths = _mm_loadu_ps(&m_widths[i]);
+            __m128 heights = _mm_loadu_ps(&m_heights[i]);
+            
+            __m128 fail = _mm_and_ps(_mm_cmpgt_ps(confidence, vZero),
+                _mm_cmplt_ps(confidence, vMinConfidence));
+            fail = _mm_or_ps(fail, _mm_cmplt_ps(widths, vMinWidth));
+            fail = _mm_or_ps(fail, _mm_cmplt_ps(heights, vMinHeight));
+            fail = _mm_or_ps(fail, _mm_cmpgt_ps(widths, vMaxWidth));
+            fail = _mm_or_ps(fail, _mm_cmpgt_ps(heights, vMaxHeight));
+            
+            uint64_t bits = _mm_movemask_ps(_mm_andnot_ps(fail, _mm_castsi128_ps(pass)));
+            mask[i >> 6] |= bits << (i & 63);
+        }
+        
+#else // NEON
+
+        const uint width(4);
+        const uint32_t laneBits[4] = {1, 2, 4, 8};
+        
+        uint32x4_t vLaneBits = vld1q_u32(laneBits);
+        uint32x4_t vClassId = vdupq_n_u32(criteria.classId);
+        uint32x4_t vAnyClass = vdupq_n_u32(anyClass);
+        uint32x4_t vSourceId = vdupq_n_u32(criteria.sourceId);
+        uint32x4_t vAnySource = vdupq_n_u32(anySource);
+        uint32x4_t vInferDoneOnly = vdupq_n_u32(inferDoneOnly);
+        uint32x4_t vZeroInt = vdupq_n_u32(0);
+        float32x4_t vZero = vdupq_n_f32(0);
+        float32x4_t vMinConfidence = vdupq_n_f32(criteria.minConfidence);
+        float32x4_t vMinWidth = vdupq_n_f32(minWidth);
+        float32x4_t vMinHeight = vdupq_n_f32(minHeight);
+        float32x4_t vMaxWidth = vdupq_n_f32(maxWidth);
+        float32x4_t vMaxHeight = vdupq_n_f32(maxHeight);
+        
+        for (uint i = 0; i < m_objectCount; i += width)
+        {
+            uint32x4_t pass = vandq_u32(
+                vorrq_u32(vAnyClass, vceqq_u32(vClassId, 
+                    vld1q_u32((const uint32_t*)&m_classIds[i]))),
+                vorrq_u32(vAnySource, vceqq_u32(vSourceId, 
+                    vld1q_u32(&m_sourceIds[i]))));
+            pass = vbicq_u32(pass, vandq_u32(vInferDoneOnly, 
+                vceqq_u32(vZeroInt, vld1q_u32(&m_inferDone[i]))));
+                
+            float32x4_t confidence = vld1q_f32(&m_confidences[i]);
+            float32x4_t widths = vld1q_f32(&m_widths[i]);
+            float32x4_t heights = vld1q_f32(&m_heights[i]);
+            
+            uint32x4_t fail = vandq_u32(vcgtq_f32(confidence, vZero),
+                vcltq_f32(confidence, vMinConfidence));
+            fail = vorrq_u32(fail, vcltq_f32(widths, vMinWidth));
+            fail = vorrq_u32(fail, vcltq_f32(heights, vMinHeight));
+            fail = vorrq_u32(fail, vcgtq_f32(widths, vMaxWidth));
+            fail = vorrq_u32(fail, vcgtq_f32(heights, vMaxHeight));
+            
+            uint64_t bits = vaddvq_u32(vandq_u32(vbicq_u32(pass, fail), vLaneBits));
+            mask[i >> 6] |= bits << (i & 63);
+        }
+        
+#endif
+        // Clear the bits of the padding past the last Object
+        if (m_objectCount & 63)
+        {
+            mask.back() &= ((uint64_t)1 << (m_objectCount & 63)) - 1;
+        }
+#else
+        EvaluateCriteriaScalar(criteria, mask);
+#endif
+    }
+}
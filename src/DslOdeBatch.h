@@ -0,0 +1,153 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_BATCH_H
+#define _DSL_ODE_BATCH_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    struct OdeTriggerCriteria;
+    
+    /**
+     * @brief number of objects evaluated per step by the widest criteria kernel. 
+     * The batch arrays are padded to a multiple of this value.
+     */
+    #define DSL_ODE_BATCH_KERNEL_WIDTH 8
+
+    /**
+     * @class OdeObjectBatch
+     * @brief Structure-of-arrays copy of the Object meta data in a batch. Gathered
+     * once per batch by the ODE Handler so that each Trigger can evaluate its 
+     * minimum criteria over all Objects in a single pass, producing a bitmask
+     * with one bit per Object.
+     */
+    class OdeObjectBatch
+    {
+    public: 
+    
+        OdeObjectBatch();
+        
+        ~OdeObjectBatch();
+        
+        /**
+         * @brief Clears and then gathers all Frame and Object meta data from a batch
+         * @param[in] pBatchMeta batch meta data to gather
+         */
+        void Gather(NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Clears all Frames and Objects from the batch
+         */
+        void Clear();
+        
+        /**
+         * @brief Adds a Frame to the batch. All Objects added following
+         * belong to this Frame until the next Frame is added.
+         * @param[in] pFrameMeta Frame meta data to add
+         */
+        void AddFrame(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Adds an Object to the current Frame.
+         * @param[in] pObjectMeta Object meta data to add
+         */
+        void AddObject(NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Evaluates a Trigger's minimum criteria for every Object in the batch,
+         * using the widest vector instructions available for the build target
+         * @param[in] criteria Trigger criteria to evaluate
+         * @param[out] mask one bit per Object, set if the Object meets the criteria
+         */
+        void EvaluateCriteria(const OdeTriggerCriteria& criteria, 
+            std::vector<uint64_t>& mask);
+        
+        /**
+         * @brief Scalar version of EvaluateCriteria, used for the tail of each batch
+         * and for build targets without vector support
+         * @param[in] criteria Trigger criteria to evaluate
+         * @param[out] mask one bit per Object, set if the Object meets the criteria
+         */
+        void EvaluateCriteriaScalar(const OdeTriggerCriteria& criteria, 
+            std::vector<uint64_t>& mask);
+            
+        /**
+         * @brief Tests an Object's bit in a mask produced by EvaluateCriteria
+         * @param[in] mask mask to test
+         * @param[in] object index of the Object in the batch
+         * @return true if the Object's bit is set
+         */
+        static bool IsSet(const std::vector<uint64_t>& mask, uint object)
+        {
+            return (mask[object >> 6] >> (object & 63)) & 1;
+        };
+        
+        /**
+         * @brief number of Objects in the batch
+         */
+        uint m_objectCount;
+        
+        /**
+         * @brief Frame meta data for each Frame in the batch, in batch order
+         */
+        std::vector<NvDsFrameMeta*> m_frameMetas;
+        
+        /**
+         * @brief index of the first Object for each Frame, with one extra
+         * entry holding the total number of Objects 
+         */
+        std::vector<uint> m_frameFirstObject;
+        
+        /**
+         * @brief Object meta data for each Object in the batch
+         */
+        std::vector<NvDsObjectMeta*> m_objectMetas;
+        
+        /**
+         * @brief Per Object arrays, padded to a multiple of DSL_ODE_BATCH_KERNEL_WIDTH
+         */
+        std::vector<int> m_classIds;
+        std::vector<uint> m_sourceIds;
+        std::vector<uint> m_frameIndices;
+        std::vector<uint> m_inferDone;
+        std::vector<float> m_confidences;
+        std::vector<float> m_lefts;
+        std::vector<float> m_tops;
+        std::vector<float> m_widths;
+        std::vector<float> m_heights;
+        
+    private:
+    
+        /**
+         * @brief pads the per Object arrays to a multiple of DSL_ODE_BATCH_KERNEL_WIDTH
+         * so that the vector kernels can load past the last Object
+         */
+        void pad();
+    };
+}
+
+#endif // _DSL_ODE_BATCH_H
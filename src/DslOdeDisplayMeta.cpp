@@ -0,0 +1,194 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeDisplayMeta.h"
+
+namespace DSL
+{
+    /**
+     * @brief builder made current on this thread by the last call to Begin
+     */
+    static thread_local OdeDisplayMetaBuilder* s_pCurrentBuilder(NULL);
+    
+    OdeDisplayMetaBuilder::OdeDisplayMetaBuilder()
+        : m_pBuffer(NULL)
+        , m_pPrevious(NULL)
+        , m_frameCount(0)
+    {
+        LOG_FUNC();
+    }
+    
+    OdeDisplayMetaBuilder::~OdeDisplayMetaBuilder()
+    {
+        LOG_FUNC();
+    }
+    
+    void OdeDisplayMetaBuilder::Begin(GstBuffer* pBuffer)
+    {
+        m_pBuffer = pBuffer;
+        m_frameCount = 0;
+        m_textArena.clear();
+        
+        m_pPrevious = s_pCurrentBuilder;
+        s_pCurrentBuilder = this;
+    }
+    
+    uint OdeDisplayMetaBuilder::Flush()
+    {
+        uint displayMetaCount(0);
+        
+        NvDsBatchMeta* pBatchMeta = (m_frameCount) 
+            ? gst_buffer_get_nvds_batch_meta(m_pBuffer) : NULL;
+        
+        for (uint i = 0; i < m_frameCount; i++)
+        {
+            OdeDisplayFrameElements& frame = m_frames[i];
+            
+            uint rect(0), label(0), line(0);
+            while (rect < frame.rects.size() or label < frame.labels.size() or
+                line < frame.lines.size())
+            {
+                // Fill each display meta with up to the maximum of each element type
+                NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(pBatchMeta);
+                
+                while (rect < frame.rects.size() and 
+                    pDisplayMeta->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
+                {
+                    pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = frame.rects[rect++];
+                }
+                while (label < frame.labels.size() and 
+                    pDisplayMeta->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
+                {
+                    // The text is freed with the display meta, so each label needs its own copy
+                    NvOSD_TextParams& textParams = 
+                        pDisplayMeta->text_params[pDisplayMeta->num_labels++];
+                    textParams = frame.labels[label];
+                    textParams.display_text = g_strndup(
+                        m_textArena.data() + frame.labelTexts[label].first, 
+                        frame.labelTexts[label].second);
+                    label++;
+                }
+                while (line < frame.lines.size() and 
+                    pDisplayMeta->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
+                {
+                    pDisplayMeta->line_params[pDisplayMeta->num_lines++] = frame.lines[line++];
+                }
+                nvds_add_display_meta_to_frame(frame.pFrameMeta, pDisplayMeta);
+                displayMetaCount++;
+            }
+            frame.rects.clear();
+            frame.labels.clear();
+            frame.labelTexts.clear();
+            frame.lines.clear();
+        }
+        m_frameCount = 0;
+        m_textArena.clear();
+        m_pBuffer = NULL;
+        
+        if (s_pCurrentBuilder == this)
+        {
+            s_pCurrentBuilder = m_pPrevious;
+        }
+        m_pPrevious = NULL;
+        
+        return displayMetaCount;
+    }
+    
+    void OdeDisplayMetaBuilder::AddRect(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+        const NvOSD_RectParams& rectParams)
+    {
+        OdeDisplayMetaBuilder* pBuilder = getCurrent(pBuffer);
+        if (pBuilder)
+        {
+            pBuilder->getFrameElements(pFrameMeta).rects.push_back(rectParams);
+            return;
+        }
+        NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(
+            gst_buffer_get_nvds_batch_meta(pBuffer));
+        pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = rectParams;
+        nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+    }
+    
+    void OdeDisplayMetaBuilder::AddLabel(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+        const NvOSD_TextParams& textParams, const char* text, uint length)
+    {
+        OdeDisplayMetaBuilder* pBuilder = getCurrent(pBuffer);
+        if (pBuilder)
+        {
+            OdeDisplayFrameElements& frame = pBuilder->getFrameElements(pFrameMeta);
+            
+            frame.labels.push_back(textParams);
+            frame.labelTexts.push_back(std::make_pair(
+                (uint)pBuilder->m_textArena.size(), length));
+            pBuilder->m_textArena.insert(pBuilder->m_textArena.end(), text, text+length);
+            return;
+        }
+        NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(
+            gst_buffer_get_nvds_batch_meta(pBuffer));
+        NvOSD_TextParams& newTextParams = pDisplayMeta->text_params[pDisplayMeta->num_labels++];
+        newTextParams = textParams;
+        newTextParams.display_text = g_strndup(text, length);
+        nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+    }
+    
+    void OdeDisplayMetaBuilder::AddLine(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+        const NvOSD_LineParams& lineParams)
+    {
+        OdeDisplayMetaBuilder* pBuilder = getCurrent(pBuffer);
+        if (pBuilder)
+        {
+            pBuilder->getFrameElements(pFrameMeta).lines.push_back(lineParams);
+            return;
+        }
+        NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(
+            gst_buffer_get_nvds_batch_meta(pBuffer));
+        pDisplayMeta->line_params[pDisplayMeta->num_lines++] = lineParams;
+        nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+    }
+    
+    OdeDisplayMetaBuilder* OdeDisplayMetaBuilder::getCurrent(GstBuffer* pBuffer)
+    {
+        return (s_pCurrentBuilder and s_pCurrentBuilder->m_pBuffer == pBuffer) 
+            ? s_pCurrentBuilder : NULL;
+    }
+    
+    OdeDisplayFrameElements& OdeDisplayMetaBuilder::getFrameElements(NvDsFrameMeta* pFrameMeta)
+    {
+        // Elements are added frame by frame, so search from the most recent
+        for (uint i = m_frameCount; i > 0; i--)
+        {
+            if (m_frames[i-1].pFrameMeta == pFrameMeta)
+            {
+                return m_frames[i-1];
+            }
+        }
+        if (m_frameCount == m_frames.size())
+        {
+            m_frames.push_back(OdeDisplayFrameElements());
+        }
+        m_frames[m_frameCount].pFrameMeta = pFrameMeta;
+        return m_frames[m_frameCount++];
+    }
+}
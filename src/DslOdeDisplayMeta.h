@@ -0,0 +1,168 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_DISPLAY_META_H
+#define _DSL_ODE_DISPLAY_META_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @struct OdeDisplayFrameElements
+     * @brief Display elements added to one frame of the current batch, 
+     * held until packed into display meta on flush.
+     */
+    struct OdeDisplayFrameElements
+    {
+        /**
+         * @brief frame the elements are to be displayed on
+         */
+        NvDsFrameMeta* pFrameMeta;
+        
+        /**
+         * @brief rectangles, in the order added
+         */
+        std::vector<NvOSD_RectParams> rects;
+        
+        /**
+         * @brief labels, in the order added. The display text is set on flush.
+         */
+        std::vector<NvOSD_TextParams> labels;
+        
+        /**
+         * @brief offset and length of each label's text in the builder's text arena
+         */
+        std::vector<std::pair<uint, uint>> labelTexts;
+        
+        /**
+         * @brief lines, in the order added
+         */
+        std::vector<NvOSD_LineParams> lines;
+    };
+
+    /**
+     * @class OdeDisplayMetaBuilder
+     * @brief Collects the rectangles, labels and lines added by ODE Triggers and 
+     * Actions for each frame of a batch, and packs them into as few display meta
+     * as MAX_ELEMENTS_IN_DISPLAY_META allows when flushed. Owned by an ODE Handler,
+     * which makes its builder current on the streaming thread while handling a batch.
+     * Elements added with no current builder are added to the frame immediately.
+     */
+    class OdeDisplayMetaBuilder
+    {
+    public:
+    
+        OdeDisplayMetaBuilder();
+        
+        ~OdeDisplayMetaBuilder();
+        
+        /**
+         * @brief Begins a new batch, making this builder current on the calling thread
+         * @param[in] pBuffer buffer holding the batch meta to acquire display meta from
+         */
+        void Begin(GstBuffer* pBuffer);
+        
+        /**
+         * @brief Packs all elements added since Begin into display meta, adds them 
+         * to their frames, and restores the previously current builder, if any.
+         * @return number of display meta added
+         */
+        uint Flush();
+        
+        /**
+         * @brief Adds a rectangle to a frame, to the current builder if any
+         * @param[in] pBuffer buffer holding the frame
+         * @param[in] pFrameMeta frame to display the rectangle on
+         * @param[in] rectParams rectangle to display
+         */
+        static void AddRect(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+            const NvOSD_RectParams& rectParams);
+        
+        /**
+         * @brief Adds a label to a frame, to the current builder if any
+         * @param[in] pBuffer buffer holding the frame
+         * @param[in] pFrameMeta frame to display the label on
+         * @param[in] textParams label position, font and colors. The display text is ignored.
+         * @param[in] text text to display, copied
+         * @param[in] length length of the text, not including a null character
+         */
+        static void AddLabel(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+            const NvOSD_TextParams& textParams, const char* text, uint length);
+        
+        /**
+         * @brief Adds a line to a frame, to the current builder if any
+         * @param[in] pBuffer buffer holding the frame
+         * @param[in] pFrameMeta frame to display the line on
+         * @param[in] lineParams line to display
+         */
+        static void AddLine(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, 
+            const NvOSD_LineParams& lineParams);
+    
+    private:
+    
+        /**
+         * @brief Gets the current builder for a buffer.
+         * @param[in] pBuffer buffer the element is for
+         * @return the calling thread's current builder if it is building the buffer, 
+         * NULL otherwise
+         */
+        static OdeDisplayMetaBuilder* getCurrent(GstBuffer* pBuffer);
+    
+        /**
+         * @brief Gets the elements for a frame, adding a new entry on first use
+         * @param[in] pFrameMeta frame to get the elements for
+         * @return elements for the frame
+         */
+        OdeDisplayFrameElements& getFrameElements(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief buffer of the current batch
+         */
+        GstBuffer* m_pBuffer;
+        
+        /**
+         * @brief builder that was current when Begin was called, restored on Flush
+         */
+        OdeDisplayMetaBuilder* m_pPrevious;
+        
+        /**
+         * @brief elements for each frame, the first m_frameCount are in use. 
+         * Entries are kept between batches to reuse their storage.
+         */
+        std::vector<OdeDisplayFrameElements> m_frames;
+        
+        /**
+         * @brief number of entries in m_frames in use for the current batch
+         */
+        uint m_frameCount;
+        
+        /**
+         * @brief text of all labels added in the current batch
+         */
+        std::vector<char> m_textArena;
+    };
+}
+
+#endif // _DSL_ODE_DISPLAY_META_H
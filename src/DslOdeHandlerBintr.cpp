@@ -32,9 +32,12 @@ namespace DSL
     OdeHandlerBintr::OdeHandlerBintr(const char* name)
         : Bintr(name)
         , m_isEnabled(true)
+        , m_pWorkerPool(new OdeWorkerPool(1))
     {
         LOG_FUNC();
 
+        g_mutex_init(&m_dispatchMutex);
+
         m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "ode-handler-queue");
         
         Bintr::AddChild(m_pQueue);
@@ -61,6 +64,8 @@ namespace DSL
             UnlinkAll();
         }
         RemoveAllChildren();
+        
+        g_mutex_clear(&m_dispatchMutex);
     }
 
     bool OdeHandlerBintr::AddToParent(DSL_BASE_PTR pParentBintr)
@@ -104,6 +109,7 @@ namespace DSL
     bool OdeHandlerBintr::AddChild(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
         
         if (!Base::AddChild(pChild))
         {
@@ -112,12 +118,14 @@ namespace DSL
             return false;
         }
         m_pOdeTriggers[pChild->GetName()] = pChild;
+        buildDispatchTable();
         return true;
     }
 
     bool OdeHandlerBintr::RemoveChild(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
         
         if (!Base::RemoveChild(pChild))
         {
@@ -126,17 +134,75 @@ namespace DSL
             return false;
         }
         m_pOdeTriggers.erase(pChild->GetName());
+        buildDispatchTable();
         return true;
     }
     
     void OdeHandlerBintr::RemoveAllChildren()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
         
         m_pOdeTriggers.clear();
+        buildDispatchTable();
         Base::RemoveAllChildren();
     }
 
+    void OdeHandlerBintr::buildDispatchTable()
+    {
+        LOG_FUNC();
+        
+        m_odeTriggerList.clear();
+        m_odeTriggerClassIds.clear();
+        m_classIdDispatchTable.clear();
+        m_fallbackDispatchList.clear();
+        
+        // First pass to size the table to the largest in-range Class Id filter
+        uint tableSize(0);
+        for (const auto &imap: m_pOdeTriggers)
+        {
+            OdeTrigger* pOdeTrigger = std::dynamic_pointer_cast<OdeTrigger>(imap.second).get();
+            
+            uint classId = pOdeTrigger->m_classId;
+            
+            m_odeTriggerList.push_back(pOdeTrigger);
+            m_odeTriggerClassIds.push_back(classId);
+            
+            if (classId < DSL_ODE_HANDLER_MAX_DISPATCH_CLASS_ID)
+            {
+                tableSize = std::max(tableSize, classId+1);
+            }
+        }
+        m_classIdDispatchTable.resize(tableSize);
+
+        // Second pass, in map order, so that each list preserves the order in which
+        // Triggers were checked when iterating m_pOdeTriggers directly
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
+        {
+            uint classId = m_odeTriggerClassIds[i];
+            if (classId < tableSize)
+            {
+                m_classIdDispatchTable[classId].push_back(i);
+                continue;
+            }
+            // DSL_ODE_ANY_CLASS, or a Class Id too large for the table. 
+            // The Trigger's own criteria check will filter the Class Id.
+            if (classId == DSL_ODE_ANY_CLASS)
+            {
+                for (auto &classIdList: m_classIdDispatchTable)
+                {
+                    classIdList.push_back(i);
+                }
+            }
+            m_fallbackDispatchList.push_back(i);
+        }
+        m_criteriaMasks.resize(m_odeTriggerList.size());
+        m_triggerTimesNs.assign(m_odeTriggerList.size(), 0);
+        
+        LOG_DEBUG("Dispatch table for OdeHandlerBintr '" << GetName() 
+            << "' rebuilt with " << tableSize << " Class Id entries");
+    }
+
     bool OdeHandlerBintr::GetEnabled()
     {
         LOG_FUNC();
@@ -167,49 +233,241 @@ namespace DSL
         return RemoveBatchMetaHandler(DSL_PAD_SRC, PadBufferHandler);
     }
     
+    bool OdeHandlerBintr::SetBatchSize(uint batchSize)
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+            
+            for (const auto pOdeTrigger: m_odeTriggerList)
+            {
+                pOdeTrigger->ReserveSources(batchSize);
+            }
+        }
+        return Bintr::SetBatchSize(batchSize);
+    }
+    
+    uint OdeHandlerBintr::GetWorkerCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+        
+        return m_pWorkerPool->GetWorkerCount();
+    }
+    
+    bool OdeHandlerBintr::SetWorkerCount(uint workerCount)
+    {
+        LOG_FUNC();
+        
+        if (workerCount < 1 or workerCount > DSL_ODE_WORKER_POOL_MAX_WORKERS)
+        {
+            LOG_ERROR("Invalid worker count of " << workerCount 
+                << " for OdeHandlerBintr '" << GetName() << "'");
+            return false;
+        }
+        // Create the new pool outside of the lock, the current batch may still be in progress
+        std::unique_ptr<OdeWorkerPool> pWorkerPool(new OdeWorkerPool(workerCount));
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+            m_pWorkerPool.swap(pWorkerPool);
+        }
+        LOG_INFO("OdeHandlerBintr '" << GetName() << "' set to use " 
+            << workerCount << " workers");
+        
+        // the previous pool's workers are stopped and joined on release
+        return true;
+    }
+    
     bool OdeHandlerBintr::HandlePadBuffer(GstBuffer* pBuffer)
     {
         NvDsBatchMeta* batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
         
-        // For each frame in the batched meta data
-        for (NvDsMetaList* pFrameMetaList = batchMeta->frame_meta_list; pFrameMetaList != NULL; pFrameMetaList = pFrameMetaList->next)
+        // Guard the dispatch table against Trigger add/remove from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatchMutex);
+        
+        // Rebuild the dispatch table if a Trigger's Class Id filter has been updated
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
         {
-            // Check for valid frame data
-            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
-            if (pFrameMeta != NULL)
+            if (m_odeTriggerList[i]->m_classId != m_odeTriggerClassIds[i])
             {
-                // Preprocess the frame
-                for (const auto &imap: m_pOdeTriggers)
+                buildDispatchTable();
+                break;
+            }
+        }
+        
+        // Time spent on each Trigger is accumulated for the batch, on this thread only.
+        // Each call is timed from the end of the previous call, one clock read per call.
+        uint64_t timeNs = OdeMetricsTimeNs();
+        auto addTriggerTime = [this, &timeNs](uint trigger)
+        {
+            uint64_t endTimeNs = OdeMetricsTimeNs();
+            m_triggerTimesNs[trigger] += endTimeNs - timeNs;
+            timeNs = endTimeNs;
+        };
+        
+        // Bring each Trigger's Area index up to date before the frames are evaluated
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
+        {
+            m_odeTriggerList[i]->PreProcessBatch();
+            addTriggerTime(i);
+        }
+        
+        // Gather all Objects in the batch and evaluate each Trigger's minimum criteria
+        // over all of them at once. Only Objects with their bit set are checked below.
+        m_objectBatch.Gather(batchMeta);
+        timeNs = OdeMetricsTimeNs();
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
+        {
+            m_odeTriggerList[i]->EvaluateMinCriteria(m_objectBatch, m_criteriaMasks[i]);
+            addTriggerTime(i);
+        }
+        
+        // Evaluate all frames in the batch concurrently, listing the Objects each 
+        // Trigger is to check. Nothing is updated other than the frame's own list.
+        uint frameCount = m_objectBatch.m_frameMetas.size();
+        if (m_frameChecks.size() < frameCount)
+        {
+            m_frameChecks.resize(frameCount);
+        }
+        m_pWorkerPool->ParallelFor(frameCount, 
+            [this](uint frame){evaluateFrame(frame);});
+        timeNs = OdeMetricsTimeNs();
+        
+        // Then, invoke the Triggers for each frame, in batch order, on this thread. 
+        // Trigger state, limits, event counts, and all Actions - including those that 
+        // acquire display meta from the batch pool - see the same order as a serial pass.
+        // Display elements are collected and packed into display meta once, at the end.
+        m_displayMetaBuilder.Begin(pBuffer);
+        
+        bool areasChanged(false);
+        for (uint frame = 0; frame < frameCount; frame++)
+        {
+            NvDsFrameMeta* pFrameMeta = m_objectBatch.m_frameMetas[frame];
+            
+            // Preprocess the frame
+            for (uint i = 0; i < m_odeTriggerList.size(); i++)
+            {
+                m_odeTriggerList[i]->PreProcessFrame(pBuffer, pFrameMeta);
+                addTriggerTime(i);
+            }
+            
+            // Actions invoked for earlier frames, or while preprocessing this one, may 
+            // have changed a Trigger's Areas, leaving the checks for the remaining 
+            // frames out of date.
+            if (preProcessChangedAreas() or areasChanged)
+            {
+                m_pWorkerPool->ParallelFor(frameCount - frame, 
+                    [this, frame](uint i){evaluateFrame(frame + i);});
+                timeNs = OdeMetricsTimeNs();
+                areasChanged = false;
+            }
+            
+            // For each detected object in the frame, the Triggers that passed evaluation.
+            // Note: the list is rebuilt while iterating if an Action changes the Areas
+            for (uint next = 0; next < m_frameChecks[frame].size(); )
+            {
+                const OdeTriggerCheck check = m_frameChecks[frame][next++];
+                
+                m_odeTriggerList[check.trigger]->CheckForOccurrence(pBuffer, 
+                    pFrameMeta, m_objectBatch.m_objectMetas[check.object]);
+                addTriggerTime(check.trigger);
+                
+                // If the Trigger's Actions changed any Trigger's Areas, the checks that 
+                // follow in this frame are rebuilt in place - so that an Object newly 
+                // in, or out of, an Area is checked just as in a serial pass. 
+                // The later frames are re-evaluated before they are processed. 
+                if (preProcessChangedAreas())
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PreProcessFrame(pBuffer, pFrameMeta);
+                    m_frameChecks[frame].resize(next);
+                    evaluateObjects(frame, check.object, check.trigger+1);
+                    timeNs = OdeMetricsTimeNs();
+                    areasChanged = true;
                 }
-                // For each detected object in the frame.
-                for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta != NULL; pMeta = pMeta->next)
+            }
+            
+            // After each detected object is checked for ODE individually, post process 
+            // each frame for Absence events, Limit events, etc. (i.e. frame level events).
+            for (uint i = 0; i < m_odeTriggerList.size(); i++)
+            {
+                m_odeTriggerList[i]->PostProcessFrame(pBuffer, pFrameMeta);
+                addTriggerTime(i);
+            }
+        }
+        
+        // Allow the Actions to complete any batch level work, e.g. client batch callbacks
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
+        {
+            m_odeTriggerList[i]->PostProcessBatch();
+            addTriggerTime(i);
+        }
+        m_displayMetaBuilder.Flush();
+        
+        // Publish the batch's metrics, once per Trigger
+        uint objectCount = m_objectBatch.m_objectMetas.size();
+        for (uint i = 0; i < m_odeTriggerList.size(); i++)
+        {
+            m_odeTriggerList[i]->AddBatchMetrics(objectCount, m_triggerTimesNs[i]);
+            m_triggerTimesNs[i] = 0;
+        }
+        
+        return true;
+    }
+    
+    void OdeHandlerBintr::evaluateFrame(uint frame)
+    {
+        m_frameChecks[frame].clear();
+        evaluateObjects(frame, m_objectBatch.m_frameFirstObject[frame], 0);
+    }
+    
+    void OdeHandlerBintr::evaluateObjects(uint frame, uint firstObject, uint firstTrigger)
+    {
+        std::vector<OdeTriggerCheck>& checks = m_frameChecks[frame];
+        
+        // For each detected object in the frame, from the first to evaluate.
+        for (uint object = firstObject; 
+            object < m_objectBatch.m_frameFirstObject[frame+1]; object++)
+        {
+            NvDsObjectMeta* pObjectMeta = m_objectBatch.m_objectMetas[object];
+            
+            // Only the Triggers that can match the Object's Class Id are checked.
+            // Note: a negative Class Id will index the fallback list
+            uint classId = (uint)pObjectMeta->class_id;
+            const std::vector<uint>& odeTriggers = 
+                (classId < m_classIdDispatchTable.size()) 
+                ? m_classIdDispatchTable[classId] 
+                : m_fallbackDispatchList;
+                
+            // Each list is in Trigger order, so the first Object's Triggers
+            // before firstTrigger - already checked - can be skipped.
+            for (const auto i: odeTriggers)
+            {
+                if (object == firstObject and i < firstTrigger)
                 {
-                    // Check for valid object data
-                    NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pMeta->data);
-                    if (pObjectMeta != NULL)
-                    {
-                        // For each ODE Trigger owned by this ODE Manager, check for ODE
-                        for (const auto &imap: m_pOdeTriggers)
-                        {
-                            DSL_ODE_TRIGGER_PTR pOdeTrigger = std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                            pOdeTrigger->CheckForOccurrence(pBuffer, pFrameMeta, pObjectMeta);
-                        }
-                    }
+                    continue;
                 }
-                
-                // After each detected object is checked for ODE individually, post process 
-                // each frame for Absence events, Limit events, etc. (i.e. frame level events).
-                for (const auto &imap: m_pOdeTriggers)
+                if (OdeObjectBatch::IsSet(m_criteriaMasks[i], object) and
+                    m_odeTriggerList[i]->CheckForAreaOverlap(pObjectMeta))
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PostProcessFrame(pBuffer, pFrameMeta);
+                    checks.push_back({i, object});
                 }
             }
         }
-        return true;
+    }
+    
+    bool OdeHandlerBintr::preProcessChangedAreas()
+    {
+        bool changed(false);
+        
+        for (const auto& pOdeTrigger: m_odeTriggerList)
+        {
+            if (pOdeTrigger->AreAreasPreCheckedStale())
+            {
+                pOdeTrigger->PreProcessBatch();
+                changed = true;
+            }
+        }
+        return changed;
     }
     
     static boolean PadBufferHandler(void* pBuffer, void* user_data)
@@ -30,6 +30,7 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslBintr.h"
 #include "DslOdeTrigger.h"
+#include "DslOdeWorkerPool.h"
 
 namespace DSL
 {
@@ -39,6 +40,30 @@ namespace DSL
     #define DSL_ODE_HANDLER_PTR std::shared_ptr<OdeHandlerBintr>
     #define DSL_ODE_HANDLER_NEW(name) \
         std::shared_ptr<OdeHandlerBintr>(new OdeHandlerBintr(name))
+
+    /**
+     * @brief upper bound on the size of the Class Id dispatch table. Triggers 
+     * with a Class Id filter beyond this value are checked for every object.
+     */
+    #define DSL_ODE_HANDLER_MAX_DISPATCH_CLASS_ID                       1024
+        
+    /**
+     * @struct OdeTriggerCheck
+     * @brief An Object in the current batch to be checked by one of the Handler's
+     * Triggers, found while evaluating the Object's Frame.
+     */
+    struct OdeTriggerCheck
+    {
+        /**
+         * @brief index of the Trigger in the Handler's m_odeTriggerList
+         */
+        uint trigger;
+        
+        /**
+         * @brief index of the Object in the Handler's m_objectBatch
+         */
+        uint object;
+    };
         
     class OdeHandlerBintr : public Bintr
     {
@@ -98,6 +123,30 @@ namespace DSL
          */
         bool SetEnabled(bool enabled);
         
+        /**
+         * @brief Sets the batch size for the OdeHandlerBintr, reserving per-source
+         * state in the Areas of all child Triggers for each Source in the batch
+         * @param[in] batchSize the new batch size to use
+         * @return true if successful, false otherwise
+         */
+        bool SetBatchSize(uint batchSize);
+        
+        /**
+         * @brief Gets the number of workers used to evaluate the frames of each batch
+         * @return current worker count, including the streaming thread. Default = 1
+         */
+        uint GetWorkerCount();
+        
+        /**
+         * @brief Sets the number of workers used to evaluate the frames of each batch.
+         * The frames are evaluated concurrently, and the Triggers and their Actions
+         * are then invoked on the streaming thread in batch order.
+         * @param[in] workerCount new worker count, including the streaming thread, 
+         * in the range [1, DSL_ODE_WORKER_POOL_MAX_WORKERS]
+         * @return true if successful, false if the count is out of range
+         */
+        bool SetWorkerCount(uint workerCount);
+        
         /**
          * @brief Handles a Pad buffer, by iterating through each child ODE Type
          * checking for an occurrence of such an event
@@ -108,6 +157,38 @@ namespace DSL
 
     private:
     
+        /**
+         * @brief Rebuilds the Class Id dispatch table from the current map of
+         * child ODE Triggers. Caller must hold m_dispatchMutex.
+         */
+        void buildDispatchTable();
+        
+        /**
+         * @brief Evaluates one frame of the current batch, finding the Objects in
+         * the frame to be checked by each Trigger. Reads the Trigger and batch state
+         * only, so frames can be evaluated concurrently by the worker pool.
+         * @param[in] frame index of the frame in m_objectBatch
+         */
+        void evaluateFrame(uint frame);
+        
+        /**
+         * @brief Appends the checks for the Objects of one frame, starting with the 
+         * given Object and Trigger, to the frame's list. Used to evaluate the full
+         * frame, or to rebuild the rest of the frame's list when its Areas change.
+         * @param[in] frame index of the frame in m_objectBatch
+         * @param[in] firstObject index of the first Object in m_objectBatch to evaluate
+         * @param[in] firstTrigger index of the first Trigger in m_odeTriggerList to 
+         * evaluate for the first Object. All Triggers are evaluated for the others.
+         */
+        void evaluateObjects(uint frame, uint firstObject, uint firstTrigger);
+        
+        /**
+         * @brief Re-runs PreProcessBatch for each Trigger whose Areas have changed
+         * since the batch was evaluated, e.g. by an Add or Remove Area ODE Action.
+         * @return true if any Trigger's Areas have changed.
+         */
+        bool preProcessChangedAreas();
+    
         /**
          * @brief Handler enabled setting, default = true (enabled), 
          */ 
@@ -122,6 +203,71 @@ namespace DSL
          * @brief map of Child ODE in-use by this OdeHandlerBintr
          */
         std::map<std::string, DSL_BASE_PTR> m_pOdeTriggers;
+
+        /**
+         * @brief mutex to guard the dispatch table from updates by the client API
+         * while a batch is being processed
+         */
+        GMutex m_dispatchMutex;
+
+        /**
+         * @brief flat list of all child ODE Triggers, in the same order as m_pOdeTriggers.
+         * Raw pointers are safe as each Trigger is owned by m_pOdeTriggers.
+         */
+        std::vector<OdeTrigger*> m_odeTriggerList;
+
+        /**
+         * @brief Class Id filter of each Trigger in m_odeTriggerList when the dispatch
+         * table was last built. Used to detect a Class Id update from the client.
+         */
+        std::vector<uint> m_odeTriggerClassIds;
+
+        /**
+         * @brief dispatch table indexed by Object Class Id. Each entry lists the
+         * m_odeTriggerList indices of the Triggers with a matching Class Id or 
+         * DSL_ODE_ANY_CLASS in m_pOdeTriggers order.
+         */
+        std::vector<std::vector<uint>> m_classIdDispatchTable;
+
+        /**
+         * @brief Triggers to check for Objects with a Class Id outside of the dispatch
+         * table, i.e. DSL_ODE_ANY_CLASS Triggers and those with an out-of-range Class Id
+         */
+        std::vector<uint> m_fallbackDispatchList;
+        
+        /**
+         * @brief structure-of-arrays copy of the current batch's Object meta data
+         */
+        OdeObjectBatch m_objectBatch;
+        
+        /**
+         * @brief minimum criteria mask for the current batch, for each Trigger
+         * in m_odeTriggerList
+         */
+        std::vector<std::vector<uint64_t>> m_criteriaMasks;
+        
+        /**
+         * @brief time spent on each Trigger in m_odeTriggerList for the 
+         * current batch, in nanoseconds, published to the Trigger's metrics.
+         */
+        std::vector<uint64_t> m_triggerTimesNs;
+        
+        /**
+         * @brief Trigger checks for each frame in the current batch, in the
+         * order the Triggers are to be invoked, written by evaluateFrame.
+         */
+        std::vector<std::vector<OdeTriggerCheck>> m_frameChecks;
+        
+        /**
+         * @brief collects the display elements added by all Triggers and Actions
+         * for the current batch, flushed once the batch has been processed.
+         */
+        OdeDisplayMetaBuilder m_displayMetaBuilder;
+        
+        /**
+         * @brief pool of workers to evaluate the frames of each batch
+         */
+        std::unique_ptr<OdeWorkerPool> m_pWorkerPool;
     };
     
     static boolean PadBufferHandler(void* pBuffer, void* user_data);    
@@ -0,0 +1,428 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeJournal.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdexcept>
+
+namespace DSL
+{
+    /**
+     * @brief the claim word holds the generation above the record slot. 
+     */
+    #define DSL_ODE_JOURNAL_SLOT_BITS 40
+    #define DSL_ODE_JOURNAL_SLOT_MASK ((1ULL << DSL_ODE_JOURNAL_SLOT_BITS) - 1)
+
+    OdeJournalWriter::OdeJournalWriter(const char* filePath, uint64_t maxSize, uint maxFiles)
+        : m_filePath(filePath)
+        , m_capacity(1)
+        , m_maxFiles((maxFiles == 1) ? 2 : maxFiles)
+        , m_claim(0)
+        , m_writersInFlight(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_writerMutex);
+        
+        if (maxSize > sizeof(OdeJournalHeader) + sizeof(dsl_ode_occurrence_record))
+        {
+            m_capacity = (maxSize - sizeof(OdeJournalHeader)) / sizeof(dsl_ode_occurrence_record);
+        }
+        m_capacity = std::min(m_capacity, (uint64_t)(DSL_ODE_JOURNAL_SLOT_MASK >> 1));
+        
+        m_files[0] = m_files[1] = {-1, NULL, NULL};
+        
+        if (!openFile(0, m_files[0]))
+        {
+            g_mutex_clear(&m_writerMutex);
+            throw std::runtime_error("Failed to create ODE Journal file '" + m_filePath + "'");
+        }
+    }
+    
+    OdeJournalWriter::~OdeJournalWriter()
+    {
+        LOG_FUNC();
+        
+        uint64_t claim = m_claim.load();
+        uint64_t generation = claim >> DSL_ODE_JOURNAL_SLOT_BITS;
+        uint64_t slot = claim & DSL_ODE_JOURNAL_SLOT_MASK;
+        
+        closeFile(m_files[generation & 1], std::min(slot, m_capacity));
+        closeFile(m_files[(generation + 1) & 1], m_capacity);
+        
+        g_mutex_clear(&m_writerMutex);
+    }
+    
+    dsl_ode_occurrence_record* OdeJournalWriter::ClaimRecord()
+    {
+        while (true)
+        {
+            // Counted as in flight before claiming, so that a rotation can't
+            // unmap the file between the claim and the write.
+            m_writersInFlight.fetch_add(1);
+            
+            uint64_t claim = m_claim.fetch_add(1);
+            uint64_t generation = claim >> DSL_ODE_JOURNAL_SLOT_BITS;
+            uint64_t slot = claim & DSL_ODE_JOURNAL_SLOT_MASK;
+            
+            if (slot < m_capacity)
+            {
+                // NULL if the file for this generation failed to open
+                dsl_ode_occurrence_record* pRecords = m_files[generation & 1].pRecords;
+                if (pRecords)
+                {
+                    return &pRecords[slot];
+                }
+                m_writersInFlight.fetch_sub(1);
+                return NULL;
+            }
+            m_writersInFlight.fetch_sub(1);
+            
+            if (slot == m_capacity)
+            {
+                rotate(generation);
+                continue;
+            }
+            // Another writer is rotating, wait for the next generation
+            while ((m_claim.load(std::memory_order_acquire) >> DSL_ODE_JOURNAL_SLOT_BITS) == generation)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+    
+    void OdeJournalWriter::CommitRecord()
+    {
+        m_writersInFlight.fetch_sub(1, std::memory_order_release);
+    }
+    
+    void OdeJournalWriter::AddTriggerName(uint triggerIndex, const std::string& name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        if (triggerIndex >= DSL_ODE_JOURNAL_MAX_TRIGGERS)
+        {
+            LOG_WARN("ODE Journal '" << m_filePath << "' can not store the name of Trigger '" 
+                << name << "', maximum of " << DSL_ODE_JOURNAL_MAX_TRIGGERS << " exceeded");
+            return;
+        }
+        if (triggerIndex >= m_triggerNames.size())
+        {
+            m_triggerNames.resize(triggerIndex + 1);
+        }
+        m_triggerNames[triggerIndex] = name;
+        
+        // Another thread may have written a record with this index, before this 
+        // call, into the previous file if a rotation occurred in between.
+        for (auto& file: m_files)
+        {
+            if (file.pHeader)
+            {
+                strncpy(file.pHeader->triggerNames[triggerIndex], name.c_str(), 
+                    DSL_ODE_JOURNAL_MAX_TRIGGER_NAME - 1);
+                file.pHeader->triggerCount = m_triggerNames.size();
+            }
+        }
+    }
+    
+    uint OdeJournalWriter::GetFileCount()
+    {
+        LOG_FUNC();
+        
+        return (m_claim.load() >> DSL_ODE_JOURNAL_SLOT_BITS) + 1;
+    }
+    
+    std::string OdeJournalWriter::getFilePath(uint64_t generation)
+    {
+        return (generation) 
+            ? m_filePath + "." + std::to_string(generation) : m_filePath;
+    }
+    
+    bool OdeJournalWriter::openFile(uint64_t generation, MappedFile& mappedFile)
+    {
+        LOG_FUNC();
+        
+        std::string filePath(getFilePath(generation));
+        size_t size = sizeof(OdeJournalHeader) + m_capacity*sizeof(dsl_ode_occurrence_record);
+        
+        int fd = open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+        {
+            LOG_ERROR("Failed to create ODE Journal file '" << filePath << "'");
+            return false;
+        }
+        // Allocate the file's blocks up front so appends never extend the file. 
+        // Not all file systems support preallocation, so fall back to a sparse file.
+        if (posix_fallocate(fd, 0, size) != 0 and ftruncate(fd, size) != 0)
+        {
+            LOG_ERROR("Failed to allocate " << size << " bytes for ODE Journal file '" << filePath << "'");
+            close(fd);
+            return false;
+        }
+        void* pMap = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map ODE Journal file '" << filePath << "'");
+            close(fd);
+            return false;
+        }
+        OdeJournalHeader* pHeader = (OdeJournalHeader*)pMap;
+        
+        strncpy(pHeader->magic, DSL_ODE_JOURNAL_MAGIC, sizeof(pHeader->magic));
+        pHeader->version = DSL_ODE_JOURNAL_VERSION;
+        pHeader->recordSize = sizeof(dsl_ode_occurrence_record);
+        pHeader->capacity = m_capacity;
+        pHeader->recordCount = 0;
+        pHeader->fileIndex = generation;
+        pHeader->triggerCount = m_triggerNames.size();
+        for (uint i = 0; i < m_triggerNames.size(); i++)
+        {
+            strncpy(pHeader->triggerNames[i], m_triggerNames[i].c_str(), 
+                DSL_ODE_JOURNAL_MAX_TRIGGER_NAME - 1);
+        }
+        
+        mappedFile.fd = fd;
+        mappedFile.pHeader = pHeader;
+        mappedFile.pRecords = (dsl_ode_occurrence_record*)(pHeader + 1);
+        
+        LOG_INFO("ODE Journal file '" << filePath << "' created with capacity for " 
+            << m_capacity << " records");
+        return true;
+    }
+    
+    void OdeJournalWriter::closeFile(MappedFile& mappedFile, uint64_t recordCount)
+    {
+        LOG_FUNC();
+        
+        if (mappedFile.fd < 0)
+        {
+            return;
+        }
+        if (mappedFile.pHeader)
+        {
+            mappedFile.pHeader->recordCount = recordCount;
+            munmap(mappedFile.pHeader, 
+                sizeof(OdeJournalHeader) + m_capacity*sizeof(dsl_ode_occurrence_record));
+        }
+        if (ftruncate(mappedFile.fd, 
+            sizeof(OdeJournalHeader) + recordCount*sizeof(dsl_ode_occurrence_record)) != 0)
+        {
+            LOG_WARN("Failed to truncate ODE Journal file to " << recordCount << " records");
+        }
+        close(mappedFile.fd);
+        mappedFile = {-1, NULL, NULL};
+    }
+    
+    void OdeJournalWriter::rotate(uint64_t generation)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        // Wait for the writers that claimed a slot before the current file filled
+        // up to commit their records. No new slot can be claimed until the next 
+        // generation is stored below, so the wait is bounded by one record copy.
+        while (m_writersInFlight.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+        
+        // The file from the previous generation can now be closed and reused
+        MappedFile& nextFile = m_files[(generation + 1) & 1];
+        closeFile(nextFile, m_capacity);
+        
+        MappedFile& fullFile = m_files[generation & 1];
+        if (fullFile.pHeader)
+        {
+            fullFile.pHeader->recordCount = m_capacity;
+            msync(fullFile.pHeader, sizeof(OdeJournalHeader) + 
+                m_capacity*sizeof(dsl_ode_occurrence_record), MS_ASYNC);
+        }
+        
+        // On failure the next generation's records are dropped
+        // and the next rotation will try again.
+        openFile(generation + 1, nextFile);
+        
+        // The oldest file to delete was closed above, or on an earlier rotation
+        if (m_maxFiles and generation + 1 >= m_maxFiles)
+        {
+            std::string oldestFilePath(getFilePath(generation + 1 - m_maxFiles));
+            if (unlink(oldestFilePath.c_str()) != 0 and errno != ENOENT)
+            {
+                LOG_WARN("Failed to delete ODE Journal file '" << oldestFilePath << "'");
+            }
+        }
+        
+        m_claim.store((generation + 1) << DSL_ODE_JOURNAL_SLOT_BITS, std::memory_order_release);
+    }
+
+    // ********************************************************************
+
+    OdeJournalReader::OdeJournalReader(const char* filePath)
+        : m_fd(-1)
+        , m_size(0)
+        , m_pHeader(NULL)
+        , m_pRecords(NULL)
+        , m_recordSlots(0)
+    {
+        LOG_FUNC();
+        
+        m_fd = open(filePath, O_RDONLY);
+        if (m_fd < 0)
+        {
+            LOG_ERROR("Failed to open ODE Journal file '" << filePath << "'");
+            return;
+        }
+        struct stat info;
+        if (fstat(m_fd, &info) != 0 or (size_t)info.st_size < sizeof(OdeJournalHeader))
+        {
+            LOG_ERROR("File '" << filePath << "' is not an ODE Journal file");
+            return;
+        }
+        void* pMap = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, m_fd, 0);
+        if (pMap == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map ODE Journal file '" << filePath << "'");
+            return;
+        }
+        m_size = info.st_size;
+        m_pHeader = (const OdeJournalHeader*)pMap;
+        
+        if (strncmp(m_pHeader->magic, DSL_ODE_JOURNAL_MAGIC, sizeof(m_pHeader->magic)) or 
+            m_pHeader->version != DSL_ODE_JOURNAL_VERSION or
+            m_pHeader->recordSize != sizeof(dsl_ode_occurrence_record))
+        {
+            LOG_ERROR("File '" << filePath << "' is not a compatible ODE Journal file");
+            return;
+        }
+        m_pRecords = (const dsl_ode_occurrence_record*)(m_pHeader + 1);
+        m_recordSlots = std::min((uint64_t)m_pHeader->capacity, 
+            (m_size - sizeof(OdeJournalHeader)) / sizeof(dsl_ode_occurrence_record));
+        
+        madvise(pMap, m_size, MADV_SEQUENTIAL);
+    }
+    
+    OdeJournalReader::~OdeJournalReader()
+    {
+        LOG_FUNC();
+        
+        if (m_pHeader)
+        {
+            munmap((void*)m_pHeader, m_size);
+        }
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+        }
+    }
+    
+    uint64_t OdeJournalReader::Scan(const char* trigger, uint sourceId, uint64_t startTime, 
+        uint64_t endTime, std::function<void(const dsl_ode_occurrence_record&)> handler)
+    {
+        LOG_FUNC();
+        
+        uint triggerIndex(UINT32_MAX);
+        if (trigger)
+        {
+            for (uint i = 0; i < std::min(m_pHeader->triggerCount, (uint32_t)DSL_ODE_JOURNAL_MAX_TRIGGERS); i++)
+            {
+                if (strncmp(m_pHeader->triggerNames[i], trigger, DSL_ODE_JOURNAL_MAX_TRIGGER_NAME) == 0)
+                {
+                    triggerIndex = i;
+                    break;
+                }
+            }
+            if (triggerIndex == UINT32_MAX)
+            {
+                return 0;
+            }
+        }
+        uint64_t count(0);
+        for (uint64_t i = 0; i < m_recordSlots; i++)
+        {
+            const dsl_ode_occurrence_record& record = m_pRecords[i];
+            
+            // Event ids start at 1, so a zero id is a slot that was never written
+            if (record.event_id == 0 or
+                (trigger and record.trigger_index != triggerIndex) or
+                (sourceId != DSL_ODE_ANY_SOURCE and record.source_id != sourceId) or
+                record.ntp_timestamp < startTime or record.ntp_timestamp > endTime)
+            {
+                continue;
+            }
+            if (handler)
+            {
+                handler(record);
+            }
+            count++;
+        }
+        return count;
+    }
+    
+    int64_t OdeJournalReader::WriteCsv(const char* csvFilePath, const char* trigger, uint sourceId, 
+        uint64_t startTime, uint64_t endTime)
+    {
+        LOG_FUNC();
+        
+        std::ofstream csvFile(csvFilePath, std::ofstream::out | std::ofstream::trunc);
+        if (!csvFile.is_open())
+        {
+            LOG_ERROR("Failed to create CSV file '" << csvFilePath << "'");
+            return -1;
+        }
+        csvFile << "event_id,trigger,source_id,frame_num,ntp_timestamp,class_id,object_id,"
+            << "confidence,left,top,width,height\n";
+            
+        return Scan(trigger, sourceId, startTime, endTime, 
+            [&](const dsl_ode_occurrence_record& record)
+            {
+                csvFile << record.event_id << ',' << GetTriggerName(record.trigger_index) << ','
+                    << record.source_id << ',' << record.frame_num << ',' 
+                    << record.ntp_timestamp << ',' << record.class_id << ',';
+                if (record.is_object)
+                {
+                    csvFile << record.object_id;
+                }
+                csvFile << ',' << record.confidence << ',' << record.left << ',' 
+                    << record.top << ',' << record.width << ',' << record.height << '\n';
+            });
+    }
+    
+    std::string OdeJournalReader::GetTriggerName(uint triggerIndex)
+    {
+        if (triggerIndex >= std::min(m_pHeader->triggerCount, (uint32_t)DSL_ODE_JOURNAL_MAX_TRIGGERS))
+        {
+            return "";
+        }
+        // Names are stored null terminated, but don't trust the file
+        return std::string(m_pHeader->triggerNames[triggerIndex], 
+            strnlen(m_pHeader->triggerNames[triggerIndex], DSL_ODE_JOURNAL_MAX_TRIGGER_NAME));
+    }
+}
@@ -0,0 +1,359 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_JOURNAL_H
+#define _DSL_ODE_JOURNAL_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @brief identifies a file as an ODE Journal, followed by the format version.
+     */
+    #define DSL_ODE_JOURNAL_MAGIC "DSLJRNL"
+    #define DSL_ODE_JOURNAL_VERSION 1
+    
+    /**
+     * @brief maximum number of Trigger names stored in each file's header. 
+     * Records from additional Triggers are written with an unnamed index.
+     */
+    #define DSL_ODE_JOURNAL_MAX_TRIGGERS 62
+    
+    /**
+     * @brief maximum length of a stored Trigger name, including the terminator.
+     */
+    #define DSL_ODE_JOURNAL_MAX_TRIGGER_NAME 64
+    
+    /**
+     * @brief maximum number of records returned to a client per scan callback.
+     */
+    #define DSL_ODE_JOURNAL_SCAN_CHUNK_SIZE 1024
+
+    /**
+     * @struct OdeJournalHeader
+     * @brief Fixed size header at the start of every ODE Journal file. The 
+     * header is followed by a preallocated array of dsl_ode_occurrence_records.
+     */
+    struct OdeJournalHeader
+    {
+        /**
+         * @brief DSL_ODE_JOURNAL_MAGIC, null terminated.
+         */
+        char magic[8];
+        
+        /**
+         * @brief DSL_ODE_JOURNAL_VERSION of the writer.
+         */
+        uint32_t version;
+        
+        /**
+         * @brief sizeof(dsl_ode_occurrence_record) of the writer.
+         */
+        uint32_t recordSize;
+        
+        /**
+         * @brief number of records preallocated in the file.
+         */
+        uint64_t capacity;
+        
+        /**
+         * @brief number of records written, set when the file is closed.
+         * The file is truncated to this number of records on close.
+         */
+        uint64_t recordCount;
+        
+        /**
+         * @brief number of valid entries in triggerNames.
+         */
+        uint32_t triggerCount;
+        
+        /**
+         * @brief rotation index of the file, 0 for the first file.
+         */
+        uint32_t fileIndex;
+        
+        /**
+         * @brief Trigger names indexed by dsl_ode_occurrence_record.trigger_index.
+         */
+        char triggerNames[DSL_ODE_JOURNAL_MAX_TRIGGERS][DSL_ODE_JOURNAL_MAX_TRIGGER_NAME];
+        
+        /**
+         * @brief pads the header to a full page so the records are page aligned.
+         */
+        char reserved[88];
+    };
+    
+    static_assert(sizeof(OdeJournalHeader) == 4096, "ODE Journal header must be one page");
+    static_assert(sizeof(dsl_ode_occurrence_record) == 64, "ODE Journal records must be 64 bytes");
+
+    /**
+     * @class OdeJournalWriter
+     * @brief Appends records to a memory-mapped, preallocated journal file, rotating
+     * to a new file when full. Files after the first are named <filePath>.<index>.
+     * If a maximum file count is set, the oldest file is deleted on rotation.
+     * Each record is claimed with a single atomic fetch-add of a word holding
+     * both the file generation and the record slot within the file.
+     */
+    class OdeJournalWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Journal Writer class. Creates and maps the first file.
+         * @param[in] filePath path of the first journal file to create
+         * @param[in] maxSize maximum size of each file in bytes, including the header
+         * @param[in] maxFiles maximum number of files to keep, including the current
+         * file, 0 for no limit. A limit of 1 is raised to 2, as the previous file 
+         * is kept until the next rotation.
+         * @throws std::runtime_error if the first file can not be created and mapped
+         */
+        OdeJournalWriter(const char* filePath, uint64_t maxSize, uint maxFiles = 0);
+        
+        /**
+         * @brief dtor for the ODE Journal Writer class. Closes the current file
+         * and truncates it to the records written.
+         */
+        ~OdeJournalWriter();
+        
+        /**
+         * @brief Claims the next record, rotating to a new file if the current 
+         * file is full. The caller must fill the complete record, and then call
+         * CommitRecord, before the file can be rotated out and unmapped.
+         * @return pointer to the claimed record in the mapped file, or NULL if
+         * the current file failed to be created. NULL records are not committed.
+         */
+        dsl_ode_occurrence_record* ClaimRecord();
+        
+        /**
+         * @brief Commits a record returned by ClaimRecord once filled. The record 
+         * is not to be used after. Each thread must commit its record before 
+         * claiming the next, as a rotation waits for all claimed records.
+         */
+        void CommitRecord();
+        
+        /**
+         * @brief Stores a Trigger name in the current and previous file's headers, 
+         * as a record with the index may have been claimed in either, and in the 
+         * header of each file created after.
+         * @param[in] triggerIndex index to store the name at
+         * @param[in] name Trigger name to store, truncated if too long.
+         */
+        void AddTriggerName(uint triggerIndex, const std::string& name);
+        
+        /**
+         * @brief Gets the number of files created, including the current file.
+         * @return number of files created
+         */
+        uint GetFileCount();
+        
+        /**
+         * @brief Gets the number of records preallocated in each file.
+         * @return record capacity of each file
+         */
+        uint64_t GetCapacity()
+        {
+            return m_capacity;
+        }
+        
+    private:
+    
+        /**
+         * @brief a single mapped journal file.
+         */
+        struct MappedFile
+        {
+            int fd;
+            OdeJournalHeader* pHeader;
+            dsl_ode_occurrence_record* pRecords;
+        };
+    
+        /**
+         * @brief Creates, preallocates and maps the journal file for a given generation
+         * @param[in] generation generation of the file, also the rotation index
+         * @param[out] mappedFile the mapped file
+         * @return true on success, false otherwise
+         */
+        bool openFile(uint64_t generation, MappedFile& mappedFile);
+        
+        /**
+         * @brief Gets the path of the journal file for a given generation
+         * @param[in] generation generation of the file
+         * @return m_filePath for generation 0, <m_filePath>.<generation> otherwise
+         */
+        std::string getFilePath(uint64_t generation);
+        
+        /**
+         * @brief Closes a mapped file, truncating it to the given number of records
+         * @param[in] mappedFile the mapped file to close
+         * @param[in] recordCount number of records written to the file
+         */
+        void closeFile(MappedFile& mappedFile, uint64_t recordCount);
+        
+        /**
+         * @brief Rotates to the next generation. Called by the one writer that 
+         * claimed the first slot past the end of the current file.
+         * @param[in] generation the generation being retired
+         */
+        void rotate(uint64_t generation);
+        
+        /**
+         * @brief path of the first journal file.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief number of records preallocated in each file.
+         */
+        uint64_t m_capacity;
+        
+        /**
+         * @brief maximum number of files to keep, 0 for no limit.
+         */
+        uint m_maxFiles;
+        
+        /**
+         * @brief generation, in the upper bits, and next record slot, in the lower bits.
+         */
+        std::atomic<uint64_t> m_claim;
+        
+        /**
+         * @brief number of writers that have claimed, or are claiming, a record
+         * and have yet to commit it. Rotation waits for the count to drop to 0.
+         */
+        std::atomic<uint64_t> m_writersInFlight;
+        
+        /**
+         * @brief current and previous generation files indexed by generation & 1.
+         * The previous file is kept mapped until the next rotation so that Trigger
+         * names can still be added to its header.
+         */
+        MappedFile m_files[2];
+        
+        /**
+         * @brief mutex to protect rotation and the Trigger names.
+         */
+        GMutex m_writerMutex;
+        
+        /**
+         * @brief Trigger names indexed by trigger_index, copied to each new file.
+         */
+        std::vector<std::string> m_triggerNames;
+    };
+
+    /**
+     * @class OdeJournalReader
+     * @brief Maps a single journal file read-only to scan its records.
+     */
+    class OdeJournalReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Journal Reader class. The Reader is left
+         * invalid if the file can not be mapped or is not a journal file.
+         * @param[in] filePath path of the journal file to read
+         */
+        OdeJournalReader(const char* filePath);
+        
+        /**
+         * @brief dtor for the ODE Journal Reader class
+         */
+        ~OdeJournalReader();
+        
+        /**
+         * @brief Gets the valid state of the Reader, must be checked before use
+         * @return true if the file was mapped and is a compatible journal file
+         */
+        bool IsValid()
+        {
+            return (m_pRecords != NULL);
+        }
+        
+        /**
+         * @brief Scans the records that match all filters. Empty slots in a file 
+         * that was not closed are skipped.
+         * @param[in] trigger name of the Trigger to match, NULL for any Trigger
+         * @param[in] sourceId source id to match, DSL_ODE_ANY_SOURCE for any source
+         * @param[in] startTime minimum NTP timestamp to match
+         * @param[in] endTime maximum NTP timestamp to match
+         * @param[in] handler function to call with each matching record
+         * @return number of matching records.
+         */
+        uint64_t Scan(const char* trigger, uint sourceId, uint64_t startTime, 
+            uint64_t endTime, std::function<void(const dsl_ode_occurrence_record&)> handler);
+            
+        /**
+         * @brief Writes the records that match all filters to a CSV file
+         * @param[in] csvFilePath path of the CSV file to create
+         * @param[in] trigger name of the Trigger to match, NULL for any Trigger
+         * @param[in] sourceId source id to match, DSL_ODE_ANY_SOURCE for any source
+         * @param[in] startTime minimum NTP timestamp to match
+         * @param[in] endTime maximum NTP timestamp to match
+         * @return number of records written, or -1 if the file can't be created.
+         */
+        int64_t WriteCsv(const char* csvFilePath, const char* trigger, uint sourceId, 
+            uint64_t startTime, uint64_t endTime);
+            
+        /**
+         * @brief Gets the name of the Trigger for a trigger_index
+         * @param[in] triggerIndex index to look up
+         * @return the Trigger's name, or an empty string if not stored
+         */
+        std::string GetTriggerName(uint triggerIndex);
+        
+    private:
+    
+        /**
+         * @brief file descriptor of the mapped file.
+         */
+        int m_fd;
+    
+        /**
+         * @brief size of the mapped file in bytes.
+         */
+        size_t m_size;
+        
+        /**
+         * @brief the file's header.
+         */
+        const OdeJournalHeader* m_pHeader;
+        
+        /**
+         * @brief the file's records.
+         */
+        const dsl_ode_occurrence_record* m_pRecords;
+        
+        /**
+         * @brief number of record slots in the file.
+         */
+        uint64_t m_recordSlots;
+    };
+}
+
+#endif // _DSL_ODE_JOURNAL_H
@@ -0,0 +1,146 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeLine.h"
+
+namespace DSL
+{
+    // Initialize static Line update counter
+    std::atomic<uint64_t> OdeLine::s_updateCount(0);
+
+    OdeLine::OdeLine(const char* name, uint x1, uint y1, uint x2, uint y2, bool display)
+        : Base(name)
+        , m_lineParams{0}
+        , m_display(display)
+    {
+        LOG_FUNC();
+        
+        m_lineParams.x1 = x1;
+        m_lineParams.y1 = y1;
+        m_lineParams.x2 = x2;
+        m_lineParams.y2 = y2;
+        
+        // default line width and color
+        m_lineParams.line_width = 4;
+        m_lineParams.line_color.red = 1.0;
+        m_lineParams.line_color.green = 1.0;
+        m_lineParams.line_color.blue = 1.0;
+        m_lineParams.line_color.alpha = 0.8;
+
+        g_mutex_init(&m_propertyMutex);
+    }
+    
+    OdeLine::~OdeLine()
+    {
+        LOG_FUNC();
+
+        g_mutex_clear(&m_propertyMutex);
+    }
+        
+    void OdeLine::GetLine(uint* x1, uint* y1, uint* x2, uint* y2, bool* display)
+    {
+        LOG_FUNC();
+        
+        *x1 = m_lineParams.x1;
+        *y1 = m_lineParams.y1;
+        *x2 = m_lineParams.x2;
+        *y2 = m_lineParams.y2;
+        *display = m_display;
+    }
+    
+    void OdeLine::SetLine(uint x1, uint y1, uint x2, uint y2, bool display)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_lineParams.x1 = x1;
+        m_lineParams.y1 = y1;
+        m_lineParams.x2 = x2;
+        m_lineParams.y2 = y2;
+        m_display = display;
+        
+        s_updateCount++;
+    }
+    
+    void OdeLine::GetColor(double* red, double* green, double* blue, double* alpha)
+    {
+        LOG_FUNC();
+        
+        *red = m_lineParams.line_color.red;
+        *green = m_lineParams.line_color.green;
+        *blue = m_lineParams.line_color.blue;
+        *alpha = m_lineParams.line_color.alpha;
+    }
+
+    void OdeLine::SetColor(double red, double green, double blue, double alpha)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_lineParams.line_color.red = red;
+        m_lineParams.line_color.green = green;
+        m_lineParams.line_color.blue = blue;
+        m_lineParams.line_color.alpha = alpha;
+        
+        s_updateCount++;
+    }
+    
+    void OdeLine::CheckCrossings(const NvOSD_LineParams& line, 
+        OdeLineMovements& movements, std::vector<int8_t>& crossings)
+    {
+        uint count = movements.Size();
+        crossings.resize(count);
+        
+        const float ax = line.x1;
+        const float ay = line.y1;
+        const float bx = line.x2;
+        const float by = line.y2;
+        const float dx = bx - ax;
+        const float dy = by - ay;
+        
+        const float* __restrict__ x0 = movements.x0.data();
+        const float* __restrict__ y0 = movements.y0.data();
+        const float* __restrict__ x1 = movements.x1.data();
+        const float* __restrict__ y1 = movements.y1.data();
+        int8_t* __restrict__ pCrossings = crossings.data();
+        
+        // Branch free, so that the loop is vectorized. A movement crosses the line 
+        // if its end points are on opposite sides of the line, and the line's
+        // end points are on opposite sides of the movement.
+        for (uint i = 0; i < count; i++)
+        {
+            float fromSide = dx*(y0[i] - ay) - dy*(x0[i] - ax);
+            float toSide = dx*(y1[i] - ay) - dy*(x1[i] - ax);
+            
+            float mx = x1[i] - x0[i];
+            float my = y1[i] - y0[i];
+            float startSide = mx*(ay - y0[i]) - my*(ax - x0[i]);
+            float endSide = mx*(by - y0[i]) - my*(bx - x0[i]);
+            
+            int within = (startSide > 0) != (endSide > 0);
+            pCrossings[i] = (int8_t)(((toSide > 0) - (fromSide > 0)) * within);
+        }
+    }
+}
@@ -0,0 +1,170 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_LINE_H
+#define _DSL_ODE_LINE_H
+
+#include "Dsl.h"
+#include "DslBase.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_ODE_LINE_PTR std::shared_ptr<OdeLine>
+    #define DSL_ODE_LINE_NEW(name, x1, y1, x2, y2, display) \
+        std::shared_ptr<OdeLine>(new OdeLine(name, x1, y1, x2, y2, display))
+
+    /**
+     * @struct OdeLineMovements
+     * @brief Movements of a set of Objects, from their previous to their current 
+     * reference points, kept as a structure of arrays so that the crossing tests
+     * over all Objects in a frame are done in simple loops the compiler can vectorize.
+     */
+    struct OdeLineMovements
+    {
+        void Add(float fromX, float fromY, float toX, float toY)
+        {
+            x0.push_back(fromX);
+            y0.push_back(fromY);
+            x1.push_back(toX);
+            y1.push_back(toY);
+        };
+        
+        void Clear()
+        {
+            x0.clear();
+            y0.clear();
+            x1.clear();
+            y1.clear();
+        };
+        
+        uint Size(){return x0.size();};
+        
+        std::vector<float> x0;
+        std::vector<float> y0;
+        std::vector<float> x1;
+        std::vector<float> y1;
+    };
+
+    class OdeLine : public Base
+    {
+    public: 
+
+        /**
+         * @brief ctor for the OdeLine
+         * @param[in] x1 x coordinate of the line's start point in pixels
+         * @param[in] y1 y coordinate of the line's start point in pixels
+         * @param[in] x2 x coordinate of the line's end point in pixels
+         * @param[in] y2 y coordinate of the line's end point in pixels
+         * @param[in] display if true, the line will be displayed by adding meta data
+         */
+        OdeLine(const char* name, uint x1, uint y1, uint x2, uint y2, bool display);
+
+        /**
+         * @brief dtor for the OdeLine
+         */
+        ~OdeLine();
+
+        /**
+         * @brief Gets the current line segment
+         * @param[out] x1 x coordinate of the line's start point in pixels
+         * @param[out] y1 y coordinate of the line's start point in pixels
+         * @param[out] x2 x coordinate of the line's end point in pixels
+         * @param[out] y2 y coordinate of the line's end point in pixels
+         * @param[out] display if true, the line will be displayed by adding meta data
+         */
+        void GetLine(uint* x1, uint* y1, uint* x2, uint* y2, bool* display);
+
+        /**
+         * @brief Sets the current line segment
+         * @param[in] x1 x coordinate of the line's start point in pixels
+         * @param[in] y1 y coordinate of the line's start point in pixels
+         * @param[in] x2 x coordinate of the line's end point in pixels
+         * @param[in] y2 y coordinate of the line's end point in pixels
+         * @param[in] display if true, the line will be displayed by adding meta data
+         */
+        void SetLine(uint x1, uint y1, uint x2, uint y2, bool display);
+
+        /**
+         * @brief Gets the current line color
+         * @param[out] red red level for the line color [0..1]
+         * @param[out] blue blue level for the line color [0..1]
+         * @param[out] green green level for the line color [0..1]
+         * @param[out] alpha alpha level for the line color [0..1]
+         */
+        void GetColor(double* red, double* green, double* blue, double* alpha);
+        
+        /**
+         * @brief Sets the current line color
+         * @param[in] red red level for the line color [0..1]
+         * @param[in] blue blue level for the line color [0..1]
+         * @param[in] green green level for the line color [0..1]
+         * @param[in] alpha alpha level for the line color [0..1]
+         */
+        void SetColor(double red, double green, double blue, double alpha);
+        
+        /**
+         * @brief Tests a set of Object movements for crossings of a line segment. 
+         * A movement crosses the line if it moves from one side of the line to the 
+         * other, within the line's end points. Points on the line are on its left.
+         * @param[in] line line segment to test
+         * @param[in] movements Object movements to test
+         * @param[out] crossings for each movement, 1 if it crossed the line from 
+         * left to right, -1 if it crossed from right to left, and 0 otherwise. The 
+         * sides are as seen looking along the line from its start to its end point, 
+         * in frame coordinates with the y-axis down.
+         */
+        static void CheckCrossings(const NvOSD_LineParams& line, 
+            OdeLineMovements& movements, std::vector<int8_t>& crossings);
+        
+        /**
+         * @brief total count of all Line updates, incremented on every call to
+         * SetLine and SetColor. Allows the parent Triggers to know when to rebuild 
+         * their copies of the Lines.
+         */
+        static std::atomic<uint64_t> s_updateCount;
+        
+        /**
+         * @brief Line parameters for crossing tests and display
+         */
+        NvOSD_LineParams m_lineParams;
+        
+        /**
+         * @brief Display the line (add display meta) if true
+         */
+        bool m_display;
+        
+    private:
+
+        /**
+         * @brief Mutex to ensure mutual exlusion for propery get/sets
+         */
+        GMutex m_propertyMutex;
+    };
+}
+
+#endif //_DSL_ODE_LINE_H
@@ -0,0 +1,123 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeMetrics.h"
+
+namespace DSL
+{
+    OdeTriggerMetrics::OdeTriggerMetrics()
+    {
+        Reset();
+    }
+    
+    void OdeTriggerMetrics::AddBatch(uint64_t objectsEvaluated, uint64_t objectsPassed,
+        uint64_t occurrences, uint64_t evaluationTimeNs)
+    {
+        // Relaxed ordering only, each counter is independent of the others
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+        m_objectsEvaluated.fetch_add(objectsEvaluated, std::memory_order_relaxed);
+        m_objectsPassed.fetch_add(objectsPassed, std::memory_order_relaxed);
+        m_occurrences.fetch_add(occurrences, std::memory_order_relaxed);
+        m_evaluationTimeNs.fetch_add(evaluationTimeNs, std::memory_order_relaxed);
+        m_histogram[HistogramBucket(evaluationTimeNs)].fetch_add(1, 
+            std::memory_order_relaxed);
+    }
+    
+    void OdeTriggerMetrics::Get(dsl_ode_trigger_metrics* metrics)
+    {
+        metrics->batches = m_batches.load(std::memory_order_relaxed);
+        metrics->objects_evaluated = m_objectsEvaluated.load(std::memory_order_relaxed);
+        metrics->objects_passed = m_objectsPassed.load(std::memory_order_relaxed);
+        metrics->occurrences = m_occurrences.load(std::memory_order_relaxed);
+        metrics->evaluation_time_ns = m_evaluationTimeNs.load(std::memory_order_relaxed);
+        for (uint i = 0; i < DSL_ODE_METRICS_HISTOGRAM_BUCKETS; i++)
+        {
+            metrics->evaluation_time_histogram[i] = 
+                m_histogram[i].load(std::memory_order_relaxed);
+        }
+    }
+    
+    void OdeTriggerMetrics::Reset()
+    {
+        m_batches.store(0);
+        m_objectsEvaluated.store(0);
+        m_objectsPassed.store(0);
+        m_occurrences.store(0);
+        m_evaluationTimeNs.store(0);
+        for (auto& bucket: m_histogram)
+        {
+            bucket.store(0);
+        }
+    }
+    
+    uint OdeTriggerMetrics::HistogramBucket(uint64_t evaluationTimeNs)
+    {
+        // bucket n holds times from 2^(n-1) up to 2^n microseconds
+        uint64_t timeUs = evaluationTimeNs / 1000;
+        uint bucket(0);
+        while (timeUs and bucket < DSL_ODE_METRICS_HISTOGRAM_BUCKETS-1)
+        {
+            timeUs >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+    
+    // ********************************************************************
+
+    OdeActionMetrics::OdeActionMetrics()
+    {
+        Reset();
+    }
+    
+    void OdeActionMetrics::AddInvocation(uint64_t executionTimeNs)
+    {
+        m_invocations.fetch_add(1, std::memory_order_relaxed);
+        m_executionTimeNs.fetch_add(executionTimeNs, std::memory_order_relaxed);
+        
+        // An Action can be shared by Triggers on different streaming threads
+        uint64_t maxExecutionTimeNs = m_maxExecutionTimeNs.load(std::memory_order_relaxed);
+        while (executionTimeNs > maxExecutionTimeNs and 
+            !m_maxExecutionTimeNs.compare_exchange_weak(maxExecutionTimeNs, 
+                executionTimeNs, std::memory_order_relaxed))
+        {
+        }
+    }
+    
+    void OdeActionMetrics::Get(dsl_ode_action_metrics* metrics)
+    {
+        metrics->invocations = m_invocations.load(std::memory_order_relaxed);
+        metrics->execution_time_ns = m_executionTimeNs.load(std::memory_order_relaxed);
+        metrics->max_execution_time_ns = m_maxExecutionTimeNs.load(std::memory_order_relaxed);
+    }
+    
+    void OdeActionMetrics::Reset()
+    {
+        m_invocations.store(0);
+        m_executionTimeNs.store(0);
+        m_maxExecutionTimeNs.store(0);
+    }
+}
@@ -0,0 +1,139 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_METRICS_H
+#define _DSL_ODE_METRICS_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief Gets the current monotonic time for ODE metrics
+     * @return current time in nanoseconds
+     */
+    inline uint64_t OdeMetricsTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @class OdeTriggerMetrics
+     * @brief Lock-free performance counters for an ODE Trigger. The counters are
+     * added to once per batch by the streaming thread and can be read or reset
+     * from any thread. 
+     */
+    class OdeTriggerMetrics
+    {
+    public:
+    
+        OdeTriggerMetrics();
+        
+        /**
+         * @brief Adds the counts for one batch
+         * @param[in] objectsEvaluated number of Objects evaluated in the batch
+         * @param[in] objectsPassed number of Objects that passed all criteria
+         * @param[in] occurrences number of occurrences triggered in the batch
+         * @param[in] evaluationTimeNs time spent on the batch in nanoseconds
+         */
+        void AddBatch(uint64_t objectsEvaluated, uint64_t objectsPassed,
+            uint64_t occurrences, uint64_t evaluationTimeNs);
+            
+        /**
+         * @brief Gets a snapshot of the current counters. Each counter is read 
+         * atomically, although a batch may be added while the snapshot is taken.
+         * @param[out] metrics client structure to fill
+         */
+        void Get(dsl_ode_trigger_metrics* metrics);
+        
+        /**
+         * @brief Resets all counters to zero
+         */
+        void Reset();
+        
+        /**
+         * @brief Gets the histogram bucket for a given evaluation time
+         * @param[in] evaluationTimeNs time spent on a batch in nanoseconds
+         * @return bucket index, in the range [0..DSL_ODE_METRICS_HISTOGRAM_BUCKETS)
+         */
+        static uint HistogramBucket(uint64_t evaluationTimeNs);
+        
+    private:
+    
+        std::atomic<uint64_t> m_batches;
+        
+        std::atomic<uint64_t> m_objectsEvaluated;
+        
+        std::atomic<uint64_t> m_objectsPassed;
+        
+        std::atomic<uint64_t> m_occurrences;
+        
+        std::atomic<uint64_t> m_evaluationTimeNs;
+        
+        std::atomic<uint64_t> m_histogram[DSL_ODE_METRICS_HISTOGRAM_BUCKETS];
+    };
+
+    /**
+     * @class OdeActionMetrics
+     * @brief Lock-free performance counters for an ODE Action. The counters are
+     * added to by the thread handling the Action's occurrences, either the 
+     * streaming thread or the shared executor, and can be read or reset from any thread.
+     */
+    class OdeActionMetrics
+    {
+    public:
+    
+        OdeActionMetrics();
+        
+        /**
+         * @brief Adds one handled occurrence
+         * @param[in] executionTimeNs time spent handling the occurrence in nanoseconds
+         */
+        void AddInvocation(uint64_t executionTimeNs);
+        
+        /**
+         * @brief Gets a snapshot of the current counters. 
+         * @param[out] metrics client structure to fill, less the dropped count
+         */
+        void Get(dsl_ode_action_metrics* metrics);
+        
+        /**
+         * @brief Resets all counters to zero
+         */
+        void Reset();
+        
+    private:
+    
+        std::atomic<uint64_t> m_invocations;
+        
+        std::atomic<uint64_t> m_executionTimeNs;
+        
+        std::atomic<uint64_t> m_maxExecutionTimeNs;
+    };
+}
+
+#endif // _DSL_ODE_METRICS_H
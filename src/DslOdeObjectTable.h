@@ -0,0 +1,285 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_OBJECT_TABLE_H
+#define _DSL_ODE_OBJECT_TABLE_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @class OdeObjectTable
+     * @brief Open-addressing hash table, with linear probing, of per Object values 
+     * keyed on Source Id and tracked Object Id. Entries are stored inline in a 
+     * single power-of-two sized array. Entries are removed in bulk with EraseIf, 
+     * which the owner uses to evict Objects that are no longer being seen.
+     */
+    template<typename T>
+    class OdeObjectTable
+    {
+    public:
+    
+        OdeObjectTable(uint initialCapacity = 64)
+            : m_size(0)
+        {
+            uint capacity(16);
+            while (capacity < initialCapacity)
+            {
+                capacity <<= 1;
+            }
+            m_entries.resize(capacity);
+        };
+        
+        /**
+         * @brief Finds the value for an Object
+         * @param[in] sourceId Source Id of the Object's Frame
+         * @param[in] objectId tracked Object Id
+         * @return pointer to the value if found, NULL otherwise
+         */
+        T* Find(uint sourceId, uint64_t objectId)
+        {
+            for (uint i = hash(sourceId, objectId);; i = (i + 1) & mask())
+            {
+                Entry& entry = m_entries[i];
+                if (!entry.used)
+                {
+                    return NULL;
+                }
+                if (entry.objectId == objectId and entry.sourceId == sourceId)
+                {
+                    return &entry.value;
+                }
+            }
+        };
+        
+        /**
+         * @brief Finds the value for an Object, inserting a value initialized entry
+         * if not found. Values returned by earlier calls are invalidated on insert.
+         * @param[in] sourceId Source Id of the Object's Frame
+         * @param[in] objectId tracked Object Id
+         * @param[out] inserted set to true if a new entry was inserted
+         * @return reference to the Object's value
+         */
+        T& FindOrInsert(uint sourceId, uint64_t objectId, bool* inserted)
+        {
+            if (IsFull())
+            {
+                rehash(m_entries.size() * 2);
+            }
+            for (uint i = hash(sourceId, objectId);; i = (i + 1) & mask())
+            {
+                Entry& entry = m_entries[i];
+                if (!entry.used)
+                {
+                    entry.used = true;
+                    entry.sourceId = sourceId;
+                    entry.objectId = objectId;
+                    entry.value = T();
+                    m_size++;
+                    *inserted = true;
+                    return entry.value;
+                }
+                if (entry.objectId == objectId and entry.sourceId == sourceId)
+                {
+                    *inserted = false;
+                    return entry.value;
+                }
+            }
+        };
+        
+        /**
+         * @brief Removes the entry for an Object, shifting the entries that follow
+         * it in the probe sequence back so that no tombstones are left behind.
+         * Values returned by earlier calls are invalidated on erase.
+         * @param[in] sourceId Source Id of the Object's Frame
+         * @param[in] objectId tracked Object Id
+         * @return true if the entry was found and removed
+         */
+        bool Erase(uint sourceId, uint64_t objectId)
+        {
+            uint i = hash(sourceId, objectId);
+            for (;; i = (i + 1) & mask())
+            {
+                if (!m_entries[i].used)
+                {
+                    return false;
+                }
+                if (m_entries[i].objectId == objectId and m_entries[i].sourceId == sourceId)
+                {
+                    break;
+                }
+            }
+            m_entries[i].used = false;
+            m_size--;
+            
+            for (uint j = (i + 1) & mask(); m_entries[j].used; j = (j + 1) & mask())
+            {
+                // An entry can fill the hole only if its home slot is not 
+                // cyclically within (i, j], i.e. the hole is on its probe sequence
+                uint home = hash(m_entries[j].sourceId, m_entries[j].objectId);
+                if (((j - home) & mask()) >= ((j - i) & mask()))
+                {
+                    m_entries[i] = m_entries[j];
+                    m_entries[j].used = false;
+                    i = j;
+                }
+            }
+            return true;
+        };
+        
+        /**
+         * @brief Removes all entries for which a predicate returns true, rebuilding
+         * the table once. If less than a quarter of the entries are removed, the 
+         * capacity is doubled on rebuild, so that an owner that sweeps whenever the
+         * table IsFull() sweeps at most once for every capacity/8 inserts.
+         * @param[in] predicate callable with (uint sourceId, uint64_t objectId, T& value)
+         * @return number of entries removed
+         */
+        template<typename P>
+        uint EraseIf(P predicate)
+        {
+            uint size(m_size);
+            
+            for (auto& entry: m_entries)
+            {
+                if (entry.used and predicate(entry.sourceId, entry.objectId, entry.value))
+                {
+                    entry.used = false;
+                    m_size--;
+                }
+            }
+            uint erased(size - m_size);
+            
+            rehash((erased * 4 < size) ? m_entries.size() * 2 : m_entries.size());
+            return erased;
+        };
+        
+        /**
+         * @brief Calls a function for every entry in the table
+         * @param[in] function callable with (uint sourceId, uint64_t objectId, T& value)
+         */
+        template<typename F>
+        void ForEach(F function)
+        {
+            for (auto& entry: m_entries)
+            {
+                if (entry.used)
+                {
+                    function(entry.sourceId, entry.objectId, entry.value);
+                }
+            }
+        };
+        
+        /**
+         * @brief Removes all entries, keeping the current capacity
+         */
+        void Clear()
+        {
+            for (auto& entry: m_entries)
+            {
+                entry.used = false;
+            }
+            m_size = 0;
+        };
+        
+        /**
+         * @brief returns the number of entries in the table
+         */
+        uint Size(){return m_size;};
+        
+        /**
+         * @brief returns the number of slots in the table
+         */
+        uint Capacity(){return m_entries.size();};
+        
+        /**
+         * @brief returns the number of bytes allocated for the slots
+         */
+        size_t GetMemoryUsed(){return m_entries.capacity() * sizeof(Entry);};
+        
+        /**
+         * @brief returns true if the next insert will grow the table, i.e. the 
+         * load factor has reached one half. Allows the owner to evict first.
+         */
+        bool IsFull(){return (m_size + 1) * 2 > m_entries.size();};
+        
+    private:
+    
+        struct Entry
+        {
+            Entry() : objectId(0), sourceId(0), used(false), value() {};
+            
+            uint64_t objectId;
+            uint sourceId;
+            bool used;
+            T value;
+        };
+        
+        uint mask(){return m_entries.size() - 1;};
+        
+        uint hash(uint sourceId, uint64_t objectId)
+        {
+            // splitmix64 finalizer
+            uint64_t key = objectId ^ ((uint64_t)sourceId << 48) ^ sourceId;
+            key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+            key = key ^ (key >> 31);
+            return (uint)key & mask();
+        };
+        
+        void insert(Entry& entry)
+        {
+            uint i = hash(entry.sourceId, entry.objectId);
+            while (m_entries[i].used)
+            {
+                i = (i + 1) & mask();
+            }
+            m_entries[i] = entry;
+            m_size++;
+        };
+        
+        void rehash(uint capacity)
+        {
+            std::vector<Entry> entries(capacity);
+            entries.swap(m_entries);
+            m_size = 0;
+            
+            for (auto& entry: entries)
+            {
+                if (entry.used)
+                {
+                    insert(entry);
+                }
+            }
+        };
+        
+        std::vector<Entry> m_entries;
+        
+        uint m_size;
+    };
+}
+
+#endif // _DSL_ODE_OBJECT_TABLE_H
@@ -0,0 +1,150 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeTrackStore.h"
+
+namespace DSL
+{
+    OdeTrackStore::OdeTrackStore(uint maxAge, uint initialCapacity)
+        : m_maxAge(maxAge)
+        , m_generation(0)
+        , m_index(initialCapacity * 2)
+        , m_oldest(DSL_ODE_TRACK_NONE)
+        , m_newest(DSL_ODE_TRACK_NONE)
+    {
+        m_tracks.reserve(initialCapacity);
+        m_free.reserve(initialCapacity);
+    }
+    
+    void OdeTrackStore::NewFrame()
+    {
+        m_generation++;
+    }
+    
+    OdeTrack& OdeTrackStore::Touch(uint64_t objectId, 
+        uint64_t frameNum, uint64_t timeNs, bool* inserted)
+    {
+        // Tracks are indexed with a single source, the store is per source
+        uint& slot = m_index.FindOrInsert(0, objectId, inserted);
+        
+        if (*inserted)
+        {
+            if (m_free.size())
+            {
+                slot = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                slot = m_tracks.size();
+                m_tracks.emplace_back();
+            }
+            OdeTrack& track = m_tracks[slot];
+            track.objectId = objectId;
+            track.firstFrame = frameNum;
+            track.firstTimeNs = timeNs;
+            track.triggered = false;
+            append(slot);
+        }
+        else if (slot != m_newest)
+        {
+            unlink(slot);
+            append(slot);
+        }
+        OdeTrack& track = m_tracks[slot];
+        track.lastFrame = frameNum;
+        track.lastTimeNs = timeNs;
+        track.generation = m_generation;
+        return track;
+    }
+    
+    OdeTrack* OdeTrackStore::Find(uint64_t objectId)
+    {
+        uint* pSlot = m_index.Find(0, objectId);
+        return pSlot ? &m_tracks[*pSlot] : NULL;
+    }
+    
+    void OdeTrackStore::Clear()
+    {
+        m_index.Clear();
+        m_tracks.clear();
+        m_free.clear();
+        m_oldest = DSL_ODE_TRACK_NONE;
+        m_newest = DSL_ODE_TRACK_NONE;
+    }
+    
+    size_t OdeTrackStore::GetMemoryUsed()
+    {
+        return m_tracks.capacity() * sizeof(OdeTrack) + 
+            m_free.capacity() * sizeof(uint) + m_index.GetMemoryUsed();
+    }
+    
+    void OdeTrackStore::unlink(uint track)
+    {
+        OdeTrack& entry = m_tracks[track];
+        
+        if (entry.prev == DSL_ODE_TRACK_NONE)
+        {
+            m_oldest = entry.next;
+        }
+        else
+        {
+            m_tracks[entry.prev].next = entry.next;
+        }
+        if (entry.next == DSL_ODE_TRACK_NONE)
+        {
+            m_newest = entry.prev;
+        }
+        else
+        {
+            m_tracks[entry.next].prev = entry.prev;
+        }
+    }
+    
+    void OdeTrackStore::append(uint track)
+    {
+        OdeTrack& entry = m_tracks[track];
+        
+        entry.prev = m_newest;
+        entry.next = DSL_ODE_TRACK_NONE;
+        if (m_newest == DSL_ODE_TRACK_NONE)
+        {
+            m_oldest = track;
+        }
+        else
+        {
+            m_tracks[m_newest].next = track;
+        }
+        m_newest = track;
+    }
+    
+    void OdeTrackStore::remove(uint track)
+    {
+        unlink(track);
+        m_index.Erase(0, m_tracks[track].objectId);
+        m_free.push_back(track);
+    }
+}
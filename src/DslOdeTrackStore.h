@@ -0,0 +1,215 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_TRACK_STORE_H
+#define _DSL_ODE_TRACK_STORE_H
+
+#include "Dsl.h"
+#include "DslOdeObjectTable.h"
+
+namespace DSL
+{
+    /**
+     * @brief slab index used to terminate the last-seen list
+     */
+    #define DSL_ODE_TRACK_NONE UINT32_MAX
+
+    /**
+     * @struct OdeTrack
+     * @brief State kept for each tracked Object, from first seen to expired
+     */
+    struct OdeTrack
+    {
+        /**
+         * @brief tracked Object Id, unique per source
+         */
+        uint64_t objectId;
+        
+        /**
+         * @brief frame number and timestamp when the Object was first seen
+         */
+        uint64_t firstFrame;
+        uint64_t firstTimeNs;
+        
+        /**
+         * @brief frame number and timestamp when the Object was last seen
+         */
+        uint64_t lastFrame;
+        uint64_t lastTimeNs;
+        
+        /**
+         * @brief store generation when the Object was last seen
+         */
+        uint64_t generation;
+        
+        /**
+         * @brief set by the owner once the track has triggered an occurrence
+         */
+        bool triggered;
+        
+        /**
+         * @brief reference point of the Object when last seen, kept by the owner
+         */
+        float x;
+        float y;
+        
+        /**
+         * @brief previous and next tracks in last-seen order, slab indices
+         */
+        uint prev;
+        uint next;
+    };
+
+    /**
+     * @class OdeTrackStore
+     * @brief Tracked Objects for a single source. Tracks are allocated from a slab, 
+     * with freed entries reused, and indexed by Object Id with an OdeObjectTable.
+     * Each frame is a new generation. Tracks are kept in last-seen order so that 
+     * the tracks not seen for a given number of generations are expired from the 
+     * front of the list, in time proportional to the number of tracks expired.
+     */
+    class OdeTrackStore
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeTrackStore class
+         * @param[in] maxAge number of frames a track can go unseen before it expires
+         * @param[in] initialCapacity number of tracks to allocate up front
+         */
+        OdeTrackStore(uint maxAge, uint initialCapacity = 64);
+        
+        /**
+         * @brief Starts a new generation, called once per frame before the frame's
+         * Objects are added with Touch
+         */
+        void NewFrame();
+        
+        /**
+         * @brief Records an Object as seen on the current frame, adding a new track
+         * if the Object is not found. References returned by earlier calls are 
+         * invalidated when a new track is added.
+         * @param[in] objectId tracked Object Id
+         * @param[in] frameNum frame number of the current frame
+         * @param[in] timeNs timestamp of the current frame
+         * @param[out] inserted set to true if a new track was added
+         * @return reference to the Object's track
+         */
+        OdeTrack& Touch(uint64_t objectId, uint64_t frameNum, uint64_t timeNs, bool* inserted);
+        
+        /**
+         * @brief Finds the track for an Object
+         * @param[in] objectId tracked Object Id
+         * @return pointer to the track if found, NULL otherwise
+         */
+        OdeTrack* Find(uint64_t objectId);
+        
+        /**
+         * @brief Expires all tracks not seen within the last maxAge generations
+         * @param[in] expired callable with (OdeTrack& track), called for each 
+         * track before it is removed
+         * @return number of tracks expired
+         */
+        template<typename F>
+        uint Expire(F expired)
+        {
+            uint count(0);
+            while (m_oldest != DSL_ODE_TRACK_NONE and 
+                m_generation - m_tracks[m_oldest].generation > m_maxAge)
+            {
+                OdeTrack& track = m_tracks[m_oldest];
+                expired(track);
+                remove(m_oldest);
+                count++;
+            }
+            return count;
+        };
+        
+        /**
+         * @brief Removes all tracks, keeping the current capacity
+         */
+        void Clear();
+        
+        /**
+         * @brief returns the number of live tracks
+         */
+        uint Size(){return m_index.Size();};
+        
+        /**
+         * @brief returns the number of bytes allocated for the slab and index
+         */
+        size_t GetMemoryUsed();
+        
+    private:
+    
+        /**
+         * @brief unlinks a track from the last-seen list
+         */
+        void unlink(uint track);
+        
+        /**
+         * @brief links a track to the end of the last-seen list
+         */
+        void append(uint track);
+        
+        /**
+         * @brief removes a track from the index and returns it to the slab
+         */
+        void remove(uint track);
+        
+        /**
+         * @brief number of generations a track can go unseen before it expires
+         */
+        uint m_maxAge;
+        
+        /**
+         * @brief current generation, incremented on each new frame
+         */
+        uint64_t m_generation;
+        
+        /**
+         * @brief slab of tracks, in-use and free
+         */
+        std::vector<OdeTrack> m_tracks;
+        
+        /**
+         * @brief free slab entries to reuse before growing the slab
+         */
+        std::vector<uint> m_free;
+        
+        /**
+         * @brief slab index of each track, keyed on Object Id
+         */
+        OdeObjectTable<uint> m_index;
+        
+        /**
+         * @brief least and most recently seen tracks, slab indices
+         */
+        uint m_oldest;
+        uint m_newest;
+    };
+}
+
+#endif // _DSL_ODE_TRACK_STORE_H
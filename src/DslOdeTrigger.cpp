@@ -31,7 +31,82 @@ namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    std::atomic<uint64_t> OdeTrigger::s_eventCount(0);
+    
+    thread_local uint64_t OdeTrigger::s_eventId = 0;
+
+    /**
+     * @brief Object filter check for one combination of DSL_ODE_CRITERIA_* filters.
+     * Filters not in FILTERS are known to pass, and are removed at compile time.
+     */
+    template<uint FILTERS>
+    static bool checkCriteriaFilters(const OdeTriggerCriteria& criteria,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if ((FILTERS & DSL_ODE_CRITERIA_CLASS) and 
+            (criteria.classId != pObjectMeta->class_id))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_SOURCE) and 
+            (criteria.sourceId != pFrameMeta->source_id))
+        {
+            return false;
+        }
+        // Temporary hack? GIE is now reporting negative confidence without patch
+        if ((FILTERS & DSL_ODE_CRITERIA_CONFIDENCE) and 
+            (pObjectMeta->confidence > 0) and (pObjectMeta->confidence < criteria.minConfidence))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_MIN_WIDTH) and 
+            (pObjectMeta->rect_params.width < criteria.minWidth))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_MIN_HEIGHT) and 
+            (pObjectMeta->rect_params.height < criteria.minHeight))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_MAX_WIDTH) and 
+            (pObjectMeta->rect_params.width > criteria.maxWidth))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_MAX_HEIGHT) and 
+            (pObjectMeta->rect_params.height > criteria.maxHeight))
+        {
+            return false;
+        }
+        if ((FILTERS & DSL_ODE_CRITERIA_INFER_DONE) and !pFrameMeta->bInferDone)
+        {
+            return false;
+        }
+        return true;
+    }
+    
+    template<uint... FILTERS>
+    static const OdeTriggerCriteriaCheck* criteriaChecks(
+        std::integer_sequence<uint, FILTERS...>)
+    {
+        static const OdeTriggerCriteriaCheck checks[] = 
+            {&checkCriteriaFilters<FILTERS>...};
+        return checks;
+    }
+    
+    /**
+     * @brief Gets the Object filter check specialized for a set of filters
+     * @param[in] filters mask of DSL_ODE_CRITERIA_* filters
+     * @return check for the filters
+     */
+    static OdeTriggerCriteriaCheck criteriaCheck(uint filters)
+    {
+        static const OdeTriggerCriteriaCheck* checks = 
+            criteriaChecks(std::make_integer_sequence<uint, DSL_ODE_CRITERIA_ALL+1>());
+            
+        return checks[filters & DSL_ODE_CRITERIA_ALL];
+    }
 
     OdeTrigger::OdeTrigger(const char* name, 
         uint classId, uint limit)
@@ -51,10 +126,21 @@ namespace DSL
         , m_minFrameCountN(1)
         , m_minFrameCountD(1)
         , m_inferDoneOnly(false)
+        , m_areaListUpdates(0)
+        , m_areaIndexListUpdates(0)
+        , m_areaIndexAreaUpdates(0)
+        , m_areasPreChecked(false)
+        , m_preCheckedListUpdates(0)
+        , m_preCheckedAreaUpdates(0)
+        , m_criteriaPreChecked(false)
+        , m_batchObjectsPassed(0)
+        , m_batchOccurrences(0)
     {
         LOG_FUNC();
 
         g_mutex_init(&m_propertyMutex);
+        
+        publishCriteria();
     }
 
     OdeTrigger::~OdeTrigger()
@@ -107,6 +193,7 @@ namespace DSL
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (m_pOdeAreas.find(pChild->GetName()) != m_pOdeAreas.end())
         {
@@ -114,20 +201,24 @@ namespace DSL
             return false;
         }
         m_pOdeAreas[pChild->GetName()] = pChild;
+        m_areaListUpdates++;
         return true;
     }
 
     bool OdeTrigger::RemoveArea(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_pOdeAreas.erase(pChild->GetName());
+        m_areaListUpdates++;
         return true;
     }
     
     void OdeTrigger::RemoveAllAreas()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         for (auto &imap: m_pOdeAreas)
         {
@@ -135,6 +226,7 @@ namespace DSL
             imap.second->ClearParentName();
         }
         m_pOdeAreas.clear();
+        m_areaListUpdates++;
     }
     
     void OdeTrigger::Reset()
@@ -145,6 +237,41 @@ namespace DSL
         m_triggered = 0;
     }
         
+    uint64_t OdeTrigger::NextEventId()
+    {
+        s_eventId = s_eventCount.fetch_add(1) + 1;
+        return s_eventId;
+    }
+    
+    void OdeTrigger::newEvent()
+    {
+        NextEventId();
+        m_batchOccurrences++;
+    }
+    
+    void OdeTrigger::AddBatchMetrics(uint objectsEvaluated, uint64_t evaluationTimeNs)
+    {
+        m_metrics.AddBatch(objectsEvaluated, m_batchObjectsPassed, 
+            m_batchOccurrences, evaluationTimeNs);
+            
+        m_batchObjectsPassed = 0;
+        m_batchOccurrences = 0;
+    }
+    
+    void OdeTrigger::GetMetrics(dsl_ode_trigger_metrics* metrics)
+    {
+        LOG_FUNC();
+        
+        m_metrics.Get(metrics);
+    }
+    
+    void OdeTrigger::ResetMetrics()
+    {
+        LOG_FUNC();
+        
+        m_metrics.Reset();
+    }
+        
     bool OdeTrigger::GetEnabled()
     {
         LOG_FUNC();
@@ -174,6 +301,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_classId = classId;
+        publishCriteria();
     }
 
     uint OdeTrigger::GetSourceId()
@@ -189,6 +317,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_sourceId = sourceId;
+        publishCriteria();
     }
 
     double OdeTrigger::GetMinConfidence()
@@ -204,6 +333,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_minConfidence = minConfidence;
+        publishCriteria();
     }
     
     void OdeTrigger::GetMinDimensions(uint* minWidth, uint* minHeight)
@@ -221,6 +351,7 @@ namespace DSL
         
         m_minWidth = minWidth;
         m_minHeight = minHeight;
+        publishCriteria();
     }
     
     void OdeTrigger::GetMaxDimensions(uint* maxWidth, uint* maxHeight)
@@ -238,6 +369,7 @@ namespace DSL
         
         m_maxWidth = maxWidth;
         m_maxHeight = maxHeight;
+        publishCriteria();
     }
     
     bool OdeTrigger::GetInferDoneOnlySetting()
@@ -250,8 +382,10 @@ namespace DSL
     void OdeTrigger::SetInferDoneOnlySetting(bool inferDoneOnly)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_inferDoneOnly = inferDoneOnly;
+        publishCriteria();
     }
     
     void OdeTrigger::GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD)
@@ -262,13 +396,92 @@ namespace DSL
         *minFrameCountD = m_minFrameCountD;
     }
 
-    void OdeTrigger::SetMinFrameCount(uint minFrameCountN, uint minFrameCountD)
+    bool OdeTrigger::SetMinFrameCount(uint minFrameCountN, uint minFrameCountD)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        if ((minFrameCountD > DSL_ODE_TRIGGER_MAX_FRAME_COUNT_D) or (minFrameCountN > minFrameCountD))
+        {
+            LOG_ERROR("Invalid minimum frame count of " << minFrameCountN << " of " 
+                << minFrameCountD << " for ODE Trigger '" << GetName() << "'");
+            return false;
+        }
         m_minFrameCountN = minFrameCountN;
         m_minFrameCountD = minFrameCountD;
+        publishCriteria();
+        return true;
+    }
+    
+    void OdeTrigger::EvaluateMinCriteria(OdeObjectBatch& batch, std::vector<uint64_t>& mask)
+    {
+        // The snapshot evaluated is used for the rest of the batch, so that Objects 
+        // with their bit set do not need to be filtered again in checkForMinCriteria
+        m_batchCriteria = m_criteria.Load();
+        batch.EvaluateCriteria(m_batchCriteria, mask);
+        m_criteriaPreChecked = true;
+    }
+    
+    void OdeTrigger::publishCriteria()
+    {
+        OdeTriggerCriteria criteria;
+        
+        criteria.classId = m_classId;
+        criteria.sourceId = m_sourceId;
+        criteria.minConfidence = m_minConfidence;
+        criteria.minWidth = m_minWidth;
+        criteria.minHeight = m_minHeight;
+        criteria.maxWidth = m_maxWidth;
+        criteria.maxHeight = m_maxHeight;
+        criteria.inferDoneOnly = m_inferDoneOnly;
+        criteria.minFrameCountN = m_minFrameCountN;
+        criteria.minFrameCountD = m_minFrameCountD;
+        
+        // Only the filters that can fail an Object are checked. An unset dimension
+        // can never fail, nor can a minimum confidence of zero or less.
+        criteria.filters = 0;
+        if (criteria.classId != DSL_ODE_ANY_CLASS)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_CLASS;
+        }
+        if (criteria.sourceId != DSL_ODE_ANY_SOURCE)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_SOURCE;
+        }
+        if (criteria.minConfidence > 0)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_CONFIDENCE;
+        }
+        if (criteria.minWidth)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_MIN_WIDTH;
+        }
+        if (criteria.minHeight)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_MIN_HEIGHT;
+        }
+        if (criteria.maxWidth)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_MAX_WIDTH;
+        }
+        if (criteria.maxHeight)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_MAX_HEIGHT;
+        }
+        if (criteria.inferDoneOnly)
+        {
+            criteria.filters |= DSL_ODE_CRITERIA_INFER_DONE;
+        }
+        criteria.check = criteriaCheck(criteria.filters);
+        
+        m_criteria.Store(criteria);
+    }
+    
+    uint OdeTrigger::GetCriteriaFilters()
+    {
+        LOG_FUNC();
+        
+        return m_criteria.Load().filters;
     }
 
     void OdeTrigger::PreProcessFrame(GstBuffer* pBuffer,
@@ -280,114 +493,192 @@ namespace DSL
         }
         // Reset the occurrences from the last frame. 
         m_occurrences = 0;
+        
+        updateAreaIndex();
 
-        for (const auto &imap: m_pOdeAreas)
+        for (const auto &pOdeArea: m_displayAreas)
         {
-            // If an Area is set to display, create a rectange and color representation
-            DSL_ODE_AREA_PTR pOdeArea = std::dynamic_pointer_cast<OdeArea>(imap.second);
-            if (pOdeArea->m_display)
+            // Only the first Trigger to process the frame displays a shared Area
+            if (pOdeArea->ClaimFrameDisplay(pFrameMeta->source_id, pFrameMeta->frame_num))
             {
-                // If this is the first time seeing a frame for the reported Source Id.
-                if (pOdeArea->m_frameNumPerSource.find(pFrameMeta->source_id) == pOdeArea->m_frameNumPerSource.end())
-                {
-                    // Initial the frame number for the new source
-                    pOdeArea->m_frameNumPerSource[pFrameMeta->source_id] = 0;
-                }
-                
-                // If the last frame number for the reported source is less than the current frame
-                if (pOdeArea->m_frameNumPerSource[pFrameMeta->source_id] < pFrameMeta->frame_num)
-                {
-                    // Update the frame number so we only add the rectangle once
-                    pOdeArea->m_frameNumPerSource[pFrameMeta->source_id] = pFrameMeta->frame_num;
-                    
-                    NvDsBatchMeta* batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
-                    NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(batchMeta);
-                    
-                    pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = pOdeArea->m_rectParams;
-                    nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
-                }
+                OdeDisplayMetaBuilder::AddRect(pBuffer, pFrameMeta, pOdeArea->m_rectParams);
             }
         }
     }
+    
+    void OdeTrigger::ReserveSources(uint sourceCount)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        for (const auto &imap: m_pOdeAreas)
+        {
+            std::dynamic_pointer_cast<OdeArea>(imap.second)->ReserveSources(sourceCount);
+        }
+    }
+
+    void OdeTrigger::PreProcessBatch()
+    {
+        updateAreaIndex();
+        m_areasPreChecked = true;
+        m_preCheckedListUpdates = m_areaIndexListUpdates;
+        m_preCheckedAreaUpdates = m_areaIndexAreaUpdates;
+    }
+    
+    bool OdeTrigger::AreAreasPreCheckedStale()
+    {
+        return m_areasPreChecked and 
+            (m_areaListUpdates.load() != m_preCheckedListUpdates or
+                OdeArea::s_updateCount.load() != m_preCheckedAreaUpdates);
+    }
+
+    void OdeTrigger::PostProcessBatch()
+    {
+        m_areasPreChecked = false;
+        m_criteriaPreChecked = false;
+        
+        // Actions are notified even when disabled, as they may still hold
+        // occurrences from frames processed earlier in the batch.
+        for (const auto &imap: m_pOdeActions)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->PostProcessBatch();
+        }
+    }
 
     bool OdeTrigger::checkForMinCriteria(NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context. Property updates
+        // from the client API are read from the published snapshot, without locking
+        const OdeTriggerCriteria criteria = (m_criteriaPreChecked) 
+            ? m_batchCriteria : m_criteria.Load();
         
         // Ensure enabled, and that the limit has not been exceeded
         if (m_limit and m_triggered >= m_limit) 
         {
             return false;
         }
-        // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and (m_classId != pObjectMeta->class_id))
+        // Class id, Source id, confidence, dimensions, and infer-done, checked by
+        // the specialization for the filters currently set - unless already checked 
+        // for the current batch, as the parent ODE Handler only passes on the Objects
+        // with their bit set by EvaluateMinCriteria.
+        if (!m_criteriaPreChecked and !criteria.check(criteria, pFrameMeta, pObjectMeta))
         {
             return false;
         }
-        // Filter on Source id if set
-        if ((m_sourceId != DSL_ODE_ANY_SOURCE) and (m_sourceId != pFrameMeta->source_id))
+        // If areas are defined, check for overlay, unless already checked for the 
+        // current batch by the parent ODE Handler, with the Areas as they are now.
+        if (!m_areasPreChecked or AreAreasPreCheckedStale())
         {
-            return false;
+            updateAreaIndex();
+            if (m_areaIndex.Size() and !m_areaIndex.Overlaps(pObjectMeta->rect_params))
+            {
+                return false;
+            }
         }
-        // Temporary hack? GIE is now reporting negative confidence without patch
-        if ((pObjectMeta->confidence > 0) and (pObjectMeta->confidence < m_minConfidence))
+        // Last, as it records the Object as seen on this frame
+        if (!checkForMinFrameCount(criteria, pFrameMeta, pObjectMeta))
         {
             return false;
         }
-        // Ensure that the minimum confidence has been reached
-//        if (pObjectMeta->confidence < m_minConfidence)
-//        {
-//            return false;
-//        }
-        // If defined, check for minimum dimensions
-        if ((m_minWidth and pObjectMeta->rect_params.width < m_minWidth) or
-            (m_minHeight and pObjectMeta->rect_params.height < m_minHeight))
+        m_batchObjectsPassed++;
+        return true;
+    }
+
+    bool OdeTrigger::checkForMinFrameCount(const OdeTriggerCriteria& criteria, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Untracked Objects can't be followed from frame to frame, and would all
+        // share one history. They are passed as if the minimum were not set.
+        if (criteria.minFrameCountN <= 1 or pObjectMeta->object_id == UNTRACKED_OBJECT_ID)
         {
-            return false;
+            return true;
         }
-        // If defined, check for maximum dimensions
-        if ((m_maxWidth and pObjectMeta->rect_params.width > m_maxWidth) or
-            (m_maxHeight and pObjectMeta->rect_params.height > m_maxHeight))
+        uint sourceId = pFrameMeta->source_id;
+        int64_t frameNum = pFrameMeta->frame_num;
+        
+        if (sourceId >= m_lastFramePerSource.size())
         {
-            return false;
+            m_lastFramePerSource.resize(sourceId+1, 0);
         }
-        // If define, check if Inference was done on the frame or not
-        if (m_inferDoneOnly and !pFrameMeta->bInferDone)
+        m_lastFramePerSource[sourceId] = frameNum;
+        
+        // Evict the Objects that are no longer being seen before growing the table.
+        // The sweep grows the table itself when it frees too few entries. Histories
+        // ahead of their Source are from before the Source restarted or rewound.
+        if (m_frameHistories.IsFull())
         {
-            return false;
+            uint evicted = m_frameHistories.EraseIf(
+                [this](uint sourceId, uint64_t objectId, OdeFrameHistory& history)
+                {
+                    int64_t age = m_lastFramePerSource[sourceId] - history.lastFrame;
+                    return (age < 0 or age >= DSL_ODE_TRIGGER_MAX_FRAME_COUNT_D);
+                });
+            LOG_DEBUG("ODE Trigger '" << GetName() << "' evicted " << evicted 
+                << " frame histories");
         }
-        // If areas are defined, check for overlay
-        if (m_pOdeAreas.size())
+        
+        bool inserted(false);
+        OdeFrameHistory& history = m_frameHistories.FindOrInsert(sourceId, 
+            pObjectMeta->object_id, &inserted);
+        
+        int64_t shift = frameNum - history.lastFrame;
+        if (inserted or shift < 0 or shift >= 64)
         {
-            for (const auto &imap: m_pOdeAreas)
-            {
-                DSL_ODE_AREA_PTR pOdeArea = std::dynamic_pointer_cast<OdeArea>(imap.second);
-                if (doesOverlap(pObjectMeta->rect_params, pOdeArea->m_rectParams))
-                {
-                    return true;
-                }
-            }
-            return false;
+            // new Object, restarted Source, or not seen for 64 frames
+            history.frames = 0;
         }
-        return true;
+        else
+        {
+            history.frames <<= shift;
+        }
+        history.frames |= 1;
+        history.lastFrame = frameNum;
+        
+        uint64_t window = (criteria.minFrameCountD >= 64) 
+            ? UINT64_MAX : (((uint64_t)1 << criteria.minFrameCountD) - 1);
+            
+        return (uint)__builtin_popcountll(history.frames & window) >= criteria.minFrameCountN;
     }
 
-    inline bool OdeTrigger::valueInRange(int value, int min, int max)
-    { 
-        return (value >= min) && (value <= max);
+    bool OdeTrigger::CheckForAreaOverlap(NvDsObjectMeta* pObjectMeta)
+    {
+        return !m_areaIndex.Size() or m_areaIndex.ConcurrentOverlaps(pObjectMeta->rect_params);
     }
 
-    inline bool OdeTrigger::doesOverlap(NvOSD_RectParams a, NvOSD_RectParams b)
+    void OdeTrigger::updateAreaIndex()
     {
-        bool xOverlap = valueInRange(a.left, b.left, b.left + b.width) ||
-                        valueInRange(b.left, a.left, a.left + a.width);
-
-        bool yOverlap = valueInRange(a.top, b.top, b.top + b.height) ||
-                        valueInRange(b.top, a.top, a.top + a.height);
+        uint64_t listUpdates = m_areaListUpdates.load();
+        uint64_t areaUpdates = OdeArea::s_updateCount.load();
+        
+        if (listUpdates == m_areaIndexListUpdates and areaUpdates == m_areaIndexAreaUpdates)
+        {
+            return;
+        }
+        
+        // Gaurd against Areas being added/removed by the client API while rebuilding
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        std::vector<NvOSD_RectParams> areas;
+        m_displayAreas.clear();
+        for (const auto &imap: m_pOdeAreas)
+        {
+            DSL_ODE_AREA_PTR pOdeArea = std::dynamic_pointer_cast<OdeArea>(imap.second);
+            areas.push_back(pOdeArea->m_rectParams);
+            if (pOdeArea->m_display)
+            {
+                m_displayAreas.push_back(pOdeArea.get());
+            }
+        }
+        m_areaIndex.Build(areas);
+        
+        m_areaIndexListUpdates = m_areaListUpdates.load();
+        m_areaIndexAreaUpdates = areaUpdates;
+    }
 
-        return xOverlap && yOverlap;
+    inline bool OdeTrigger::doesOverlap(NvOSD_RectParams a, NvOSD_RectParams b)
+    {
+        return OdeAreaIndex::DoesOverlap(a, b);
     }    
     
     // *****************************************************************************
@@ -414,13 +705,13 @@ namespace DSL
         m_triggered++;
         m_occurrences++;
         
-        // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, pObjectMeta);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, pObjectMeta);
         }
         return true;
     }
@@ -467,13 +758,13 @@ namespace DSL
         // event has been triggered
         m_triggered++;
 
-         // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
         }
         return m_occurrences;
    }
@@ -513,13 +804,13 @@ namespace DSL
         // event has been triggered
         m_triggered++;
 
-         // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
         }
         return 1; // Summation ODE is triggered on every frame
    }
@@ -557,33 +848,30 @@ namespace DSL
         // need at least two objects for intersection to occur
         if (m_enabled and m_occurrenceMetaList.size() > 1)
         {
-            // iterate through the list of object occurrences that passed all min criteria
-            for (uint i = 0; i < m_occurrenceMetaList.size()-1 ; i++) 
+            findIntersectionPairs();
+            
+            // iterate through the pairs of object occurrences that passed all min criteria
+            for (const auto &ipair: m_intersectionPairs) 
             {
-                for (uint j = i+1; j < m_occurrenceMetaList.size() ; j++) 
+                // event has been triggered
+                m_occurrences++;
+                
+                // TODO: should we be testing the new trigger count against the limit here?
+                // or just wait for the next frame and leave "checkForOccurrence" to test the limit?
+                m_triggered++;
+                
+                // assign a new event id and count the occurrence
+                newEvent();
+
+                for (const auto &imap: m_pOdeActions)
                 {
-                    // check each in turn for any frame overlap
-                    if (doesOverlap(m_occurrenceMetaList[i]->rect_params, m_occurrenceMetaList[j]->rect_params))
-                    {
-                        // event has been triggered
-                        m_occurrences++;
-                        
-                        // TODO: should we be testing the new trigger count against the limit here?
-                        // or just wait for the next frame and leave "checkForOccurrence" to test the limit?
-                        m_triggered++;
-                        
-                         // update the total event count static variable
-                        s_eventCount++;
-
-                        for (const auto &imap: m_pOdeActions)
-                        {
-                            DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-                            
-                            // Invoke each action twice, once for each object in the tested pair
-                            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, m_occurrenceMetaList[i]);
-                            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, m_occurrenceMetaList[j]);
-                        }
-                    }
+                    DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    
+                    // Invoke each action twice, once for each object in the tested pair
+                    pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, 
+                        m_occurrenceMetaList[ipair.first]);
+                    pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, 
+                        m_occurrenceMetaList[ipair.second]);
                 }
             }
         }   
@@ -593,6 +881,65 @@ namespace DSL
         return m_occurrences;
    }
 
+    void IntersectionOdeTrigger::findIntersectionPairs()
+    {
+        m_intersectionPairs.clear();
+        m_sweepExtents.clear();
+        m_sweepActive.clear();
+        
+        for (uint i = 0; i < m_occurrenceMetaList.size(); i++)
+        {
+            NvOSD_RectParams& rect = m_occurrenceMetaList[i]->rect_params;
+            
+            // Same integer conversion as doesOverlap. The extent is widened to include 
+            // the left edge, so that a negative width can't hide an overlap 
+            int left = rect.left;
+            int right = rect.left + rect.width;
+            m_sweepExtents.push_back({left, std::max(left, right), i});
+        }
+        std::sort(m_sweepExtents.begin(), m_sweepExtents.end(),
+            [](const SweepExtent& a, const SweepExtent& b)
+            {
+                return a.left < b.left;
+            });
+        
+        for (uint i = 0; i < m_sweepExtents.size(); i++)
+        {
+            const SweepExtent& current = m_sweepExtents[i];
+            
+            // Drop all extents that end before the current extent starts, they 
+            // can't overlap on the x-axis with this or any of the following extents
+            for (uint j = 0; j < m_sweepActive.size(); )
+            {
+                if (m_sweepExtents[m_sweepActive[j]].right < current.left)
+                {
+                    m_sweepActive[j] = m_sweepActive.back();
+                    m_sweepActive.pop_back();
+                    continue;
+                }
+                j++;
+            }
+            
+            // Candidates overlap on the x-axis, the full test decides the pair
+            for (const auto &iActive: m_sweepActive)
+            {
+                uint first = m_sweepExtents[iActive].index;
+                uint second = current.index;
+                
+                if (doesOverlap(m_occurrenceMetaList[first]->rect_params, 
+                    m_occurrenceMetaList[second]->rect_params))
+                {
+                    m_intersectionPairs.push_back(
+                        std::make_pair(std::min(first, second), std::max(first, second)));
+                }
+            }
+            m_sweepActive.push_back(i);
+        }
+        
+        // Restore the order of the pairwise test
+        std::sort(m_intersectionPairs.begin(), m_intersectionPairs.end());
+    }
+
     // *****************************************************************************
 
     CustomOdeTrigger::CustomOdeTrigger(const char* name, 
@@ -632,13 +979,13 @@ namespace DSL
         m_triggered++;
         m_occurrences++;
         
-        // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, pObjectMeta);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, pObjectMeta);
         }
         return true;
     }
@@ -679,13 +1026,13 @@ namespace DSL
         // event has been triggered
         m_triggered++;
 
-         // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
         }
         return m_occurrences;
     }
@@ -726,13 +1073,13 @@ namespace DSL
         // event has been triggered
         m_triggered++;
 
-         // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
         }
         return m_occurrences;
    }
@@ -774,15 +1121,519 @@ namespace DSL
         // event has been triggered
         m_triggered++;
 
-         // update the total event count static variable
-        s_eventCount++;
+        // assign a new event id and count the occurrence
+        newEvent();
 
         for (const auto &imap: m_pOdeActions)
         {
             DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
         }
         return m_occurrences;
    }
 
-}
\ No newline at end of file
+
+    // *****************************************************************************
+    
+    WindowOdeTrigger::WindowOdeTrigger(const char* name, uint classId, uint limit, 
+        uint aggregate, uint crossing, float threshold, uint window, uint bucket)
+        : OdeTrigger(name, classId, limit)
+        , m_aggregate(aggregate)
+        , m_crossing(crossing)
+        , m_threshold(threshold)
+        , m_bucketNs((uint64_t)bucket * 1000000)
+        , m_bucketCount((window + bucket - 1) / bucket)
+        , m_timestamp(DSL_ODE_WINDOW_TIMESTAMP_PTS)
+        , m_windowsTimestamp(DSL_ODE_WINDOW_TIMESTAMP_PTS)
+    {
+        LOG_FUNC();
+    }
+
+    WindowOdeTrigger::~WindowOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool WindowOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!checkForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        
+        m_occurrences++;
+        
+        return true;
+    }
+
+    uint WindowOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        if (!m_enabled)
+        {
+            return 0;
+        }
+        // A change of timestamp invalidates the bucket indices of all windows
+        uint timestamp = m_timestamp.load(std::memory_order_relaxed);
+        if (timestamp != m_windowsTimestamp)
+        {
+            for (auto& window: m_windows)
+            {
+                window.Clear();
+            }
+            m_crossed.assign(m_crossed.size(), false);
+            m_windowsTimestamp = timestamp;
+        }
+        uint sourceId = pFrameMeta->source_id;
+        while (m_windows.size() <= sourceId)
+        {
+            m_windows.emplace_back(m_bucketCount);
+            m_crossed.push_back(false);
+        }
+        uint64_t timeNs = (timestamp == DSL_ODE_WINDOW_TIMESTAMP_NTP) 
+            ? pFrameMeta->ntp_timestamp : pFrameMeta->buf_pts;
+            
+        OdeWindow& window = m_windows[sourceId];
+        window.AddFrame(timeNs / m_bucketNs, m_occurrences);
+        
+        double aggregate = window.GetAggregate(m_aggregate);
+        bool crossed = (m_crossing == DSL_ODE_WINDOW_CROSSING_ABOVE)
+            ? (aggregate > m_threshold) : (aggregate < m_threshold);
+            
+        // Only the frame on which the aggregate crosses the threshold triggers
+        if (!crossed or m_crossed[sourceId])
+        {
+            m_crossed[sourceId] = crossed;
+            return 0;
+        }
+        m_crossed[sourceId] = true;
+        
+        if (m_limit and m_triggered >= m_limit)
+        {
+            return 0;
+        }
+        // event has been triggered
+        m_triggered++;
+
+        // assign a new event id and count the occurrence
+        newEvent();
+
+        for (const auto &imap: m_pOdeActions)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, NULL);
+        }
+        return 1;
+    }
+    
+    uint WindowOdeTrigger::GetTimestamp()
+    {
+        LOG_FUNC();
+        
+        return m_timestamp;
+    }
+    
+    void WindowOdeTrigger::SetTimestamp(uint timestamp)
+    {
+        LOG_FUNC();
+        
+        m_timestamp = timestamp;
+    }
+
+    // *****************************************************************************
+    
+    TrackOdeTrigger::TrackOdeTrigger(const char* name, 
+        uint classId, uint limit, uint lostFrames)
+        : OdeTrigger(name, classId, limit)
+        , m_lostFrames(lostFrames)
+    {
+        LOG_FUNC();
+    }
+
+    TrackOdeTrigger::~TrackOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    void TrackOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        OdeTrigger::PreProcessFrame(pBuffer, pFrameMeta);
+        
+        while (m_stores.size() <= pFrameMeta->source_id)
+        {
+            m_stores.emplace_back(m_lostFrames);
+        }
+        m_stores[pFrameMeta->source_id].NewFrame();
+    }
+    
+    uint TrackOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        if (!m_enabled or pFrameMeta->source_id >= m_stores.size())
+        {
+            return 0;
+        }
+        m_stores[pFrameMeta->source_id].Expire(
+            [&](OdeTrack& track)
+            {
+                handleLostTrack(pBuffer, pFrameMeta, track);
+            });
+        return m_occurrences;
+    }
+    
+    uint TrackOdeTrigger::GetTrackCount(uint sourceId)
+    {
+        LOG_FUNC();
+        
+        return (sourceId < m_stores.size()) ? m_stores[sourceId].Size() : 0;
+    }
+    
+    OdeTrack* TrackOdeTrigger::touchTrack(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta, bool* inserted)
+    {
+        // Untracked Objects all share the same Id, and would be seen as one track
+        if (pObjectMeta->object_id == UNTRACKED_OBJECT_ID)
+        {
+            return NULL;
+        }
+        // The Trigger may have been enabled after the frame was pre-processed
+        while (m_stores.size() <= pFrameMeta->source_id)
+        {
+            m_stores.emplace_back(m_lostFrames);
+        }
+        return &m_stores[pFrameMeta->source_id].Touch(pObjectMeta->object_id, 
+            pFrameMeta->frame_num, pFrameMeta->buf_pts, inserted);
+    }
+    
+    bool TrackOdeTrigger::trigger(GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (m_limit and m_triggered >= m_limit)
+        {
+            return false;
+        }
+        // event has been triggered
+        m_triggered++;
+        m_occurrences++;
+
+        // assign a new event id and count the occurrence
+        newEvent();
+
+        for (const auto &imap: m_pOdeActions)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->DispatchOccurrence(shared_from_this(), pBuffer, pFrameMeta, pObjectMeta);
+        }
+        return true;
+    }
+    
+    // *****************************************************************************
+    
+    NewTrackOdeTrigger::NewTrackOdeTrigger(const char* name, 
+        uint classId, uint limit, uint lostFrames)
+        : TrackOdeTrigger(name, classId, limit, lostFrames)
+    {
+        LOG_FUNC();
+    }
+
+    NewTrackOdeTrigger::~NewTrackOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool NewTrackOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_enabled or !checkForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        bool inserted(false);
+        if (!touchTrack(pFrameMeta, pObjectMeta, &inserted))
+        {
+            return false;
+        }
+        return inserted and trigger(pBuffer, pFrameMeta, pObjectMeta);
+    }
+
+    // *****************************************************************************
+    
+    LostTrackOdeTrigger::LostTrackOdeTrigger(const char* name, 
+        uint classId, uint limit, uint lostFrames)
+        : TrackOdeTrigger(name, classId, limit, lostFrames)
+    {
+        LOG_FUNC();
+    }
+
+    LostTrackOdeTrigger::~LostTrackOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool LostTrackOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_enabled or !checkForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        bool inserted(false);
+        touchTrack(pFrameMeta, pObjectMeta, &inserted);
+        
+        return false;
+    }
+    
+    void LostTrackOdeTrigger::handleLostTrack(GstBuffer* pBuffer, 
+        NvDsFrameMeta* pFrameMeta, OdeTrack& track)
+    {
+        // The Object is no longer in the frame, so there is no Object meta to report
+        trigger(pBuffer, pFrameMeta, NULL);
+    }
+
+    // *****************************************************************************
+    
+    DwellOdeTrigger::DwellOdeTrigger(const char* name, uint classId, uint limit, 
+        uint minDwellTime, uint lostFrames)
+        : TrackOdeTrigger(name, classId, limit, lostFrames)
+        , m_minDwellTimeNs((uint64_t)minDwellTime * 1000000)
+    {
+        LOG_FUNC();
+    }
+
+    DwellOdeTrigger::~DwellOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool DwellOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        if (!m_enabled or !checkForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        bool inserted(false);
+        OdeTrack* pTrack = touchTrack(pFrameMeta, pObjectMeta, &inserted);
+        
+        // Triggers once per track, when the minimum dwell time is first reached
+        if (!pTrack or pTrack->triggered or 
+            (pTrack->lastTimeNs - pTrack->firstTimeNs) < m_minDwellTimeNs)
+        {
+            return false;
+        }
+        pTrack->triggered = true;
+        
+        return trigger(pBuffer, pFrameMeta, pObjectMeta);
+    }
+
+    // *****************************************************************************
+    
+    LineCrossingOdeTrigger::LineCrossingOdeTrigger(const char* name, uint classId, 
+        uint limit, uint direction, uint referencePoint, uint lostFrames)
+        : TrackOdeTrigger(name, classId, limit, lostFrames)
+        , m_direction(direction)
+        , m_referencePoint(referencePoint)
+        , m_lineListUpdates(1)
+        , m_linesListUpdates(0)
+        , m_linesLineUpdates(0)
+        , m_framePreProcessed(false)
+    {
+        LOG_FUNC();
+    }
+
+    LineCrossingOdeTrigger::~LineCrossingOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool LineCrossingOdeTrigger::AddLine(DSL_BASE_PTR pChild)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_pOdeLines.find(pChild->GetName()) != m_pOdeLines.end())
+        {
+            LOG_ERROR("ODE Line '" << pChild->GetName() << "' is already a child of ODE Trigger'" << GetName() << "'");
+            return false;
+        }
+        m_pOdeLines[pChild->GetName()] = pChild;
+        m_lineCounts[pChild->GetName()] = std::shared_ptr<OdeLineCrossingCounts>(
+            new OdeLineCrossingCounts());
+        m_lineListUpdates++;
+        return true;
+    }
+
+    bool LineCrossingOdeTrigger::RemoveLine(DSL_BASE_PTR pChild)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_pOdeLines.find(pChild->GetName()) == m_pOdeLines.end())
+        {
+            LOG_ERROR("ODE Line '" << pChild->GetName() << "' is not a child of ODE Trigger'" << GetName() << "'");
+            return false;
+        }
+        m_pOdeLines.erase(pChild->GetName());
+        m_lineCounts.erase(pChild->GetName());
+        m_lineListUpdates++;
+        return true;
+    }
+    
+    void LineCrossingOdeTrigger::RemoveAllLines()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_pOdeLines.clear();
+        m_lineCounts.clear();
+        m_lineListUpdates++;
+    }
+    
+    bool LineCrossingOdeTrigger::GetCounts(const char* line, 
+        uint64_t* leftToRight, uint64_t* rightToLeft)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        auto imap = m_lineCounts.find(line);
+        if (imap == m_lineCounts.end())
+        {
+            return false;
+        }
+        *leftToRight = imap->second->leftToRight.load();
+        *rightToLeft = imap->second->rightToLeft.load();
+        return true;
+    }
+    
+    void LineCrossingOdeTrigger::ResetCounts()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        for (auto &imap: m_lineCounts)
+        {
+            imap.second->leftToRight = 0;
+            imap.second->rightToLeft = 0;
+        }
+    }
+    
+    void LineCrossingOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        TrackOdeTrigger::PreProcessFrame(pBuffer, pFrameMeta);
+        
+        updateLines();
+        m_framePreProcessed = true;
+        
+        for (const auto &line: m_lines)
+        {
+            if (line.display)
+            {
+                OdeDisplayMetaBuilder::AddLine(pBuffer, pFrameMeta, line.lineParams);
+            }
+        }
+    }
+    
+    bool LineCrossingOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // The Trigger may have been enabled after the frame was pre-processed
+        if (!m_enabled or !m_framePreProcessed or 
+            !checkForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        const NvOSD_RectParams& rect = pObjectMeta->rect_params;
+        float x = rect.left + rect.width/2;
+        float y = (m_referencePoint == DSL_ODE_LINE_POINT_CENTER) 
+            ? rect.top + rect.height/2 
+            : rect.top + rect.height;
+        
+        bool inserted(false);
+        OdeTrack* pTrack = touchTrack(pFrameMeta, pObjectMeta, &inserted);
+        if (!pTrack)
+        {
+            return false;
+        }
+        
+        // Crossings are tested over all Objects in the frame on post process
+        if (!inserted)
+        {
+            m_movements.Add(pTrack->x, pTrack->y, x, y);
+            m_movingObjects.push_back(pObjectMeta);
+        }
+        pTrack->x = x;
+        pTrack->y = y;
+        
+        return false;
+    }
+    
+    uint LineCrossingOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta)
+    {
+        if (m_enabled and m_framePreProcessed)
+        {
+            for (const auto &line: m_lines)
+            {
+                OdeLine::CheckCrossings(line.lineParams, m_movements, m_crossings);
+                
+                for (uint i = 0; i < m_crossings.size(); i++)
+                {
+                    if (!m_crossings[i])
+                    {
+                        continue;
+                    }
+                    bool leftToRight = (m_crossings[i] > 0);
+                    if (leftToRight)
+                    {
+                        line.pCounts->leftToRight++;
+                    }
+                    else
+                    {
+                        line.pCounts->rightToLeft++;
+                    }
+                    if (m_direction == DSL_ODE_LINE_DIRECTION_ANY or
+                        (m_direction == DSL_ODE_LINE_DIRECTION_LEFT_TO_RIGHT and leftToRight) or
+                        (m_direction == DSL_ODE_LINE_DIRECTION_RIGHT_TO_LEFT and !leftToRight))
+                    {
+                        trigger(pBuffer, pFrameMeta, m_movingObjects[i]);
+                    }
+                }
+            }
+        }
+        m_movements.Clear();
+        m_movingObjects.clear();
+        m_framePreProcessed = false;
+        
+        return TrackOdeTrigger::PostProcessFrame(pBuffer, pFrameMeta);
+    }
+    
+    void LineCrossingOdeTrigger::updateLines()
+    {
+        uint64_t listUpdates = m_lineListUpdates.load();
+        uint64_t lineUpdates = OdeLine::s_updateCount.load();
+        
+        if (listUpdates == m_linesListUpdates and lineUpdates == m_linesLineUpdates)
+        {
+            return;
+        }
+        
+        // Gaurd against Lines being added/removed by the client API while rebuilding
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_lines.clear();
+        for (const auto &imap: m_pOdeLines)
+        {
+            DSL_ODE_LINE_PTR pOdeLine = std::dynamic_pointer_cast<OdeLine>(imap.second);
+            m_lines.push_back({pOdeLine->m_lineParams, 
+                pOdeLine->m_display, m_lineCounts[imap.first]});
+        }
+        m_linesListUpdates = m_lineListUpdates.load();
+        m_linesLineUpdates = lineUpdates;
+    }
+}
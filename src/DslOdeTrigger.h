@@ -28,6 +28,14 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslOdeArea.h"
+#include "DslOdeLine.h"
+#include "DslOdeBatch.h"
+#include "DslOdeDisplayMeta.h"
+#include "DslOdeMetrics.h"
+#include "DslOdeObjectTable.h"
+#include "DslOdeTrackStore.h"
+#include "DslOdeWindow.h"
 
 namespace DSL
 {
@@ -68,6 +76,98 @@ namespace DSL
     #define DSL_ODE_TRIGGER_RANGE_NEW(name, classId, limit, lower, upper) \
         std::shared_ptr<RangeOdeTrigger>(new RangeOdeTrigger(name, classId, limit, lower, upper))
 
+    #define DSL_ODE_TRIGGER_WINDOW_PTR std::shared_ptr<WindowOdeTrigger>
+    #define DSL_ODE_TRIGGER_WINDOW_NEW(name, classId, limit, aggregate, crossing, threshold, window, bucket) \
+        std::shared_ptr<WindowOdeTrigger>(new WindowOdeTrigger(name, \
+            classId, limit, aggregate, crossing, threshold, window, bucket))
+
+    #define DSL_ODE_TRIGGER_NEW_TRACK_PTR std::shared_ptr<NewTrackOdeTrigger>
+    #define DSL_ODE_TRIGGER_NEW_TRACK_NEW(name, classId, limit, lostFrames) \
+        std::shared_ptr<NewTrackOdeTrigger>(new NewTrackOdeTrigger(name, classId, limit, lostFrames))
+
+    #define DSL_ODE_TRIGGER_LOST_TRACK_PTR std::shared_ptr<LostTrackOdeTrigger>
+    #define DSL_ODE_TRIGGER_LOST_TRACK_NEW(name, classId, limit, lostFrames) \
+        std::shared_ptr<LostTrackOdeTrigger>(new LostTrackOdeTrigger(name, classId, limit, lostFrames))
+
+    #define DSL_ODE_TRIGGER_DWELL_PTR std::shared_ptr<DwellOdeTrigger>
+    #define DSL_ODE_TRIGGER_DWELL_NEW(name, classId, limit, minDwellTime, lostFrames) \
+        std::shared_ptr<DwellOdeTrigger>(new DwellOdeTrigger(name, \
+            classId, limit, minDwellTime, lostFrames))
+
+    #define DSL_ODE_TRIGGER_LINE_CROSSING_PTR std::shared_ptr<LineCrossingOdeTrigger>
+    #define DSL_ODE_TRIGGER_LINE_CROSSING_NEW(name, \
+        classId, limit, direction, referencePoint, lostFrames) \
+        std::shared_ptr<LineCrossingOdeTrigger>(new LineCrossingOdeTrigger(name, \
+            classId, limit, direction, referencePoint, lostFrames))
+
+    /**
+     * @brief maximum denominator for the minimum frame count, N of D frames
+     */
+    #define DSL_ODE_TRIGGER_MAX_FRAME_COUNT_D 64
+
+    /**
+     * @brief Object filters in use by a Trigger's minimum criteria, one bit per filter.
+     * Used to select the criteria check specialized for the filters that are set.
+     */
+    #define DSL_ODE_CRITERIA_CLASS          0x01
+    #define DSL_ODE_CRITERIA_SOURCE         0x02
+    #define DSL_ODE_CRITERIA_CONFIDENCE     0x04
+    #define DSL_ODE_CRITERIA_MIN_WIDTH      0x08
+    #define DSL_ODE_CRITERIA_MIN_HEIGHT     0x10
+    #define DSL_ODE_CRITERIA_MAX_WIDTH      0x20
+    #define DSL_ODE_CRITERIA_MAX_HEIGHT     0x40
+    #define DSL_ODE_CRITERIA_INFER_DONE     0x80
+    #define DSL_ODE_CRITERIA_ALL            0xFF
+
+    struct OdeTriggerCriteria;
+    
+    /**
+     * @brief Object filter check, specialized for one combination of 
+     * DSL_ODE_CRITERIA_* filters
+     */
+    typedef bool (*OdeTriggerCriteriaCheck)(const OdeTriggerCriteria& criteria,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+    /**
+     * @struct OdeTriggerCriteria
+     * @brief Snapshot of the client settable minimum criteria, published 
+     * by the OdeTrigger setters and read without locking on each Object check
+     */
+    struct OdeTriggerCriteria
+    {
+        uint classId;
+        uint sourceId;
+        float minConfidence;
+        uint minWidth;
+        uint minHeight;
+        uint maxWidth;
+        uint maxHeight;
+        bool inferDoneOnly;
+        uint minFrameCountN;
+        uint minFrameCountD;
+        
+        /**
+         * @brief DSL_ODE_CRITERIA_* filters set in the criteria above
+         */
+        uint filters;
+        
+        /**
+         * @brief check of the Object filters, specialized for the filters set
+         */
+        OdeTriggerCriteriaCheck check;
+    };
+    
+    /**
+     * @struct OdeFrameHistory
+     * @brief Sliding bitset of the last 64 frames in which a tracked Object 
+     * met a Trigger's minimum criteria. Bit 0 is the frame number in lastFrame.
+     */
+    struct OdeFrameHistory
+    {
+        int64_t lastFrame;
+        uint64_t frames;
+    };
+
     class OdeTrigger : public Base
     {
     public: 
@@ -77,9 +177,23 @@ namespace DSL
         ~OdeTrigger();
 
         /**
-         * @brief total count of all events
+         * @brief total count of all events, incremented by all Triggers 
+         * from all streaming threads.
+         */
+        static std::atomic<uint64_t> s_eventCount;
+        
+        /**
+         * @brief unique id of the last event triggered on the current thread,
+         * read by the synchronous Actions handling the event.
+         */
+        static thread_local uint64_t s_eventId;
+        
+        /**
+         * @brief Assigns the next unique event id, and sets it as the 
+         * current thread's event id.
+         * @return the new event id
          */
-        static uint64_t s_eventCount;
+        static uint64_t NextEventId();
         
         /**
          * @brief Function to check a given Object Meta data structure for the occurence of an event
@@ -98,6 +212,12 @@ namespace DSL
         virtual void PreProcessFrame(GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief Reserves per-source state in each of the Trigger's Areas
+         * @param[in] sourceCount number of Sources, i.e. the Stream-muxer batch size
+         */
+        void ReserveSources(uint sourceCount);
+        
         /**
          * @brief Function called to process all Occurrence/Absence data for the current frame
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for post processing
@@ -106,6 +226,37 @@ namespace DSL
         virtual uint PostProcessFrame(GstBuffer* pBuffer,
             NvDsFrameMeta* pFrameMeta){return m_occurrences;};
 
+        /**
+         * @brief Function called by the parent ODE Handler once per batch, before any
+         * frame is processed. Rebuilds the Area index if out of date, so that it can
+         * be read concurrently by CheckForAreaOverlap. Area overlap is not rechecked by
+         * CheckForOccurrence until PostProcessBatch, as the Handler only passes the
+         * Objects that overlap - unless the Areas change during the batch.
+         */
+        void PreProcessBatch();
+        
+        /**
+         * @brief Function called once all frames in the current batch have been 
+         * processed, to allow the Trigger's Actions to complete any batch level work.
+         */
+        void PostProcessBatch();
+        
+        /**
+         * @brief Tests an Object against the Trigger's Areas. Can be called from 
+         * multiple threads at once between PreProcessBatch and PostProcessBatch.
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test
+         * @return true if the Object overlaps one of the Areas, or no Areas are set
+         */
+        bool CheckForAreaOverlap(NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Checks if the Trigger's Areas have been added, removed or updated 
+         * since PreProcessBatch, e.g. by an Add or Remove Area ODE Action, in which 
+         * case the Handler's overlap checks for the rest of the batch are out of date.
+         * @return true if the Areas have changed since the overlap pre-check
+         */
+        bool AreAreasPreCheckedStale();
+
         /**
          * @brief Adds an ODE Action as a child to this ODE Type
          * @param[in] pChild pointer to ODE Action to add
@@ -239,11 +390,14 @@ namespace DSL
         void GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD);
         
         /**
-         * @brief Sets the current Minimum frame count to trigger an event (n of d frames)
-         * @param[out] minFrameCountN frame count numeratior  
-         * @param[out] minFrameCountD frame count denominator
+         * @brief Sets the current Minimum frame count to trigger an event (n of d frames).
+         * Objects are followed by their tracked Object Id, per source. Untracked
+         * Objects are not filtered by the minimum frame count.
+         * @param[in] minFrameCountN frame count numeratior, 0 or 1 to disable
+         * @param[in] minFrameCountD frame count denominator, up to DSL_ODE_TRIGGER_MAX_FRAME_COUNT_D
+         * @return false if the denominator is out of range or less than the numerator
          */
-        void SetMinFrameCount(uint minFrameCountN, uint minFrameCountD);
+        bool SetMinFrameCount(uint minFrameCountN, uint minFrameCountD);
 
         /**
          * @brief Gets the current "inferrence-done" only setting
@@ -259,8 +413,52 @@ namespace DSL
          */
         void SetInferDoneOnlySetting(bool inferDoneOnly);
         
+        /**
+         * @brief Evaluates the client settable minimum criteria, class id, source id,
+         * confidence, min/max dimensions, and infer-done, for every Object in a batch.
+         * Objects without their bit set can be skipped as they will fail the criteria
+         * check in CheckForOccurrence, which no longer checks the criteria for the rest
+         * of the batch. The limit and Areas are not evaluated.
+         * @param[in] batch Object batch gathered by the parent ODE Handler
+         * @param[out] mask one bit per Object in the batch, set if the criteria are met
+         */
+        void EvaluateMinCriteria(OdeObjectBatch& batch, std::vector<uint64_t>& mask);
+        
+        /**
+         * @brief Gets the Object filters set in the current minimum criteria,
+         * which select the specialized check used for each Object
+         * @return mask of DSL_ODE_CRITERIA_* filters
+         */
+        uint GetCriteriaFilters();
+        
+        /**
+         * @brief Adds the metrics for the current batch, called by the parent ODE 
+         * Handler once the batch is complete. The Objects passed and occurrences
+         * counted by the Trigger during the batch are added and cleared.
+         * @param[in] objectsEvaluated number of Objects evaluated in the batch
+         * @param[in] evaluationTimeNs time spent on the Trigger in nanoseconds
+         */
+        void AddBatchMetrics(uint objectsEvaluated, uint64_t evaluationTimeNs);
+        
+        /**
+         * @brief Gets the Trigger's performance counters
+         * @param[out] metrics client structure to fill
+         */
+        void GetMetrics(dsl_ode_trigger_metrics* metrics);
+        
+        /**
+         * @brief Resets the Trigger's performance counters to zero
+         */
+        void ResetMetrics();
+        
     protected:
     
+        /**
+         * @brief Assigns a new event id for an occurrence triggered by this Trigger,
+         * and counts the occurrence for the current batch. 
+         */
+        void newEvent();
+    
         /**
          * @brief Common function to check if an Object's meta data meets the min criteria for ODE 
          * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
@@ -269,15 +467,6 @@ namespace DSL
          */
         bool checkForMinCriteria(NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
-        /**
-         * @brief helper function for doesOverlap
-         * @param value to check if in range
-         * @param min min value of range check
-         * @param max max value of range check
-         * @return trun if value in range of min-max
-         */
-        bool valueInRange(int value, int min, int max);
-        
         /**
          * @brief Determines if two rectangles overlaps 
          * @param[in] a rectangle A for test
@@ -286,11 +475,99 @@ namespace DSL
          */
         bool doesOverlap(NvOSD_RectParams a, NvOSD_RectParams b);
         
+        /**
+         * @brief publishes a new criteria snapshot from the current property values
+         * The caller must hold the property mutex.
+         */
+        void publishCriteria();
+        
+        /**
+         * @brief Records that an Object met all other criteria on the current frame, and 
+         * checks if it has done so for N of the last D frames. Called from the system 
+         * (callback) context.
+         * @param[in] criteria current criteria snapshot
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if the minimum frame count is met, not set, or the Object is untracked
+         */
+        bool checkForMinFrameCount(const OdeTriggerCriteria& criteria, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief rebuilds the Area index if Areas have been added, removed, 
+         * or updated since the last build. Called from the system (callback) context.
+         */
+        void updateAreaIndex();
+        
         /**
          * @brief Map of ODE Areas to use for minimum critera
          */
         std::map <std::string, DSL_BASE_PTR> m_pOdeAreas;
         
+        /**
+         * @brief spatial index of the ODE Areas, used for minimum criteria
+         */
+        OdeAreaIndex m_areaIndex;
+        
+        /**
+         * @brief Areas to display on each frame, rebuilt with m_areaIndex. Raw pointers
+         * are used so that the list does not hold the Areas in-use once removed, and 
+         * are safe as the list is rebuilt on any change to m_pOdeAreas before use.
+         */
+        std::vector<OdeArea*> m_displayAreas;
+        
+        /**
+         * @brief incremented on every change to m_pOdeAreas
+         */
+        std::atomic<uint64_t> m_areaListUpdates;
+        
+        /**
+         * @brief value of m_areaListUpdates when m_areaIndex was last built
+         */
+        uint64_t m_areaIndexListUpdates;
+        
+        /**
+         * @brief value of OdeArea::s_updateCount when m_areaIndex was last built
+         */
+        uint64_t m_areaIndexAreaUpdates;
+        
+        /**
+         * @brief true between PreProcessBatch and PostProcessBatch, while the parent
+         * ODE Handler has already tested each Object for Area overlap.
+         */
+        bool m_areasPreChecked;
+        
+        /**
+         * @brief values of m_areaListUpdates and OdeArea::s_updateCount when the
+         * Areas were pre-checked, compared to detect Area changes mid-batch.
+         */
+        uint64_t m_preCheckedListUpdates;
+        uint64_t m_preCheckedAreaUpdates;
+        
+        /**
+         * @brief true between EvaluateMinCriteria and PostProcessBatch, while the
+         * parent ODE Handler has already tested each Object against m_batchCriteria.
+         */
+        bool m_criteriaPreChecked;
+        
+        /**
+         * @brief criteria snapshot evaluated for the current batch
+         */
+        OdeTriggerCriteria m_batchCriteria;
+        
+        /**
+         * @brief frame history for each tracked Object, keyed on Source and Object Id. 
+         * Only used when a minimum frame count is set.
+         */
+        OdeObjectTable<OdeFrameHistory> m_frameHistories;
+        
+        /**
+         * @brief most recent frame number seen for each Source Id. Histories whose 
+         * last frame is 64 or more frames behind, or any frames ahead of, their 
+         * Source are evicted.
+         */
+        std::vector<int64_t> m_lastFramePerSource;
+        
         /**
          * @brief Map of child ODE Actions to invoke on ODE occurrence
          */
@@ -300,6 +577,27 @@ namespace DSL
          * @brief Mutex to ensure mutual exlusion for propery get/sets
          */
         GMutex m_propertyMutex;
+        
+        /**
+         * @brief criteria snapshot read by checkForMinCriteria without
+         * taking the property mutex. 
+         */
+        SeqLockSnapshot<OdeTriggerCriteria> m_criteria;
+        
+        /**
+         * @brief performance counters, added to once per batch
+         */
+        OdeTriggerMetrics m_metrics;
+        
+        /**
+         * @brief number of Objects that passed all criteria in the current batch
+         */
+        uint m_batchObjectsPassed;
+        
+        /**
+         * @brief number of occurrences triggered in the current batch
+         */
+        uint m_batchOccurrences;
 
     
     public:
@@ -503,6 +801,41 @@ namespace DSL
          * to list to be checked for intersection on PostProcessFrame
          */ 
         std::vector<NvDsObjectMeta*> m_occurrenceMetaList;
+        
+        /**
+         * @brief Finds all intersecting pairs in m_occurrenceMetaList with a sort 
+         * and sweep along the x-axis. Results are identical to testing every pair.
+         * The pairs, as indices into m_occurrenceMetaList, are written to 
+         * m_intersectionPairs in the same order as the pairwise test, i < j.
+         */
+        void findIntersectionPairs();
+        
+        /**
+         * @brief x-axis extent of each occurrence for the sweep, in the 
+         * integer coordinates used by doesOverlap
+         */
+        struct SweepExtent
+        {
+            int left;
+            int right;
+            uint index;
+        };
+        
+        /**
+         * @brief occurrence extents, sorted by left edge. Kept between frames
+         * to avoid reallocation
+         */
+        std::vector<SweepExtent> m_sweepExtents;
+        
+        /**
+         * @brief indices into m_sweepExtents of the extents the sweep line is within
+         */
+        std::vector<uint> m_sweepActive;
+        
+        /**
+         * @brief intersecting pairs found by the last call to findIntersectionPairs()
+         */
+        std::vector<std::pair<uint, uint>> m_intersectionPairs;
     
     };
 
@@ -654,6 +987,410 @@ namespace DSL
     
     };
 
+    class WindowOdeTrigger : public OdeTrigger
+    {
+    public:
+    
+        WindowOdeTrigger(const char* name, uint classId, uint limit, uint aggregate, 
+            uint crossing, float threshold, uint window, uint bucket);
+        
+        ~WindowOdeTrigger();
+
+        /**
+         * @brief Function to check a given Object Meta data structure for Object occurrence, 
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame, adding the frame's count to the window
+         * for its source, and generate a Window ODE occurrence if the windowed aggregate
+         * has crossed the Trigger's threshold.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Gets the timestamp used to assign frames to buckets
+         * @return one of the DSL_ODE_WINDOW_TIMESTAMP constants
+         */
+        uint GetTimestamp();
+        
+        /**
+         * @brief Sets the timestamp used to assign frames to buckets. The windows
+         * for all sources are cleared by the streaming thread on change.
+         * @param[in] timestamp one of the DSL_ODE_WINDOW_TIMESTAMP constants
+         */
+        void SetTimestamp(uint timestamp);
+
+    private:
+    
+        /**
+         * @brief windowed aggregate to test, one of the DSL_ODE_WINDOW_AGGREGATE constants
+         */
+        uint m_aggregate;
+        
+        /**
+         * @brief direction of crossing, one of the DSL_ODE_WINDOW_CROSSING constants
+         */
+        uint m_crossing;
+        
+        /**
+         * @brief threshold for the windowed aggregate
+         */
+        float m_threshold;
+        
+        /**
+         * @brief duration of each bucket in nanoseconds
+         */
+        uint64_t m_bucketNs;
+        
+        /**
+         * @brief number of buckets spanned by each window
+         */
+        uint m_bucketCount;
+        
+        /**
+         * @brief timestamp set by the client, one of the DSL_ODE_WINDOW_TIMESTAMP constants
+         */
+        std::atomic<uint> m_timestamp;
+        
+        /**
+         * @brief timestamp used by the current windows, streaming thread only
+         */
+        uint m_windowsTimestamp;
+    
+        /**
+         * @brief sliding window for each source, indexed by source id, 
+         * grown on first use by the streaming thread.
+         */
+        std::vector<OdeWindow> m_windows;
+        
+        /**
+         * @brief true for each source while its aggregate is past the threshold, 
+         * so that each crossing triggers a single occurrence
+         */
+        std::vector<bool> m_crossed;
+    };
+
+    /**
+     * @class TrackOdeTrigger
+     * @brief Base class for the Triggers that follow tracked Objects, by Object Id,
+     * from the first frame they meet the Trigger's criteria until they have not 
+     * met the criteria for a given number of frames. A Tracker is required.
+     */
+    class TrackOdeTrigger : public OdeTrigger
+    {
+    public:
+    
+        TrackOdeTrigger(const char* name, uint classId, uint limit, uint lostFrames);
+        
+        ~TrackOdeTrigger();
+
+        /**
+         * @brief Function to pre process the frame, starting a new generation
+         * of the tracks for the frame's source.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to pre process.
+         */
+        void PreProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Function to post process the frame, expiring the tracks 
+         * for the frame's source that have not been seen for lostFrames frames.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Gets the number of Objects currently tracked for a source
+         * @param[in] sourceId source to query
+         * @return number of live tracks
+         */
+        uint GetTrackCount(uint sourceId);
+
+    protected:
+    
+        /**
+         * @brief Records an Object that met the Trigger's criteria as seen on the current frame
+         * @param[in] pFrameMeta the Frame that holds the Object
+         * @param[in] pObjectMeta the Object to record
+         * @param[out] inserted set to true if the Object is new
+         * @return pointer to the Object's track, or NULL if the Object is untracked
+         * and so cannot be followed from frame to frame
+         */
+        OdeTrack* touchTrack(NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, bool* inserted);
+        
+        /**
+         * @brief Called for each track of the frame's source as it expires. 
+         */
+        virtual void handleLostTrack(GstBuffer* pBuffer, 
+            NvDsFrameMeta* pFrameMeta, OdeTrack& track){};
+            
+        /**
+         * @brief Triggers an occurrence, invoking all Actions
+         * @return true if triggered, false if the limit has been reached
+         */
+        bool trigger(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+    
+    private:
+    
+        /**
+         * @brief number of frames a track can go unseen before it is lost
+         */
+        uint m_lostFrames;
+        
+        /**
+         * @brief tracks for each source, indexed by source id, 
+         * grown on first use by the streaming thread.
+         */
+        std::vector<OdeTrackStore> m_stores;
+    };
+    
+    class NewTrackOdeTrigger : public TrackOdeTrigger
+    {
+    public:
+    
+        NewTrackOdeTrigger(const char* name, uint classId, uint limit, uint lostFrames);
+        
+        ~NewTrackOdeTrigger();
+
+        /**
+         * @brief Function to check a given Object Meta data structure for a New Track
+         * occurrence, the first frame on which a tracked Object meets the criteria.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+    };
+    
+    class LostTrackOdeTrigger : public TrackOdeTrigger
+    {
+    public:
+    
+        LostTrackOdeTrigger(const char* name, uint classId, uint limit, uint lostFrames);
+        
+        ~LostTrackOdeTrigger();
+
+        /**
+         * @brief Function to check a given Object Meta data structure, recording
+         * the tracked Object as seen on the current frame.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return false always, occurrences are triggered on post process
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+    private:
+    
+        /**
+         * @brief Triggers a Lost Track occurrence for an expired track
+         */
+        void handleLostTrack(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta, OdeTrack& track);
+    };
+    
+    class DwellOdeTrigger : public TrackOdeTrigger
+    {
+    public:
+    
+        DwellOdeTrigger(const char* name, uint classId, uint limit, 
+            uint minDwellTime, uint lostFrames);
+        
+        ~DwellOdeTrigger();
+
+        /**
+         * @brief Function to check a given Object Meta data structure for a Dwell
+         * occurrence, the first frame on which a tracked Object has met the criteria
+         * for at least the minimum dwell time. 
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+    private:
+    
+        /**
+         * @brief minimum dwell time in nanoseconds
+         */
+        uint64_t m_minDwellTimeNs;
+    };
+
+    /**
+     * @struct OdeLineCrossingCounts
+     * @brief Crossing counts for one Line of a Line Crossing Trigger, updated 
+     * by the streaming thread and read by the client.
+     */
+    struct OdeLineCrossingCounts
+    {
+        OdeLineCrossingCounts() : leftToRight(0), rightToLeft(0) {};
+        
+        std::atomic<uint64_t> leftToRight;
+        std::atomic<uint64_t> rightToLeft;
+    };
+    
+    class LineCrossingOdeTrigger : public TrackOdeTrigger
+    {
+    public:
+    
+        LineCrossingOdeTrigger(const char* name, uint classId, uint limit, 
+            uint direction, uint referencePoint, uint lostFrames);
+        
+        ~LineCrossingOdeTrigger();
+
+        /**
+         * @brief Adds an ODE Line to this Trigger
+         * @param[in] pChild pointer to ODE Line to add
+         * @return true if successful add, false otherwise
+         */
+        bool AddLine(DSL_BASE_PTR pChild);
+        
+        /**
+         * @brief Removes an ODE Line from this Trigger
+         * @param[in] pChild pointer to ODE Line to remove
+         * @return true if successful remove, false if the Line is not in use
+         */
+        bool RemoveLine(DSL_BASE_PTR pChild);
+        
+        /**
+         * @brief Removes all ODE Lines from this Trigger
+         */
+        void RemoveAllLines();
+        
+        /**
+         * @brief Gets the crossing counts for one of the Trigger's Lines
+         * @param[in] line name of the Line to query
+         * @param[out] leftToRight number of crossings from the Line's left side to its right
+         * @param[out] rightToLeft number of crossings from the Line's right side to its left
+         * @return true if successful, false if the Line is not in use
+         */
+        bool GetCounts(const char* line, uint64_t* leftToRight, uint64_t* rightToLeft);
+        
+        /**
+         * @brief Resets the crossing counts for all of the Trigger's Lines to zero
+         */
+        void ResetCounts();
+        
+        /**
+         * @brief Function to pre process the frame, updating the Trigger's copy of 
+         * its Lines if changed, and displaying the Lines.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to pre process.
+         */
+        void PreProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Function to check a given Object Meta data structure, recording the
+         * movement of its reference point since the Object was last seen.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return false always, occurrences are triggered on post process
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame, testing the movements of all 
+         * Objects in the frame against each Line, and triggering an occurrence for 
+         * each crossing in the Trigger's direction.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, NvDsFrameMeta* pFrameMeta);
+
+    private:
+    
+        /**
+         * @brief rebuilds the Trigger's copy of its Lines if Lines have been added, 
+         * removed, or updated since the last build.
+         */
+        void updateLines();
+        
+        /**
+         * @brief one of the DSL_ODE_LINE_DIRECTION constants
+         */
+        uint m_direction;
+        
+        /**
+         * @brief one of the DSL_ODE_LINE_POINT constants
+         */
+        uint m_referencePoint;
+        
+        /**
+         * @brief Map of ODE Lines to test for crossings
+         */
+        std::map <std::string, DSL_BASE_PTR> m_pOdeLines;
+        
+        /**
+         * @brief crossing counts for each Line, by Line name
+         */
+        std::map <std::string, std::shared_ptr<OdeLineCrossingCounts>> m_lineCounts;
+        
+        /**
+         * @brief copy of a Line used by the streaming thread
+         */
+        struct LineCopy
+        {
+            NvOSD_LineParams lineParams;
+            bool display;
+            std::shared_ptr<OdeLineCrossingCounts> pCounts;
+        };
+        
+        /**
+         * @brief copies of the Lines, rebuilt on any change to m_pOdeLines or the Lines
+         */
+        std::vector<LineCopy> m_lines;
+        
+        /**
+         * @brief incremented on every change to m_pOdeLines
+         */
+        std::atomic<uint64_t> m_lineListUpdates;
+        
+        /**
+         * @brief value of m_lineListUpdates when m_lines was last built
+         */
+        uint64_t m_linesListUpdates;
+        
+        /**
+         * @brief value of OdeLine::s_updateCount when m_lines was last built
+         */
+        uint64_t m_linesLineUpdates;
+        
+        /**
+         * @brief true once the current frame has been pre-processed, with m_lines 
+         * up to date, cleared on post process
+         */
+        bool m_framePreProcessed;
+        
+        /**
+         * @brief movements of the Objects in the current frame, and their Object meta
+         */
+        OdeLineMovements m_movements;
+        std::vector<NvDsObjectMeta*> m_movingObjects;
+        
+        /**
+         * @brief crossing results for the current frame and Line
+         */
+        std::vector<int8_t> m_crossings;
+    };
+
 }
 
 #endif // _DSL_ODE_H
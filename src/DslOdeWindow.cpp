@@ -0,0 +1,154 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeWindow.h"
+
+namespace DSL
+{
+    OdeWindow::OdeWindow(uint bucketCount)
+        : m_bucketCount(bucketCount)
+        , m_started(false)
+        , m_current{0}
+        , m_closed(bucketCount)
+        , m_minimums(bucketCount)
+        , m_maximums(bucketCount)
+        , m_closedSum(0)
+        , m_closedFrames(0)
+    {
+    }
+    
+    void OdeWindow::AddFrame(int64_t bucket, uint count)
+    {
+        if (!m_started or bucket < m_current.index)
+        {
+            Clear();
+            m_started = true;
+            m_current = {bucket, 0, 0, UINT32_MAX, 0};
+        }
+        else if (bucket > m_current.index)
+        {
+            // Close the current bucket, updating the running sums and queues
+            m_closed.PushBack(m_current);
+            m_closedSum += m_current.sum;
+            m_closedFrames += m_current.frames;
+            
+            while (!m_minimums.IsEmpty() and m_minimums.Back().min >= m_current.min)
+            {
+                m_minimums.PopBack();
+            }
+            m_minimums.PushBack(m_current);
+            
+            while (!m_maximums.IsEmpty() and m_maximums.Back().max <= m_current.max)
+            {
+                m_maximums.PopBack();
+            }
+            m_maximums.PushBack(m_current);
+            
+            // Drop the buckets that are no longer in the window. Each bucket 
+            // is pushed and popped once, for O(1) amortized time per frame.
+            int64_t oldest = bucket - m_bucketCount;
+            
+            while (!m_closed.IsEmpty() and m_closed.Front().index <= oldest)
+            {
+                m_closedSum -= m_closed.Front().sum;
+                m_closedFrames -= m_closed.Front().frames;
+                m_closed.PopFront();
+            }
+            while (!m_minimums.IsEmpty() and m_minimums.Front().index <= oldest)
+            {
+                m_minimums.PopFront();
+            }
+            while (!m_maximums.IsEmpty() and m_maximums.Front().index <= oldest)
+            {
+                m_maximums.PopFront();
+            }
+            m_current = {bucket, 0, 0, UINT32_MAX, 0};
+        }
+        m_current.sum += count;
+        m_current.frames++;
+        m_current.min = std::min(m_current.min, count);
+        m_current.max = std::max(m_current.max, count);
+    }
+    
+    void OdeWindow::Clear()
+    {
+        m_started = false;
+        m_current = {0, 0, 0, UINT32_MAX, 0};
+        m_closed.Clear();
+        m_minimums.Clear();
+        m_maximums.Clear();
+        m_closedSum = 0;
+        m_closedFrames = 0;
+    }
+    
+    double OdeWindow::GetAggregate(uint aggregate) const
+    {
+        switch (aggregate)
+        {
+        case DSL_ODE_WINDOW_AGGREGATE_SUM :
+            return GetSum();
+        case DSL_ODE_WINDOW_AGGREGATE_AVERAGE :
+            return GetFrames() ? (double)GetSum() / GetFrames() : 0;
+        case DSL_ODE_WINDOW_AGGREGATE_MIN :
+            return GetMin();
+        case DSL_ODE_WINDOW_AGGREGATE_MAX :
+            return GetMax();
+        }
+        return 0;
+    }
+    
+    uint64_t OdeWindow::GetSum() const
+    {
+        return m_closedSum + m_current.sum;
+    }
+    
+    uint64_t OdeWindow::GetFrames() const
+    {
+        return m_closedFrames + m_current.frames;
+    }
+    
+    uint OdeWindow::GetMin() const
+    {
+        if (!m_started)
+        {
+            return 0;
+        }
+        if (m_minimums.IsEmpty())
+        {
+            return m_current.min;
+        }
+        return std::min(m_current.min, m_minimums.Front().min);
+    }
+    
+    uint OdeWindow::GetMax() const
+    {
+        if (m_maximums.IsEmpty())
+        {
+            return m_current.max;
+        }
+        return std::max(m_current.max, m_maximums.Front().max);
+    }
+}
@@ -0,0 +1,212 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_WINDOW_H
+#define _DSL_ODE_WINDOW_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @struct OdeWindowBucket
+     * @brief Aggregate of the per-frame counts for all frames with timestamps
+     * in the same bucket interval.
+     */
+    struct OdeWindowBucket
+    {
+        int64_t index;
+        uint64_t sum;
+        uint frames;
+        uint min;
+        uint max;
+    };
+    
+    /**
+     * @class OdeWindowRing
+     * @brief Fixed capacity double ended queue of buckets. Never allocates after construction.
+     */
+    class OdeWindowRing
+    {
+    public:
+    
+        OdeWindowRing(uint capacity)
+            : m_buckets(capacity)
+            , m_first(0)
+            , m_size(0)
+        {};
+        
+        bool IsEmpty() const
+        {
+            return !m_size;
+        };
+        
+        const OdeWindowBucket& Front() const
+        {
+            return m_buckets[m_first];
+        };
+        
+        const OdeWindowBucket& Back() const
+        {
+            return m_buckets[(m_first + m_size - 1) % m_buckets.size()];
+        };
+        
+        void PushBack(const OdeWindowBucket& bucket)
+        {
+            m_buckets[(m_first + m_size) % m_buckets.size()] = bucket;
+            m_size++;
+        };
+        
+        void PopFront()
+        {
+            m_first = (m_first + 1) % m_buckets.size();
+            m_size--;
+        };
+        
+        void PopBack()
+        {
+            m_size--;
+        };
+        
+        void Clear()
+        {
+            m_first = 0;
+            m_size = 0;
+        };
+        
+    private:
+    
+        std::vector<OdeWindowBucket> m_buckets;
+        
+        uint m_first;
+        
+        uint m_size;
+    };
+    
+    /**
+     * @class OdeWindow
+     * @brief Sliding time window over the per-frame Object counts of one source. 
+     * Frames are grouped into fixed interval buckets, and the window spans the
+     * current bucket and the buckets before it, up to a fixed bucket count. 
+     * The running sum, and the minimum and maximum using monotonic queues, are 
+     * maintained in O(1) amortized time per frame and bounded memory.
+     */
+    class OdeWindow
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeWindow class
+         * @param[in] bucketCount number of buckets spanned by the window, 
+         * in the range [1..DSL_ODE_WINDOW_BUCKETS_MAX]
+         */
+        OdeWindow(uint bucketCount);
+        
+        /**
+         * @brief Adds the count for one frame. Buckets that are no longer in the 
+         * window are dropped. The window is cleared if the bucket index goes backwards.
+         * @param[in] bucket bucket index for the frame's timestamp
+         * @param[in] count Object count for the frame
+         */
+        void AddFrame(int64_t bucket, uint count);
+        
+        /**
+         * @brief Clears all frames from the window
+         */
+        void Clear();
+        
+        /**
+         * @brief Gets a windowed aggregate of the per-frame counts
+         * @param[in] aggregate one of the DSL_ODE_WINDOW_AGGREGATE constants
+         * @return the aggregate, or 0 if the window is empty
+         */
+        double GetAggregate(uint aggregate) const;
+        
+        /**
+         * @brief sum of the per-frame counts in the window
+         */
+        uint64_t GetSum() const;
+        
+        /**
+         * @brief number of frames in the window
+         */
+        uint64_t GetFrames() const;
+        
+        /**
+         * @brief minimum per-frame count in the window
+         */
+        uint GetMin() const;
+        
+        /**
+         * @brief maximum per-frame count in the window
+         */
+        uint GetMax() const;
+        
+    private:
+    
+        /**
+         * @brief number of buckets spanned by the window
+         */
+        uint m_bucketCount;
+        
+        /**
+         * @brief true once the first frame has been added
+         */
+        bool m_started;
+        
+        /**
+         * @brief the current, still open bucket
+         */
+        OdeWindowBucket m_current;
+        
+        /**
+         * @brief closed buckets still in the window, oldest first
+         */
+        OdeWindowRing m_closed;
+        
+        /**
+         * @brief closed buckets with increasing minimums, the front is the window minimum
+         */
+        OdeWindowRing m_minimums;
+        
+        /**
+         * @brief closed buckets with decreasing maximums, the front is the window maximum
+         */
+        OdeWindowRing m_maximums;
+        
+        /**
+         * @brief running sum of the counts in m_closed
+         */
+        uint64_t m_closedSum;
+        
+        /**
+         * @brief running number of frames in m_closed
+         */
+        uint64_t m_closedFrames;
+    };
+}
+
+#endif // _DSL_ODE_WINDOW_H
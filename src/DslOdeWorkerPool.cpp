@@ -0,0 +1,242 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeWorkerPool.h"
+
+namespace DSL
+{
+    /**
+     * @struct OdeWorkerContext
+     * @brief start-up data for each worker thread
+     */
+    struct OdeWorkerContext
+    {
+        OdeWorkerPool* pPool;
+        uint worker;
+    };
+    
+    static inline uint64_t packRange(uint first, uint end)
+    {
+        return ((uint64_t)end << 32) | first;
+    }
+    
+    OdeWorkerPool::OdeWorkerPool(uint workerCount)
+        : m_ranges(std::min(std::max(workerCount, 1u), (uint)DSL_ODE_WORKER_POOL_MAX_WORKERS))
+        , m_pIteration(NULL)
+        , m_generation(0)
+        , m_busyWorkers(0)
+        , m_stop(false)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_workMutex);
+        g_cond_init(&m_workStart);
+        g_cond_init(&m_workDone);
+        
+        for (auto& range: m_ranges)
+        {
+            range.bounds.store(0);
+        }
+        // worker 0 is the thread calling ParallelFor
+        for (uint i = 1; i < m_ranges.size(); i++)
+        {
+            std::string threadName = "dsl-ode-worker-" + std::to_string(i);
+            m_threads.push_back(g_thread_new(threadName.c_str(), 
+                OdeWorkerPoolWorkerThread, new OdeWorkerContext{this, i}));
+        }
+    }
+    
+    OdeWorkerPool::~OdeWorkerPool()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_workMutex);
+            m_stop = true;
+            g_cond_broadcast(&m_workStart);
+        }
+        for (auto const& ithread: m_threads)
+        {
+            g_thread_join(ithread);
+        }
+        g_cond_clear(&m_workDone);
+        g_cond_clear(&m_workStart);
+        g_mutex_clear(&m_workMutex);
+    }
+    
+    uint OdeWorkerPool::GetWorkerCount()
+    {
+        LOG_FUNC();
+        
+        return m_ranges.size();
+    }
+    
+    void OdeWorkerPool::ParallelFor(uint count, const std::function<void(uint)>& iteration)
+    {
+        // Nothing to share, run in order on the calling thread
+        if (m_threads.empty() or count < 2)
+        {
+            for (uint i = 0; i < count; i++)
+            {
+                iteration(i);
+            }
+            return;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_workMutex);
+            
+            m_pIteration = &iteration;
+            
+            // Even split, with the remainder spread over the first workers
+            uint workers = m_ranges.size();
+            uint first(0);
+            for (uint i = 0; i < workers; i++)
+            {
+                uint size = count / workers + ((i < count % workers) ? 1 : 0);
+                m_ranges[i].bounds.store(packRange(first, first+size));
+                first += size;
+            }
+            m_busyWorkers = m_threads.size();
+            m_generation++;
+            g_cond_broadcast(&m_workStart);
+        }
+        
+        runIterations(0);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_workMutex);
+        while (m_busyWorkers)
+        {
+            g_cond_wait(&m_workDone, &m_workMutex);
+        }
+        m_pIteration = NULL;
+    }
+    
+    void OdeWorkerPool::RunWorker(uint worker)
+    {
+        uint64_t generation(0);
+        
+        while (true)
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_workMutex);
+                while (!m_stop and m_generation == generation)
+                {
+                    g_cond_wait(&m_workStart, &m_workMutex);
+                }
+                if (m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+            }
+            
+            runIterations(worker);
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_workMutex);
+            if (--m_busyWorkers == 0)
+            {
+                g_cond_signal(&m_workDone);
+            }
+        }
+    }
+    
+    void OdeWorkerPool::runIterations(uint worker)
+    {
+        uint iteration(0);
+        
+        do
+        {
+            while (takeIteration(worker, iteration))
+            {
+                (*m_pIteration)(iteration);
+            }
+        } while (stealIterations(worker));
+    }
+    
+    bool OdeWorkerPool::takeIteration(uint worker, uint& iteration)
+    {
+        std::atomic<uint64_t>& bounds = m_ranges[worker].bounds;
+        
+        uint64_t current = bounds.load(std::memory_order_acquire);
+        while (true)
+        {
+            uint first = (uint)current;
+            uint end = (uint)(current >> 32);
+            if (first >= end)
+            {
+                return false;
+            }
+            // a failed exchange reloads current, as the back may have been stolen
+            if (bounds.compare_exchange_weak(current, packRange(first+1, end),
+                std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                iteration = first;
+                return true;
+            }
+        }
+    }
+    
+    bool OdeWorkerPool::stealIterations(uint worker)
+    {
+        uint workers = m_ranges.size();
+        
+        // Start with the next worker so that thieves spread over their victims
+        for (uint i = 1; i < workers; i++)
+        {
+            std::atomic<uint64_t>& bounds = m_ranges[(worker+i) % workers].bounds;
+            
+            uint64_t current = bounds.load(std::memory_order_acquire);
+            while (true)
+            {
+                uint first = (uint)current;
+                uint end = (uint)(current >> 32);
+                if (first >= end)
+                {
+                    break;
+                }
+                uint split = end - (end - first + 1) / 2;
+                if (bounds.compare_exchange_weak(current, packRange(first, split),
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    // Only the owner writes to its own range once empty
+                    m_ranges[worker].bounds.store(packRange(split, end), 
+                        std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+    static gpointer OdeWorkerPoolWorkerThread(gpointer pWorker)
+    {
+        OdeWorkerContext* pContext = static_cast<OdeWorkerContext*>(pWorker);
+        
+        pContext->pPool->RunWorker(pContext->worker);
+        delete pContext;
+        
+        return NULL;
+    }
+}
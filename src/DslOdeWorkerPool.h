@@ -0,0 +1,174 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_WORKER_POOL_H
+#define _DSL_ODE_WORKER_POOL_H
+
+#include "Dsl.h"
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @brief upper limit on the number of workers in an ODE worker pool, 
+     * including the calling thread.
+     */
+    #define DSL_ODE_WORKER_POOL_MAX_WORKERS 64
+
+    /**
+     * @class OdeWorkerPool
+     * @brief Fixed pool of worker threads for running the iterations of a loop
+     * concurrently. Each call to ParallelFor splits the iterations into one 
+     * contiguous range per worker. A worker takes iterations from the front of
+     * its own range, and once empty, steals the back half of another's range.
+     * The calling thread takes part as worker 0, so a pool of one worker runs
+     * every iteration, in order, on the calling thread.
+     */
+    class OdeWorkerPool
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeWorkerPool class
+         * @param[in] workerCount number of workers, including the calling thread.
+         * Clamped to [1, DSL_ODE_WORKER_POOL_MAX_WORKERS].
+         */
+        OdeWorkerPool(uint workerCount);
+        
+        ~OdeWorkerPool();
+        
+        /**
+         * @brief Gets the number of workers in the pool, including the calling thread.
+         * @return number of workers.
+         */
+        uint GetWorkerCount();
+        
+        /**
+         * @brief Calls a function once for each iteration in [0, count), spread
+         * over all workers. Returns once every iteration has completed. Must not
+         * be called concurrently, or from within one of its own iterations.
+         * @param[in] count number of iterations.
+         * @param[in] iteration function to call with each iteration index.
+         */
+        void ParallelFor(uint count, const std::function<void(uint)>& iteration);
+        
+        /**
+         * @brief Worker loop, runs the iterations of each ParallelFor until stopped.
+         * @param[in] worker index of the calling worker, 1 or greater.
+         */
+        void RunWorker(uint worker);
+        
+    private:
+    
+        /**
+         * @brief Runs the iterations in a worker's own range, then steals from
+         * the other workers until all ranges are empty.
+         * @param[in] worker index of the calling worker.
+         */
+        void runIterations(uint worker);
+        
+        /**
+         * @brief Takes the next iteration from the front of a worker's own range.
+         * @param[in] worker index of the calling worker.
+         * @param[out] iteration the iteration taken.
+         * @return true if an iteration was taken, false if the range is empty.
+         */
+        bool takeIteration(uint worker, uint& iteration);
+        
+        /**
+         * @brief Steals the back half of another worker's range, 
+         * replacing the calling worker's empty range.
+         * @param[in] worker index of the calling worker.
+         * @return true if any iterations were stolen, false if all ranges are empty.
+         */
+        bool stealIterations(uint worker);
+        
+        /**
+         * @struct OdeWorkerRange
+         * @brief Range of iterations owned by one worker, with the first iteration
+         * in the low 32 bits and the end in the high 32 bits. Padded to a cache line
+         * so that the workers do not contend on each other's ranges.
+         */
+        struct OdeWorkerRange
+        {
+            std::atomic<uint64_t> bounds;
+            char padding[64 - sizeof(std::atomic<uint64_t>)];
+        };
+        
+        /**
+         * @brief one range for each worker, indexed by worker.
+         */
+        std::vector<OdeWorkerRange> m_ranges;
+        
+        /**
+         * @brief iteration function of the current ParallelFor.
+         */
+        const std::function<void(uint)>* m_pIteration;
+        
+        /**
+         * @brief mutex to guard the generation, busy count and stop flag.
+         */
+        GMutex m_workMutex;
+        
+        /**
+         * @brief signaled when a new ParallelFor starts, or the pool stops.
+         */
+        GCond m_workStart;
+        
+        /**
+         * @brief signaled when the last busy worker completes.
+         */
+        GCond m_workDone;
+        
+        /**
+         * @brief incremented on each ParallelFor, so that the workers 
+         * can tell a new start from a spurious wakeup.
+         */
+        uint64_t m_generation;
+        
+        /**
+         * @brief number of worker threads still running the current ParallelFor.
+         */
+        uint m_busyWorkers;
+        
+        /**
+         * @brief set on destruction to stop the worker threads.
+         */
+        bool m_stop;
+        
+        /**
+         * @brief worker threads, one less than the worker count.
+         */
+        std::vector<GThread*> m_threads;
+    };
+    
+    /**
+     * @brief Thread function for each of the pool's worker threads.
+     * @param[in] pWorker pointer to a heap allocated OdeWorkerContext, 
+     * identifying the pool and worker index. Freed by the thread.
+     */
+    static gpointer OdeWorkerPoolWorkerThread(gpointer pWorker);
+}
+
+#endif // _DSL_ODE_WORKER_POOL_H
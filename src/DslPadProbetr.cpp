@@ -29,7 +29,11 @@ namespace DSL
 {
     PadProbetr::PadProbetr(const char* name, const char* factoryName, DSL_ELEMENT_PTR parentElement)
         : m_name(name)
+        , m_pClientBatchMetaHandlers(std::make_shared<const BatchMetaHandlers>())
+        , m_clientBatchMetaHandlerCount(0)
         , m_kittiOutputEnabled(false)
+        , m_kittiOutputMode(DSL_KITTI_OUTPUT_MODE_FRAME_FILES)
+        , m_kittiMaxFileSize(0)
     {
         GstPad* pStaticPad = gst_element_get_static_pad(parentElement->GetGstElement(), factoryName);
         if (!pStaticPad)
@@ -60,13 +64,21 @@ namespace DSL
         void* pClientUserData)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
         
         if (IsChild(pClientBatchMetaHandler))
         {
             LOG_ERROR("Client Meta Batch Handler is already a child of PadProbetr '" << m_name << "'");
             return false;
         }
-        m_pClientBatchMetaHandlers[pClientBatchMetaHandler] = pClientUserData;
+        std::shared_ptr<BatchMetaHandlers> pNewHandlers = 
+            std::make_shared<BatchMetaHandlers>(*std::atomic_load(&m_pClientBatchMetaHandlers));
+        pNewHandlers->push_back(std::make_shared<BatchMetaHandler>(
+            pClientBatchMetaHandler, pClientUserData));
+        
+        std::atomic_store(&m_pClientBatchMetaHandlers, 
+            std::shared_ptr<const BatchMetaHandlers>(pNewHandlers));
+        m_clientBatchMetaHandlerCount.store(pNewHandlers->size());
 
         return true;
     }
@@ -74,14 +86,27 @@ namespace DSL
     bool PadProbetr::RemoveBatchMetaHandler(dsl_batch_meta_handler_cb pClientBatchMetaHandler)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
         
         if (!IsChild(pClientBatchMetaHandler))
         {
             LOG_ERROR("Client Meta Batch Handler is not owned by PadProbetr '" << m_name << "'");
             return false;
         }
-        m_pClientBatchMetaHandlers.erase(pClientBatchMetaHandler);
+        std::shared_ptr<BatchMetaHandlers> pNewHandlers = 
+            std::make_shared<BatchMetaHandlers>(*std::atomic_load(&m_pClientBatchMetaHandlers));
+        auto iHandler = std::find_if(pNewHandlers->begin(), pNewHandlers->end(),
+            [pClientBatchMetaHandler](const std::shared_ptr<BatchMetaHandler>& pHandler)
+            {return pHandler->handler == pClientBatchMetaHandler;});
         
+        // Pad Probes still iterating over a previous list skip the Handler from here on.
+        // They are not waited on, as the caller may hold a lock the Handler needs.
+        (*iHandler)->removed = true;
+        pNewHandlers->erase(iHandler);
+        
+        m_clientBatchMetaHandlerCount.store(pNewHandlers->size());
+        std::atomic_store(&m_pClientBatchMetaHandlers, 
+            std::shared_ptr<const BatchMetaHandlers>(pNewHandlers));
         return true;
     }
 
@@ -89,12 +114,18 @@ namespace DSL
     {
         LOG_FUNC();
         
-        return (m_pClientBatchMetaHandlers.find(pClientBatchMetaHandler) != m_pClientBatchMetaHandlers.end());
+        std::shared_ptr<const BatchMetaHandlers> pHandlers = 
+            std::atomic_load(&m_pClientBatchMetaHandlers);
+        
+        return (std::find_if(pHandlers->begin(), pHandlers->end(),
+            [pClientBatchMetaHandler](const std::shared_ptr<BatchMetaHandler>& pHandler)
+            {return pHandler->handler == pClientBatchMetaHandler;}) != pHandlers->end());
     }
 
     bool PadProbetr::SetKittiOutputEnabled(bool enabled, const char* path)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
         
         if (enabled)
         {
@@ -120,17 +151,70 @@ namespace DSL
             LOG_INFO("Disabling Kitti output for PadProbetr '" << m_name << "'");
             m_kittiOutputPath.clear();
         }
+        return updateKittiWriter(enabled);
+    }
+    
+    void PadProbetr::GetKittiOutputMode(uint* mode, uint* maxFileSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
+        
+        *mode = m_kittiOutputMode;
+        *maxFileSize = m_kittiMaxFileSize;
+    }
+    
+    bool PadProbetr::SetKittiOutputMode(uint mode, uint maxFileSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
+        
+        if (mode > DSL_KITTI_OUTPUT_MODE_SOURCE_FILES)
+        {
+            LOG_ERROR("Invalid Kitti output mode " << mode << " for PadProbetr '" << m_name << "'");
+            return false;
+        }
+        m_kittiOutputMode = mode;
+        m_kittiMaxFileSize = maxFileSize;
+        
+        if (m_kittiOutputEnabled)
+        {
+            return updateKittiWriter(true);
+        }
+        return true;
+    }
+    
+    bool PadProbetr::updateKittiWriter(bool enabled)
+    {
+        LOG_FUNC();
+        
+        DSL_KITTI_WRITER_PTR pKittiWriter(nullptr);
+        if (enabled)
+        {
+            try
+            {
+                pKittiWriter = DSL_KITTI_WRITER_NEW(m_name.c_str(), 
+                    m_kittiOutputPath.c_str(), m_kittiOutputMode, m_kittiMaxFileSize);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Failed to create Kitti Writer for PadProbetr '" << m_name << "'");
+                return false;
+            }
+        }
         m_kittiOutputEnabled = enabled;
+        
+        // The previous Writer, if any, is destroyed by the last of this thread and any
+        // Pad Probe still using it, writing all batches it has queued before closing
+        // its files. Pad Probes in progress are not waited on.
+        std::atomic_store(&m_pKittiWriter, pKittiWriter);
         return true;
     }
 
     GstPadProbeReturn PadProbetr::HandlePadProbe(GstPad* pPad, GstPadProbeInfo* pInfo)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
-        
         if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
         {
-            if (m_pClientBatchMetaHandlers.size() or m_kittiOutputEnabled)
+            if (m_clientBatchMetaHandlerCount.load() or m_kittiOutputEnabled)
             {
                 GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
                 if (!pBuffer)
@@ -138,20 +222,42 @@ namespace DSL
                     LOG_WARN("Unable to get data buffer for PadProbetr '" << m_name << "'");
                     return GST_PAD_PROBE_OK;
                 }
-                for (auto const& imap: m_pClientBatchMetaHandlers)
+                
+                std::shared_ptr<const BatchMetaHandlers> pHandlers = 
+                    std::atomic_load(&m_pClientBatchMetaHandlers);
+                
+                std::vector<dsl_batch_meta_handler_cb> removedHandlers;
+                for (auto const& pHandler: *pHandlers)
                 {
-                    // Remove the client on false return
-                    if (!imap.first(pBuffer, imap.second))
+                    // Removed since the snapshot was taken, possibly by a previous Handler
+                    if (pHandler->removed)
                     {
-                        LOG_INFO("Removing client batch meta handler for PadProbetr '" << m_name << "'");
-                        RemoveBatchMetaHandler(imap.first);
+                        continue;
                     }
+                    // Remove the client on false return, deferred until iteration is done
+                    if (!pHandler->handler(pBuffer, pHandler->userData))
+                    {
+                        removedHandlers.push_back(pHandler->handler);
+                    }
+                }
+                pHandlers = nullptr;
+                
+                // Formats the batch and queues it for the Writer's own thread
+                DSL_KITTI_WRITER_PTR pKittiWriter = std::atomic_load(&m_pKittiWriter);
+                if (pKittiWriter)
+                {
+                    pKittiWriter->WriteBatch(gst_buffer_get_nvds_batch_meta(pBuffer));
+                    pKittiWriter = nullptr;
                 }
-                if (m_kittiOutputEnabled)
+                
+                for (auto const& ivec: removedHandlers)
                 {
-                    
+                    LOG_INFO("Removing client batch meta handler for PadProbetr '" << m_name << "'");
+                    if (IsChild(ivec))
+                    {
+                        RemoveBatchMetaHandler(ivec);
+                    }
                 }
-                // TODO if write output
             }
         }
         return GST_PAD_PROBE_PASS;
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslElementr.h"
+#include "DslKittiWriter.h"
 
 namespace DSL
 {
@@ -38,9 +39,37 @@ namespace DSL
     #define DSL_PAD_PROBE_NEW(name, factoryName, parentElement) \
         std::shared_ptr<PadProbetr>(new PadProbetr(name, factoryName, parentElement))    
 
+    /**
+     * @struct BatchMetaHandler
+     * @brief Client Batch Meta Handler and its user data, shared by all lists that
+     * hold it. Flagged as removed so that Pad Probes still iterating over an older
+     * list skip the Handler once it has been removed.
+     */
+    struct BatchMetaHandler
+    {
+        BatchMetaHandler(dsl_batch_meta_handler_cb clientHandler, void* clientUserData)
+            : handler(clientHandler)
+            , userData(clientUserData)
+            , removed(false)
+        {};
+        
+        dsl_batch_meta_handler_cb handler;
+        
+        void* userData;
+        
+        std::atomic<bool> removed;
+    };
+
+    /**
+     * @brief immutable list of Client Batch Meta Handlers. 
+     */
+    typedef std::vector<std::shared_ptr<BatchMetaHandler>> BatchMetaHandlers;
+
     /**
      * @class PadProbetr
-     * @brief Implements a container class for GST Pad Probe
+     * @brief Implements a container class for GST Pad Probe. The Client Batch Meta 
+     * Handlers are held in an immutable list that is copied, updated, and swapped
+     * on add/remove. The Pad Probe reads the current list without taking a lock. 
      */
     class PadProbetr : public std::enable_shared_from_this<PadProbetr>
     {
@@ -69,6 +98,8 @@ namespace DSL
             
         /**
          * @brief Removes the current Batch Meta Handler callback function from the PadProbetr
+         * On return, the Handler will not be called again. A call already in progress on
+         * a streaming thread is not waited on, and may complete after removal returns.
          * @param pClientBatchMetaHandler callback function pointer to remove
          * @return false if the PadProbetr does not have a Meta Batch Handler to remove.
          */
@@ -97,16 +128,41 @@ namespace DSL
          * @return true if success, false otherwise.
          */
         bool SetKittiOutputEnabled(bool enabled, const char* path);
+        
+        /**
+         * @brief Gets the current Kitti output mode and maximum file size
+         * @param[out] mode one of the DSL_KITTI_OUTPUT_MODE constants
+         * @param[out] maxFileSize maximum size of each source file in bytes, 0 = no rotation
+         */
+        void GetKittiOutputMode(uint* mode, uint* maxFileSize);
+        
+        /**
+         * @brief Sets the Kitti output mode and maximum file size. 
+         * If output is currently enabled, new files are started with the new settings.
+         * @param[in] mode one of the DSL_KITTI_OUTPUT_MODE constants
+         * @param[in] maxFileSize maximum size of each source file in bytes, 0 = no rotation
+         * @return true if success, false otherwise.
+         */
+        bool SetKittiOutputMode(uint mode, uint maxFileSize);
 
     private:
     
+        /**
+         * @brief Creates a new Kitti Writer, or clears the current Writer, and swaps it
+         * in. The previous Writer is destroyed once the last Pad Probe using it is done.
+         * @param[in] enabled true to create a new Writer, false to clear the current Writer
+         * @return false if the new Writer could not be created, true otherwise. 
+         */
+        bool updateKittiWriter(bool enabled);
+        
         /**
          * @brief unique name for this PadProbetr
          */
         std::string m_name;
 
         /**
-         * @brief mutex fo the Pad Probe handler
+         * @brief mutex to serialize updates to the Client Batch Meta Handler list.
+         * Not taken by the Pad Probe handler.
          */
         GMutex m_padProbeMutex;
         
@@ -116,19 +172,41 @@ namespace DSL
         uint m_padProbeId;
 
         /**
-         * @brief map of Client Pad Batch Meta handlers
+         * @brief current list of Client Batch Meta Handlers, read and swapped atomically
          */
-        std::map<dsl_batch_meta_handler_cb, void*> m_pClientBatchMetaHandlers;
-
+        std::shared_ptr<const BatchMetaHandlers> m_pClientBatchMetaHandlers;
+        
+        /**
+         * @brief number of Handlers in the current list, checked first by the 
+         * Pad Probe handler so that a probe with no Handlers costs a single load.
+         */
+        std::atomic<uint> m_clientBatchMetaHandlerCount;
+        
         /**
          * true if kitti file output is currently enabled.
          */
-        bool m_kittiOutputEnabled;
+        std::atomic<bool> m_kittiOutputEnabled;
         
         /**
          * @brief absolute or relative pathspec to the Kitti output dir used by this PadProbetr
          */
         std::string m_kittiOutputPath;
+        
+        /**
+         * @brief one of the DSL_KITTI_OUTPUT_MODE constants.
+         */
+        uint m_kittiOutputMode;
+        
+        /**
+         * @brief maximum size of each Kitti source file in bytes, 0 = no rotation.
+         */
+        uint m_kittiMaxFileSize;
+        
+        /**
+         * @brief current Kitti Writer, read and swapped atomically, 
+         * nullptr while Kitti output is disabled.
+         */
+        DSL_KITTI_WRITER_PTR m_pKittiWriter;
     };
     
     static GstPadProbeReturn PadProbeCB(GstPad* pPad, 
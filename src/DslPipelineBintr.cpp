@@ -287,6 +287,10 @@ namespace DSL
                 LOG_ERROR("Unable to prepare Pipeline '" << GetName() << "' for Play");
                 return false;
             }
+            if (m_pLatencyTracer)
+            {
+                traceLinkedComponents();
+            }
             // For non-live sources we Pause to preroll before we play
             if (!m_pPipelineSourcesBintr->StreamMuxPlayTypeIsLive())
             {
@@ -336,6 +340,10 @@ namespace DSL
             LOG_ERROR("Failed to Stop Pipeline '" << GetName() << "'");
             return false;
         }
+        if (m_pLatencyTracer)
+        {
+            m_pLatencyTracer->RemoveAll();
+        }
         if (IsLinked())
         {
             UnlinkAll();
@@ -371,6 +379,135 @@ namespace DSL
             GST_DEBUG_GRAPH_SHOW_ALL, filename);
     }
 
+    bool PipelineBintr::GetLatencyTracingEnabled()
+    {
+        LOG_FUNC();
+        
+        return (m_pLatencyTracer != nullptr);
+    }
+    
+    bool PipelineBintr::SetLatencyTracingEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (enabled == (m_pLatencyTracer != nullptr))
+        {
+            LOG_INFO("Latency tracing for Pipeline '" << GetName() 
+                << "' is already " << (enabled ? "enabled" : "disabled"));
+            return true;
+        }
+        if (!enabled)
+        {
+            // deleting the tracer removes all probes from the linked components
+            m_pLatencyTracer = nullptr;
+            return true;
+        }
+        m_pLatencyTracer = DSL_LATENCY_TRACER_NEW(GetCStrName());
+        
+        if (IsLinked())
+        {
+            traceLinkedComponents();
+        }
+        return true;
+    }
+    
+    bool PipelineBintr::GetLatencyStats(const char* component, dsl_latency_stats* pStats)
+    {
+        LOG_FUNC();
+        
+        if (!m_pLatencyTracer)
+        {
+            LOG_ERROR("Latency tracing is not enabled for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        return m_pLatencyTracer->GetStats(component, pStats);
+    }
+    
+    bool PipelineBintr::ResetLatencyStats()
+    {
+        LOG_FUNC();
+        
+        if (!m_pLatencyTracer)
+        {
+            LOG_ERROR("Latency tracing is not enabled for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        m_pLatencyTracer->ResetStats();
+        return true;
+    }
+    
+    bool PipelineBintr::AddLatencyStatsHandler(dsl_latency_stats_handler_cb handler, 
+        uint interval, void* clientData)
+    {
+        LOG_FUNC();
+        
+        if (!m_pLatencyTracer)
+        {
+            LOG_ERROR("Latency tracing is not enabled for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        return m_pLatencyTracer->AddStatsHandler(handler, interval, clientData);
+    }
+    
+    bool PipelineBintr::RemoveLatencyStatsHandler(dsl_latency_stats_handler_cb handler)
+    {
+        LOG_FUNC();
+        
+        if (!m_pLatencyTracer)
+        {
+            LOG_ERROR("Latency tracing is not enabled for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        return m_pLatencyTracer->RemoveStatsHandler(handler);
+    }
+    
+    void PipelineBintr::traceLinkedComponents()
+    {
+        LOG_FUNC();
+        
+        // Frames enter the Pipeline at the src pad of each Source, keyed by the 
+        // Source's unique id until batched, and by their frame meta once batched.
+        std::vector<DSL_LATENCY_TRACE_POINT_PTR> sourcePoints;
+        for (auto const& imap: m_pPipelineSourcesBintr->m_pChildSources)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(
+                imap.second->GetGstElement(), "src");
+            sourcePoints.push_back(m_pLatencyTracer->AddPoint(pSrcPad,
+                (imap.second->IsBatched()) ? -1 : imap.second->GetId()));
+            gst_object_unref(pSrcPad);
+        }
+        
+        // Each component is traced from its sink pad to its src pad, except for the
+        // Sources that enter through the Sources' pads. The Sinks, Demuxer, and 
+        // Splitter have no src pad and end the Pipeline's traced stages.
+        std::vector<DSL_LATENCY_TRACE_POINT_PTR> entryPoints(sourcePoints);
+        DSL_LATENCY_TRACE_POINT_PTR pLastPoint;
+        
+        for (auto const& ibintr: m_linkedComponents)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(ibintr->GetGstElement(), "sink");
+            if (pSinkPad)
+            {
+                pLastPoint = m_pLatencyTracer->AddPoint(pSinkPad, -1);
+                entryPoints = {pLastPoint};
+                gst_object_unref(pSinkPad);
+            }
+            GstPad* pSrcPad = gst_element_get_static_pad(ibintr->GetGstElement(), "src");
+            if (!pSrcPad)
+            {
+                break;
+            }
+            pLastPoint = m_pLatencyTracer->AddPoint(pSrcPad, -1);
+            gst_object_unref(pSrcPad);
+            
+            m_pLatencyTracer->AddStage(ibintr->GetCStrName(), entryPoints, {pLastPoint});
+        }
+        if (pLastPoint)
+        {
+            m_pLatencyTracer->AddStage("", sourcePoints, {pLastPoint});
+        }
+    }
+    
     bool PipelineBintr::AddStateChangeListener(dsl_state_change_listener_cb listener, void* userdata)
     {
         LOG_FUNC();
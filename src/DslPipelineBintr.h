@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslDewarperBintr.h"
 #include "DslPipelineSourcesBintr.h"
+#include "DslLatencyTracer.h"
     
 namespace DSL 
 {
@@ -261,6 +262,52 @@ namespace DSL
          */
         bool RemoveXWindowDeleteEventHandler(dsl_xwindow_delete_event_handler_cb handler);
             
+        /**
+         * @brief Gets the current latency tracing enabled setting for this Pipeline
+         * @return true if latency tracing is enabled, false otherwise
+         */
+        bool GetLatencyTracingEnabled();
+        
+        /**
+         * @brief Enables or disables latency tracing for this Pipeline. Probes are
+         * installed on the linked components while the Pipeline is playing or paused.
+         * @param[in] enabled set to true to enable, false to disable and remove all
+         * latency stats and latency stats handlers.
+         * @return true on successful update, false otherwise
+         */
+        bool SetLatencyTracingEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the latency stats for a traced component or end-to-end
+         * @param[in] component name of the component, empty for end-to-end
+         * @param[out] pStats stats structure to fill in, the component name excluded
+         * @return true if the component is traced, false otherwise
+         */
+        bool GetLatencyStats(const char* component, dsl_latency_stats* pStats);
+        
+        /**
+         * @brief Resets the latency stats for all traced components
+         * @return false if latency tracing is disabled, true otherwise
+         */
+        bool ResetLatencyStats();
+        
+        /**
+         * @brief adds a callback to be called periodically with the latency stats
+         * @param[in] handler pointer to the client's function to call
+         * @param[in] interval reporting interval in milliseconds
+         * @param[in] clientData opaque pointer to client data passed into the handler.
+         * @return true on successful add, false otherwise
+         */
+        bool AddLatencyStatsHandler(dsl_latency_stats_handler_cb handler, 
+            uint interval, void* clientData);
+
+        /**
+         * @brief removes a previously added latency stats handler
+         * @param[in] handler pointer to the client's function to remove
+         * @return true on successful remove, false otherwise
+         */
+        bool RemoveLatencyStatsHandler(dsl_latency_stats_handler_cb handler);
+            
         /**
          * @brief handles incoming Message Packets received
          * by the bus watcher callback function
@@ -306,11 +353,23 @@ namespace DSL
         
         void HandleErrorMessage(GstMessage* pMessage);
         
+        /**
+         * @brief adds a trace point to the Latency Tracer for the src pad of each Source
+         * and for the sink and src pads of each linked component, and adds a stage for
+         * each component with both pads and for the Pipeline end-to-end.
+         */
+        void traceLinkedComponents();
+        
         /**
          * @brief parent bin for all Source bins in this Pipeline
          */
         DSL_PIPELINE_SOURCES_PTR m_pPipelineSourcesBintr;
         
+        /**
+         * @brief optional Latency Tracer, created when latency tracing is enabled.
+         */
+        DSL_LATENCY_TRACER_PTR m_pLatencyTracer;
+        
         /**
          * @brief width setting to use on XWindow creation in pixels
          */
@@ -79,6 +79,15 @@ namespace DSL
             return false;
         }
         
+        // A batched source replaces the Stream Muxer, so can't share it with other sources
+        if (m_pChildSources.size() and (pChildSource->IsBatched() or 
+            m_pChildSources.begin()->second->IsBatched()))
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() << "' can't be added to '" 
+                << GetName() << "', a batched Source must be the only Source");
+            return false;
+        }
+        
         // Set the play type based on the first source added
         if (m_pChildSources.size() == 0)
         {
@@ -137,7 +146,11 @@ namespace DSL
             return false;
         }
 
-        if (pChildSource->IsLinkedToSink())
+        if (pChildSource->IsBatched() and IsLinked())
+        {
+            unlinkBatchedSource(pChildSource);
+        }
+        else if (pChildSource->IsLinkedToSink())
         {
             // unlink the source from the Streammuxer
             pChildSource->UnlinkFromSink();
@@ -160,6 +173,15 @@ namespace DSL
             LOG_ERROR("PipelineSourcesBintr '" << GetName() << "' is already linked");
             return false;
         }
+        if (m_pChildSources.size() and m_pChildSources.begin()->second->IsBatched())
+        {
+            if (!linkBatchedSource(m_pChildSources.begin()->second))
+            {
+                return false;
+            }
+            m_isLinked = true;
+            return true;
+        }
         uint id(0);
         for (auto const& imap: m_pChildSources)
         {
@@ -193,6 +215,12 @@ namespace DSL
             LOG_ERROR("PipelineSourcesBintr '" << GetName() << "' is not linked");
             return;
         }
+        if (m_pChildSources.size() and m_pChildSources.begin()->second->IsBatched())
+        {
+            unlinkBatchedSource(m_pChildSources.begin()->second);
+            m_isLinked = false;
+            return;
+        }
         for (auto const& imap: m_pChildSources)
         {
             // unlink from the Tee Element
@@ -211,6 +239,68 @@ namespace DSL
         m_isLinked = false;
     }
     
+    bool PipelineSourcesBintr::linkBatchedSource(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        pChildSource->SetId(0);
+        if (!pChildSource->LinkAll())
+        {
+            LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                << "' failed to Link Batched Source '" << pChildSource->GetName() << "'");
+            return false;
+        }
+        
+        // The Stream Muxer would replace the Source's batch meta, so is kept in the 
+        // NULL state and the Ghost Pad is retargeted to the Source's src pad.
+        gst_element_set_locked_state(m_pStreamMux->GetGstElement(), TRUE);
+        
+        GstPad* pGhostPad = gst_element_get_static_pad(GetGstElement(), "src");
+        GstPad* pSourcePad = gst_element_get_static_pad(pChildSource->GetGstElement(), "src");
+        
+        bool retargeted = gst_ghost_pad_set_target(GST_GHOST_PAD(pGhostPad), pSourcePad);
+        
+        gst_object_unref(pSourcePad);
+        gst_object_unref(pGhostPad);
+
+        if (!retargeted)
+        {
+            LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                << "' failed to retarget its src pad to Batched Source '" 
+                << pChildSource->GetName() << "'");
+            unlinkBatchedSource(pChildSource);
+            return false;
+        }
+        LOG_INFO("PipelineSourcesBintr '" << GetName() 
+            << "' bypassing the Stream Muxer for Batched Source '" 
+            << pChildSource->GetName() << "'");
+        return true;
+    }
+    
+    void PipelineSourcesBintr::unlinkBatchedSource(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        GstPad* pGhostPad = gst_element_get_static_pad(GetGstElement(), "src");
+        GstPad* pStreamMuxPad = gst_element_get_static_pad(m_pStreamMux->GetGstElement(), "src");
+        
+        if (!gst_ghost_pad_set_target(GST_GHOST_PAD(pGhostPad), pStreamMuxPad))
+        {
+            LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                << "' failed to retarget its src pad to the Stream Muxer");
+        }
+        gst_object_unref(pStreamMuxPad);
+        gst_object_unref(pGhostPad);
+        
+        gst_element_set_locked_state(m_pStreamMux->GetGstElement(), FALSE);
+
+        if (pChildSource->IsLinked())
+        {
+            pChildSource->UnlinkAll();
+        }
+        pChildSource->SetId(-1);
+    }
+    
     void PipelineSourcesBintr::SetStreamMuxPlayType(bool areSourcesLive)
     {
         LOG_FUNC();
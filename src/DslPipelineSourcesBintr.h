@@ -158,6 +158,21 @@ namespace DSL
          */
         bool RemoveChild(DSL_BASE_PTR pChildElement);
 
+        /**
+         * @brief Links a batched Source, the only child source, in place of the 
+         * Stream Muxer by retargeting this Bintr's src Ghost Pad to the Source.
+         * @param pChildSource the batched Source to link
+         * @return true if successful, false otherwise
+         */
+        bool linkBatchedSource(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief Unlinks a batched Source linked with linkBatchedSource, and 
+         * restores the Stream Muxer as the target of the src Ghost Pad.
+         * @param pChildSource the batched Source to unlink
+         */
+        void unlinkBatchedSource(DSL_SOURCE_PTR pChildSource);
+
     public:
 
         DSL_ELEMENT_PTR m_pStreamMux;
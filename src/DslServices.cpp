@@ -30,9 +30,11 @@ THE SOFTWARE.
 #include "DslGieBintr.h"
 #include "DslTrackerBintr.h"
 #include "DslOdeHandlerBintr.h"
+#include "DslMetaRecorderBintr.h"
 #include "DslTilerBintr.h"
 #include "DslOsdBintr.h"
 #include "DslSinkBintr.h"
+#include "DslCaptureService.h"
 
 
 #define RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(actions, name) do \
@@ -53,6 +55,24 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define RETURN_IF_ODE_LINE_NAME_NOT_FOUND(lines, name) do \
+{ \
+    if (lines.find(name) == lines.end()) \
+    { \
+        LOG_ERROR("ODE Line name '" << name << "' was not found"); \
+        return DSL_RESULT_ODE_LINE_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+
+#define RETURN_IF_META_RECORDING_NAME_NOT_FOUND(recordings, name) do \
+{ \
+    if (recordings.find(name) == recordings.end()) \
+    { \
+        LOG_ERROR("Meta Recording name '" << name << "' was not found"); \
+        return DSL_RESULT_META_RECORDING_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+
 #define RETURN_IF_ODE_ACTION_IS_NOT_CORRECT_TYPE(actions, name, action) do \
 { \
     if (!actions[name]->IsType(typeid(action)))\
@@ -71,6 +91,15 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(events, name, event) do \
+{ \
+    if (!events[name]->IsType(typeid(event)))\
+    { \
+        LOG_ERROR("ODE Trigger '" << name << "' is not the correct type"); \
+        return DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
 
 #define RETURN_IF_BRANCH_NAME_NOT_FOUND(branches, name) do \
 { \
@@ -113,7 +142,8 @@ THE SOFTWARE.
     if (!components[name]->IsType(typeid(CsiSourceBintr)) and  \
         !components[name]->IsType(typeid(UsbSourceBintr)) and  \
         !components[name]->IsType(typeid(UriSourceBintr)) and  \
-        !components[name]->IsType(typeid(RtspSourceBintr))) \
+        !components[name]->IsType(typeid(RtspSourceBintr)) and  \
+        !components[name]->IsType(typeid(ReplaySourceBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Source"); \
         return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
@@ -130,6 +160,15 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define RETURN_IF_COMPONENT_IS_NOT_REPLAY_SOURCE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(ReplaySourceBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Replay Source"); \
+        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
+    } \
+}while(0); 
+
 #define RETURN_IF_COMPONENT_IS_NOT_GIE(components, name) do \
 { \
     if (!components[name]->IsType(typeid(PrimaryGieBintr)) and  \
@@ -345,6 +384,62 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeActionCallbackBatchNew(const char* name,
+        dsl_ode_handle_occurrences_cb clientHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeActions.find(name) != m_odeActions.end())
+            {   
+                LOG_ERROR("ODE Action name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE;
+            }
+            m_odeActions[name] = DSL_ODE_ACTION_CALLBACK_BATCH_NEW(name, clientHandler, clientData);
+
+            LOG_INFO("New ODE Batch Callback Action '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New ODE Batch Callback Action '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionCallbackBatchTriggerNameGet(const char* name,
+        uint triggerIndex, const wchar_t** trigger)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            RETURN_IF_ODE_ACTION_IS_NOT_CORRECT_TYPE(m_odeActions, name, BatchCallbackOdeAction);
+            
+            DSL_ODE_ACTION_CALLBACK_BATCH_PTR pOdeAction = 
+                std::dynamic_pointer_cast<BatchCallbackOdeAction>(m_odeActions[name]);
+            
+            *trigger = pOdeAction->GetTriggerName(triggerIndex);
+            if (*trigger == NULL)
+            {
+                LOG_ERROR("ODE Action '" << name << "' has not assigned Trigger index " << triggerIndex);
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception getting Trigger name");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeActionCaptureFrameNew(const char* name,
         const char* outdir)
     {
@@ -577,6 +672,56 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::OdeActionJournalNew(const char* name, 
+        const char* filePath, uint maxSizeMb, uint maxFiles)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeActions.find(name) != m_odeActions.end())
+            {   
+                LOG_ERROR("ODE Action name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE;
+            }
+            
+            // ensure the journal's directory exists
+            std::string dirPath(filePath);
+            size_t separator = dirPath.find_last_of('/');
+            dirPath = (separator == std::string::npos) ? "." : dirPath.substr(0, separator+1);
+            
+            struct stat info;
+            if ((stat(dirPath.c_str(), &info) != 0) or !(info.st_mode & S_IFDIR))
+            {
+                LOG_ERROR("Unable to access directory '" << dirPath << "' for Journal Action '" << name << "'");
+                return DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND;
+            }
+            if (!maxSizeMb)
+            {
+                LOG_ERROR("Invalid max size of 0 MB for Journal Action '" << name << "'");
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            if (maxFiles == 1)
+            {
+                LOG_ERROR("Invalid max file count of 1 for Journal Action '" << name << "'");
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            m_odeActions[name] = DSL_ODE_ACTION_JOURNAL_NEW(name, 
+                filePath, (uint64_t)maxSizeMb*1024*1024, maxFiles);
+
+            LOG_INFO("New ODE Journal Action '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New ODE Journal Action '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::OdeActionLogNew(const char* name)
     {
         LOG_FUNC();
@@ -1017,6 +1162,130 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeActionAsyncGet(const char* name, 
+        boolean* enabled, uint* overflowPolicy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            bool bEnabled(false);
+            pOdeAction->GetAsyncSettings(&bEnabled, overflowPolicy);
+            *enabled = bEnabled;
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception getting Async settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionAsyncSet(const char* name, 
+        boolean enabled, uint overflowPolicy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+                
+            if (enabled and !pOdeAction->IsAsyncCapable())
+            {
+                LOG_ERROR("ODE Action '" << name << "' must be executed synchronously");
+                return DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE;
+            }
+            if (!pOdeAction->SetAsyncSettings(enabled, overflowPolicy))
+            {
+                LOG_ERROR("ODE Action '" << name << "' failed to set Async settings");
+                return DSL_RESULT_ODE_ACTION_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception setting Async settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionAsyncDroppedGet(const char* name, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            *dropped = pOdeAction->GetAsyncDropped();
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception getting Async dropped count");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionMetricsGet(const char* name, 
+        dsl_ode_action_metrics* metrics)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetMetrics(metrics);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception getting metrics");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionMetricsReset(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->ResetMetrics();
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception resetting metrics");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeActionDelete(const char* name)
     {
         LOG_FUNC();
@@ -1064,6 +1333,92 @@ namespace DSL
         return m_odeActions.size();
     }
     
+    DslReturnType Services::OdeJournalScan(const char* filePath, const char* trigger,
+        uint sourceId, uint64_t startTime, uint64_t endTime, 
+        dsl_ode_handle_occurrences_cb clientHandler, void* clientData, uint64_t* count)
+    {
+        LOG_FUNC();
+        
+        // Journal files are independent of the Services, so no lock is required
+        try
+        {
+            struct stat info;
+            if (stat(filePath, &info) != 0)
+            {
+                LOG_ERROR("Unable to access ODE Journal file '" << filePath << "'");
+                return DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND;
+            }
+            OdeJournalReader journalReader(filePath);
+            if (!journalReader.IsValid())
+            {
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            
+            // Matching records are returned to the client in chunks
+            std::vector<dsl_ode_occurrence_record> records;
+            records.reserve(DSL_ODE_JOURNAL_SCAN_CHUNK_SIZE);
+            
+            *count = journalReader.Scan(trigger, sourceId, startTime, endTime,
+                [&](const dsl_ode_occurrence_record& record)
+                {
+                    if (!clientHandler)
+                    {
+                        return;
+                    }
+                    records.push_back(record);
+                    if (records.size() == DSL_ODE_JOURNAL_SCAN_CHUNK_SIZE)
+                    {
+                        clientHandler(&records[0], records.size(), clientData);
+                        records.clear();
+                    }
+                });
+            if (records.size())
+            {
+                clientHandler(&records[0], records.size(), clientData);
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Journal '" << filePath << "' threw exception on scan");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeJournalCsvWrite(const char* filePath, const char* csvFilePath,
+        const char* trigger, uint sourceId, uint64_t startTime, uint64_t endTime, uint64_t* count)
+    {
+        LOG_FUNC();
+        
+        try
+        {
+            struct stat info;
+            if (stat(filePath, &info) != 0)
+            {
+                LOG_ERROR("Unable to access ODE Journal file '" << filePath << "'");
+                return DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND;
+            }
+            OdeJournalReader journalReader(filePath);
+            if (!journalReader.IsValid())
+            {
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            int64_t written = journalReader.WriteCsv(csvFilePath, 
+                trigger, sourceId, startTime, endTime);
+            if (written < 0)
+            {
+                return DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND;
+            }
+            *count = written;
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Journal '" << filePath << "' threw exception writing CSV file");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::OdeAreaNew(const char* name, 
         uint left, uint top, uint width, uint height, boolean display)
     {
@@ -1247,40 +1602,205 @@ namespace DSL
         return m_odeAreas.size();
     }
         
-    DslReturnType Services::OdeTriggerOccurrenceNew(const char* name, uint classId, uint limit)
+    DslReturnType Services::OdeLineNew(const char* name, 
+        uint x1, uint y1, uint x2, uint y2, boolean display)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure event name uniqueness 
-            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            // ensure ODE Line name uniqueness 
+            if (m_odeLines.find(name) != m_odeLines.end())
             {   
-                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
-                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+                LOG_ERROR("ODE Line name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_LINE_NAME_NOT_UNIQUE;
             }
-            m_odeTriggers[name] = DSL_ODE_TRIGGER_OCCURRENCE_NEW(name, classId, limit);
             
-            LOG_INFO("New Occurrence ODE Trigger '" << name << "' created successfully");
+            m_odeLines[name] = DSL_ODE_LINE_NEW(name, x1, y1, x2, y2, display);
+         
+            LOG_INFO("New ODE Line '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Occurrence ODE Trigger '" << name << "' threw exception on create");
-            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+            LOG_ERROR("ODE Line '" << name << "' threw exception on creation");
+            return DSL_RESULT_ODE_LINE_THREW_EXCEPTION;
         }
-    }
-    
-    DslReturnType Services::OdeTriggerAbsenceNew(const char* name, uint classId, uint limit)
+    }                
+
+    DslReturnType Services::OdeLineGet(const char* name, 
+        uint* x1, uint* y1, uint* x2, uint* y2, boolean* display)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure event name uniqueness 
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, name);
+            
+            bool bDisplay(false);
+            m_odeLines[name]->GetLine(x1, y1, x2, y2, &bDisplay);
+            *display = bDisplay;
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Line '" << name << "' threw exception getting Line");
+            return DSL_RESULT_ODE_LINE_THREW_EXCEPTION;
+        }
+    }                
+            
+    DslReturnType Services::OdeLineSet(const char* name, 
+        uint x1, uint y1, uint x2, uint y2, boolean display)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, name);
+            
+            m_odeLines[name]->SetLine(x1, y1, x2, y2, display);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Line '" << name << "' threw exception setting Line");
+            return DSL_RESULT_ODE_LINE_THREW_EXCEPTION;
+        }
+    }                
+            
+    DslReturnType Services::OdeLineColorGet(const char* name, 
+        double* red, double* green, double* blue, double* alpha)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, name);
+            
+            m_odeLines[name]->GetColor(red, green, blue, alpha);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Line '" << name << "' threw exception getting Color");
+            return DSL_RESULT_ODE_LINE_THREW_EXCEPTION;
+        }
+    }                
+            
+    DslReturnType Services::OdeLineColorSet(const char* name, 
+        double red, double green, double blue, double alpha)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, name);
+                
+            if ((red > 1.0) or (green > 1.0) or (blue > 1.0) or (alpha > 1.0))
+            {
+                LOG_ERROR("Invalid color value for ODE Line '" << name << "'");
+                return DSL_RESULT_ODE_LINE_SET_FAILED;
+            }
+            m_odeLines[name]->SetColor(red, green, blue, alpha);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Line '" << name << "' threw exception setting Color");
+            return DSL_RESULT_ODE_LINE_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeLineDelete(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, name);
+        
+        if (m_odeLines[name].use_count() > 1)
+        {
+            LOG_INFO("ODE Line'" << name << "' is in use");
+            return DSL_RESULT_ODE_LINE_IN_USE;
+        }
+        m_odeLines.erase(name);
+
+        LOG_INFO("ODE Line '" << name << "' deleted successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::OdeLineDeleteAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        for (auto const& imap: m_odeLines)
+        {
+            if (imap.second.use_count() > 1)
+            {
+                LOG_ERROR("ODE Line '" << imap.second->GetName() << "' is currently in use");
+                return DSL_RESULT_ODE_LINE_IN_USE;
+            }
+        }
+        m_odeLines.clear();
+
+        LOG_INFO("All ODE Lines deleted successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    uint Services::OdeLineListSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return m_odeLines.size();
+    }
+        
+    DslReturnType Services::OdeTriggerOccurrenceNew(const char* name, uint classId, uint limit)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_OCCURRENCE_NEW(name, classId, limit);
+            
+            LOG_INFO("New Occurrence ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Occurrence ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerAbsenceNew(const char* name, uint classId, uint limit)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
             if (m_odeTriggers.find(name) != m_odeTriggers.end())
             {   
                 LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
@@ -1465,6 +1985,178 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::OdeTriggerWindowNew(const char* name, uint classId, uint limit, 
+        uint aggregate, uint crossing, float threshold, uint window, uint bucket)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (aggregate > DSL_ODE_WINDOW_AGGREGATE_MAX or crossing > DSL_ODE_WINDOW_CROSSING_BELOW)
+            {
+                LOG_ERROR("Invalid aggregate or crossing for Window ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            if (!bucket or window < bucket or 
+                ((uint64_t)window + bucket - 1) / bucket > DSL_ODE_WINDOW_BUCKETS_MAX)
+            {
+                LOG_ERROR("Invalid window of " << window << " ms with buckets of " 
+                    << bucket << " ms for Window ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_WINDOW_NEW(name, 
+                classId, limit, aggregate, crossing, threshold, window, bucket);
+            
+            LOG_INFO("New Window ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Window ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerNewTrackNew(const char* name, 
+        uint classId, uint limit, uint lostFrames)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (!lostFrames)
+            {
+                LOG_ERROR("Invalid lost-frames of 0 for New Track ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_NEW_TRACK_NEW(name, classId, limit, lostFrames);
+            
+            LOG_INFO("New New Track ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New New Track ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerLostTrackNew(const char* name, 
+        uint classId, uint limit, uint lostFrames)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (!lostFrames)
+            {
+                LOG_ERROR("Invalid lost-frames of 0 for Lost Track ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_LOST_TRACK_NEW(name, classId, limit, lostFrames);
+            
+            LOG_INFO("New Lost Track ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Lost Track ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerDwellNew(const char* name, uint classId, uint limit, 
+        uint minDwellTime, uint lostFrames)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (!lostFrames)
+            {
+                LOG_ERROR("Invalid lost-frames of 0 for Dwell ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_DWELL_NEW(name, 
+                classId, limit, minDwellTime, lostFrames);
+            
+            LOG_INFO("New Dwell ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Dwell ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerLineCrossingNew(const char* name, uint classId, 
+        uint limit, uint direction, uint referencePoint, uint lostFrames)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (direction > DSL_ODE_LINE_DIRECTION_RIGHT_TO_LEFT or 
+                referencePoint > DSL_ODE_LINE_POINT_CENTER or !lostFrames)
+            {
+                LOG_ERROR("Invalid direction, reference point or lost-frames for Line Crossing ODE Trigger '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_LINE_CROSSING_NEW(name, 
+                classId, limit, direction, referencePoint, lostFrames);
+            
+            LOG_INFO("New Line Crossing ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Line Crossing ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::OdeTriggerReset(const char* name)
     {
         LOG_FUNC();
@@ -1487,6 +2179,51 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerMetricsGet(const char* name, 
+        dsl_ode_trigger_metrics* metrics)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetMetrics(metrics);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting metrics");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerMetricsReset(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->ResetMetrics();
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception resetting metrics");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
@@ -1717,21 +2454,182 @@ namespace DSL
         try
         {
             RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
-            
-            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
-         
-            pOdeTrigger->GetMaxDimensions(max_width, max_height);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetMaxDimensions(max_width, max_height);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting maximum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerDimensionsMaxSet(const char* name, uint max_width, uint max_height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            // TODO: validate the max values for in-range
+            pOdeTrigger->SetMaxDimensions(max_width, max_height);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception setting maximum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerFrameCountMinGet(const char* name, uint* min_count_n, uint* min_count_d)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetMinFrameCount(min_count_n, min_count_d);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting minimum frame count");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services:: OdeTriggerFrameCountMinSet(const char* name, uint min_count_n, uint min_count_d)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            if (!pOdeTrigger->SetMinFrameCount(min_count_n, min_count_d))
+            {
+                LOG_ERROR("Invalid minimum frame count for ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception setting minimum frame count");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerWindowTimestampGet(const char* name, uint* timestamp)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, WindowOdeTrigger);
+            
+            DSL_ODE_TRIGGER_WINDOW_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<WindowOdeTrigger>(m_odeTriggers[name]);
+         
+            *timestamp = pOdeTrigger->GetTimestamp();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting window timestamp");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerWindowTimestampSet(const char* name, uint timestamp)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, WindowOdeTrigger);
+            
+            if (timestamp > DSL_ODE_WINDOW_TIMESTAMP_NTP)
+            {
+                LOG_ERROR("Invalid window timestamp " << timestamp << " for ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            DSL_ODE_TRIGGER_WINDOW_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<WindowOdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetTimestamp(timestamp);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception setting window timestamp");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerLineCrossingLineAdd(const char* name, const char* line)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, LineCrossingOdeTrigger);
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, line);
+
+            DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<LineCrossingOdeTrigger>(m_odeTriggers[name]);
+
+            // Note: Lines can be added when in use, i.e. shared between
+            // multiple ODE Triggers
+
+            if (!pOdeTrigger->AddLine(m_odeLines[line]))
+            {
+                LOG_ERROR("ODE Trigger '" << name
+                    << "' failed to add ODE Line '" << line << "'");
+                return DSL_RESULT_ODE_TRIGGER_LINE_ADD_FAILED;
+            }
+            LOG_INFO("ODE Line '" << line
+                << "' was added to ODE Trigger '" << name << "' successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting maximum dimensions");
+            LOG_ERROR("ODE Trigger '" << name
+                << "' threw exception adding ODE Line '" << line << "'");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
-    }                
+    }
 
-    DslReturnType Services::OdeTriggerDimensionsMaxSet(const char* name, uint max_width, uint max_height)
+    DslReturnType Services::OdeTriggerLineCrossingLineRemove(const char* name, const char* line)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -1739,23 +2637,33 @@ namespace DSL
         try
         {
             RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
-            
-            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
-         
-            // TODO: validate the max values for in-range
-            pOdeTrigger->SetMaxDimensions(max_width, max_height);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, LineCrossingOdeTrigger);
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, line);
+
+            DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<LineCrossingOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->RemoveLine(m_odeLines[line]))
+            {
+                LOG_ERROR("ODE Line'" << line << 
+                    "' is not in use by ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE;
+            }
+            LOG_INFO("ODE Line '" << line
+                << "' was removed from ODE Trigger '" << name << "' successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Trigger '" << name << "' threw exception setting maximum dimensions");
+            LOG_ERROR("ODE Trigger '" << name
+                << "' threw exception remove ODE Line '" << line << "'");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
-    }                
+    }
 
-    DslReturnType Services::OdeTriggerFrameCountMinGet(const char* name, uint* min_count_n, uint* min_count_d)
+    DslReturnType Services::OdeTriggerLineCrossingCountsGet(const char* name, const char* line,
+        uint64_t* leftToRight, uint64_t* rightToLeft)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -1763,22 +2671,28 @@ namespace DSL
         try
         {
             RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
-            
-            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
-         
-            pOdeTrigger->GetMinFrameCount(min_count_n, min_count_d);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, LineCrossingOdeTrigger);
+            RETURN_IF_ODE_LINE_NAME_NOT_FOUND(m_odeLines, line);
 
+            DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<LineCrossingOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->GetCounts(line, leftToRight, rightToLeft))
+            {
+                LOG_ERROR("ODE Line'" << line << 
+                    "' is not in use by ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting minimum frame count");
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting crossing counts");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
-    }                
+    }
 
-    DslReturnType Services:: OdeTriggerFrameCountMinSet(const char* name, uint min_count_n, uint min_count_d)
+    DslReturnType Services::OdeTriggerLineCrossingCountsReset(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -1786,21 +2700,20 @@ namespace DSL
         try
         {
             RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
-            
-            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
-         
-            // TODO: validate the min values for in-range
-            pOdeTrigger->SetMinFrameCount(min_count_n, min_count_d);
+            RETURN_IF_ODE_TRIGGER_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, LineCrossingOdeTrigger);
+
+            DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<LineCrossingOdeTrigger>(m_odeTriggers[name]);
 
+            pOdeTrigger->ResetCounts();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting minimum frame count");
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception resetting crossing counts");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
-    }                
+    }
 
     DslReturnType Services::OdeTriggerInferDoneOnlyGet(const char* name, boolean* inferDoneOnly)
     {
@@ -2192,6 +3105,99 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::SourceReplayNew(const char* name, 
+        const char* filePath, boolean realTime)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        std::ifstream streamRecordingFile(filePath);
+        if (!streamRecordingFile.good())
+        {
+            LOG_ERROR("Meta Recording '" << filePath << "' Not found");
+            return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+        }
+        try
+        {
+            if (!DSL_META_RECORDING_READER_NEW(filePath)->IsValid())
+            {
+                LOG_ERROR("File '" << filePath << "' for Replay Source '" << name 
+                    << "' is not a valid Meta Recording");
+                return DSL_RESULT_SOURCE_RECORDING_INVALID;
+            }
+            m_components[name] = DSL_REPLAY_SOURCE_NEW(name, filePath, realTime);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Replay Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Replay Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceReplayScenarioNew(const char* name, uint sourceCount, 
+        uint objectsPerFrame, uint classCount, uint64_t batchCount, boolean realTime)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        if (!sourceCount)
+        {
+            LOG_ERROR("Invalid source count of 0 for Replay Source '" << name << "'");
+            return DSL_RESULT_SOURCE_SCENARIO_INVALID;
+        }
+        try
+        {
+            m_components[name] = DSL_REPLAY_SCENARIO_SOURCE_NEW(name, 
+                sourceCount, objectsPerFrame, classCount, batchCount, realTime);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Replay Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Replay Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceReplayBatchesGet(const char* name, uint64_t* batches)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_REPLAY_SOURCE(m_components, name);
+
+            DSL_REPLAY_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<ReplaySourceBintr>(m_components[name]);
+
+            *batches = pSourceBintr->GetBatchCount();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Replay Source '" << name << "' threw exception getting batch count");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
     DslReturnType Services::SourceDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
@@ -2659,6 +3665,58 @@ namespace DSL
         }
         return DSL_RESULT_SUCCESS;
     }
+
+    DslReturnType  Services::PrimaryGieKittiOutputModeGet(const char* name, 
+        uint* mode, uint* maxFileSize)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+
+            pPrimaryGieBintr->GetKittiOutputMode(mode, maxFileSize);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception getting Kitti output mode");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType  Services::PrimaryGieKittiOutputModeSet(const char* name, 
+        uint mode, uint maxFileSize)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+
+            if (!pPrimaryGieBintr->SetKittiOutputMode(mode, maxFileSize))
+            {
+                LOG_ERROR("Invalid Kitti output mode " << mode << " for Primary GIE '" << name << "'");
+                return DSL_RESULT_GIE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception setting Kitti output mode");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
         
     DslReturnType Services::SecondaryGieNew(const char* name, const char* inferConfigFile,
         const char* modelEngineFile, const char* inferOnGieName, uint interval)
@@ -3101,6 +4159,58 @@ namespace DSL
         }
         return DSL_RESULT_SUCCESS;
     }
+
+    DslReturnType  Services::TrackerKittiOutputModeGet(const char* name, 
+        uint* mode, uint* maxFileSize)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            
+            DSL_TRACKER_PTR pTrackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            pTrackerBintr->GetKittiOutputMode(mode, maxFileSize);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception getting Kitti output mode");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType  Services::TrackerKittiOutputModeSet(const char* name, 
+        uint mode, uint maxFileSize)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            
+            DSL_TRACKER_PTR pTrackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            if (!pTrackerBintr->SetKittiOutputMode(mode, maxFileSize))
+            {
+                LOG_ERROR("Invalid Kitti output mode " << mode << " for Tracker '" << name << "'");
+                return DSL_RESULT_TRACKER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception setting Kitti output mode");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
         
     DslReturnType Services::TeeDemuxerNew(const char* name)
     {
@@ -3622,6 +4732,61 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+   DslReturnType Services::OdeHandlerWorkerCountGet(const char* handler, uint* count)
+   {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, handler);
+
+        try
+        {
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, handler, OdeHandlerBintr);
+
+            DSL_ODE_HANDLER_PTR pOdeHandlerBintr = 
+                std::dynamic_pointer_cast<OdeHandlerBintr>(m_components[handler]);
+
+            *count = pOdeHandlerBintr->GetWorkerCount();
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Handler '" << handler
+                << "' threw exception getting the worker count");
+            return DSL_RESULT_ODE_HANDLER_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+   DslReturnType Services::OdeHandlerWorkerCountSet(const char* handler, uint count)
+   {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, handler);
+
+        try
+        {
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, handler, OdeHandlerBintr);
+
+            DSL_ODE_HANDLER_PTR pOdeHandlerBintr = 
+                std::dynamic_pointer_cast<OdeHandlerBintr>(m_components[handler]);
+
+            if (!pOdeHandlerBintr->SetWorkerCount(count))
+            {
+                LOG_ERROR("ODE Handler '" << handler
+                    << "' failed to set worker count to " << count);
+                return DSL_RESULT_ODE_HANDLER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Handler '" << handler
+                << "' threw exception setting the worker count");
+            return DSL_RESULT_ODE_HANDLER_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
    DslReturnType Services::OdeHandlerTriggerAdd(const char* handler, const char* trigger)
    {
         LOG_FUNC();
@@ -3726,6 +4891,163 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
     
+    DslReturnType Services::MetaRecorderNew(const char* name, 
+        const char* filePath, uint maxSizeMb)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Meta Recorder name '" << name << "' is not unique");
+            return DSL_RESULT_META_RECORDER_NAME_NOT_UNIQUE;
+        }
+        try
+        {   
+            // ensure the recording's directory exists
+            std::string dirPath(filePath);
+            size_t separator = dirPath.find_last_of('/');
+            dirPath = (separator == std::string::npos) ? "." : dirPath.substr(0, separator+1);
+            
+            struct stat info;
+            if ((stat(dirPath.c_str(), &info) != 0) or !(info.st_mode & S_IFDIR))
+            {
+                LOG_ERROR("Unable to access directory '" << dirPath 
+                    << "' for Meta Recorder '" << name << "'");
+                return DSL_RESULT_META_RECORDER_FILE_PATH_INVALID;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new MetaRecorderBintr(name, 
+                filePath, (uint64_t)maxSizeMb*1024*1024));
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Meta Recorder '" << name << "' threw exception on create");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Meta Recorder '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::MetaRecorderMetricsGet(const char* name, 
+        uint64_t* recorded, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            
+            if (!m_components[name]->IsType(typeid(MetaRecorderBintr)))
+            {
+                LOG_ERROR("Component '" << name << "' is not a Meta Recorder");
+                return DSL_RESULT_META_RECORDER_COMPONENT_IS_NOT_META_RECORDER;
+            }
+            DSL_META_RECORDER_BINTR_PTR pMetaRecorderBintr = 
+                std::dynamic_pointer_cast<MetaRecorderBintr>(m_components[name]);
+
+            pMetaRecorderBintr->GetMetrics(recorded, dropped);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Recorder '" << name << "' threw an exception getting metrics");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::MetaRecordingOpen(const char* name, const char* filePath)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (m_metaRecordings.find(name) != m_metaRecordings.end())
+            {   
+                LOG_ERROR("Meta Recording name '" << name << "' is not unique");
+                return DSL_RESULT_META_RECORDING_NAME_NOT_UNIQUE;
+            }
+            DSL_META_RECORDING_READER_PTR pReader = DSL_META_RECORDING_READER_NEW(filePath);
+            if (!pReader->IsValid())
+            {
+                return DSL_RESULT_META_RECORDING_FILE_INVALID;
+            }
+            m_metaRecordings[name] = pReader;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Recording '" << name << "' threw an exception on open");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        LOG_INFO("Meta Recording '" << name << "' opened successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::MetaRecordingFrameNext(const char* name, 
+        dsl_meta_recording_frame* frame)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_META_RECORDING_NAME_NOT_FOUND(m_metaRecordings, name);
+            
+            if (!m_metaRecordings[name]->NextFrame(frame))
+            {
+                return DSL_RESULT_META_RECORDING_END;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Recording '" << name << "' threw an exception reading a frame");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::MetaRecordingClose(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_META_RECORDING_NAME_NOT_FOUND(m_metaRecordings, name);
+            
+            m_metaRecordings.erase(name);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Recording '" << name << "' threw an exception on close");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        LOG_INFO("Meta Recording '" << name << "' closed successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::MetaRecordingCloseAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            m_metaRecordings.clear();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Services threw an exception closing all Meta Recordings");
+            return DSL_RESULT_META_RECORDER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
     DslReturnType Services::OfvNew(const char* name)
     {
         LOG_FUNC();
@@ -4728,6 +6050,54 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::SinkImageCaptureMetricsGet(uint* queueDepth, uint64_t* encoded, 
+        uint64_t* dropped, uint64_t* averageLatency, uint64_t* maxLatency)
+    {
+        LOG_FUNC();
+
+        try
+        {
+            CaptureService::GetService()->GetMetrics(queueDepth, 
+                encoded, dropped, averageLatency, maxLatency);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Capture Service threw an exception getting metrics");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SinkImageCaptureMetricsReset()
+    {
+        LOG_FUNC();
+
+        try
+        {
+            CaptureService::GetService()->ResetMetrics();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Capture Service threw an exception resetting metrics");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    void Services::SinkImageCaptureServiceShutdown()
+    {
+        LOG_FUNC();
+
+        try
+        {
+            CaptureService::Shutdown();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Capture Service threw an exception on shutdown");
+        }
+    }
+
     uint Services::SinkNumInUseGet()
     {
         LOG_FUNC();
@@ -5673,13 +7043,170 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::PipelineLatencyTracingEnabledGet(const char* pipeline,
+        boolean* enabled)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            *enabled = m_pipelines[pipeline]->GetLatencyTracingEnabled();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception getting the latency tracing enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+        
+    DslReturnType Services::PipelineLatencyTracingEnabledSet(const char* pipeline,
+        boolean enabled)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            m_pipelines[pipeline]->SetLatencyTracingEnabled((bool)enabled);
+            LOG_INFO("Pipeline '" << pipeline << "' set latency tracing enabled = " 
+                << enabled << " successfully");
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception setting the latency tracing enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineLatencyStatsGet(const char* pipeline,
+        const char* component, dsl_latency_stats* stats)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!m_pipelines[pipeline]->GetLatencyTracingEnabled())
+            {
+                LOG_ERROR("Latency tracing is not enabled for Pipeline '" << pipeline << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED;
+            }
+            if (!m_pipelines[pipeline]->GetLatencyStats(component, stats))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' has no latency stats for component '" << component << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception getting latency stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineLatencyStatsReset(const char* pipeline)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!m_pipelines[pipeline]->ResetLatencyStats())
+            {
+                LOG_ERROR("Latency tracing is not enabled for Pipeline '" << pipeline << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception resetting latency stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineLatencyStatsHandlerAdd(const char* pipeline, 
+        dsl_latency_stats_handler_cb handler, uint interval, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->GetLatencyTracingEnabled())
+            {
+                LOG_ERROR("Latency tracing is not enabled for Pipeline '" << pipeline << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED;
+            }
+            if (!interval or 
+                !m_pipelines[pipeline]->AddLatencyStatsHandler(handler, interval, clientData))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to add Latency Stats Handler");
+                return DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception adding Latency Stats Handler");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineLatencyStatsHandlerRemove(const char* pipeline, 
+        dsl_latency_stats_handler_cb handler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->GetLatencyTracingEnabled())
+            {
+                LOG_ERROR("Latency tracing is not enabled for Pipeline '" << pipeline << "'");
+                return DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED;
+            }
+            if (!m_pipelines[pipeline]->RemoveLatencyStatsHandler(handler))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to remove Latency Stats Handler");
+                return DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception removing Latency Stats Handler");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
     bool Services::IsSourceComponent(const char* component)
     {
         LOG_FUNC();
      
         return (m_components[component]->IsType(typeid(CsiSourceBintr)) or 
             m_components[component]->IsType(typeid(UriSourceBintr)) or
-            m_components[component]->IsType(typeid(RtspSourceBintr)));
+            m_components[component]->IsType(typeid(RtspSourceBintr)) or
+            m_components[component]->IsType(typeid(ReplaySourceBintr)));
     }
  
     uint Services::GetNumSourcesInUse()
@@ -5785,6 +7312,8 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED] = L"DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE] = L"DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE";
+        m_returnValueToString[DSL_RESULT_SOURCE_RECORDING_INVALID] = L"DSL_RESULT_SOURCE_RECORDING_INVALID";
+        m_returnValueToString[DSL_RESULT_SOURCE_SCENARIO_INVALID] = L"DSL_RESULT_SOURCE_SCENARIO_INVALID";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_FOUND] = L"DSL_RESULT_DEWARPER_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_BAD_FORMAT] = L"DSL_RESULT_DEWARPER_NAME_BAD_FORMAT";
@@ -5827,6 +7356,11 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_AREA_REMOVE_FAILED] = L"DSL_RESULT_ODE_TRIGGER_AREA_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_AREA_NOT_IN_USE] = L"DSL_RESULT_ODE_TRIGGER_AREA_NOT_IN_USE";
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_CLIENT_CALLBACK_INVALID] = L"DSL_RESULT_ODE_TRIGGER_CLIENT_CALLBACK_INVALID";
+        m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE] = L"DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE";
+        m_returnValueToString[DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID] = L"DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID";
+        m_returnValueToString[DSL_RESULT_ODE_TRIGGER_LINE_ADD_FAILED] = L"DSL_RESULT_ODE_TRIGGER_LINE_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_ODE_TRIGGER_LINE_REMOVE_FAILED] = L"DSL_RESULT_ODE_TRIGGER_LINE_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE] = L"DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE";
         m_returnValueToString[DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_ACTION_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_ACTION_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_ODE_ACTION_THREW_EXCEPTION] = L"DSL_RESULT_ODE_ACTION_THREW_EXCEPTION";
@@ -5836,10 +7370,16 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND] = L"DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_ODE_ACTION_CAPTURE_TYPE_INVALID] = L"DSL_RESULT_ODE_ACTION_CAPTURE_TYPE_INVALID";
         m_returnValueToString[DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE] = L"DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE";
+        m_returnValueToString[DSL_RESULT_ODE_ACTION_PARAMETER_INVALID] = L"DSL_RESULT_ODE_ACTION_PARAMETER_INVALID";
         m_returnValueToString[DSL_RESULT_ODE_AREA_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_AREA_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_AREA_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_AREA_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_ODE_AREA_THREW_EXCEPTION] = L"DSL_RESULT_ODE_AREA_THREW_EXCEPTION";
         m_returnValueToString[DSL_RESULT_ODE_AREA_SET_FAILED] = L"DSL_RESULT_ODE_AREA_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_ODE_LINE_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_LINE_NAME_NOT_UNIQUE";
+        m_returnValueToString[DSL_RESULT_ODE_LINE_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_LINE_NAME_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_ODE_LINE_THREW_EXCEPTION] = L"DSL_RESULT_ODE_LINE_THREW_EXCEPTION";
+        m_returnValueToString[DSL_RESULT_ODE_LINE_IN_USE] = L"DSL_RESULT_ODE_LINE_IN_USE";
+        m_returnValueToString[DSL_RESULT_ODE_LINE_SET_FAILED] = L"DSL_RESULT_ODE_LINE_SET_FAILED";
         m_returnValueToString[DSL_RESULT_SINK_NAME_NOT_UNIQUE] = L"DSL_RESULT_SINK_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_SINK_NAME_NOT_FOUND] = L"DSL_RESULT_SINK_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_SINK_NAME_BAD_FORMAT] = L"DSL_RESULT_SINK_NAME_BAD_FORMAT";
@@ -5926,6 +7466,17 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_STOP] = L"DSL_RESULT_PIPELINE_FAILED_TO_STOP";
         m_returnValueToString[DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED";
         m_returnValueToString[DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED] = L"DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND] = L"DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_META_RECORDER_NAME_NOT_UNIQUE] = L"DSL_RESULT_META_RECORDER_NAME_NOT_UNIQUE";
+        m_returnValueToString[DSL_RESULT_META_RECORDER_NAME_NOT_FOUND] = L"DSL_RESULT_META_RECORDER_NAME_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_META_RECORDER_THREW_EXCEPTION] = L"DSL_RESULT_META_RECORDER_THREW_EXCEPTION";
+        m_returnValueToString[DSL_RESULT_META_RECORDER_COMPONENT_IS_NOT_META_RECORDER] = L"DSL_RESULT_META_RECORDER_COMPONENT_IS_NOT_META_RECORDER";
+        m_returnValueToString[DSL_RESULT_META_RECORDER_FILE_PATH_INVALID] = L"DSL_RESULT_META_RECORDER_FILE_PATH_INVALID";
+        m_returnValueToString[DSL_RESULT_META_RECORDING_NAME_NOT_UNIQUE] = L"DSL_RESULT_META_RECORDING_NAME_NOT_UNIQUE";
+        m_returnValueToString[DSL_RESULT_META_RECORDING_NAME_NOT_FOUND] = L"DSL_RESULT_META_RECORDING_NAME_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_META_RECORDING_FILE_INVALID] = L"DSL_RESULT_META_RECORDING_FILE_INVALID";
+        m_returnValueToString[DSL_RESULT_META_RECORDING_END] = L"DSL_RESULT_META_RECORDING_END";
         m_returnValueToString[DSL_RESULT_INVALID_RESULT_CODE] = L"Invalid DSL Result CODE";
     }
 
@@ -55,6 +55,12 @@ namespace DSL {
         DslReturnType OdeActionCallbackNew(const char* name,
             dsl_ode_handle_occurrence_cb clientHandler, void* clientData);
 
+        DslReturnType OdeActionCallbackBatchNew(const char* name,
+            dsl_ode_handle_occurrences_cb clientHandler, void* clientData);
+
+        DslReturnType OdeActionCallbackBatchTriggerNameGet(const char* name,
+            uint triggerIndex, const wchar_t** trigger);
+
         DslReturnType OdeActionCaptureFrameNew(const char* name, const char* outdir);
         
         DslReturnType OdeActionCaptureObjectNew(const char* name, const char* outdir);
@@ -62,6 +68,9 @@ namespace DSL {
         DslReturnType OdeActionDisplayNew(const char* name,
             uint offsetX, uint offsetY, bool offsetY_with_classId);
         
+        DslReturnType OdeActionJournalNew(const char* name, 
+            const char* filePath, uint maxSizeMb, uint maxFiles);
+        
         DslReturnType OdeActionLogNew(const char* name);
         
         DslReturnType OdeActionFillAreaNew(const char* name,
@@ -115,12 +124,31 @@ namespace DSL {
 
         DslReturnType OdeActionEnabledSet(const char* name, boolean enabled);
 
+        DslReturnType OdeActionAsyncGet(const char* name, 
+            boolean* enabled, uint* overflowPolicy);
+
+        DslReturnType OdeActionAsyncSet(const char* name, 
+            boolean enabled, uint overflowPolicy);
+
+        DslReturnType OdeActionAsyncDroppedGet(const char* name, uint64_t* dropped);
+        
+        DslReturnType OdeActionMetricsGet(const char* name, dsl_ode_action_metrics* metrics);
+        
+        DslReturnType OdeActionMetricsReset(const char* name);
+
         DslReturnType OdeActionDelete(const char* name);
         
         DslReturnType OdeActionDeleteAll();
         
         uint OdeActionListSize();
 
+        DslReturnType OdeJournalScan(const char* filePath, const char* trigger,
+            uint sourceId, uint64_t startTime, uint64_t endTime, 
+            dsl_ode_handle_occurrences_cb clientHandler, void* clientData, uint64_t* count);
+
+        DslReturnType OdeJournalCsvWrite(const char* filePath, const char* csvFilePath,
+            const char* trigger, uint sourceId, uint64_t startTime, uint64_t endTime, uint64_t* count);
+
         DslReturnType OdeAreaNew(const char* name, 
             uint left, uint top, uint width, uint height, boolean display);
 
@@ -142,6 +170,27 @@ namespace DSL {
         
         uint OdeAreaListSize();
         
+        DslReturnType OdeLineNew(const char* name, 
+            uint x1, uint y1, uint x2, uint y2, boolean display);
+
+        DslReturnType OdeLineGet(const char* name, 
+            uint* x1, uint* y1, uint* x2, uint* y2, boolean* display);
+
+        DslReturnType OdeLineSet(const char* name, 
+            uint x1, uint y1, uint x2, uint y2, boolean display);
+
+        DslReturnType OdeLineColorGet(const char* name, 
+            double* red, double* green, double* blue, double* alpha);
+
+        DslReturnType OdeLineColorSet(const char* name, 
+            double red, double green, double blue, double alpha);
+
+        DslReturnType OdeLineDelete(const char* name);
+        
+        DslReturnType OdeLineDeleteAll();
+        
+        uint OdeLineListSize();
+        
         DslReturnType OdeTriggerOccurrenceNew(const char* name, uint classId, uint limit);
         
         DslReturnType OdeTriggerAbsenceNew(const char* name, uint classId, uint limit);
@@ -160,7 +209,26 @@ namespace DSL {
         DslReturnType OdeTriggerRangeNew(const char* name, 
             uint classId, uint limit, uint lower, uint upper);
         
+        DslReturnType OdeTriggerWindowNew(const char* name, uint classId, uint limit, 
+            uint aggregate, uint crossing, float threshold, uint window, uint bucket);
+
+        DslReturnType OdeTriggerNewTrackNew(const char* name, 
+            uint classId, uint limit, uint lostFrames);
+        
+        DslReturnType OdeTriggerLostTrackNew(const char* name, 
+            uint classId, uint limit, uint lostFrames);
+        
+        DslReturnType OdeTriggerDwellNew(const char* name, uint classId, uint limit, 
+            uint minDwellTime, uint lostFrames);
+
+        DslReturnType OdeTriggerLineCrossingNew(const char* name, uint classId, uint limit, 
+            uint direction, uint referencePoint, uint lostFrames);
+        
         DslReturnType OdeTriggerReset(const char* name);
+        
+        DslReturnType OdeTriggerMetricsGet(const char* name, dsl_ode_trigger_metrics* metrics);
+        
+        DslReturnType OdeTriggerMetricsReset(const char* name);
 
         DslReturnType OdeTriggerEnabledGet(const char* name, boolean* enabled);
 
@@ -190,6 +258,19 @@ namespace DSL {
 
         DslReturnType OdeTriggerFrameCountMinSet(const char* name, uint min_count_n, uint min_count_d);
         
+        DslReturnType OdeTriggerWindowTimestampGet(const char* name, uint* timestamp);
+        
+        DslReturnType OdeTriggerWindowTimestampSet(const char* name, uint timestamp);
+        
+        DslReturnType OdeTriggerLineCrossingLineAdd(const char* name, const char* line);
+        
+        DslReturnType OdeTriggerLineCrossingLineRemove(const char* name, const char* line);
+        
+        DslReturnType OdeTriggerLineCrossingCountsGet(const char* name, const char* line,
+            uint64_t* leftToRight, uint64_t* rightToLeft);
+        
+        DslReturnType OdeTriggerLineCrossingCountsReset(const char* name);
+        
         DslReturnType OdeTriggerInferDoneOnlyGet(const char* name, boolean* inferDoneOnly);
         
         DslReturnType OdeTriggerInferDoneOnlySet(const char* name, boolean inferDoneOnly);
@@ -224,6 +305,14 @@ namespace DSL {
         DslReturnType SourceRtspNew(const char* name, const char* uri, 
             uint protocol, uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
             
+        DslReturnType SourceReplayNew(const char* name, 
+            const char* filePath, boolean realTime);
+            
+        DslReturnType SourceReplayScenarioNew(const char* name, uint sourceCount, 
+            uint objectsPerFrame, uint classCount, uint64_t batchCount, boolean realTime);
+            
+        DslReturnType SourceReplayBatchesGet(const char* name, uint64_t* batches);
+            
         DslReturnType SourceDimensionsGet(const char* name, uint* width, uint* height);
         
         DslReturnType SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d);
@@ -254,6 +343,10 @@ namespace DSL {
             const char* modelEngineFile, uint interval);
 
         DslReturnType PrimaryGieKittiOutputEnabledSet(const char* name, boolean enabled, const char* file);
+
+        DslReturnType PrimaryGieKittiOutputModeGet(const char* name, uint* mode, uint* maxFileSize);
+
+        DslReturnType PrimaryGieKittiOutputModeSet(const char* name, uint mode, uint maxFileSize);
         
         DslReturnType PrimaryGieBatchMetaHandlerAdd(const char* name, uint pad, dsl_batch_meta_handler_cb handler, void* userData);
 
@@ -291,6 +384,10 @@ namespace DSL {
         
         DslReturnType TrackerKittiOutputEnabledSet(const char* name, boolean enabled, const char* file);
 
+        DslReturnType TrackerKittiOutputModeGet(const char* name, uint* mode, uint* maxFileSize);
+
+        DslReturnType TrackerKittiOutputModeSet(const char* name, uint mode, uint maxFileSize);
+
         DslReturnType TeeDemuxerNew(const char* name);
         
         DslReturnType TeeSplitterNew(const char* name);
@@ -327,12 +424,29 @@ namespace DSL {
         
         DslReturnType OdeHandlerEnabledSet(const char* name, boolean enabled);
         
+        DslReturnType OdeHandlerWorkerCountGet(const char* name, uint* count);
+        
+        DslReturnType OdeHandlerWorkerCountSet(const char* name, uint count);
+        
         DslReturnType OdeHandlerTriggerAdd(const char* odeHandler, const char* trigger);
 
         DslReturnType OdeHandlerTriggerRemove(const char* odeHandler, const char* trigger);
 
         DslReturnType OdeHandlerTriggerRemoveAll(const char* odeHandler);
 
+        DslReturnType MetaRecorderNew(const char* name, const char* filePath, uint maxSizeMb);
+
+        DslReturnType MetaRecorderMetricsGet(const char* name, 
+            uint64_t* recorded, uint64_t* dropped);
+
+        DslReturnType MetaRecordingOpen(const char* name, const char* filePath);
+
+        DslReturnType MetaRecordingFrameNext(const char* name, dsl_meta_recording_frame* frame);
+
+        DslReturnType MetaRecordingClose(const char* name);
+
+        DslReturnType MetaRecordingCloseAll();
+
         DslReturnType OfvNew(const char* name);
 
         DslReturnType OsdNew(const char* name, boolean clockEnabled);
@@ -409,6 +523,13 @@ namespace DSL {
 
         DslReturnType SinkImageObjectCaptureClassRemove(const char* name, uint classId);
 
+        DslReturnType SinkImageCaptureMetricsGet(uint* queueDepth, uint64_t* encoded, 
+            uint64_t* dropped, uint64_t* averageLatency, uint64_t* maxLatency);
+
+        DslReturnType SinkImageCaptureMetricsReset();
+        
+        void SinkImageCaptureServiceShutdown();
+
         uint SinkNumInUseGet();
         
         uint SinkNumInUseMaxGet();
@@ -513,6 +634,21 @@ namespace DSL {
 
         DslReturnType PipelineXWindowDeleteEventHandlerRemove(const char* pipeline, 
             dsl_xwindow_delete_event_handler_cb handler);
+
+        DslReturnType PipelineLatencyTracingEnabledGet(const char* pipeline, boolean* enabled);
+
+        DslReturnType PipelineLatencyTracingEnabledSet(const char* pipeline, boolean enabled);
+        
+        DslReturnType PipelineLatencyStatsGet(const char* pipeline, 
+            const char* component, dsl_latency_stats* stats);
+        
+        DslReturnType PipelineLatencyStatsReset(const char* pipeline);
+        
+        DslReturnType PipelineLatencyStatsHandlerAdd(const char* pipeline, 
+            dsl_latency_stats_handler_cb handler, uint interval, void* clientData);
+
+        DslReturnType PipelineLatencyStatsHandlerRemove(const char* pipeline, 
+            dsl_latency_stats_handler_cb handler);
         
         GMainLoop* GetMainLoopHandle()
         {
@@ -630,6 +766,16 @@ namespace DSL {
          */
         std::map <std::string, DSL_ODE_AREA_PTR> m_odeAreas;
         
+        /**
+         * @brief map of all ODE Lines created by the client, key=name
+         */
+        std::map <std::string, DSL_ODE_LINE_PTR> m_odeLines;
+        
+        /**
+         * @brief map of all Meta Recordings opened by the client, key=name
+         */
+        std::map <std::string, DSL_META_RECORDING_READER_PTR> m_metaRecordings;
+        
         /**
          * @brief map of all ODE Types created by the client, key=name
          */
@@ -22,14 +22,10 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
-#include <nvbufsurftransform.h>
-#include "opencv2/imgproc/imgproc.hpp"
-#include "opencv2/imgproc/types_c.h"
-#include "opencv2/highgui/highgui.hpp"
-
 #include "Dsl.h"
 #include "DslSinkBintr.h"
 #include "DslBranchBintr.h"
+#include "DslCaptureService.h"
 
 namespace DSL
 {
@@ -893,6 +889,7 @@ namespace DSL
         , m_isFrameCaptureEnabled(false)
         , m_objectCaptureFrameCount(0)
         , m_isObjectCaptureEnabled(false)
+        , m_capturesDropped(0)
     {
         LOG_FUNC();
         
@@ -1041,72 +1038,6 @@ namespace DSL
         return true;
     }
 
-    static bool TransformAndSave(NvBufSurface* surface, const std::string& filespec, 
-        NvBufSurfTransformRect& src_rect, NvBufSurfTransformRect& dst_rect)
-    {
-        NvBufSurfTransformParams bufSurfTransform;
-        bufSurfTransform.src_rect = &src_rect;
-        bufSurfTransform.dst_rect = &dst_rect;
-        bufSurfTransform.transform_flag = NVBUFSURF_TRANSFORM_CROP_SRC |
-            NVBUFSURF_TRANSFORM_CROP_DST;
-        bufSurfTransform.transform_filter = NvBufSurfTransformInter_Default;
-
-        NvBufSurface *dstSurface = NULL;
-
-        NvBufSurfaceCreateParams bufSurfaceCreateParams;
-
-        // An intermediate buffer for NV12/RGBA to BGR conversion
-        bufSurfaceCreateParams.gpuId = surface->gpuId;
-        bufSurfaceCreateParams.width = dst_rect.width;
-        bufSurfaceCreateParams.height = dst_rect.height;
-        bufSurfaceCreateParams.size = 0;
-        bufSurfaceCreateParams.colorFormat = NVBUF_COLOR_FORMAT_RGBA;
-        bufSurfaceCreateParams.layout = NVBUF_LAYOUT_PITCH;
-        bufSurfaceCreateParams.memType = NVBUF_MEM_DEFAULT;
-
-        cudaError_t cudaError = cudaSetDevice(surface->gpuId);
-        cudaStream_t cudaStream;
-        cudaError = cudaStreamCreate(&cudaStream);
-
-        int retval = NvBufSurfaceCreate(&dstSurface, surface->batchSize,
-            &bufSurfaceCreateParams);	
-
-        NvBufSurfTransformConfigParams bufSurfTransformConfigParams;
-        NvBufSurfTransform_Error err;
-
-        bufSurfTransformConfigParams.compute_mode = NvBufSurfTransformCompute_Default;
-        bufSurfTransformConfigParams.gpu_id = surface->gpuId;
-        bufSurfTransformConfigParams.cuda_stream = cudaStream;
-        err = NvBufSurfTransformSetSessionParams (&bufSurfTransformConfigParams);
-
-        NvBufSurfaceMemSet(dstSurface, 0, 0, 0);
-
-        err = NvBufSurfTransform (surface, dstSurface, &bufSurfTransform);
-        if (err != NvBufSurfTransformError_Success)
-        {
-            g_print ("NvBufSurfTransform failed with error %d while converting buffer\n", err);
-        }
-
-        NvBufSurfaceMap(dstSurface, 0, 0, NVBUF_MAP_READ);
-        NvBufSurfaceSyncForCpu(dstSurface, 0, 0);
-
-        cv::Mat bgr_frame = cv::Mat(cv::Size(bufSurfaceCreateParams.width,
-            bufSurfaceCreateParams.height), CV_8UC3);
-
-        cv::Mat in_mat = cv::Mat(bufSurfaceCreateParams.height, 
-            bufSurfaceCreateParams.width, CV_8UC4, 
-            dstSurface->surfaceList[0].mappedAddr.addr[0],
-            dstSurface->surfaceList[0].pitch);
-
-        cv::cvtColor (in_mat, bgr_frame, CV_RGBA2BGR);
-
-        cv::imwrite(filespec.c_str(), bgr_frame);
-
-        NvBufSurfaceUnMap(dstSurface, 0, 0);
-        NvBufSurfaceDestroy(dstSurface);
-        cudaStreamDestroy(cudaStream);
-    }
-
     bool ImageSinkBintr::HandleFrameCapture(GstBuffer* pBuffer)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
@@ -1133,13 +1064,17 @@ namespace DSL
         std::string filespec = m_outdir + "/frame" + std::to_string(m_frameCaptureframeCount) + ".jpeg";
 
         NvBufSurfTransformRect srcRect = {0, 0, surface->surfaceList[0].width, surface->surfaceList[0].height};
-        NvBufSurfTransformRect dstRect = {0, 0, surface->surfaceList[0].width, surface->surfaceList[0].height};
 
-        bool retVal = TransformAndSave(surface, filespec, srcRect, dstRect);
+        // encode and write are done by the Capture Service's workers. 
+        // A dropped capture is counted, but is not cause to remove the handler.
+        if (!CaptureService::GetService()->SubmitSurface(surface, 0, srcRect, filespec))
+        {
+            m_capturesDropped++;
+        }
 
         gst_buffer_unmap(pBuffer, &inMapInfo);
         
-        return retVal;
+        return true;
     }
     
     bool ImageSinkBintr::HandleObjectCapture(GstBuffer* pBuffer)
@@ -1197,16 +1132,24 @@ namespace DSL
                         // capturing full frame or bbox rectangle only?
                         if (m_captureClasses[obj_meta->class_id]->m_fullFrame)
                         {
-                            NvBufSurfTransformRect srcRect = {0, 0, (uint)surface->surfaceList[0].width, surface->surfaceList[0].height};
-                            NvBufSurfTransformRect dstRect = {0, 0, (uint)surface->surfaceList[0].width, surface->surfaceList[0].height};
-                            TransformAndSave(surface, filespec, srcRect, dstRect);
+                            NvBufSurfTransformRect srcRect = {0, 0, 
+                                surface->surfaceList[frame_meta->batch_id].width, 
+                                surface->surfaceList[frame_meta->batch_id].height};
+                            if (!CaptureService::GetService()->SubmitSurface(surface, 
+                                frame_meta->batch_id, srcRect, filespec))
+                            {
+                                m_capturesDropped++;
+                            }
                         }
                         else
                         {
                             NvBufSurfTransformRect srcRect = {(uint)rect_params->top, (uint)rect_params->left, 
                                 (uint)rect_params->width, (uint)rect_params->height};
-                            NvBufSurfTransformRect dstRect = {0, 0, (uint)rect_params->width, (uint)rect_params->height};
-                            TransformAndSave(surface, filespec, srcRect, dstRect);
+                            if (!CaptureService::GetService()->SubmitSurface(surface, 
+                                frame_meta->batch_id, srcRect, filespec))
+                            {
+                                m_capturesDropped++;
+                            }
                         }
                     }
                 }
@@ -1217,6 +1160,14 @@ namespace DSL
         return true;
     }
     
+    uint64_t ImageSinkBintr::GetCapturesDropped()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureMutex);
+        
+        return m_capturesDropped;
+    }
+    
     static boolean FrameCaptureHandler(void* batch_meta, void* user_data)
     {
         return static_cast<ImageSinkBintr*>(user_data)->
@@ -511,6 +511,13 @@ namespace DSL
          */
         bool HandleObjectCapture(GstBuffer* pBuffer);
         
+        /**
+         * @brief Gets the number of frame and object captures dropped by the Capture
+         * Service, for lack of a free image record or surface, since creation.
+         * @return number of dropped captures for this Image Sink
+         */
+        uint64_t GetCapturesDropped();
+        
     private:
     
         /**
@@ -553,6 +560,13 @@ namespace DSL
          */
         std::map <uint, std::shared_ptr<CaptureClass>> m_captureClasses;
         
+        /**
+         * @brief number of captures not queued by the Capture Service. A dropped
+         * capture leaves the handlers registered, as the pools free up once the
+         * workers catch up.
+         */
+        uint64_t m_capturesDropped;
+        
         /**
          * @brief mutex for updating Image Capture params
          */
@@ -965,6 +965,212 @@ namespace DSL
     }
     
     
+    //*********************************************************************************
+
+    ReplaySourceBintr::ReplaySourceBintr(const char* name, 
+        const char* filePath, bool realTime)
+        : SourceBintr(name)
+        , m_filePath(filePath)
+        , m_realTime(realTime)
+        , m_maxBatchSize(0)
+        , m_batchCount(0)
+        , m_firstPts(0)
+        , m_startTime(0)
+        , m_lastPts(0)
+    {
+        LOG_FUNC();
+        
+        // The dimensions of the Source are those of the first recorded frame
+        DSL_META_RECORDING_READER_PTR pReader = 
+            DSL_META_RECORDING_READER_NEW(filePath);
+        if (!pReader->IsValid())
+        {
+            LOG_ERROR("Failed to open Meta Recording '" << filePath 
+                << "' for Replay Source '" << name << "'");
+            throw;
+        }
+        dsl_meta_recording_frame frame;
+        if (pReader->NextFrame(&frame))
+        {
+            m_width = frame.source_frame_width;
+            m_height = frame.source_frame_height;
+        }
+        initAppSrc(realTime);
+    }
+
+    ReplaySourceBintr::ReplaySourceBintr(const char* name, uint sourceCount, 
+        uint objectsPerFrame, uint classCount, uint64_t batchCount, bool realTime)
+        : SourceBintr(name)
+        , m_realTime(realTime)
+        , m_maxBatchSize(sourceCount)
+        , m_batchCount(0)
+        , m_firstPts(0)
+        , m_startTime(0)
+        , m_lastPts(0)
+    {
+        LOG_FUNC();
+        
+        m_pScenario = DSL_META_REPLAY_SCENARIO_NEW(sourceCount, 
+            objectsPerFrame, classCount, batchCount);
+        
+        m_width = DSL_META_REPLAY_SCENARIO_WIDTH;
+        m_height = DSL_META_REPLAY_SCENARIO_HEIGHT;
+        m_fps_n = DSL_META_REPLAY_SCENARIO_FPS_N;
+        m_fps_d = DSL_META_REPLAY_SCENARIO_FPS_D;
+        
+        initAppSrc(realTime);
+    }
+    
+    void ReplaySourceBintr::initAppSrc(bool realTime)
+    {
+        LOG_FUNC();
+        
+        m_isLive = realTime;
+        
+        m_pSourceElement = DSL_ELEMENT_NEW("appsrc", "replay-app-src");
+        
+        m_pSourceElement->SetAttribute("is-live", m_isLive);
+        m_pSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        m_pSourceElement->SetAttribute("do-timestamp", FALSE);
+        
+        // system memory caps, so components that need video, e.g. the Tiler 
+        // or OSD, fail to negotiate rather than fail on the empty buffers
+        GstCaps* pCaps = gst_caps_new_simple("video/x-raw", 
+            "format", G_TYPE_STRING, "NV12", NULL);
+        if (!pCaps)
+        {
+            LOG_ERROR("Failed to create new Simple Capabilities for '" << GetName() << "'");
+            throw;  
+        }
+        if (m_width and m_height)
+        {
+            gst_caps_set_simple(pCaps, "width", G_TYPE_INT, m_width, 
+                "height", G_TYPE_INT, m_height, NULL);
+        }
+        m_pSourceElement->SetAttribute("caps", pCaps);
+        gst_caps_unref(pCaps);        
+
+        g_signal_connect(m_pSourceElement->GetGObject(), "need-data", 
+            G_CALLBACK(ReplaySourceNeedDataCB), this);
+        
+        AddChild(m_pSourceElement);
+        
+        m_pSourceElement->AddGhostPadToParent("src");
+    }
+
+    ReplaySourceBintr::~ReplaySourceBintr()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {    
+            UnlinkAll();
+        }
+    }
+    
+    bool ReplaySourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("ReplaySourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+        if (m_pScenario)
+        {
+            m_pScenario->Reset();
+        }
+        else
+        {
+            m_pReader = DSL_META_RECORDING_READER_NEW(m_filePath.c_str());
+            if (!m_pReader->IsValid())
+            {
+                LOG_ERROR("ReplaySourceBintr '" << GetName() 
+                    << "' failed to open Meta Recording '" << m_filePath << "'");
+                m_pReader = nullptr;
+                return false;
+            }
+        }
+        m_batchCount = 0;
+        m_lastPts = 0;
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void ReplaySourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("ReplaySourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pReader = nullptr;
+        m_isLinked = false;
+    }
+    
+    uint64_t ReplaySourceBintr::GetBatchCount()
+    {
+        LOG_FUNC();
+        
+        return m_batchCount;
+    }
+    
+    void ReplaySourceBintr::HandleNeedData()
+    {
+        const dsl_meta_recording_frame* pFrames(NULL);
+        uint frameCount(0);
+        GstFlowReturn ret;
+
+        bool read = (m_pReader) 
+            ? m_pReader->NextBatch(&pFrames, &frameCount)
+            : m_pScenario->NextBatch(&pFrames, &frameCount);
+        if (!read)
+        {
+            LOG_INFO("ReplaySourceBintr '" << GetName() << "' end of stream after " 
+                << m_batchCount << " batches");
+            g_signal_emit_by_name(m_pSourceElement->GetGObject(), "end-of-stream", &ret);
+            return;
+        }
+        
+        // timestamps are relative to the first batch, and never go back 
+        // as the recording may span more than one run of its Pipeline
+        if (!m_batchCount)
+        {
+            m_firstPts = pFrames[0].buf_pts;
+            m_startTime = g_get_monotonic_time();
+        }
+        GstClockTime pts = (pFrames[0].buf_pts > m_firstPts)
+            ? pFrames[0].buf_pts - m_firstPts : 0;
+        m_lastPts = std::max(m_lastPts, pts);
+        
+        if (m_realTime)
+        {
+            gint64 delay = m_startTime + (gint64)GST_TIME_AS_USECONDS(m_lastPts) 
+                - g_get_monotonic_time();
+            if (delay > 0)
+            {
+                g_usleep(delay);
+            }
+        }
+        GstBuffer* pBuffer = MetaReplayBufferNew(pFrames, frameCount, m_maxBatchSize);
+        GST_BUFFER_PTS(pBuffer) = m_lastPts;
+        
+        // the push-buffer action signal takes its own reference to the buffer
+        g_signal_emit_by_name(m_pSourceElement->GetGObject(), "push-buffer", pBuffer, &ret);
+        gst_buffer_unref(pBuffer);
+        
+        if (ret != GST_FLOW_OK)
+        {
+            LOG_WARN("ReplaySourceBintr '" << GetName() 
+                << "' failed to push batch with flow return = " << ret);
+        }
+        m_batchCount++;
+    }
+    
     static void UriSourceElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
     {
         static_cast<UriSourceBintr*>(pSource)->HandleSourceElementOnPadAdded(pBin, pPad);
@@ -1004,4 +1210,9 @@ namespace DSL
         return static_cast<DecodeSourceBintr*>(pSource)->HandleStreamBufferSeek();
     }
 
+    static void ReplaySourceNeedDataCB(GstElement* pAppSrc, guint length, gpointer pSource)
+    {
+        static_cast<ReplaySourceBintr*>(pSource)->HandleNeedData();
+    }
+
 } // SDL namespace
\ No newline at end of file
@@ -31,6 +31,8 @@ THE SOFTWARE.
 #include "DslBintr.h"
 #include "DslElementr.h"
 #include "DslDewarperBintr.h"
+#include "DslMetaRecorder.h"
+#include "DslMetaReplay.h"
 
 namespace DSL
 {
@@ -59,6 +61,14 @@ namespace DSL
     #define DSL_RTSP_SOURCE_NEW(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval) \
         std::shared_ptr<RtspSourceBintr>(new RtspSourceBintr(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval))
 
+    #define DSL_REPLAY_SOURCE_PTR std::shared_ptr<ReplaySourceBintr>
+    #define DSL_REPLAY_SOURCE_NEW(name, filePath, realTime) \
+        std::shared_ptr<ReplaySourceBintr>(new ReplaySourceBintr(name, filePath, realTime))
+    #define DSL_REPLAY_SCENARIO_SOURCE_NEW(name, \
+        sourceCount, objectsPerFrame, classCount, batchCount, realTime) \
+        std::shared_ptr<ReplaySourceBintr>(new ReplaySourceBintr(name, \
+            sourceCount, objectsPerFrame, classCount, batchCount, realTime))
+
     /**
      * @class SourceBintr
      * @brief Implements a base Source Bintr for all derived Source types.
@@ -116,6 +126,18 @@ namespace DSL
          */ 
         void GetFrameRate(uint* fps_n, uint* fps_d);
         
+        /**
+         * @brief returns whether this Source produces batched buffers with 
+         * batch meta attached, which must not pass through a Stream Muxer.
+         * @return true if batched, false for a single stream of frames.
+         */
+        virtual bool IsBatched()
+        {
+            LOG_FUNC();
+            
+            return false;
+        }
+        
         /**
          * @brief Links the Streaming Source to a Stream Muxer
          * @param[in] pStreamMux
@@ -500,6 +522,131 @@ namespace DSL
         DSL_ELEMENT_PTR m_pDecodeQueue;
     };
 
+    //*********************************************************************************
+
+    /**
+     * @class ReplaySourceBintr
+     * @brief Replays a Meta Recording, or a synthetic scenario, as zero sized batched
+     * buffers with the batch meta rebuilt from each recorded batch, so that the
+     * downstream ODE Handler and Sinks can be run without a GPU, decoder, or inference.
+     * The buffers carry no video, and can only be handled by components that use 
+     * the batch meta alone. Batches are pushed as fast as downstream can handle them,
+     * or in real time according to the recorded presentation timestamps.
+     */
+    class ReplaySourceBintr : public SourceBintr
+    {
+    public: 
+    
+        /**
+         * @brief ctor for a ReplaySourceBintr that replays a Meta Recording
+         * @param[in] name unique name for the new Source
+         * @param[in] filePath path of the first file of the recording
+         * @param[in] realTime if true, batches are pushed according to their recorded
+         * timestamps, otherwise as fast as possible
+         */
+        ReplaySourceBintr(const char* name, const char* filePath, bool realTime);
+
+        /**
+         * @brief ctor for a ReplaySourceBintr that replays a synthetic scenario
+         * @param[in] name unique name for the new Source
+         * @param[in] sourceCount number of sources, i.e. frames in each batch
+         * @param[in] objectsPerFrame number of Objects in each frame
+         * @param[in] classCount number of Class Ids, evenly spread over the Objects
+         * @param[in] batchCount number of batches to replay, 0 for no end
+         * @param[in] realTime if true, batches are pushed at the scenario's frame rate,
+         * otherwise as fast as possible
+         */
+        ReplaySourceBintr(const char* name, uint sourceCount, uint objectsPerFrame, 
+            uint classCount, uint64_t batchCount, bool realTime);
+
+        ~ReplaySourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr, and rewinds
+         * the recording or scenario to its first batch
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Source Bintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief overrides the base method, the Replay Source is always batched.
+         */
+        bool IsBatched()
+        {
+            LOG_FUNC();
+            
+            return true;
+        }
+        
+        /**
+         * @brief Gets the number of batches pushed since last linked
+         * @return number of batches pushed
+         */
+        uint64_t GetBatchCount();
+        
+        /**
+         * @brief Handles the App Source's need-data signal by pushing the next
+         * batch, or end-of-stream once all batches have been pushed. 
+         * Called on the App Source's streaming thread.
+         */
+        void HandleNeedData();
+        
+    private:
+    
+        /**
+         * @brief Creates the App Source and floats its src pad as the Ghost Pad.
+         * @param[in] realTime if true, the App Source is live
+         */
+        void initAppSrc(bool realTime);
+    
+        /**
+         * @brief path of the first file of the recording, empty for a scenario.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief true if batches are pushed according to their timestamps.
+         */
+        bool m_realTime;
+        
+        /**
+         * @brief reader for the recording while linked, nullptr for a scenario.
+         */
+        DSL_META_RECORDING_READER_PTR m_pReader;
+        
+        /**
+         * @brief synthetic scenario, nullptr for a recording.
+         */
+        DSL_META_REPLAY_SCENARIO_PTR m_pScenario;
+        
+        /**
+         * @brief maximum number of frames in each batch, 0 if not known.
+         */
+        uint m_maxBatchSize;
+        
+        /**
+         * @brief number of batches pushed since last linked.
+         */
+        std::atomic<uint64_t> m_batchCount;
+        
+        /**
+         * @brief recorded timestamp of the first batch, and the monotonic 
+         * time in microseconds it was pushed.
+         */
+        uint64_t m_firstPts;
+        gint64 m_startTime;
+        
+        /**
+         * @brief timestamp of the last batch pushed, relative to the first batch.
+         */
+        GstClockTime m_lastPts;
+    };
+
     /**
      * @brief 
      * @param[in] pBin
@@ -561,5 +708,13 @@ namespace DSL
      */
     static gboolean StreamBufferSeekCB(gpointer pSource);
 
+    /**
+     * @brief Callback for the Replay Source's App Source need-data signal
+     * @param[in] pAppSrc the App Source in need of data
+     * @param[in] length number of bytes needed, unused
+     * @param[in] pSource (callback user data) pointer to the unique Replay Source
+     */
+    static void ReplaySourceNeedDataCB(GstElement* pAppSrc, guint length, gpointer pSource);
+
 } // DSL
 #endif // _DSL_SOURCE_BINTR_H
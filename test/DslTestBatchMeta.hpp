@@ -0,0 +1,297 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_TEST_BATCH_META_H
+#define _DSL_TEST_BATCH_META_H
+
+#include "Dsl.h"
+#include <random>
+
+namespace DSL
+{
+    /**
+     * @brief release function for the synthetic batch meta attached to a GstBuffer
+     */
+    static void TestBatchMetaRelease(gpointer data, gpointer user_data)
+    {
+        nvds_destroy_batch_meta((NvDsBatchMeta*)data);
+    }
+
+    /**
+     * @brief Creates a new GstBuffer with an empty NvDsBatchMeta attached, allocated 
+     * in host memory. No GPU or GStreamer Pipeline is required to use the buffer.
+     * @param[in] maxBatchSize maximum number of frames the batch meta can hold
+     * @return new GstBuffer, to be released by the caller with gst_buffer_unref
+     */
+    inline GstBuffer* TestBatchBufferNew(uint maxBatchSize)
+    {
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(maxBatchSize);
+        
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL, 
+            NULL, TestBatchMetaRelease);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        return pBuffer;
+    }
+
+    /**
+     * @brief Adds a new Frame Meta to the batch meta of a test buffer 
+     * @param[in] pBuffer test buffer created with TestBatchBufferNew
+     * @param[in] sourceId unique source id for the new frame
+     * @param[in] frameNum frame number for the new frame
+     * @return the new Frame Meta, owned by the batch meta
+     */
+    inline NvDsFrameMeta* TestFrameMetaAdd(GstBuffer* pBuffer, 
+        uint sourceId, int frameNum)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        
+        pFrameMeta->source_id = sourceId;
+        pFrameMeta->pad_index = sourceId;
+        pFrameMeta->batch_id = pBatchMeta->num_frames_in_batch;
+        pFrameMeta->frame_num = frameNum;
+        pFrameMeta->bInferDone = true;
+        pFrameMeta->source_frame_width = 1920;
+        pFrameMeta->source_frame_height = 1080;
+        
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        return pFrameMeta;
+    }
+
+    /**
+     * @brief Adds a new Object Meta to a Frame Meta created with TestFrameMetaAdd
+     * @param[in] pFrameMeta parent frame to add the object to
+     * @param[in] classId class id for the new object
+     * @param[in] objectId tracking id for the new object
+     * @param[in] left left coordinate of the object's bounding box
+     * @param[in] top top coordinate of the object's bounding box
+     * @param[in] width width of the object's bounding box
+     * @param[in] height height of the object's bounding box
+     * @param[in] confidence inference confidence for the new object
+     * @return the new Object Meta, owned by the batch meta
+     */
+    inline NvDsObjectMeta* TestObjectMetaAdd(NvDsFrameMeta* pFrameMeta, 
+        int classId, guint64 objectId, float left, float top, 
+        float width, float height, float confidence)
+    {
+        NvDsObjectMeta* pObjectMeta = 
+            nvds_acquire_obj_meta_from_pool(pFrameMeta->base_meta.batch_meta);
+        
+        pObjectMeta->class_id = classId;
+        pObjectMeta->object_id = objectId;
+        pObjectMeta->confidence = confidence;
+        pObjectMeta->rect_params.left = left;
+        pObjectMeta->rect_params.top = top;
+        pObjectMeta->rect_params.width = width;
+        pObjectMeta->rect_params.height = height;
+        
+        nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+        return pObjectMeta;
+    }
+
+    /**
+     * @struct TestBatchMetaParams
+     * @brief Parameters for the synthetic batches built by TestBatchMetaGenerator
+     */
+    struct TestBatchMetaParams
+    {
+        /**
+         * @brief number of Sources, i.e. frames in each batch
+         */
+        uint sourceCount;
+        
+        /**
+         * @brief number of Objects in each frame
+         */
+        uint objectsPerFrame;
+        
+        /**
+         * @brief relative weight of each Class Id, indexed by Class Id
+         */
+        std::vector<double> classWeights;
+        
+        /**
+         * @brief uniform range for the width and height of each Object's bounding box
+         */
+        float minBboxSize;
+        float maxBboxSize;
+        
+        /**
+         * @brief maximum distance an Object moves in x and y from frame to frame
+         */
+        float maxSpeed;
+        
+        /**
+         * @brief probability that an Object leaves the frame on each frame, 
+         * replaced by a new Object with a new tracking id
+         */
+        double turnover;
+        
+        /**
+         * @brief seed for the random number generator. 
+         * The same parameters and seed always build the same batches.
+         */
+        uint seed;
+    };
+    
+    /**
+     * @brief Gets the default TestBatchMetaParams, 4 Sources with 20 Objects
+     * per frame, evenly spread over 4 Class Ids.
+     * @return default parameters, to be updated by the caller as needed
+     */
+    inline TestBatchMetaParams TestBatchMetaParamsDefault()
+    {
+        TestBatchMetaParams params;
+        params.sourceCount = 4;
+        params.objectsPerFrame = 20;
+        params.classWeights = {1.0, 1.0, 1.0, 1.0};
+        params.minBboxSize = 20;
+        params.maxBboxSize = 200;
+        params.maxSpeed = 8;
+        params.turnover = 0;
+        params.seed = 1;
+        return params;
+    }
+    
+    /**
+     * @class TestBatchMetaGenerator
+     * @brief Builds a sequence of synthetic batches in host memory, with tracked
+     * Objects that move across each 1920x1080 frame from batch to batch. 
+     */
+    class TestBatchMetaGenerator
+    {
+    public:
+    
+        TestBatchMetaGenerator(const TestBatchMetaParams& params)
+            : m_params(params)
+            , m_random(params.seed)
+            , m_classes(params.classWeights.begin(), params.classWeights.end())
+            , m_frameNum(0)
+            , m_nextObjectId(0)
+        {
+            m_tracks.resize(params.sourceCount*params.objectsPerFrame);
+            for (auto& track: m_tracks)
+            {
+                newTrack(track);
+            }
+        }
+        
+        /**
+         * @brief Builds the next batch, with one frame per Source 
+         * @return new GstBuffer, to be released by the caller with gst_buffer_unref
+         */
+        GstBuffer* Next()
+        {
+            GstBuffer* pBuffer = TestBatchBufferNew(m_params.sourceCount);
+            
+            for (uint source = 0; source < m_params.sourceCount; source++)
+            {
+                NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, source, m_frameNum);
+                
+                for (uint object = 0; object < m_params.objectsPerFrame; object++)
+                {
+                    TestTrack& track = m_tracks[source*m_params.objectsPerFrame + object];
+                    moveTrack(track);
+                    TestObjectMetaAdd(pFrameMeta, track.classId, track.objectId,
+                        track.left, track.top, track.width, track.height, track.confidence);
+                }
+            }
+            m_frameNum++;
+            return pBuffer;
+        }
+        
+    private:
+    
+        /**
+         * @struct TestTrack
+         * @brief state of one tracked Object 
+         */
+        struct TestTrack
+        {
+            int classId;
+            guint64 objectId;
+            float left, top, width, height;
+            float dx, dy;
+            float confidence;
+        };
+        
+        void newTrack(TestTrack& track)
+        {
+            std::uniform_real_distribution<float> size(
+                m_params.minBboxSize, m_params.maxBboxSize);
+            std::uniform_real_distribution<float> speed(
+                -m_params.maxSpeed, m_params.maxSpeed);
+            std::uniform_real_distribution<float> confidence(0.2, 1.0);
+            
+            track.classId = m_classes(m_random);
+            track.objectId = m_nextObjectId++;
+            track.width = size(m_random);
+            track.height = size(m_random);
+            track.left = std::uniform_real_distribution<float>(0, 
+                std::max(1.0f, 1920 - track.width))(m_random);
+            track.top = std::uniform_real_distribution<float>(0, 
+                std::max(1.0f, 1080 - track.height))(m_random);
+            track.dx = speed(m_random);
+            track.dy = speed(m_random);
+            track.confidence = confidence(m_random);
+        }
+        
+        void moveTrack(TestTrack& track)
+        {
+            if (m_params.turnover > 0 and 
+                std::uniform_real_distribution<double>(0, 1)(m_random) < m_params.turnover)
+            {
+                newTrack(track);
+                return;
+            }
+            // bounce off the edges of the frame
+            if (track.left + track.dx < 0 or track.left + track.width + track.dx > 1920)
+            {
+                track.dx = -track.dx;
+            }
+            if (track.top + track.dy < 0 or track.top + track.height + track.dy > 1080)
+            {
+                track.dy = -track.dy;
+            }
+            track.left += track.dx;
+            track.top += track.dy;
+        }
+    
+        TestBatchMetaParams m_params;
+        
+        std::mt19937 m_random;
+        
+        std::discrete_distribution<int> m_classes;
+        
+        int m_frameNum;
+        
+        guint64 m_nextObjectId;
+        
+        std::vector<TestTrack> m_tracks;
+    };
+}
+
+#endif // _DSL_TEST_BATCH_META_H
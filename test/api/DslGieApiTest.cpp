@@ -409,6 +409,56 @@ SCENARIO( "A Primary GIE can Enable and Disable Kitti output",  "[gie-api]" )
     }
 }
 
+SCENARIO( "A Primary GIE can Set and Get its Kitti output mode",  "[gie-api]" )
+{
+    GIVEN( "A new Primary GIE in memory" ) 
+    {
+        std::wstring primaryGieName(L"primary-gie");
+        std::wstring inferConfigFile = L"./test/configs/config_infer_primary_nano.txt";
+        std::wstring modelEngineFile = L"./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+        uint interval(1);
+
+        REQUIRE( dsl_gie_primary_new(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), interval) == DSL_RESULT_SUCCESS );
+        
+        uint mode(99), maxFileSize(99);
+        REQUIRE( dsl_gie_primary_kitti_output_mode_get(primaryGieName.c_str(), 
+            &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+        REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_FRAME_FILES );
+        REQUIRE( maxFileSize == 0 );
+        
+        WHEN( "The Primary GIE's Kitti output mode is set" )
+        {
+            REQUIRE( dsl_gie_primary_kitti_output_mode_set(primaryGieName.c_str(), 
+                DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 1000000) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct mode and maximum file size are returned" )
+            {
+                REQUIRE( dsl_gie_primary_kitti_output_mode_get(primaryGieName.c_str(), 
+                    &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_SOURCE_FILES );
+                REQUIRE( maxFileSize == 1000000 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid Kitti output mode is set" )
+        {
+            REQUIRE( dsl_gie_primary_kitti_output_mode_set(primaryGieName.c_str(), 
+                DSL_KITTI_OUTPUT_MODE_SOURCE_FILES+1, 0) == DSL_RESULT_GIE_SET_FAILED );
+
+            THEN( "The mode is unchanged" )
+            {
+                REQUIRE( dsl_gie_primary_kitti_output_mode_get(primaryGieName.c_str(), 
+                    &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_FRAME_FILES );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A Secondary GIE can Set and Get its Infer Config and Model Engine Files",  "[gie-api]" )
 {
     GIVEN( "A new Secondary GIE in memory" ) 
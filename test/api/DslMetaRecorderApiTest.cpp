@@ -0,0 +1,150 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+SCENARIO( "The Components container is updated correctly on new Meta Recorder", "[meta-recorder-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring metaRecorderName(L"meta-recorder");
+        std::wstring filePath(L"./test-recording.dslm");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Meta Recorder is created" ) 
+        {
+            REQUIRE( dsl_meta_recorder_new(metaRecorderName.c_str(), 
+                filePath.c_str(), 100) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and contents are updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                
+                // second call must fail
+                REQUIRE( dsl_meta_recorder_new(metaRecorderName.c_str(), 
+                    filePath.c_str(), 100) == DSL_RESULT_META_RECORDER_NAME_NOT_UNIQUE );
+                    
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Meta Recorder can't be created for a directory that does not exist", "[meta-recorder-api]" )
+{
+    GIVEN( "A file path in a directory that does not exist" ) 
+    {
+        std::wstring metaRecorderName(L"meta-recorder");
+        std::wstring filePath(L"./bad-directory/test-recording.dslm");
+
+        WHEN( "A new Meta Recorder is created" ) 
+        {
+            uint retval = dsl_meta_recorder_new(metaRecorderName.c_str(), filePath.c_str(), 100);
+
+            THEN( "The Meta Recorder is not created" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_META_RECORDER_FILE_PATH_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Meta Recorder has no recorded or dropped frames", "[meta-recorder-api]" )
+{
+    GIVEN( "A new Meta Recorder" ) 
+    {
+        std::wstring metaRecorderName(L"meta-recorder");
+        std::wstring filePath(L"./test-recording.dslm");
+
+        REQUIRE( dsl_meta_recorder_new(metaRecorderName.c_str(), 
+            filePath.c_str(), 0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Meta Recorder's metrics are queried" ) 
+        {
+            uint64_t recorded(99), dropped(99);
+            REQUIRE( dsl_meta_recorder_metrics_get(metaRecorderName.c_str(), 
+                &recorded, &dropped) == DSL_RESULT_SUCCESS );
+
+            THEN( "The metrics are zero" ) 
+            {
+                REQUIRE( recorded == 0 );
+                REQUIRE( dropped == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Meta Recorder API checks for a Component that is not a Meta Recorder", "[meta-recorder-api]" )
+{
+    GIVEN( "A new ODE Handler" ) 
+    {
+        std::wstring odeHandlerName(L"ode-handler");
+        REQUIRE( dsl_ode_handler_new(odeHandlerName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The ODE Handler's metrics are queried as a Meta Recorder" ) 
+        {
+            uint64_t recorded(0), dropped(0);
+            uint retval = dsl_meta_recorder_metrics_get(odeHandlerName.c_str(), 
+                &recorded, &dropped);
+
+            THEN( "The call fails" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_META_RECORDER_COMPONENT_IS_NOT_META_RECORDER );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Meta Recording API checks for invalid recordings and names", "[meta-recorder-api]" )
+{
+    GIVEN( "A recording file that does not exist" ) 
+    {
+        std::wstring recordingName(L"recording");
+        std::wstring filePath(L"./no-such-recording.dslm");
+
+        WHEN( "The recording is opened" ) 
+        {
+            uint retval = dsl_meta_recording_open(recordingName.c_str(), filePath.c_str());
+
+            THEN( "The open fails and the name is not in use" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_META_RECORDING_FILE_INVALID );
+                
+                dsl_meta_recording_frame frame;
+                REQUIRE( dsl_meta_recording_frame_next(recordingName.c_str(), 
+                    &frame) == DSL_RESULT_META_RECORDING_NAME_NOT_FOUND );
+                REQUIRE( dsl_meta_recording_close(recordingName.c_str()) == 
+                    DSL_RESULT_META_RECORDING_NAME_NOT_FOUND );
+                REQUIRE( dsl_meta_recording_close_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
@@ -128,6 +128,98 @@ SCENARIO( "A new Callback ODE Action can be created and deleted", "[ode-action-a
     }
 }
 
+SCENARIO( "A new Batch Callback ODE Action can be created and deleted", "[ode-action-api]" )
+{
+    GIVEN( "Attributes for a new Batch Callback ODE Action" ) 
+    {
+        std::wstring actionName(L"callback-batch-action");
+        std::wstring logActionName(L"log-action");
+        dsl_ode_handle_occurrences_cb client_handler;
+
+        WHEN( "A new Batch Callback ODE Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_callback_batch_new(actionName.c_str(), 
+                client_handler, NULL) == DSL_RESULT_SUCCESS );
+            
+            THEN( "A Trigger name can not be queried before any occurrence" ) 
+            {
+                const wchar_t* trigger(NULL);
+                REQUIRE( dsl_ode_action_callback_batch_trigger_name_get(actionName.c_str(), 
+                    0, &trigger) == DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_action_callback_batch_new(actionName.c_str(), 
+                    client_handler, NULL) == DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE );
+                REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "A new Log ODE Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_log_new(logActionName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "A Trigger name can not be queried from the wrong type of Action" ) 
+            {
+                const wchar_t* trigger(NULL);
+                REQUIRE( dsl_ode_action_callback_batch_trigger_name_get(logActionName.c_str(), 
+                    0, &trigger) == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_action_delete(logActionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Journal ODE Action can be created and deleted", "[ode-action-api]" )
+{
+    GIVEN( "Attributes for a new Journal ODE Action" ) 
+    {
+        std::wstring actionName(L"journal-action");
+        std::wstring filePath(L"./test-journal-api.dslj");
+        std::wstring badFilePath(L"./not-a-directory/test-journal-api.dslj");
+        std::wstring csvFilePath(L"./test-journal-api.csv");
+
+        WHEN( "A new Journal ODE Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_journal_new(actionName.c_str(), 
+                filePath.c_str(), 1, 0) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The empty journal can be scanned and converted to CSV" ) 
+            {
+                uint64_t count(99);
+                REQUIRE( dsl_ode_journal_scan(filePath.c_str(), NULL, DSL_ODE_ANY_SOURCE, 
+                    0, UINT64_MAX, NULL, NULL, &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 0 );
+                count = 99;
+                REQUIRE( dsl_ode_journal_csv_write(filePath.c_str(), csvFilePath.c_str(), 
+                    NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 0 );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "The maximum file count is set to 1" ) 
+        {
+            THEN( "The Journal ODE Action fails to create" ) 
+            {
+                REQUIRE( dsl_ode_action_journal_new(actionName.c_str(), 
+                    filePath.c_str(), 1, 1) == DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "The journal's directory does not exist" ) 
+        {
+            THEN( "The Journal ODE Action fails to create" ) 
+            {
+                uint64_t count(0);
+                REQUIRE( dsl_ode_action_journal_new(actionName.c_str(), 
+                    badFilePath.c_str(), 1, 0) == DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND );
+                REQUIRE( dsl_ode_journal_scan(badFilePath.c_str(), NULL, DSL_ODE_ANY_SOURCE, 
+                    0, UINT64_MAX, NULL, NULL, &count) == DSL_RESULT_ODE_ACTION_FILE_PATH_NOT_FOUND );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Frame Capture ODE Action can be created and deleted", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new Frame Capture ODE Action" ) 
@@ -762,3 +854,119 @@ SCENARIO( "A new Enable Action ODE Action can be created and deleted", "[ode-act
     }
 }
 
+
+SCENARIO( "The Async settings of an ODE Action can be queried and updated", "[ode-action-api]" )
+{
+    GIVEN( "A new Print ODE Action" ) 
+    {
+        std::wstring actionName(L"print-action");
+
+        REQUIRE( dsl_ode_action_print_new(actionName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        uint overflowPolicy(99);
+        REQUIRE( dsl_ode_action_async_get(actionName.c_str(), &enabled, &overflowPolicy) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        REQUIRE( overflowPolicy == DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST );
+
+        WHEN( "The Print ODE Action's Async settings are updated" ) 
+        {
+            REQUIRE( dsl_ode_action_async_set(actionName.c_str(), 
+                true, DSL_ODE_ACTION_OVERFLOW_BLOCK) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_action_async_get(actionName.c_str(), &enabled, &overflowPolicy) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( overflowPolicy == DSL_ODE_ACTION_OVERFLOW_BLOCK );
+
+                uint64_t dropped(99);
+                REQUIRE( dsl_ode_action_async_dropped_get(actionName.c_str(), &dropped) == DSL_RESULT_SUCCESS );
+                REQUIRE( dropped == 0 );
+                
+                REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid overflow policy is used" ) 
+        {
+            REQUIRE( dsl_ode_action_async_set(actionName.c_str(), 
+                true, DSL_ODE_ACTION_OVERFLOW_BLOCK+1) == DSL_RESULT_ODE_ACTION_SET_FAILED );
+            
+            THEN( "The Async settings are unchanged" ) 
+            {
+                REQUIRE( dsl_ode_action_async_get(actionName.c_str(), &enabled, &overflowPolicy) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                
+                REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ODE Action that updates Metadata can not be made Async", "[ode-action-api]" )
+{
+    GIVEN( "A new Fill Frame ODE Action" ) 
+    {
+        std::wstring actionName(L"fill-frame-action");
+
+        REQUIRE( dsl_ode_action_fill_frame_new(actionName.c_str(), 0.0, 0.0, 0.0, 0.0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Async execution is enabled" ) 
+        {
+            uint retval = dsl_ode_action_async_set(actionName.c_str(), 
+                true, DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST);
+            
+            THEN( "The service fails with the correct result" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                
+                REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The metrics of an ODE Action can be queried and reset", "[ode-action-api]" )
+{
+    GIVEN( "A new Print ODE Action" ) 
+    {
+        std::wstring actionName(L"print-action");
+
+        REQUIRE( dsl_ode_action_print_new(actionName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Action's metrics are queried" ) 
+        {
+            dsl_ode_action_metrics metrics;
+            memset(&metrics, 0xff, sizeof(metrics));
+            REQUIRE( dsl_ode_action_metrics_get(actionName.c_str(), &metrics) == DSL_RESULT_SUCCESS );
+            
+            THEN( "All counters are zero before any occurrence is handled" ) 
+            {
+                REQUIRE( metrics.invocations == 0 );
+                REQUIRE( metrics.execution_time_ns == 0 );
+                REQUIRE( metrics.max_execution_time_ns == 0 );
+                REQUIRE( metrics.async_dropped == 0 );
+                REQUIRE( dsl_ode_action_metrics_reset(actionName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "The Action is deleted" ) 
+        {
+            REQUIRE( dsl_ode_action_delete(actionName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The metrics services fail with the correct result" ) 
+            {
+                dsl_ode_action_metrics metrics;
+                REQUIRE( dsl_ode_action_metrics_get(actionName.c_str(), 
+                    &metrics) == DSL_RESULT_ODE_ACTION_NAME_NOT_FOUND );
+                REQUIRE( dsl_ode_action_metrics_reset(actionName.c_str()) 
+                    == DSL_RESULT_ODE_ACTION_NAME_NOT_FOUND );
+            }
+        }
+    }
+}
@@ -855,3 +855,122 @@ SCENARIO( "A new Pipeline with an ODE Handler, Four Summation ODE Types with a s
         }
     }
 }
+
+SCENARIO( "A new Pipeline with a Replay Source, ODE Handler, and Fake Sink can play without a GPU", "[ode-behavior]" )
+{
+    GIVEN( "A Pipeline, Replay Source, ODE Handler with an Occurrence Trigger, and Fake Sink" ) 
+    {
+        std::wstring sourceName(L"replay-source");
+        uint sourceCount(4);
+        uint objectsPerFrame(20);
+        uint classCount(4);
+        uint64_t batchCount(1000);
+
+        std::wstring odeHandlerName(L"ode-handler");
+        std::wstring odeTriggerName(L"occurrence");
+        std::wstring fakeSinkName(L"fake-sink");
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_replay_scenario_new(sourceName.c_str(), sourceCount, 
+            objectsPerFrame, classCount, batchCount, false) == DSL_RESULT_SUCCESS );
+        
+        REQUIRE( dsl_ode_handler_new(odeHandlerName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 0, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_handler_trigger_add(odeHandlerName.c_str(), 
+            odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"replay-source", L"ode-handler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline plays all batches of the scenario through the ODE Handler" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                uint64_t batches(0);
+                REQUIRE( dsl_source_replay_batches_get(sourceName.c_str(), &batches) == DSL_RESULT_SUCCESS );
+                REQUIRE( batches == batchCount );
+                
+                dsl_ode_trigger_metrics metrics{0};
+                REQUIRE( dsl_ode_trigger_metrics_get(odeTriggerName.c_str(), &metrics) == DSL_RESULT_SUCCESS );
+                REQUIRE( metrics.batches == batchCount );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline with latency tracing enabled measures each component and end-to-end", "[ode-behavior]" )
+{
+    GIVEN( "A Pipeline, Replay Source, ODE Handler, and Fake Sink" ) 
+    {
+        std::wstring sourceName(L"replay-source");
+        uint64_t batchCount(100);
+
+        std::wstring odeHandlerName(L"ode-handler");
+        std::wstring fakeSinkName(L"fake-sink");
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_replay_scenario_new(sourceName.c_str(), 4, 
+            10, 4, batchCount, false) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_handler_new(odeHandlerName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"replay-source", L"ode-handler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled with latency tracing enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "Every frame is measured through the ODE Handler and end-to-end" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                // stats remain available once stopped
+                dsl_latency_stats stats{0};
+                REQUIRE( dsl_pipeline_latency_stats_get(pipelineName.c_str(), 
+                    odeHandlerName.c_str(), &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.count == batchCount*4 );
+                REQUIRE( stats.p50_ns <= stats.p90_ns );
+                REQUIRE( stats.p90_ns <= stats.p99_ns );
+                REQUIRE( stats.p99_ns <= stats.max_ns );
+                
+                REQUIRE( dsl_pipeline_latency_stats_get(pipelineName.c_str(), 
+                    NULL, &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.component == NULL );
+                REQUIRE( stats.count == batchCount*4 );
+
+                REQUIRE( dsl_pipeline_latency_stats_get(pipelineName.c_str(), 
+                    fakeSinkName.c_str(), &stats) == DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -109,6 +109,43 @@ SCENARIO( "A ODE Handler's Enabled Setting can be disabled and re-enabled", "[od
     }
 }
 
+SCENARIO( "A ODE Handler's worker count can be updated", "[ode-handler-api]" )
+{
+    GIVEN( "A new ODE Handler with a default worker count of one" ) 
+    {
+        std::wstring odeHandlerName(L"ode-handler");
+        uint count(0);
+
+        REQUIRE( dsl_ode_handler_new(odeHandlerName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_handler_worker_count_get(odeHandlerName.c_str(), &count) == DSL_RESULT_SUCCESS );
+        REQUIRE( count == 1 );
+
+        WHEN( "The ODE Handler's worker count is updated" ) 
+        {
+            REQUIRE( dsl_ode_handler_worker_count_set(odeHandlerName.c_str(), 4) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_ode_handler_worker_count_get(odeHandlerName.c_str(), &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 4 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The ODE Handler's worker count is set out of range" ) 
+        {
+            REQUIRE( dsl_ode_handler_worker_count_set(odeHandlerName.c_str(), 0) == 
+                DSL_RESULT_ODE_HANDLER_SET_FAILED );
+            
+            THEN( "The worker count is unchanged" )
+            {
+                REQUIRE( dsl_ode_handler_worker_count_get(odeHandlerName.c_str(), &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 1 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new ODE Handler can Add and Remove a Detection Event", "[ode-handler-api]" )
 {
     GIVEN( "A new ODE Handler and new Detection Event" ) 
@@ -422,3 +422,237 @@ SCENARIO( "A new Maximum Trigger can be created and deleted correctly", "[ode-tr
     }
 }    
 
+
+SCENARIO( "A new Window Trigger can be created and deleted correctly", "[ode-trigger-api]" )
+{
+    GIVEN( "Attributes for a new Window Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"window");
+        uint class_id(0);
+        uint limit(0);
+        float threshold(10);
+        uint window(30000);
+        uint bucket(1000);
+
+        WHEN( "When the Trigger is created" )         
+        {
+            REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_ABOVE, threshold, 
+                window, bucket) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The Trigger's timestamp can be updated and the Trigger deleted" ) 
+            {
+                uint timestamp(99);
+                REQUIRE( dsl_ode_trigger_window_timestamp_get(odeTriggerName.c_str(), 
+                    &timestamp) == DSL_RESULT_SUCCESS );
+                REQUIRE( timestamp == DSL_ODE_WINDOW_TIMESTAMP_PTS );
+                REQUIRE( dsl_ode_trigger_window_timestamp_set(odeTriggerName.c_str(), 
+                    DSL_ODE_WINDOW_TIMESTAMP_NTP) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_window_timestamp_get(odeTriggerName.c_str(), 
+                    &timestamp) == DSL_RESULT_SUCCESS );
+                REQUIRE( timestamp == DSL_ODE_WINDOW_TIMESTAMP_NTP );
+                REQUIRE( dsl_ode_trigger_window_timestamp_set(odeTriggerName.c_str(), 
+                    DSL_ODE_WINDOW_TIMESTAMP_NTP+1) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "When the Trigger is created with invalid parameters" )         
+        {
+            THEN( "The Trigger fails to create" ) 
+            {
+                REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                    DSL_ODE_WINDOW_AGGREGATE_MAX+1, DSL_ODE_WINDOW_CROSSING_ABOVE, threshold, 
+                    window, bucket) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                    DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_BELOW+1, threshold, 
+                    window, bucket) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                    DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_ABOVE, threshold, 
+                    window, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                    DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_ABOVE, threshold, 
+                    bucket-1, bucket) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_window_new(odeTriggerName.c_str(), class_id, limit, 
+                    DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_ABOVE, threshold, 
+                    (DSL_ODE_WINDOW_BUCKETS_MAX+1)*10, 10) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "A Trigger of another type is created" )         
+        {
+            REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+                class_id, limit) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The window services fail with the correct result" ) 
+            {
+                uint timestamp(0);
+                REQUIRE( dsl_ode_trigger_window_timestamp_get(odeTriggerName.c_str(), 
+                    &timestamp) == DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_trigger_window_timestamp_set(odeTriggerName.c_str(), 
+                    DSL_ODE_WINDOW_TIMESTAMP_NTP) == DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "New Track, Lost Track and Dwell Triggers can be created and deleted correctly", "[ode-trigger-api]" )
+{
+    GIVEN( "Attributes for new Tracked Object Triggers" ) 
+    {
+        uint class_id(0);
+        uint limit(0);
+        uint min_dwell_time(5000);
+        uint lost_frames(30);
+
+        WHEN( "When the Triggers are created" )         
+        {
+            REQUIRE( dsl_ode_trigger_new_track_new(L"new-track", 
+                class_id, limit, lost_frames) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_lost_track_new(L"lost-track", 
+                class_id, limit, lost_frames) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_dwell_new(L"dwell", 
+                class_id, limit, min_dwell_time, lost_frames) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_list_size() == 3 );
+            
+            THEN( "The Trigger names must be unique and the Triggers can be deleted" ) 
+            {
+                REQUIRE( dsl_ode_trigger_new_track_new(L"dwell", 
+                    class_id, limit, lost_frames) == DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "When the Triggers are created with no lost frames" )         
+        {
+            THEN( "The Triggers fail to create" ) 
+            {
+                REQUIRE( dsl_ode_trigger_new_track_new(L"new-track", 
+                    class_id, limit, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_lost_track_new(L"lost-track", 
+                    class_id, limit, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_dwell_new(L"dwell", 
+                    class_id, limit, min_dwell_time, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Line Crossing Trigger can add, remove, and count the crossings of ODE Lines", "[ode-trigger-api]" )
+{
+    GIVEN( "A new Line Crossing Trigger and ODE Line" ) 
+    {
+        std::wstring odeTriggerName(L"line-crossing");
+        std::wstring odeLineName(L"line");
+
+        REQUIRE( dsl_ode_trigger_line_crossing_new(odeTriggerName.c_str(), 0, 0, 
+            DSL_ODE_LINE_DIRECTION_ANY, DSL_ODE_LINE_POINT_BOTTOM_CENTER, 30) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_line_new(odeLineName.c_str(), 0, 500, 1000, 500, true) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Line is added to the Trigger" )         
+        {
+            REQUIRE( dsl_ode_trigger_line_crossing_line_add(odeTriggerName.c_str(), 
+                odeLineName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The counts can be queried and reset, and the Line removed" ) 
+            {
+                REQUIRE( dsl_ode_trigger_line_crossing_line_add(odeTriggerName.c_str(), 
+                    odeLineName.c_str()) == DSL_RESULT_ODE_TRIGGER_LINE_ADD_FAILED );
+                REQUIRE( dsl_ode_line_delete(odeLineName.c_str()) == DSL_RESULT_ODE_LINE_IN_USE );
+                
+                uint64_t left_to_right(99), right_to_left(99);
+                REQUIRE( dsl_ode_trigger_line_crossing_counts_get(odeTriggerName.c_str(), 
+                    odeLineName.c_str(), &left_to_right, &right_to_left) == DSL_RESULT_SUCCESS );
+                REQUIRE( left_to_right == 0 );
+                REQUIRE( right_to_left == 0 );
+                REQUIRE( dsl_ode_trigger_line_crossing_counts_reset(
+                    odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_ode_trigger_line_crossing_line_remove(odeTriggerName.c_str(), 
+                    odeLineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_line_crossing_line_remove(odeTriggerName.c_str(), 
+                    odeLineName.c_str()) == DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE );
+                REQUIRE( dsl_ode_trigger_line_crossing_counts_get(odeTriggerName.c_str(), 
+                    odeLineName.c_str(), &left_to_right, &right_to_left) == DSL_RESULT_ODE_TRIGGER_LINE_NOT_IN_USE );
+
+                REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_line_delete(odeLineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+                REQUIRE( dsl_ode_line_list_size() == 0 );
+            }
+        }
+        WHEN( "A Trigger of another type is used" )         
+        {
+            REQUIRE( dsl_ode_trigger_occurrence_new(L"occurrence", 0, 0) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The line crossing services fail with the correct result" ) 
+            {
+                REQUIRE( dsl_ode_trigger_line_crossing_line_add(L"occurrence", 
+                    odeLineName.c_str()) == DSL_RESULT_ODE_TRIGGER_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_trigger_line_crossing_new(L"bad-direction", 0, 0, 
+                    DSL_ODE_LINE_DIRECTION_RIGHT_TO_LEFT+1, DSL_ODE_LINE_POINT_CENTER, 
+                    30) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_line_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+                REQUIRE( dsl_ode_line_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "The metrics of an ODE Trigger can be queried and reset", "[ode-trigger-api]" )
+{
+    GIVEN( "A new Occurrence Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        uint class_id(0);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), class_id, limit) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Trigger's metrics are queried" )         
+        {
+            dsl_ode_trigger_metrics metrics;
+            memset(&metrics, 0xff, sizeof(metrics));
+            REQUIRE( dsl_ode_trigger_metrics_get(odeTriggerName.c_str(), &metrics) == DSL_RESULT_SUCCESS );
+            
+            THEN( "All counters are zero before any batch is processed" ) 
+            {
+                REQUIRE( metrics.batches == 0 );
+                REQUIRE( metrics.objects_evaluated == 0 );
+                REQUIRE( metrics.objects_passed == 0 );
+                REQUIRE( metrics.occurrences == 0 );
+                REQUIRE( metrics.evaluation_time_ns == 0 );
+                for (uint i = 0; i < DSL_ODE_METRICS_HISTOGRAM_BUCKETS; i++)
+                {
+                    REQUIRE( metrics.evaluation_time_histogram[i] == 0 );
+                }
+                REQUIRE( dsl_ode_trigger_metrics_reset(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "The Trigger is deleted" )         
+        {
+            REQUIRE( dsl_ode_trigger_delete(odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The metrics services fail with the correct result" ) 
+            {
+                dsl_ode_trigger_metrics metrics;
+                REQUIRE( dsl_ode_trigger_metrics_get(odeTriggerName.c_str(), 
+                    &metrics) == DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND );
+                REQUIRE( dsl_ode_trigger_metrics_reset(odeTriggerName.c_str()) 
+                    == DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND );
+            }
+        }
+    }
+}    
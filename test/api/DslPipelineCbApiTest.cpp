@@ -297,3 +297,66 @@ SCENARIO( "A XWindow Delete Event Handler can be removed", "[pipeline-cb-api]" )
         }
     }
 }
+
+static void latency_stats_handler_cb(const dsl_latency_stats* stats, 
+    uint count, void* client_data)
+{
+}
+
+SCENARIO( "A Latency Stats Handler requires latency tracing and must be unique", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+
+    GIVEN( "A Pipeline with latency tracing disabled" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_latency_stats_handler_add(pipelineName.c_str(),
+            latency_stats_handler_cb, 1000, NULL) == DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED );
+
+        WHEN( "Latency tracing is enabled and a Latency Stats Handler is added" )
+        {
+            REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(),
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_latency_stats_handler_add(pipelineName.c_str(),
+                latency_stats_handler_cb, 1000, (void*)0x12345678) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same handler can't be added again" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_stats_handler_add(pipelineName.c_str(),
+                    latency_stats_handler_cb, 1000, NULL) == DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+   
+SCENARIO( "A Latency Stats Handler can be removed", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+
+    GIVEN( "A Pipeline with one Latency Stats Handler" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(),
+            true) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_latency_stats_handler_add(pipelineName.c_str(),
+            latency_stats_handler_cb, 1000, (void*)0x12345678) == DSL_RESULT_SUCCESS );
+            
+        WHEN( "The Latency Stats Handler is removed" )
+        {
+            REQUIRE( dsl_pipeline_latency_stats_handler_remove(pipelineName.c_str(),
+                latency_stats_handler_cb) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same handler can't be removed again" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_stats_handler_remove(pipelineName.c_str(),
+                    latency_stats_handler_cb) == DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -77,3 +77,52 @@ SCENARIO( "A Pipeline's graph can be dumped to .dot with and without timestamp",
         }
     }
 }
+
+SCENARIO( "A Pipeline's latency tracing can be enabled and disabled", "[pipeline-dbg-api]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline with latency tracing disabled by default" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_latency_tracing_enabled_get(pipelineName.c_str(),
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        dsl_latency_stats stats{0};
+        REQUIRE( dsl_pipeline_latency_stats_get(pipelineName.c_str(), NULL,
+            &stats) == DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED );
+        REQUIRE( dsl_pipeline_latency_stats_reset(pipelineName.c_str()) == 
+            DSL_RESULT_PIPELINE_LATENCY_TRACING_DISABLED );
+
+        WHEN( "Latency tracing is enabled" )
+        {
+            REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(),
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct setting is returned on get" ) 
+            {
+                REQUIRE( dsl_pipeline_latency_tracing_enabled_get(pipelineName.c_str(),
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                // No components are traced until the Pipeline is played
+                REQUIRE( dsl_pipeline_latency_stats_get(pipelineName.c_str(), NULL,
+                    &stats) == DSL_RESULT_PIPELINE_LATENCY_STATS_NOT_FOUND );
+                REQUIRE( dsl_pipeline_latency_stats_reset(pipelineName.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(),
+                    false) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_latency_tracing_enabled_get(pipelineName.c_str(),
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -585,3 +585,89 @@ SCENARIO( "Adding an invalid Dewarper to a Decode Source Component fails", "[sou
         }
     }
 }
+
+SCENARIO( "A new Replay Source for a synthetic scenario returns the correct attribute values", "[source-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sourceName(L"replay-source");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Replay Source is created" ) 
+        {
+            REQUIRE( dsl_source_replay_scenario_new(sourceName.c_str(), 
+                4, 20, 4, 1000, false) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Replay Source's attributes are set correctly" ) 
+            {
+                uint ret_width(0), ret_height(0), ret_fps_n(0), ret_fps_d(0);
+                uint64_t ret_batches(99);
+                REQUIRE( dsl_source_dimensions_get(sourceName.c_str(), &ret_width, &ret_height) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_frame_rate_get(sourceName.c_str(), &ret_fps_n, &ret_fps_d) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_width == 1920 );
+                REQUIRE( ret_height == 1080 );
+                REQUIRE( ret_fps_n == 30 );
+                REQUIRE( ret_fps_d == 1 );
+                REQUIRE( dsl_source_is_live(sourceName.c_str()) == false );
+                REQUIRE( dsl_source_replay_batches_get(sourceName.c_str(), &ret_batches) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_batches == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Replay Source is created with valid parameters only", "[source-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sourceName(L"replay-source");
+        std::wstring filePath(L"./test/recordings/not-a-recording.dslm");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "The parameters are invalid" ) 
+        {
+            THEN( "The Replay Source is not created" ) 
+            {
+                REQUIRE( dsl_source_replay_new(sourceName.c_str(), 
+                    filePath.c_str(), false) == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+                REQUIRE( dsl_source_replay_scenario_new(sourceName.c_str(), 
+                    0, 20, 4, 1000, false) == DSL_RESULT_SOURCE_SCENARIO_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Replay Source must be the only Source in a Pipeline", "[source-api]" )
+{
+    GIVEN( "A new Pipeline with a Replay Source and a CSI Source" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring replaySourceName(L"replay-source");
+        std::wstring csiSourceName(L"csi-source");
+
+        REQUIRE( dsl_source_replay_scenario_new(replaySourceName.c_str(), 
+            4, 20, 4, 1000, false) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_csi_new(csiSourceName.c_str(), 1280, 720, 30, 1) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Replay Source is added to the Pipeline" ) 
+        {
+            REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+                replaySourceName.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "A second Source can not be added" ) 
+            {
+                REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+                    csiSourceName.c_str()) != DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
@@ -454,3 +454,53 @@ SCENARIO( "A Tracker can Enable and Disable Kitti output", "[tracker-api]" )
     }
 }
 
+SCENARIO( "A Tracker can Set and Get its Kitti output mode", "[tracker-api]" )
+{
+    GIVEN( "A new Tracker in memory" ) 
+    {
+        std::wstring trackerName(L"ktl-tracker");
+        uint width(480);
+        uint height(272);
+
+        REQUIRE( dsl_tracker_ktl_new(trackerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        uint mode(99), maxFileSize(99);
+        REQUIRE( dsl_tracker_kitti_output_mode_get(trackerName.c_str(), 
+            &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+        REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_FRAME_FILES );
+        REQUIRE( maxFileSize == 0 );
+        
+        WHEN( "The Tracker's Kitti output mode is set while output is enabled" )
+        {
+            REQUIRE( dsl_tracker_kitti_output_enabled_set(trackerName.c_str(), true, L"./") == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_tracker_kitti_output_mode_set(trackerName.c_str(), 
+                DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 1000000) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct mode and maximum file size are returned" )
+            {
+                REQUIRE( dsl_tracker_kitti_output_mode_get(trackerName.c_str(), 
+                    &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_SOURCE_FILES );
+                REQUIRE( maxFileSize == 1000000 );
+                REQUIRE( dsl_tracker_kitti_output_enabled_set(trackerName.c_str(), false, L"") == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid Kitti output mode is set" )
+        {
+            REQUIRE( dsl_tracker_kitti_output_mode_set(trackerName.c_str(), 
+                DSL_KITTI_OUTPUT_MODE_SOURCE_FILES+1, 0) == DSL_RESULT_TRACKER_SET_FAILED );
+
+            THEN( "The mode is unchanged" )
+            {
+                REQUIRE( dsl_tracker_kitti_output_mode_get(trackerName.c_str(), 
+                    &mode, &maxFileSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_KITTI_OUTPUT_MODE_FRAME_FILES );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
@@ -32,6 +32,16 @@ print(dsl_component_delete("uri-source"))
 #print(dsl_source_rtsp_new("rtsp-source", "???????", DSL_RTP_ALL, 0, 0, 0))
 #print(dsl_component_delete("rtsp-source"))
 
+##
+## dsl_source_replay_scenario_new()
+## dsl_source_replay_batches_get()
+##
+print("dsl_source_replay_scenario_new")
+print("dsl_source_replay_batches_get")
+print(dsl_source_replay_scenario_new("replay-source", 4, 20, 4, 1000, False))
+print(dsl_source_replay_batches_get("replay-source"))
+print(dsl_component_delete("replay-source"))
+
 ##
 ## dsl_source_dimensions_get()
 ##
@@ -151,6 +161,17 @@ print(dsl_gie_primary_kitti_output_enabled_set("primary-gie", True, "./"))
 print(dsl_gie_primary_kitti_output_enabled_set("primary-gie", False, ""))
 print(dsl_component_delete("primary-gie"))
 
+##
+## dsl_gie_primary_kitti_output_mode_get()
+## dsl_gie_primary_kitti_output_mode_set()
+##
+print("dsl_gie_primary_kitti_output_mode_set")
+print(dsl_gie_primary_new("primary-gie", "./test/configs/config_infer_primary_nano.txt", 
+    "./test/models/Primary_Detector_Nano/resnet10.caffemodel", 0))
+print(dsl_gie_primary_kitti_output_mode_set("primary-gie", DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 1000000))
+print(dsl_gie_primary_kitti_output_mode_get("primary-gie"))
+print(dsl_component_delete("primary-gie"))
+
 ##
 ## dsl_gie_secondary_new()
 ##
@@ -217,6 +238,46 @@ print(dsl_tracker_kitti_output_enabled_set("ktl-tracker", True, "./"))
 print(dsl_tracker_kitti_output_enabled_set("ktl-tracker", False, ""))
 print(dsl_component_delete("ktl-tracker"))
 
+##
+## dsl_tracker_kitti_output_mode_get()
+## dsl_tracker_kitti_output_mode_set()
+##
+print("dsl_tracker_kitti_output_mode_set")
+print(dsl_tracker_ktl_new("ktl-tracker", 300, 150))
+print(dsl_tracker_kitti_output_mode_set("ktl-tracker", DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 1000000))
+print(dsl_tracker_kitti_output_mode_get("ktl-tracker"))
+print(dsl_component_delete("ktl-tracker"))
+
+##
+## dsl_meta_recorder_new()
+## dsl_meta_recorder_metrics_get()
+##
+print("dsl_meta_recorder_new")
+print("dsl_meta_recorder_metrics_get")
+print(dsl_meta_recorder_new("meta-recorder", "./recording.dslm", 100))
+print(dsl_meta_recorder_metrics_get("meta-recorder"))
+print(dsl_component_delete("meta-recorder"))
+
+##
+## dsl_meta_recording_open()
+## dsl_meta_recording_frame_next()
+## dsl_meta_recording_close()
+##
+print("dsl_meta_recording_open")
+print("dsl_meta_recording_frame_next")
+print("dsl_meta_recording_close")
+print(dsl_meta_recording_open("recording", "./recording.dslm"))
+print(dsl_meta_recording_frame_next("recording"))
+print(dsl_meta_recording_close("recording"))
+print(dsl_meta_recording_close_all())
+
+##
+## dsl_source_replay_new()
+##
+print("dsl_source_replay_new")
+print(dsl_source_replay_new("replay-source", "./recording.dslm", False))
+print(dsl_component_delete("replay-source"))
+
 ##
 ## dsl_osd_new()
 ##
@@ -625,6 +686,32 @@ print(dsl_pipeline_new("pipeline"))
 print(dsl_pipeline_xwindow_delete_event_handler_add("pipeline", delete_handler, None))
 print(dsl_pipeline_xwindow_delete_event_handler_remove("pipeline", delete_handler))
 
+##
+## dsl_pipeline_latency_tracing_enabled_get()
+## dsl_pipeline_latency_tracing_enabled_set()
+## dsl_pipeline_latency_stats_get()
+## dsl_pipeline_latency_stats_reset()
+## dsl_pipeline_latency_stats_handler_add()
+## dsl_pipeline_latency_stats_handler_remove()
+##
+print("dsl_pipeline_latency_tracing_enabled_get")
+print("dsl_pipeline_latency_tracing_enabled_set")
+print("dsl_pipeline_latency_stats_get")
+print("dsl_pipeline_latency_stats_reset")
+print("dsl_pipeline_latency_stats_handler_add")
+print("dsl_pipeline_latency_stats_handler_remove")
+def latency_stats_handler(stats, user_data):
+    for component_stats in stats:
+        print(component_stats.component, component_stats.p99_ns)
+print(dsl_pipeline_new("latency-pipeline"))
+print(dsl_pipeline_latency_tracing_enabled_set("latency-pipeline", True))
+print(dsl_pipeline_latency_tracing_enabled_get("latency-pipeline"))
+print(dsl_pipeline_latency_stats_get("latency-pipeline", None))
+print(dsl_pipeline_latency_stats_reset("latency-pipeline"))
+print(dsl_pipeline_latency_stats_handler_add("latency-pipeline", latency_stats_handler, 1000, None))
+print(dsl_pipeline_latency_stats_handler_remove("latency-pipeline", latency_stats_handler))
+print(dsl_pipeline_delete("latency-pipeline"))
+
 ##
 ## dsl_main_loop_run()
 ## dsl_main_loop_quit()
@@ -0,0 +1,374 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+/**
+ * ODE micro-benchmark. Drives OdeHandlerBintr::HandlePadBuffer directly with
+ * synthetic batches built in host memory - no GPU or Pipeline is required - and
+ * reports the time per batch, frame, and Object for each Trigger type, with and 
+ * without Areas and Actions, as JSON. Build and run with "make bench", passing 
+ * options with BENCH_ARGS, e.g. make bench BENCH_ARGS="--sources=8 --output=bench.json"
+ */
+
+#include <getopt.h>
+#include "DslServices.h"
+#include "DslOdeHandlerBintr.h"
+#include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
+#include "DslOdeArea.h"
+#include "DslOdeLine.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+/**
+ * @brief number of distinct batches built and handled in turn
+ */
+#define DSL_BENCH_BATCH_RING_SIZE 32
+
+/**
+ * @struct BenchOptions
+ * @brief command line options
+ */
+struct BenchOptions
+{
+    TestBatchMetaParams params;
+    uint batches;
+    uint workers;
+    std::string outputPath;
+};
+
+/**
+ * @struct BenchResult
+ * @brief timing for one Trigger type and configuration
+ */
+struct BenchResult
+{
+    std::string trigger;
+    bool areas;
+    bool actions;
+    double nsPerBatch;
+    double nsPerFrame;
+    double nsPerObject;
+};
+
+static void bench_occurrence_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    (*(uint64_t*)client_data)++;
+}
+
+static boolean bench_check_for_occurrence_cb(void* buffer,
+    void* frame_meta, void* object_meta, void* client_data)
+{
+    return true;
+}
+
+static DSL_ODE_TRIGGER_PTR bench_trigger_new(const std::string& type)
+{
+    const char* name = type.c_str();
+    uint classId(DSL_ODE_ANY_CLASS);
+    
+    if (type == "occurrence")
+    {
+        return DSL_ODE_TRIGGER_OCCURRENCE_NEW(name, classId, 0);
+    }
+    if (type == "absence")
+    {
+        return DSL_ODE_TRIGGER_ABSENCE_NEW(name, classId, 0);
+    }
+    if (type == "summation")
+    {
+        return DSL_ODE_TRIGGER_SUMMATION_NEW(name, classId, 0);
+    }
+    if (type == "intersection")
+    {
+        return DSL_ODE_TRIGGER_INTERSECTION_NEW(name, classId, 0);
+    }
+    if (type == "minimum")
+    {
+        return DSL_ODE_TRIGGER_MINIMUM_NEW(name, classId, 0, 10);
+    }
+    if (type == "maximum")
+    {
+        return DSL_ODE_TRIGGER_MAXIMUM_NEW(name, classId, 0, 10);
+    }
+    if (type == "range")
+    {
+        return DSL_ODE_TRIGGER_RANGE_NEW(name, classId, 0, 5, 15);
+    }
+    if (type == "window")
+    {
+        // average count over 1 second, in 100 ms buckets
+        return DSL_ODE_TRIGGER_WINDOW_NEW(name, classId, 0, DSL_ODE_WINDOW_AGGREGATE_AVERAGE, 
+            DSL_ODE_WINDOW_CROSSING_ABOVE, 10, 1000, 100);
+    }
+    // Tracks are lost after 2 frames. Use --turnover to add new and lost tracks
+    if (type == "new-track")
+    {
+        return DSL_ODE_TRIGGER_NEW_TRACK_NEW(name, classId, 0, 2);
+    }
+    if (type == "lost-track")
+    {
+        return DSL_ODE_TRIGGER_LOST_TRACK_NEW(name, classId, 0, 2);
+    }
+    if (type == "dwell")
+    {
+        return DSL_ODE_TRIGGER_DWELL_NEW(name, classId, 0, 1000, 2);
+    }
+    if (type == "line-crossing")
+    {
+        // 2 Lines, crossing at the center of the frame
+        DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = DSL_ODE_TRIGGER_LINE_CROSSING_NEW(
+            name, classId, 0, DSL_ODE_LINE_DIRECTION_ANY, DSL_ODE_LINE_POINT_BOTTOM_CENTER, 2);
+        pOdeTrigger->AddLine(DSL_ODE_LINE_NEW("line-0", 960, 0, 960, 1080, false));
+        pOdeTrigger->AddLine(DSL_ODE_LINE_NEW("line-1", 0, 540, 1920, 540, false));
+        return pOdeTrigger;
+    }
+    if (type == "custom")
+    {
+        return DSL_ODE_TRIGGER_CUSTOM_NEW(name, classId, 0, 
+            bench_check_for_occurrence_cb, NULL);
+    }
+    return nullptr;
+}
+
+static BenchResult bench_run(const BenchOptions& options, 
+    const std::vector<GstBuffer*>& buffers, const std::string& type, 
+    bool areas, bool actions)
+{
+    DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+    pOdeHandlerBintr->SetWorkerCount(options.workers);
+    
+    DSL_ODE_TRIGGER_PTR pOdeTrigger = bench_trigger_new(type);
+    
+    // 4 Areas, one centered in each quarter of the frame
+    if (areas)
+    {
+        for (uint i = 0; i < 4; i++)
+        {
+            std::string name = "area-" + std::to_string(i);
+            pOdeTrigger->AddArea(DSL_ODE_AREA_NEW(name.c_str(), 
+                (i%2)*960 + 240, (i/2)*540 + 135, 480, 270, false));
+        }
+    }
+    uint64_t occurrences(0);
+    if (actions)
+    {
+        pOdeTrigger->AddAction(DSL_ODE_ACTION_CALLBACK_NEW("callback", 
+            bench_occurrence_cb, &occurrences));
+    }
+    pOdeHandlerBintr->AddChild(pOdeTrigger);
+    
+    // warm up the Handler's and Trigger's reserved state first
+    for (auto pBuffer: buffers)
+    {
+        pOdeHandlerBintr->HandlePadBuffer(pBuffer);
+    }
+    
+    uint64_t startTimeNs = OdeMetricsTimeNs();
+    for (uint i = 0; i < options.batches; i++)
+    {
+        pOdeHandlerBintr->HandlePadBuffer(buffers[i % buffers.size()]);
+    }
+    double elapsedNs = OdeMetricsTimeNs() - startTimeNs;
+    
+    BenchResult result;
+    result.trigger = type;
+    result.areas = areas;
+    result.actions = actions;
+    result.nsPerBatch = elapsedNs / options.batches;
+    result.nsPerFrame = result.nsPerBatch / options.params.sourceCount;
+    result.nsPerObject = result.nsPerFrame / 
+        std::max(options.params.objectsPerFrame, 1u);
+    return result;
+}
+
+static void bench_write_json(std::ostream& out, const BenchOptions& options,
+    const std::vector<BenchResult>& results)
+{
+    out << "{\n";
+    out << "  \"params\": {\n";
+    out << "    \"sources\": " << options.params.sourceCount << ",\n";
+    out << "    \"objects_per_frame\": " << options.params.objectsPerFrame << ",\n";
+    out << "    \"class_weights\": [";
+    for (uint i = 0; i < options.params.classWeights.size(); i++)
+    {
+        out << ((i) ? ", " : "") << options.params.classWeights[i];
+    }
+    out << "],\n";
+    out << "    \"min_bbox_size\": " << options.params.minBboxSize << ",\n";
+    out << "    \"max_bbox_size\": " << options.params.maxBboxSize << ",\n";
+    out << "    \"turnover\": " << options.params.turnover << ",\n";
+    out << "    \"seed\": " << options.params.seed << ",\n";
+    out << "    \"batches\": " << options.batches << ",\n";
+    out << "    \"workers\": " << options.workers << "\n";
+    out << "  },\n";
+    out << "  \"results\": [\n";
+    for (uint i = 0; i < results.size(); i++)
+    {
+        const BenchResult& result = results[i];
+        out << "    {\"trigger\": \"" << result.trigger << "\""
+            << ", \"areas\": " << (result.areas ? "true" : "false")
+            << ", \"actions\": " << (result.actions ? "true" : "false")
+            << ", \"ns_per_batch\": " << (uint64_t)result.nsPerBatch
+            << ", \"ns_per_frame\": " << (uint64_t)result.nsPerFrame
+            << ", \"ns_per_object\": " << result.nsPerObject
+            << "}" << ((i+1 < results.size()) ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+static void bench_usage(const char* app, const std::vector<std::string>& types)
+{
+    std::cerr << "usage: " << app << " [options]\n"
+        << "  --sources=N         frames per batch (default 4)\n"
+        << "  --objects=N         Objects per frame (default 20)\n"
+        << "  --classes=W,W,...   relative weight of each Class Id (default 1,1,1,1)\n"
+        << "  --min-size=N        minimum bounding box width and height (default 20)\n"
+        << "  --max-size=N        maximum bounding box width and height (default 200)\n"
+        << "  --turnover=P        per-frame probability of a new track (default 0)\n"
+        << "  --seed=N            random seed (default 1)\n"
+        << "  --batches=N         batches handled per measurement (default 1000)\n"
+        << "  --workers=N         ODE Handler worker count (default 1)\n"
+        << "  --trigger=TYPE      measure one Trigger type only, one of:\n"
+        << "                     ";
+    for (const auto& type: types)
+    {
+        std::cerr << " " << type;
+    }
+    std::cerr << "\n"
+        << "  --output=PATH       write the JSON results to file (default stdout)\n";
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    options.params = TestBatchMetaParamsDefault();
+    options.batches = 1000;
+    options.workers = 1;
+    
+    const std::vector<std::string> allTypes = {"occurrence", "absence", "summation", 
+        "intersection", "minimum", "maximum", "range", "window", 
+        "new-track", "lost-track", "dwell", "line-crossing", "custom"};
+    std::vector<std::string> types(allTypes);
+    
+    static struct option longOptions[] = 
+    {
+        {"sources", required_argument, 0, 's'},
+        {"objects", required_argument, 0, 'o'},
+        {"classes", required_argument, 0, 'c'},
+        {"min-size", required_argument, 0, 'm'},
+        {"max-size", required_argument, 0, 'M'},
+        {"turnover", required_argument, 0, 'T'},
+        {"seed", required_argument, 0, 'r'},
+        {"batches", required_argument, 0, 'b'},
+        {"workers", required_argument, 0, 'w'},
+        {"trigger", required_argument, 0, 't'},
+        {"output", required_argument, 0, 'f'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", longOptions, NULL)) != -1)
+    {
+        switch (opt)
+        {
+        case 's': options.params.sourceCount = std::max(atoi(optarg), 1); break;
+        case 'o': options.params.objectsPerFrame = std::max(atoi(optarg), 0); break;
+        case 'm': options.params.minBboxSize = atof(optarg); break;
+        case 'M': options.params.maxBboxSize = atof(optarg); break;
+        case 'T': options.params.turnover = atof(optarg); break;
+        case 'r': options.params.seed = atoi(optarg); break;
+        case 'b': options.batches = std::max(atoi(optarg), 1); break;
+        case 'w': options.workers = std::max(atoi(optarg), 1); break;
+        case 't': types = {optarg}; break;
+        case 'f': options.outputPath = optarg; break;
+        case 'c':
+            {
+                options.params.classWeights.clear();
+                std::stringstream weights(optarg);
+                std::string weight;
+                while (std::getline(weights, weight, ','))
+                {
+                    options.params.classWeights.push_back(atof(weight.c_str()));
+                }
+            }
+            break;
+        default:
+            bench_usage(argv[0], allTypes);
+            return (opt == 'h') ? 0 : 1;
+        }
+    }
+    for (const auto& type: types)
+    {
+        if (std::find(allTypes.begin(), allTypes.end(), type) == allTypes.end())
+        {
+            std::cerr << "unknown Trigger type '" << type << "'\n";
+            bench_usage(argv[0], allTypes);
+            return 1;
+        }
+    }
+    if (options.params.maxBboxSize < options.params.minBboxSize or 
+        options.params.classWeights.empty())
+    {
+        bench_usage(argv[0], allTypes);
+        return 1;
+    }
+    
+    // Initializes GStreamer and the DSL logging category
+    Services::GetServices();
+    
+    TestBatchMetaGenerator generator(options.params);
+    std::vector<GstBuffer*> buffers;
+    for (uint i = 0; i < DSL_BENCH_BATCH_RING_SIZE; i++)
+    {
+        buffers.push_back(generator.Next());
+    }
+    
+    std::vector<BenchResult> results;
+    for (const auto& type: types)
+    {
+        for (uint config = 0; config < 4; config++)
+        {
+            results.push_back(bench_run(options, buffers, type, config & 1, config & 2));
+        }
+    }
+    for (auto pBuffer: buffers)
+    {
+        gst_buffer_unref(pBuffer);
+    }
+    
+    if (options.outputPath.size())
+    {
+        std::ofstream out(options.outputPath);
+        bench_write_json(out, options, results);
+    }
+    else
+    {
+        bench_write_json(std::cout, options, results);
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslCaptureService.h"
+
+using namespace DSL;
+
+/**
+ * Creates a synthetic RGBA frame in host memory, with padding at the end
+ * of each row to exercise the pitch handling.
+ */
+static std::vector<uint8_t> synthetic_rgba_frame(uint width, uint height, uint pitch)
+{
+    std::vector<uint8_t> frame(pitch*height, 0);
+    for (uint row = 0; row < height; row++)
+    {
+        for (uint col = 0; col < width; col++)
+        {
+            uint8_t* pPixel = &frame[row*pitch + col*4];
+            pPixel[0] = (uint8_t)(col*255/width);
+            pPixel[1] = (uint8_t)(row*255/height);
+            pPixel[2] = 128;
+            pPixel[3] = 255;
+        }
+    }
+    return frame;
+}
+
+static void capture_service_wait_for_empty_queue(CaptureService* pService)
+{
+    uint queueDepth(1);
+    uint64_t encoded(0), dropped(0), averageLatency(0), maxLatency(0);
+    
+    for (uint i = 0; i < 5000 and queueDepth; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        pService->GetMetrics(&queueDepth, &encoded, &dropped, &averageLatency, &maxLatency);
+    }
+}
+
+static bool capture_file_exists_and_remove(const std::string& filespec)
+{
+    bool exists = std::ifstream(filespec.c_str()).good();
+    std::remove(filespec.c_str());
+    return exists;
+}
+
+SCENARIO( "The Capture Service encodes and writes synthetic frames", "[CaptureService]" )
+{
+    GIVEN( "A synthetic RGBA frame in host memory" ) 
+    {
+        uint width(64), height(48), pitch(64*4+32);
+        std::vector<uint8_t> frame = synthetic_rgba_frame(width, height, pitch);
+        
+        CaptureService* pService = CaptureService::GetService();
+        capture_service_wait_for_empty_queue(pService);
+        pService->ResetMetrics();
+
+        WHEN( "The frame is submitted as JPEG and PNG" )
+        {
+            std::string jpegFilespec("./capture-service-test.jpeg");
+            std::string pngFilespec("./capture-service-test.png");
+            
+            REQUIRE( pService->SubmitImage(frame.data(), width, height, pitch, jpegFilespec) == true );
+            REQUIRE( pService->SubmitImage(frame.data(), width, height, pitch, pngFilespec) == true );
+            
+            capture_service_wait_for_empty_queue(pService);
+            
+            THEN( "Both files are written and the metrics are updated" )
+            {
+                uint queueDepth(99);
+                uint64_t encoded(0), dropped(99), averageLatency(0), maxLatency(0);
+                pService->GetMetrics(&queueDepth, &encoded, &dropped, &averageLatency, &maxLatency);
+                
+                REQUIRE( queueDepth == 0 );
+                REQUIRE( encoded == 2 );
+                REQUIRE( dropped == 0 );
+                REQUIRE( maxLatency >= averageLatency );
+                
+                REQUIRE( capture_file_exists_and_remove(jpegFilespec) == true );
+                REQUIRE( capture_file_exists_and_remove(pngFilespec) == true );
+            }
+        }
+        WHEN( "The frame is submitted to a directory that does not exist" )
+        {
+            std::string filespec("./capture-service-test-bad-dir/frame.jpeg");
+            
+            REQUIRE( pService->SubmitImage(frame.data(), width, height, pitch, filespec) == true );
+            
+            capture_service_wait_for_empty_queue(pService);
+            
+            THEN( "The failed write is counted as dropped" )
+            {
+                uint queueDepth(99);
+                uint64_t encoded(99), dropped(0), averageLatency(0), maxLatency(0);
+                pService->GetMetrics(&queueDepth, &encoded, &dropped, &averageLatency, &maxLatency);
+                
+                REQUIRE( encoded == 0 );
+                REQUIRE( dropped == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Capture Service drops frames when all image records are in use", "[CaptureService]" )
+{
+    GIVEN( "A large synthetic RGBA frame in host memory" ) 
+    {
+        uint width(1920), height(1080), pitch(1920*4);
+        std::vector<uint8_t> frame = synthetic_rgba_frame(width, height, pitch);
+        
+        CaptureService* pService = CaptureService::GetService();
+        capture_service_wait_for_empty_queue(pService);
+        pService->ResetMetrics();
+
+        WHEN( "More frames are submitted than there are image records" )
+        {
+            uint submitted(DSL_CAPTURE_SERVICE_POOL_SIZE*4);
+            uint queued(0);
+            
+            for (uint i = 0; i < submitted; i++)
+            {
+                std::string filespec = "./capture-service-test-" + std::to_string(i) + ".jpeg";
+                if (pService->SubmitImage(frame.data(), width, height, pitch, filespec))
+                {
+                    queued++;
+                }
+            }
+            capture_service_wait_for_empty_queue(pService);
+            
+            THEN( "Every submission is either encoded or counted as dropped" )
+            {
+                uint queueDepth(99);
+                uint64_t encoded(0), dropped(0), averageLatency(0), maxLatency(0);
+                pService->GetMetrics(&queueDepth, &encoded, &dropped, &averageLatency, &maxLatency);
+                
+                REQUIRE( queueDepth == 0 );
+                REQUIRE( encoded == queued );
+                REQUIRE( encoded + dropped == submitted );
+                
+                for (uint i = 0; i < submitted; i++)
+                {
+                    std::string filespec = "./capture-service-test-" + std::to_string(i) + ".jpeg";
+                    std::remove(filespec.c_str());
+                }
+            }
+        }
+    }
+}
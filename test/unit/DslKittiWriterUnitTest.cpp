@@ -0,0 +1,412 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslKittiWriter.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+static const std::string kittiOutputDir("./test-kitti-output");
+
+/**
+ * Reads all lines of a text file, returns false if the file can't be opened.
+ */
+static bool read_kitti_lines(const std::string& filePath, std::vector<std::string>& lines)
+{
+    std::ifstream kittiFile(filePath);
+    if (!kittiFile.is_open())
+    {
+        return false;
+    }
+    std::string line;
+    while (std::getline(kittiFile, line))
+    {
+        lines.push_back(line);
+    }
+    return true;
+}
+
+/**
+ * Gets the size of a file in bytes, or -1 if the file does not exist.
+ */
+static int64_t kitti_file_size(const std::string& filePath)
+{
+    struct stat info;
+    return (stat(filePath.c_str(), &info) == 0) ? info.st_size : -1;
+}
+
+SCENARIO( "A KittiWriter formats Objects in the KITTI format", "[KittiWriter]" )
+{
+    GIVEN( "An Object with a label, tracking id and bounding box" )
+    {
+        NvDsObjectMeta objectMeta{0};
+        strcpy(objectMeta.obj_label, "Person");
+        objectMeta.class_id = 2;
+        objectMeta.object_id = 7;
+        objectMeta.confidence = 0.75;
+        objectMeta.rect_params.left = 10.5;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 100;
+        objectMeta.rect_params.height = 200.25;
+        
+        char text[DSL_KITTI_WRITER_MAX_LINE_SIZE];
+
+        WHEN( "The Object is formatted for detection" )
+        {
+            size_t size = KittiWriter::FormatObject(text, &objectMeta, false, 123);
+            
+            THEN( "The line has the label, bounding box, and score" )
+            {
+                REQUIRE( std::string(text, size) == 
+                    "Person 0.00 0 0.00 10.50 20.00 110.50 220.25 "
+                    "0.00 0.00 0.00 0.00 0.00 0.00 0.00 0.750000\n" );
+            }
+        }
+        WHEN( "The Object is formatted for tracking" )
+        {
+            size_t size = KittiWriter::FormatObject(text, &objectMeta, true, 123);
+            
+            THEN( "The line is led by the frame number and tracking id" )
+            {
+                REQUIRE( std::string(text, size) == 
+                    "123 7 Person 0.00 0 0.00 10.50 20.00 110.50 220.25 "
+                    "0.00 0.00 0.00 0.00 0.00 0.00 0.00 0.750000\n" );
+            }
+        }
+        WHEN( "The Object is untracked, and its label is empty" )
+        {
+            objectMeta.object_id = UNTRACKED_OBJECT_ID;
+            objectMeta.obj_label[0] = 0;
+            size_t size = KittiWriter::FormatObject(text, &objectMeta, true, 0);
+            
+            THEN( "The tracking id is -1 and the label is the class id" )
+            {
+                REQUIRE( std::string(text, size).find("0 -1 2 0.00 0 0.00 10.50") == 0 );
+            }
+        }
+        WHEN( "The Object's label has spaces and is longer than the maximum" )
+        {
+            std::string label(DSL_KITTI_WRITER_MAX_LABEL_SIZE+10, 'x');
+            label[2] = ' ';
+            strcpy(objectMeta.obj_label, label.c_str());
+            size_t size = KittiWriter::FormatObject(text, &objectMeta, false, 0);
+            
+            THEN( "The spaces are replaced and the label is truncated" )
+            {
+                std::string line(text, size);
+                REQUIRE( line.find(' ') == DSL_KITTI_WRITER_MAX_LABEL_SIZE );
+                REQUIRE( line[2] == '_' );
+            }
+        }
+    }
+}
+
+SCENARIO( "A KittiWriter formats bounding boxes to within rounding of printf", "[KittiWriter]" )
+{
+    GIVEN( "A random set of bounding boxes" )
+    {
+        std::srand(4321);
+        NvDsObjectMeta objectMeta{0};
+        strcpy(objectMeta.obj_label, "car");
+        char text[DSL_KITTI_WRITER_MAX_LINE_SIZE];
+
+        WHEN( "Each box is formatted" )
+        {
+            THEN( "The parsed values match the Object's values" )
+            {
+                for (uint i = 0; i < 10000; i++)
+                {
+                    objectMeta.rect_params.left = (std::rand() % 400000) / 100.0f - 1000;
+                    objectMeta.rect_params.top = (std::rand() % 200000) / 137.0f;
+                    objectMeta.rect_params.width = (std::rand() % 100000) / 71.0f;
+                    objectMeta.rect_params.height = (std::rand() % 100000) / 33.0f;
+                    objectMeta.confidence = (std::rand() % 1000001) / 1000000.0f;
+                    
+                    size_t size = KittiWriter::FormatObject(text, &objectMeta, false, 0);
+                    text[size] = 0;
+                    
+                    char label[64];
+                    float left(0), top(0), right(0), bottom(0), score(0);
+                    REQUIRE( sscanf(text, "%s %*f %*d %*f %f %f %f %f %*f %*f %*f %*f %*f %*f %*f %f", 
+                        label, &left, &top, &right, &bottom, &score) == 6 );
+                        
+                    const NvOSD_RectParams& rect = objectMeta.rect_params;
+                    REQUIRE( std::fabs(left - rect.left) <= 0.0051 );
+                    REQUIRE( std::fabs(top - rect.top) <= 0.0051 );
+                    REQUIRE( std::fabs(right - (rect.left + rect.width)) <= 0.0051 );
+                    REQUIRE( std::fabs(bottom - (rect.top + rect.height)) <= 0.0051 );
+                    REQUIRE( std::fabs(score - objectMeta.confidence) <= 0.0000051 );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A KittiWriter writes a file for each frame", "[KittiWriter]" )
+{
+    GIVEN( "A KittiWriter in frame files mode and a set of batches" )
+    {
+        mkdir(kittiOutputDir.c_str(), 0755);
+        
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 3;
+        params.objectsPerFrame = 5;
+        TestBatchMetaGenerator generator(params);
+        uint batchCount(10);
+
+        WHEN( "The batches are written and the writer is destroyed" )
+        {
+            {
+                KittiWriter kittiWriter("test-writer", kittiOutputDir.c_str(), 
+                    DSL_KITTI_OUTPUT_MODE_FRAME_FILES, 0);
+                    
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = generator.Next();
+                    REQUIRE( kittiWriter.WriteBatch(gst_buffer_get_nvds_batch_meta(pBuffer)) == true );
+                    gst_buffer_unref(pBuffer);
+                }
+            }
+            THEN( "Each frame has its own file with a line per Object" )
+            {
+                for (uint source = 0; source < params.sourceCount; source++)
+                {
+                    for (uint frame = 0; frame < batchCount; frame++)
+                    {
+                        char filePath[256];
+                        snprintf(filePath, sizeof(filePath), "%s/%02u_%06u.txt",
+                            kittiOutputDir.c_str(), source, frame);
+                        
+                        std::vector<std::string> lines;
+                        REQUIRE( read_kitti_lines(filePath, lines) == true );
+                        REQUIRE( lines.size() == params.objectsPerFrame );
+                        REQUIRE( std::remove(filePath) == 0 );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A KittiWriter appends to a rotating file for each source", "[KittiWriter]" )
+{
+    GIVEN( "A KittiWriter in source files mode with a small maximum file size" )
+    {
+        mkdir(kittiOutputDir.c_str(), 0755);
+        
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 2;
+        params.objectsPerFrame = 10;
+        TestBatchMetaGenerator generator(params);
+        uint batchCount(100);
+        uint maxFileSize(16*1024);
+
+        WHEN( "The batches are written and the writer is destroyed" )
+        {
+            uint64_t written(0), dropped(0);
+            {
+                KittiWriter kittiWriter("test-writer", kittiOutputDir.c_str(), 
+                    DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, maxFileSize);
+                    
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = generator.Next();
+                    
+                    // the pool is small, so give the writer time to catch up if needed
+                    while (!kittiWriter.WriteBatch(gst_buffer_get_nvds_batch_meta(pBuffer)))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    gst_buffer_unref(pBuffer);
+                }
+                kittiWriter.GetMetrics(&written, &dropped);
+            }
+            THEN( "Each source's frames are split over files no larger than the maximum" )
+            {
+                for (uint source = 0; source < params.sourceCount; source++)
+                {
+                    std::vector<std::string> lines;
+                    uint fileCount(0);
+                    while (true)
+                    {
+                        std::string filePath = kittiOutputDir + "/0" + std::to_string(source) + ".txt";
+                        if (fileCount)
+                        {
+                            filePath += "." + std::to_string(fileCount);
+                        }
+                        int64_t fileSize = kitti_file_size(filePath);
+                        if (fileSize < 0)
+                        {
+                            break;
+                        }
+                        REQUIRE( fileSize <= maxFileSize );
+                        REQUIRE( read_kitti_lines(filePath, lines) == true );
+                        REQUIRE( std::remove(filePath.c_str()) == 0 );
+                        fileCount++;
+                    }
+                    REQUIRE( fileCount > 1 );
+                    REQUIRE( lines.size() == batchCount*params.objectsPerFrame );
+                    
+                    // frame numbers are in order across all files
+                    for (uint i = 0; i < lines.size(); i++)
+                    {
+                        REQUIRE( std::stoul(lines[i]) == i / params.objectsPerFrame );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A new KittiWriter continues the rotating files of the previous KittiWriter", "[KittiWriter]" )
+{
+    GIVEN( "Two KittiWriters in turn, in source files mode for the same path" )
+    {
+        mkdir(kittiOutputDir.c_str(), 0755);
+        
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 1;
+        params.objectsPerFrame = 10;
+        TestBatchMetaGenerator generator(params);
+        uint batchCount(50);
+        uint maxFileSize(16*1024);
+
+        WHEN( "Each writer writes its batches and is destroyed" )
+        {
+            for (uint writer = 0; writer < 2; writer++)
+            {
+                KittiWriter kittiWriter("test-writer", kittiOutputDir.c_str(), 
+                    DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, maxFileSize);
+                    
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = generator.Next();
+                    while (!kittiWriter.WriteBatch(gst_buffer_get_nvds_batch_meta(pBuffer)))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    gst_buffer_unref(pBuffer);
+                }
+            }
+            THEN( "The frames of both writers are kept, in order, in files no larger than the maximum" )
+            {
+                std::vector<std::string> lines;
+                uint fileCount(0);
+                while (true)
+                {
+                    std::string filePath = kittiOutputDir + "/00.txt";
+                    if (fileCount)
+                    {
+                        filePath += "." + std::to_string(fileCount);
+                    }
+                    int64_t fileSize = kitti_file_size(filePath);
+                    if (fileSize < 0)
+                    {
+                        break;
+                    }
+                    REQUIRE( fileSize <= maxFileSize );
+                    REQUIRE( read_kitti_lines(filePath, lines) == true );
+                    REQUIRE( std::remove(filePath.c_str()) == 0 );
+                    fileCount++;
+                }
+                REQUIRE( lines.size() == 2*batchCount*params.objectsPerFrame );
+                
+                for (uint i = 0; i < lines.size(); i++)
+                {
+                    REQUIRE( std::stoul(lines[i]) == i / params.objectsPerFrame );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "Benchmark the KittiWriter at 30 streams with 50 Objects per frame", "[.][benchmark][KittiWriter]" )
+{
+    GIVEN( "A KittiWriter and a ring of 30 source batches" )
+    {
+        mkdir(kittiOutputDir.c_str(), 0755);
+        
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 30;
+        params.objectsPerFrame = 50;
+        TestBatchMetaGenerator generator(params);
+        
+        std::vector<GstBuffer*> buffers;
+        for (uint i = 0; i < 30; i++)
+        {
+            buffers.push_back(generator.Next());
+        }
+        
+        WHEN( "Four seconds of batches at 30 fps are written" )
+        {
+            uint64_t written(0), dropped(0);
+            double batchTime(0);
+            {
+                KittiWriter kittiWriter("test-writer", kittiOutputDir.c_str(), 
+                    DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 0);
+                    
+                // the first pass over the pool of text records grows each 
+                // record to the batch size, so only the later batches are timed.
+                uint warmupBatches(DSL_KITTI_WRITER_POOL_SIZE), timedBatches(0);
+                std::chrono::duration<double, std::micro> totalTime(0);
+                for (uint i = 0; i < 4*buffers.size(); i++)
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    kittiWriter.WriteBatch(gst_buffer_get_nvds_batch_meta(buffers[i % buffers.size()]));
+                    if (i >= warmupBatches)
+                    {
+                        totalTime += std::chrono::steady_clock::now() - start;
+                        timedBatches++;
+                    }
+                    // the batch period, less the time taken by the streaming thread 
+                    std::this_thread::sleep_for(std::chrono::microseconds(33333) 
+                        - (std::chrono::steady_clock::now() - start));
+                }
+                batchTime = totalTime.count()/timedBatches;
+                kittiWriter.GetMetrics(&written, &dropped);
+            }
+            THEN( "The streaming thread overhead is under 2% of the batch period" )
+            {
+                std::cout << "KITTI format and queue time per batch: " << batchTime 
+                    << " us, " << 100*batchTime/33333 << " % of the batch period" << std::endl;
+                    
+                REQUIRE( dropped == 0 );
+                REQUIRE( batchTime < 0.02*33333 );
+                
+                for (uint source = 0; source < params.sourceCount; source++)
+                {
+                    char filePath[256];
+                    snprintf(filePath, sizeof(filePath), "%s/%02u.txt", 
+                        kittiOutputDir.c_str(), source);
+                    std::remove(filePath);
+                }
+                for (auto const& pBuffer: buffers)
+                {
+                    gst_buffer_unref(pBuffer);
+                }
+            }
+        }
+    }
+}
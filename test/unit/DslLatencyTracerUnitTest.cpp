@@ -0,0 +1,345 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslLatencyTracer.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+static const uint64_t frameInterval(33333333);
+
+/**
+ * Creates an unbatched buffer, as output by a Source, with a given PTS.
+ */
+static GstBuffer* source_buffer_new(uint64_t pts)
+{
+    GstBuffer* pBuffer = gst_buffer_new();
+    GST_BUFFER_PTS(pBuffer) = pts;
+    return pBuffer;
+}
+
+/**
+ * Creates a batched buffer with one frame per source, all with a given PTS.
+ */
+static GstBuffer* batch_buffer_new(uint sourceCount, uint64_t pts)
+{
+    GstBuffer* pBuffer = TestBatchBufferNew(sourceCount);
+    for (uint source = 0; source < sourceCount; source++)
+    {
+        TestFrameMetaAdd(pBuffer, source, 0)->buf_pts = pts;
+    }
+    return pBuffer;
+}
+
+SCENARIO( "A LatencyHistogram reports percentiles to within 1/16th", "[LatencyTracer]" )
+{
+    GIVEN( "A new LatencyHistogram" )
+    {
+        LatencyHistogram histogram;
+        
+        REQUIRE( histogram.GetCount() == 0 );
+        REQUIRE( histogram.GetPercentile(50) == 0 );
+        
+        WHEN( "Latencies from 1 to 10000 microseconds are added" )
+        {
+            for (uint64_t latency = 1; latency <= 10000; latency++)
+            {
+                histogram.Add(latency*1000);
+            }
+            THEN( "The percentiles are within the bucket resolution" )
+            {
+                REQUIRE( histogram.GetCount() == 10000 );
+                REQUIRE( histogram.GetMax() == 10000000 );
+                REQUIRE( histogram.GetPercentile(50) >= 5000000 );
+                REQUIRE( histogram.GetPercentile(50) <= 5000000 + 5000000/16 );
+                REQUIRE( histogram.GetPercentile(90) >= 9000000 );
+                REQUIRE( histogram.GetPercentile(90) <= 9000000 + 9000000/16 );
+                REQUIRE( histogram.GetPercentile(99) >= 9900000 );
+                REQUIRE( histogram.GetPercentile(99) <= 10000000 );
+                REQUIRE( histogram.GetPercentile(100) == 10000000 );
+            }
+        }
+        WHEN( "The histogram is reset" )
+        {
+            histogram.Add(1000);
+            histogram.Reset();
+            
+            THEN( "All latencies are cleared" )
+            {
+                REQUIRE( histogram.GetCount() == 0 );
+                REQUIRE( histogram.GetMax() == 0 );
+                REQUIRE( histogram.GetPercentile(99) == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "Each LatencyHistogram bucket covers a contiguous range of latencies", "[LatencyTracer]" )
+{
+    GIVEN( "Latencies spread over the full range" )
+    {
+        std::vector<uint64_t> latencies;
+        for (uint64_t latency = 0; latency < 4096; latency++)
+        {
+            latencies.push_back(latency);
+        }
+        for (uint shift = 12; shift < 64; shift++)
+        {
+            latencies.push_back((1ULL << shift) - 1);
+            latencies.push_back(1ULL << shift);
+            latencies.push_back((1ULL << shift) + (1ULL << (shift-1)) + 1);
+        }
+        latencies.push_back(UINT64_MAX);
+        
+        WHEN( "Each latency is mapped to its bucket" )
+        {
+            THEN( "The latency falls within the bucket's bounds" )
+            {
+                for (auto latency: latencies)
+                {
+                    uint index = LatencyHistogram::BucketIndex(latency);
+                    
+                    REQUIRE( index < DSL_LATENCY_HISTOGRAM_BUCKETS );
+                    REQUIRE( latency <= LatencyHistogram::BucketUpperBound(index) );
+                    if (index)
+                    {
+                        REQUIRE( latency > LatencyHistogram::BucketUpperBound(index-1) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyTracePoint drops timestamps while its ring is full", "[LatencyTracer]" )
+{
+    GIVEN( "A new batched LatencyTracePoint" )
+    {
+        DSL_LATENCY_TRACE_POINT_PTR pPoint = DSL_LATENCY_TRACE_POINT_NEW(-1);
+        GstBuffer* pBuffer = batch_buffer_new(4, 0);
+        
+        WHEN( "More frames are recorded than the ring can hold" )
+        {
+            for (uint i = 0; i < DSL_LATENCY_TRACER_RING_SIZE/4 + 2; i++)
+            {
+                pPoint->Record(pBuffer, i);
+            }
+            THEN( "The extra frames are dropped and the rest drained in order" )
+            {
+                REQUIRE( pPoint->m_dropped == 8 );
+                REQUIRE( pPoint->Drain() == DSL_LATENCY_TRACER_RING_SIZE );
+                REQUIRE( pPoint->m_drained[0].sourceId == 0 );
+                REQUIRE( pPoint->m_drained[3].sourceId == 3 );
+                REQUIRE( pPoint->m_drained[4].timeNs == 1 );
+                REQUIRE( pPoint->Drain() == 0 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "A LatencyTracer matches frames from their entry to their exit points", "[LatencyTracer]" )
+{
+    GIVEN( "A LatencyTracer with two Sources, a batched component, and end-to-end" )
+    {
+        LatencyTracer tracer("pipeline");
+        
+        DSL_LATENCY_TRACE_POINT_PTR pSource0 = tracer.AddPoint(NULL, 0);
+        DSL_LATENCY_TRACE_POINT_PTR pSource1 = tracer.AddPoint(NULL, 1);
+        DSL_LATENCY_TRACE_POINT_PTR pMuxSrc = tracer.AddPoint(NULL, -1);
+        DSL_LATENCY_TRACE_POINT_PTR pGieSink = tracer.AddPoint(NULL, -1);
+        DSL_LATENCY_TRACE_POINT_PTR pGieSrc = tracer.AddPoint(NULL, -1);
+        DSL_LATENCY_TRACE_POINT_PTR pSinksSink = tracer.AddPoint(NULL, -1);
+        
+        tracer.AddStage("sources-bin", {pSource0, pSource1}, {pMuxSrc});
+        tracer.AddStage("primary-gie", {pGieSink}, {pGieSrc});
+        tracer.AddStage("", {pSource0, pSource1}, {pSinksSink});
+        
+        WHEN( "100 batches are recorded with fixed delays between points" )
+        {
+            uint64_t startTime = LatencyTracerTimeNs();
+            
+            for (uint i = 0; i < 100; i++)
+            {
+                uint64_t pts = i*frameInterval;
+                uint64_t sourceTime = startTime + pts;
+                
+                // source 1 is a millisecond behind source 0
+                GstBuffer* pBuffer = source_buffer_new(pts);
+                pSource0->Record(pBuffer, sourceTime);
+                pSource1->Record(pBuffer, sourceTime + 1000000);
+                gst_buffer_unref(pBuffer);
+                
+                pBuffer = batch_buffer_new(2, pts);
+                pMuxSrc->Record(pBuffer, sourceTime + 2000000);
+                pGieSink->Record(pBuffer, sourceTime + 2000000);
+                pGieSrc->Record(pBuffer, sourceTime + 7000000);
+                pSinksSink->Record(pBuffer, sourceTime + 9000000);
+                gst_buffer_unref(pBuffer);
+            }
+            tracer.Poll(LatencyTracerTimeNs());
+            
+            THEN( "Each stage reports the delay from its entry to its exit" )
+            {
+                dsl_latency_stats stats{0};
+                
+                REQUIRE( tracer.GetStats("sources-bin", &stats) == true );
+                REQUIRE( stats.count == 200 );
+                REQUIRE( stats.dropped == 0 );
+                REQUIRE( stats.max_ns == 2000000 );
+                REQUIRE( stats.p50_ns >= 1000000 );
+                REQUIRE( stats.p50_ns <= 1000000 + 1000000/16 );
+
+                REQUIRE( tracer.GetStats("primary-gie", &stats) == true );
+                REQUIRE( stats.count == 200 );
+                REQUIRE( stats.p50_ns == 5000000 );
+                REQUIRE( stats.p99_ns == 5000000 );
+                REQUIRE( stats.max_ns == 5000000 );
+
+                REQUIRE( tracer.GetStats("", &stats) == true );
+                REQUIRE( stats.count == 200 );
+                REQUIRE( stats.p90_ns == 9000000 );
+                REQUIRE( stats.max_ns == 9000000 );
+                
+                REQUIRE( tracer.GetStats("tiler", &stats) == false );
+            }
+        }
+        WHEN( "A frame never leaves a stage" )
+        {
+            uint64_t staleTime = LatencyTracerTimeNs() - 2*DSL_LATENCY_TRACER_PENDING_TIMEOUT;
+            
+            GstBuffer* pBuffer = batch_buffer_new(1, 0);
+            pGieSink->Record(pBuffer, staleTime);
+            tracer.Poll(LatencyTracerTimeNs());
+            
+            pGieSrc->Record(pBuffer, LatencyTracerTimeNs());
+            tracer.Poll(LatencyTracerTimeNs());
+            gst_buffer_unref(pBuffer);
+            
+            THEN( "The frame is forgotten once the pending timeout expires" )
+            {
+                dsl_latency_stats stats{0};
+                
+                REQUIRE( tracer.GetStats("primary-gie", &stats) == true );
+                REQUIRE( stats.count == 0 );
+            }
+        }
+        WHEN( "The stats are reset and all points removed" )
+        {
+            GstBuffer* pBuffer = batch_buffer_new(1, 0);
+            pGieSink->Record(pBuffer, LatencyTracerTimeNs());
+            pGieSrc->Record(pBuffer, LatencyTracerTimeNs());
+            tracer.Poll(LatencyTracerTimeNs());
+            
+            dsl_latency_stats stats{0};
+            REQUIRE( tracer.GetStats("primary-gie", &stats) == true );
+            REQUIRE( stats.count == 1 );
+
+            tracer.ResetStats();
+            REQUIRE( tracer.GetStats("primary-gie", &stats) == true );
+            REQUIRE( stats.count == 0 );
+            
+            pGieSink->Record(pBuffer, LatencyTracerTimeNs());
+            pGieSrc->Record(pBuffer, LatencyTracerTimeNs());
+            gst_buffer_unref(pBuffer);
+            tracer.RemoveAll();
+            
+            THEN( "Frames recorded before the removal are kept until new stages are added" )
+            {
+                REQUIRE( tracer.GetStats("primary-gie", &stats) == true );
+                REQUIRE( stats.count == 1 );
+                
+                tracer.AddStage("tiler", {}, {});
+                REQUIRE( tracer.GetStats("primary-gie", &stats) == false );
+                REQUIRE( tracer.GetStats("tiler", &stats) == true );
+            }
+        }
+    }
+}
+
+static void latency_stats_counter_cb(const dsl_latency_stats* stats, 
+    uint count, void* client_data)
+{
+    (*(std::atomic<uint>*)client_data)++;
+}
+
+SCENARIO( "A LatencyTracer can be deleted by a client thread while its stats handler is called", "[LatencyTracer]" )
+{
+    GIVEN( "A LatencyTracer with a stats handler called every millisecond" )
+    {
+        DSL_LATENCY_TRACER_PTR pTracer = DSL_LATENCY_TRACER_NEW("pipeline");
+        
+        DSL_LATENCY_TRACE_POINT_PTR pEntry = pTracer->AddPoint(NULL, -1);
+        DSL_LATENCY_TRACE_POINT_PTR pExit = pTracer->AddPoint(NULL, -1);
+        pTracer->AddStage("", {pEntry}, {pExit});
+        
+        std::atomic<uint> reports(0);
+        REQUIRE( pTracer->AddStatsHandler(latency_stats_counter_cb, 1, &reports) == true );
+        
+        WHEN( "A client thread deletes the LatencyTracer while the main context runs" )
+        {
+            std::atomic<bool> deleted(false);
+            std::thread client([&]
+            {
+                while (reports < 10)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                pTracer = nullptr;
+                deleted = true;
+            });
+            while (!deleted)
+            {
+                g_main_context_iteration(NULL, FALSE);
+            }
+            client.join();
+            uint reportsOnDelete = reports;
+            
+            THEN( "The handler is no longer called once the LatencyTracer is deleted" )
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                while (g_main_context_iteration(NULL, FALSE));
+                REQUIRE( reports == reportsOnDelete );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyTracePoint records a batch with negligible overhead", "[.][benchmark][LatencyTracer]" )
+{
+    GIVEN( "A batched LatencyTracePoint and a 30 frame batch" )
+    {
+        DSL_LATENCY_TRACE_POINT_PTR pPoint = DSL_LATENCY_TRACE_POINT_NEW(-1);
+        GstBuffer* pBuffer = batch_buffer_new(30, 0);
+        
+        BENCHMARK( "Record and drain a 30 frame batch" )
+        {
+            pPoint->Record(pBuffer, LatencyTracerTimeNs());
+            return pPoint->Drain();
+        };
+        gst_buffer_unref(pBuffer);
+    }
+}
@@ -0,0 +1,399 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslMetaRecorder.h"
+#include "DslTestBatchMeta.hpp"
+
+#include <unistd.h>
+
+using namespace DSL;
+
+static const std::string recordingFilePath("./test-meta-recording.dslm");
+
+/**
+ * Removes all files of a recording, returns the number of files removed.
+ */
+static uint remove_recording_files(const std::string& filePath)
+{
+    uint fileCount(0);
+    while (true)
+    {
+        std::string nextFilePath(filePath);
+        if (fileCount)
+        {
+            nextFilePath += "." + std::to_string(fileCount);
+        }
+        if (std::remove(nextFilePath.c_str()) != 0)
+        {
+            return fileCount;
+        }
+        fileCount++;
+    }
+}
+
+/**
+ * Sets the timestamps of each frame in a batch from its frame number, 
+ * with a different offset for each source.
+ */
+static void set_frame_timestamps(GstBuffer* pBuffer)
+{
+    NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+    for (NvDsMetaList* pFrameList = pBatchMeta->frame_meta_list; 
+        pFrameList; pFrameList = pFrameList->next)
+    {
+        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameList->data);
+        pFrameMeta->buf_pts = pFrameMeta->frame_num*33333333ULL;
+        pFrameMeta->ntp_timestamp = 1600000000000000000ULL + 
+            pFrameMeta->source_id*1000 + pFrameMeta->buf_pts;
+    }
+}
+
+SCENARIO( "A MetaRecorder records batches that a MetaRecordingReader reads back", "[MetaRecorder]" )
+{
+    GIVEN( "A MetaRecorder and a set of batches" )
+    {
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 3;
+        params.objectsPerFrame = 5;
+        params.turnover = 0.1;
+        TestBatchMetaGenerator generator(params);
+        TestBatchMetaGenerator expectedGenerator(params);
+        uint batchCount(20);
+
+        WHEN( "The batches are recorded and the recorder is destroyed" )
+        {
+            uint64_t recorded(0), dropped(0);
+            {
+                MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), 0);
+                    
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = generator.Next();
+                    set_frame_timestamps(pBuffer);
+                    REQUIRE( metaRecorder.RecordBatch(gst_buffer_get_nvds_batch_meta(pBuffer)) == true );
+                    gst_buffer_unref(pBuffer);
+                }
+                metaRecorder.Flush();
+            }
+            THEN( "Every frame and Object is read back in order" )
+            {
+                MetaRecordingReader reader(recordingFilePath.c_str());
+                REQUIRE( reader.IsValid() == true );
+                
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = expectedGenerator.Next();
+                    set_frame_timestamps(pBuffer);
+                    NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+                    
+                    for (NvDsMetaList* pFrameList = pBatchMeta->frame_meta_list; 
+                        pFrameList; pFrameList = pFrameList->next)
+                    {
+                        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameList->data);
+                        
+                        dsl_meta_recording_frame frame;
+                        REQUIRE( reader.NextFrame(&frame) == true );
+                        REQUIRE( frame.source_id == pFrameMeta->source_id );
+                        REQUIRE( frame.batch_id == pFrameMeta->batch_id );
+                        REQUIRE( frame.frame_num == pFrameMeta->frame_num );
+                        REQUIRE( frame.buf_pts == pFrameMeta->buf_pts );
+                        REQUIRE( frame.ntp_timestamp == pFrameMeta->ntp_timestamp );
+                        REQUIRE( frame.source_frame_width == 1920 );
+                        REQUIRE( frame.source_frame_height == 1080 );
+                        REQUIRE( frame.object_count == params.objectsPerFrame );
+                        
+                        uint j(0);
+                        for (NvDsMetaList* pObjectList = pFrameMeta->obj_meta_list; 
+                            pObjectList; pObjectList = pObjectList->next, j++)
+                        {
+                            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectList->data);
+                            const dsl_meta_recording_object& object = frame.objects[j];
+                            REQUIRE( object.class_id == pObjectMeta->class_id );
+                            REQUIRE( object.object_id == pObjectMeta->object_id );
+                            REQUIRE( object.confidence == pObjectMeta->confidence );
+                            REQUIRE( object.left == pObjectMeta->rect_params.left );
+                            REQUIRE( object.top == pObjectMeta->rect_params.top );
+                            REQUIRE( object.width == pObjectMeta->rect_params.width );
+                            REQUIRE( object.height == pObjectMeta->rect_params.height );
+                            REQUIRE( object.label_count == 0 );
+                        }
+                    }
+                    gst_buffer_unref(pBuffer);
+                }
+                dsl_meta_recording_frame frame;
+                REQUIRE( reader.NextFrame(&frame) == false );
+                
+                REQUIRE( remove_recording_files(recordingFilePath) == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaRecorder records labels, classifier labels and display meta counts", "[MetaRecorder]" )
+{
+    GIVEN( "A batch with one labeled, untracked and classified Object, and display meta" )
+    {
+        GstBuffer* pBuffer = TestBatchBufferNew(1);
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, 4, 17);
+        NvDsObjectMeta* pObjectMeta = TestObjectMetaAdd(pFrameMeta, 
+            2, UNTRACKED_OBJECT_ID, 10, 20, 30, 40, 0.5);
+        strcpy(pObjectMeta->obj_label, "Vehicle");
+        
+        NvDsClassifierMeta* pClassifierMeta = 
+            nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+        pClassifierMeta->unique_component_id = 3;
+        NvDsLabelInfo* pLabelInfo = nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+        pLabelInfo->result_class_id = 5;
+        pLabelInfo->label_id = 1;
+        pLabelInfo->result_prob = 0.9;
+        strcpy(pLabelInfo->result_label, "red");
+        nvds_add_label_info_meta_to_classifier(pClassifierMeta, pLabelInfo);
+        nvds_add_classifier_meta_to_object(pObjectMeta, pClassifierMeta);
+        
+        NvDsDisplayMeta* pDisplayMeta = nvds_acquire_display_meta_from_pool(pBatchMeta);
+        pDisplayMeta->num_rects = 2;
+        pDisplayMeta->num_lines = 1;
+        nvds_add_display_meta_to_frame(pFrameMeta, pDisplayMeta);
+
+        WHEN( "The batch is recorded and read back" )
+        {
+            {
+                MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), 0);
+                REQUIRE( metaRecorder.RecordBatch(pBatchMeta) == true );
+            }
+            MetaRecordingReader reader(recordingFilePath.c_str());
+            REQUIRE( reader.IsValid() == true );
+            
+            dsl_meta_recording_frame frame;
+            REQUIRE( reader.NextFrame(&frame) == true );
+            
+            THEN( "All recorded values are read back" )
+            {
+                REQUIRE( frame.source_id == 4 );
+                REQUIRE( frame.frame_num == 17 );
+                REQUIRE( frame.display_meta_count == 1 );
+                REQUIRE( frame.display_rect_count == 2 );
+                REQUIRE( frame.display_line_count == 1 );
+                REQUIRE( frame.display_label_count == 0 );
+                REQUIRE( frame.object_count == 1 );
+                
+                const dsl_meta_recording_object& object = frame.objects[0];
+                REQUIRE( object.object_id == UNTRACKED_OBJECT_ID );
+                REQUIRE( std::string(object.label) == "Vehicle" );
+                REQUIRE( object.label_count == 1 );
+                REQUIRE( object.labels[0].unique_component_id == 3 );
+                REQUIRE( object.labels[0].result_class_id == 5 );
+                REQUIRE( object.labels[0].label_id == 1 );
+                REQUIRE( object.labels[0].result_prob == 0.9f );
+                REQUIRE( std::string(object.labels[0].result_label) == "red" );
+                
+                REQUIRE( reader.NextFrame(&frame) == false );
+                REQUIRE( remove_recording_files(recordingFilePath) == 1 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "A MetaRecorder rotates to a new file once the maximum file size is reached", "[MetaRecorder]" )
+{
+    GIVEN( "A MetaRecorder with a small maximum file size" )
+    {
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 2;
+        params.objectsPerFrame = 10;
+        TestBatchMetaGenerator generator(params);
+        uint batchCount(100);
+        uint maxFileSize(8*1024);
+
+        WHEN( "The batches are recorded and the recorder is destroyed" )
+        {
+            {
+                MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), maxFileSize);
+                    
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    GstBuffer* pBuffer = generator.Next();
+                    set_frame_timestamps(pBuffer);
+                    
+                    // the pool is small, so give the writer time to catch up if needed
+                    while (!metaRecorder.RecordBatch(gst_buffer_get_nvds_batch_meta(pBuffer)))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    gst_buffer_unref(pBuffer);
+                }
+            }
+            THEN( "The reader reads all frames in order across all files" )
+            {
+                MetaRecordingReader reader(recordingFilePath.c_str());
+                REQUIRE( reader.IsValid() == true );
+                
+                dsl_meta_recording_frame frame;
+                for (uint i = 0; i < batchCount*params.sourceCount; i++)
+                {
+                    REQUIRE( reader.NextFrame(&frame) == true );
+                    REQUIRE( frame.source_id == i % params.sourceCount );
+                    REQUIRE( frame.frame_num == i / params.sourceCount );
+                    REQUIRE( frame.buf_pts == frame.frame_num*33333333ULL );
+                }
+                REQUIRE( reader.NextFrame(&frame) == false );
+                
+                // each file can exceed the maximum by the last batch only
+                REQUIRE( remove_recording_files(recordingFilePath) > 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaRecordingReader reads a truncated recording up to the damaged record", "[MetaRecorder]" )
+{
+    GIVEN( "A recording with its last record truncated" )
+    {
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        TestBatchMetaGenerator generator(params);
+        uint batchCount(5);
+        {
+            MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), 0);
+            for (uint i = 0; i < batchCount; i++)
+            {
+                GstBuffer* pBuffer = generator.Next();
+                REQUIRE( metaRecorder.RecordBatch(gst_buffer_get_nvds_batch_meta(pBuffer)) == true );
+                gst_buffer_unref(pBuffer);
+            }
+        }
+        struct stat info;
+        REQUIRE( stat(recordingFilePath.c_str(), &info) == 0 );
+        REQUIRE( truncate(recordingFilePath.c_str(), info.st_size - 10) == 0 );
+
+        WHEN( "The recording is read" )
+        {
+            MetaRecordingReader reader(recordingFilePath.c_str());
+            REQUIRE( reader.IsValid() == true );
+            
+            uint frameCount(0);
+            dsl_meta_recording_frame frame;
+            while (reader.NextFrame(&frame))
+            {
+                frameCount++;
+            }
+            THEN( "All frames before the damaged record are read" )
+            {
+                REQUIRE( frameCount == (batchCount-1)*params.sourceCount );
+                REQUIRE( remove_recording_files(recordingFilePath) == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaRecordingReader rejects a file that is not a recording", "[MetaRecorder]" )
+{
+    GIVEN( "A text file" )
+    {
+        std::ofstream textFile(recordingFilePath);
+        textFile << "This is not a Meta Recording, but is longer than the header" << std::endl;
+        textFile.close();
+
+        WHEN( "The file is opened" )
+        {
+            MetaRecordingReader reader(recordingFilePath.c_str());
+            
+            THEN( "The reader is invalid" )
+            {
+                REQUIRE( reader.IsValid() == false );
+                REQUIRE( remove_recording_files(recordingFilePath) == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "Benchmark the MetaRecorder at 30 streams with 50 Objects per frame", "[.][benchmark][MetaRecorder]" )
+{
+    GIVEN( "A MetaRecorder and a ring of 30 source batches" )
+    {
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 30;
+        params.objectsPerFrame = 50;
+        TestBatchMetaGenerator generator(params);
+        
+        std::vector<GstBuffer*> buffers;
+        for (uint i = 0; i < 30; i++)
+        {
+            buffers.push_back(generator.Next());
+            set_frame_timestamps(buffers.back());
+        }
+        
+        WHEN( "Four seconds of batches at 30 fps are recorded" )
+        {
+            uint64_t recorded(0), dropped(0);
+            double batchTime(0);
+            {
+                MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), 0);
+                    
+                std::chrono::duration<double, std::micro> totalTime(0);
+                for (uint i = 0; i < 4*buffers.size(); i++)
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    metaRecorder.RecordBatch(gst_buffer_get_nvds_batch_meta(buffers[i % buffers.size()]));
+                    totalTime += std::chrono::steady_clock::now() - start;
+                    
+                    // the batch period, less the time taken by the streaming thread 
+                    std::this_thread::sleep_for(std::chrono::microseconds(33333) 
+                        - (std::chrono::steady_clock::now() - start));
+                }
+                batchTime = totalTime.count()/(4*buffers.size());
+                metaRecorder.Flush();
+            }
+            THEN( "The streaming thread overhead is under 1% of the batch period" )
+            {
+                MetaRecordingReader reader(recordingFilePath.c_str());
+                REQUIRE( reader.IsValid() == true );
+                dsl_meta_recording_frame frame;
+                uint frameCount(0);
+                while (reader.NextFrame(&frame))
+                {
+                    frameCount++;
+                }
+                struct stat info;
+                REQUIRE( stat(recordingFilePath.c_str(), &info) == 0 );
+                
+                std::cout << "Meta record time per batch: " << batchTime 
+                    << " us, " << 100*batchTime/33333 << " % of the batch period, "
+                    << info.st_size/frameCount << " bytes per frame" << std::endl;
+                    
+                REQUIRE( frameCount == 4*buffers.size()*params.sourceCount );
+                REQUIRE( batchTime < 0.01*33333 );
+                
+                remove_recording_files(recordingFilePath);
+                for (auto const& pBuffer: buffers)
+                {
+                    gst_buffer_unref(pBuffer);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,298 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "catch.hpp"
+#include "DslMetaRecorder.h"
+#include "DslMetaReplay.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+static const std::string recordingFilePath("./test-meta-replay.dslm");
+
+/**
+ * Requires the batch meta of two buffers to hold the same frames and objects.
+ */
+static void require_same_batch_meta(GstBuffer* pExpected, GstBuffer* pActual)
+{
+    NvDsBatchMeta* pExpectedMeta = gst_buffer_get_nvds_batch_meta(pExpected);
+    NvDsBatchMeta* pActualMeta = gst_buffer_get_nvds_batch_meta(pActual);
+    REQUIRE( pActualMeta != NULL );
+    REQUIRE( pActualMeta->num_frames_in_batch == pExpectedMeta->num_frames_in_batch );
+    
+    NvDsMetaList* pActualFrameList = pActualMeta->frame_meta_list;
+    for (NvDsMetaList* pFrameList = pExpectedMeta->frame_meta_list; 
+        pFrameList; pFrameList = pFrameList->next, pActualFrameList = pActualFrameList->next)
+    {
+        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameList->data);
+        NvDsFrameMeta* pActualFrameMeta = (NvDsFrameMeta*)(pActualFrameList->data);
+        REQUIRE( pActualFrameMeta->source_id == pFrameMeta->source_id );
+        REQUIRE( pActualFrameMeta->pad_index == pFrameMeta->source_id );
+        REQUIRE( pActualFrameMeta->batch_id == pFrameMeta->batch_id );
+        REQUIRE( pActualFrameMeta->frame_num == pFrameMeta->frame_num );
+        REQUIRE( pActualFrameMeta->buf_pts == pFrameMeta->buf_pts );
+        REQUIRE( pActualFrameMeta->source_frame_width == pFrameMeta->source_frame_width );
+        REQUIRE( pActualFrameMeta->source_frame_height == pFrameMeta->source_frame_height );
+        REQUIRE( pActualFrameMeta->num_obj_meta == pFrameMeta->num_obj_meta );
+        
+        NvDsMetaList* pActualObjectList = pActualFrameMeta->obj_meta_list;
+        for (NvDsMetaList* pObjectList = pFrameMeta->obj_meta_list; 
+            pObjectList; pObjectList = pObjectList->next, 
+            pActualObjectList = pActualObjectList->next)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectList->data);
+            NvDsObjectMeta* pActualObjectMeta = (NvDsObjectMeta*)(pActualObjectList->data);
+            REQUIRE( pActualObjectMeta->class_id == pObjectMeta->class_id );
+            REQUIRE( pActualObjectMeta->object_id == pObjectMeta->object_id );
+            REQUIRE( pActualObjectMeta->confidence == pObjectMeta->confidence );
+            REQUIRE( pActualObjectMeta->rect_params.left == pObjectMeta->rect_params.left );
+            REQUIRE( pActualObjectMeta->rect_params.top == pObjectMeta->rect_params.top );
+            REQUIRE( pActualObjectMeta->rect_params.width == pObjectMeta->rect_params.width );
+            REQUIRE( pActualObjectMeta->rect_params.height == pObjectMeta->rect_params.height );
+        }
+        REQUIRE( pActualObjectList == NULL );
+    }
+    REQUIRE( pActualFrameList == NULL );
+}
+
+SCENARIO( "Batches replayed from a recording have the batch meta that was recorded", "[MetaReplay]" )
+{
+    GIVEN( "A recording of a set of batches" )
+    {
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 3;
+        params.objectsPerFrame = 5;
+        params.turnover = 0.1;
+        TestBatchMetaGenerator generator(params);
+        TestBatchMetaGenerator expectedGenerator(params);
+        uint batchCount(20);
+
+        {
+            MetaRecorder metaRecorder("test-recorder", recordingFilePath.c_str(), 0);
+                
+            for (uint i = 0; i < batchCount; i++)
+            {
+                GstBuffer* pBuffer = generator.Next();
+                REQUIRE( metaRecorder.RecordBatch(gst_buffer_get_nvds_batch_meta(pBuffer)) == true );
+                gst_buffer_unref(pBuffer);
+            }
+            metaRecorder.Flush();
+        }
+
+        WHEN( "Each recorded batch is read and rebuilt" )
+        {
+            MetaRecordingReader reader(recordingFilePath.c_str());
+            REQUIRE( reader.IsValid() == true );
+
+            THEN( "Each rebuilt batch matches the batch that was recorded" )
+            {
+                for (uint i = 0; i < batchCount; i++)
+                {
+                    const dsl_meta_recording_frame* pFrames(NULL);
+                    uint frameCount(0);
+                    REQUIRE( reader.NextBatch(&pFrames, &frameCount) == true );
+                    REQUIRE( frameCount == params.sourceCount );
+                    
+                    GstBuffer* pExpected = expectedGenerator.Next();
+                    GstBuffer* pActual = MetaReplayBufferNew(pFrames, frameCount, 0);
+                    
+                    require_same_batch_meta(pExpected, pActual);
+                    
+                    gst_buffer_unref(pActual);
+                    gst_buffer_unref(pExpected);
+                }
+                const dsl_meta_recording_frame* pFrames(NULL);
+                uint frameCount(0);
+                REQUIRE( reader.NextBatch(&pFrames, &frameCount) == false );
+                
+                std::remove(recordingFilePath.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "A rebuilt batch has one classifier meta for each recorded classifier", "[MetaReplay]" )
+{
+    GIVEN( "A recorded frame with an untracked Object with labels from two classifiers" )
+    {
+        dsl_meta_recording_label labels[3] = {{0}};
+        labels[0].unique_component_id = 3;
+        labels[0].result_class_id = 5;
+        labels[0].label_id = 1;
+        labels[0].result_prob = 0.9f;
+        strcpy(labels[0].result_label, "red");
+        labels[1] = labels[0];
+        labels[1].label_id = 2;
+        strcpy(labels[1].result_label, "blue");
+        labels[2] = labels[0];
+        labels[2].unique_component_id = 4;
+        strcpy(labels[2].result_label, "sedan");
+        
+        dsl_meta_recording_object object = {0};
+        object.object_id = UNTRACKED_OBJECT_ID;
+        object.class_id = 2;
+        object.unique_component_id = 1;
+        object.width = 100;
+        object.height = 50;
+        strcpy(object.label, "Vehicle");
+        object.label_count = 3;
+        object.labels = labels;
+        
+        dsl_meta_recording_frame frame = {0};
+        frame.source_id = 2;
+        frame.frame_num = 7;
+        frame.object_count = 1;
+        frame.objects = &object;
+
+        WHEN( "The batch is rebuilt" )
+        {
+            GstBuffer* pBuffer = MetaReplayBufferNew(&frame, 1, 4);
+
+            THEN( "The Object's labels are grouped by classifier" )
+            {
+                NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+                REQUIRE( pBatchMeta->max_frames_in_batch == 4 );
+                REQUIRE( pBatchMeta->num_frames_in_batch == 1 );
+                
+                NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pBatchMeta->frame_meta_list->data);
+                REQUIRE( pFrameMeta->source_id == 2 );
+                REQUIRE( pFrameMeta->frame_num == 7 );
+                REQUIRE( pFrameMeta->num_obj_meta == 1 );
+                
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pFrameMeta->obj_meta_list->data);
+                REQUIRE( pObjectMeta->object_id == UNTRACKED_OBJECT_ID );
+                REQUIRE( pObjectMeta->unique_component_id == 1 );
+                REQUIRE( std::string(pObjectMeta->obj_label) == "Vehicle" );
+                REQUIRE( g_list_length(pObjectMeta->classifier_meta_list) == 2 );
+                
+                NvDsClassifierMeta* pClassifierMeta = 
+                    (NvDsClassifierMeta*)(pObjectMeta->classifier_meta_list->data);
+                REQUIRE( pClassifierMeta->unique_component_id == 3 );
+                REQUIRE( pClassifierMeta->num_labels == 2 );
+                NvDsLabelInfo* pLabelInfo = (NvDsLabelInfo*)(pClassifierMeta->label_info_list->next->data);
+                REQUIRE( pLabelInfo->label_id == 2 );
+                REQUIRE( pLabelInfo->result_class_id == 5 );
+                REQUIRE( pLabelInfo->result_prob == 0.9f );
+                REQUIRE( std::string(pLabelInfo->result_label) == "blue" );
+                
+                pClassifierMeta = 
+                    (NvDsClassifierMeta*)(pObjectMeta->classifier_meta_list->next->data);
+                REQUIRE( pClassifierMeta->unique_component_id == 4 );
+                REQUIRE( pClassifierMeta->num_labels == 1 );
+                
+                gst_buffer_unref(pBuffer);
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaReplayScenario generates the same batches after a reset", "[MetaReplay]" )
+{
+    GIVEN( "A new MetaReplayScenario" )
+    {
+        uint sourceCount(3), objectsPerFrame(10), classCount(4);
+        uint64_t batchCount(50);
+        MetaReplayScenario scenario(sourceCount, objectsPerFrame, classCount, batchCount);
+        
+        WHEN( "All batches are generated" )
+        {
+            std::vector<dsl_meta_recording_object> firstObjects;
+            std::vector<dsl_meta_recording_object> lastObjects;
+            
+            const dsl_meta_recording_frame* pFrames(NULL);
+            uint frameCount(0);
+            for (uint64_t i = 0; i < batchCount; i++)
+            {
+                REQUIRE( scenario.NextBatch(&pFrames, &frameCount) == true );
+                REQUIRE( frameCount == sourceCount );
+                for (uint j = 0; j < frameCount; j++)
+                {
+                    REQUIRE( pFrames[j].source_id == j );
+                    REQUIRE( pFrames[j].batch_id == j );
+                    REQUIRE( pFrames[j].frame_num == (int)i );
+                    REQUIRE( pFrames[j].buf_pts == i*GST_SECOND/30 );
+                    REQUIRE( pFrames[j].object_count == objectsPerFrame );
+                    for (uint k = 0; k < objectsPerFrame; k++)
+                    {
+                        const dsl_meta_recording_object& object = pFrames[j].objects[k];
+                        REQUIRE( object.class_id == (int)(k % classCount) );
+                        REQUIRE( object.left >= 0 );
+                        REQUIRE( object.top >= 0 );
+                        REQUIRE( object.left + object.width <= DSL_META_REPLAY_SCENARIO_WIDTH );
+                        REQUIRE( object.top + object.height <= DSL_META_REPLAY_SCENARIO_HEIGHT );
+                    }
+                }
+                if (i == 0)
+                {
+                    firstObjects.assign(pFrames[0].objects, pFrames[0].objects+objectsPerFrame);
+                }
+            }
+            lastObjects.assign(pFrames[0].objects, pFrames[0].objects+objectsPerFrame);
+
+            THEN( "The scenario ends, and restarts with the same batches once reset" )
+            {
+                REQUIRE( scenario.NextBatch(&pFrames, &frameCount) == false );
+                
+                // objects must have moved over the scenario
+                REQUIRE( lastObjects[0].left != firstObjects[0].left );
+                
+                scenario.Reset();
+                REQUIRE( scenario.NextBatch(&pFrames, &frameCount) == true );
+                REQUIRE( pFrames[0].frame_num == 0 );
+                for (uint k = 0; k < objectsPerFrame; k++)
+                {
+                    REQUIRE( pFrames[0].objects[k].object_id == firstObjects[k].object_id );
+                    REQUIRE( pFrames[0].objects[k].left == firstObjects[k].left );
+                    REQUIRE( pFrames[0].objects[k].top == firstObjects[k].top );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "Benchmark rebuilding replayed batches at 30 streams with 50 Objects per frame", "[.][benchmark][MetaReplay]" )
+{
+    GIVEN( "A MetaReplayScenario with 30 sources and 50 Objects per frame" )
+    {
+        MetaReplayScenario scenario(30, 50, 4, 0);
+
+        WHEN( "Each batch is generated and rebuilt" )
+        {
+            THEN( "The time to rebuild each batch is measured" )
+            {
+                BENCHMARK( "Rebuild a replayed batch" )
+                {
+                    const dsl_meta_recording_frame* pFrames(NULL);
+                    uint frameCount(0);
+                    scenario.NextBatch(&pFrames, &frameCount);
+                    GstBuffer* pBuffer = MetaReplayBufferNew(pFrames, frameCount, 30);
+                    gst_buffer_unref(pBuffer);
+                    return frameCount;
+                };
+            }
+        }
+    }
+}
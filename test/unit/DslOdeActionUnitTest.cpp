@@ -59,6 +59,48 @@ static void ode_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
     }
 }    
 
+/**
+ * Client data for the async callback tests, the callback can be held 
+ * on its first call until released to force the Action's queue to fill.
+ */
+struct AsyncCallbackData
+{
+    std::atomic<uint> calls{0};
+    std::atomic<uint64_t> lastEventId{0};
+    std::atomic<bool> entered{false};
+    std::atomic<bool> hold{false};
+    std::atomic<bool> hasBuffer{false};
+    std::thread::id threadId;
+};
+
+static void ode_async_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    AsyncCallbackData* pData = (AsyncCallbackData*)client_data;
+    
+    pData->threadId = std::this_thread::get_id();
+    pData->entered = true;
+    while (pData->hold)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (buffer)
+    {
+        pData->hasBuffer = true;
+    }
+    pData->lastEventId = event_id;
+    pData->calls++;
+}
+
+static bool ode_async_wait_for(std::atomic<uint>& value, uint expected)
+{
+    for (uint i = 0; i < 2000 and value < expected; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return value == expected;
+}
+
 SCENARIO( "A new CallbackOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new CallbackOdeAction" ) 
@@ -119,6 +161,357 @@ SCENARIO( "A CallbackOdeAction handles an ODE Occurence correctly", "[OdeAction]
     }
 }
 
+SCENARIO( "A CallbackOdeAction handles ODE Occurrences asynchronously", "[OdeAction]" )
+{
+    GIVEN( "A new CallbackOdeAction with async execution enabled" ) 
+    {
+        std::string odeTypeName("first-occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+        AsyncCallbackData clientData;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTypeName.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CALLBACK_PTR pAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW(actionName.c_str(), 
+                ode_async_occurrence_handler_cb, &clientData);
+                
+        REQUIRE( pAction->SetAsyncSettings(true, DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST) == true );
+
+        bool enabled(false);
+        uint overflowPolicy(99);
+        pAction->GetAsyncSettings(&enabled, &overflowPolicy);
+        REQUIRE( enabled == true );
+        REQUIRE( overflowPolicy == DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = 1; 
+
+        WHEN( "ODE Occurrences are dispatched" )
+        {
+            uint count(10);
+            for (uint i = 0; i < count; i++)
+            {
+                OdeTrigger::NextEventId();
+                pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, &objectMeta);
+            }
+            uint64_t lastEventId = OdeTrigger::s_eventCount;
+            
+            THEN( "Each Occurrence is handled in order off of the calling thread" )
+            {
+                REQUIRE( ode_async_wait_for(clientData.calls, count) == true );
+                REQUIRE( clientData.lastEventId == lastEventId );
+                REQUIRE( clientData.threadId != std::this_thread::get_id() );
+                REQUIRE( clientData.hasBuffer == false );
+                REQUIRE( pAction->GetAsyncDropped() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An async ODE Action applies its overflow policy when its queue is full", "[OdeAction]" )
+{
+    GIVEN( "A new CallbackOdeAction with a held client callback" ) 
+    {
+        std::string odeTypeName("first-occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+        AsyncCallbackData clientData;
+        clientData.hold = true;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTypeName.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CALLBACK_PTR pAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW(actionName.c_str(), 
+                ode_async_occurrence_handler_cb, &clientData);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        
+        uint extra(10);
+        
+        WHEN( "The overflow policy is drop-newest" )
+        {
+            REQUIRE( pAction->SetAsyncSettings(true, DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST) == true );
+            
+            // first event is held in the callback, freeing its queue record
+            OdeTrigger::NextEventId();
+            pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            while (!clientData.entered)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            for (uint i = 0; i < DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + extra; i++)
+            {
+                OdeTrigger::NextEventId();
+                pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            }
+            uint64_t lastQueuedEventId = OdeTrigger::s_eventCount - extra;
+            clientData.hold = false;
+            
+            THEN( "The newest events are dropped and counted" )
+            {
+                REQUIRE( ode_async_wait_for(clientData.calls, 
+                    DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + 1) == true );
+                REQUIRE( pAction->GetAsyncDropped() == extra );
+                REQUIRE( clientData.lastEventId == lastQueuedEventId );
+            }
+        }
+        WHEN( "The overflow policy is drop-oldest" )
+        {
+            REQUIRE( pAction->SetAsyncSettings(true, DSL_ODE_ACTION_OVERFLOW_DROP_OLDEST) == true );
+            
+            OdeTrigger::NextEventId();
+            pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            while (!clientData.entered)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            for (uint i = 0; i < DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + extra; i++)
+            {
+                OdeTrigger::NextEventId();
+                pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            }
+            uint64_t lastEventId = OdeTrigger::s_eventCount;
+            clientData.hold = false;
+            
+            THEN( "The oldest events are dropped and counted" )
+            {
+                REQUIRE( ode_async_wait_for(clientData.calls, 
+                    DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + 1) == true );
+                REQUIRE( pAction->GetAsyncDropped() == extra );
+                REQUIRE( clientData.lastEventId == lastEventId );
+            }
+        }
+        WHEN( "The overflow policy is block, and the worker never frees a record" )
+        {
+            REQUIRE( pAction->SetAsyncSettings(true, DSL_ODE_ACTION_OVERFLOW_BLOCK) == true );
+            
+            OdeTrigger::NextEventId();
+            pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            while (!clientData.entered)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            for (uint i = 0; i < DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + 1; i++)
+            {
+                OdeTrigger::NextEventId();
+                pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            }
+            clientData.hold = false;
+            
+            THEN( "The streaming thread stops blocking, and the occurrence is dropped" )
+            {
+                REQUIRE( ode_async_wait_for(clientData.calls, 
+                    DSL_ODE_ACTION_ASYNC_QUEUE_SIZE + 1) == true );
+                REQUIRE( pAction->GetAsyncDropped() == 1 );
+            }
+        }
+    }
+}
+
+/**
+ * Client data for the batch callback tests, each call's records are copied 
+ * as they are only valid for the duration of the callback.
+ */
+struct BatchCallbackData
+{
+    uint calls{0};
+    std::vector<dsl_ode_occurrence_record> records;
+};
+
+static void ode_batch_occurrences_handler_cb(const dsl_ode_occurrence_record* records, 
+    uint count, void* client_data)
+{
+    BatchCallbackData* pData = (BatchCallbackData*)client_data;
+    
+    pData->calls++;
+    pData->records.assign(records, records+count);
+}
+
+SCENARIO( "An ODE Action counts each Occurrence in its metrics", "[OdeAction]" )
+{
+    GIVEN( "A new CallbackOdeAction" ) 
+    {
+        std::string odeTypeName("first-occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTypeName.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CALLBACK_PTR pAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW(actionName.c_str(), ode_occurrence_handler_cb, NULL);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        
+        dsl_ode_action_metrics metrics;
+
+        WHEN( "ODE Occurrences are dispatched synchronously" )
+        {
+            for (uint i = 0; i < 10; i++)
+            {
+                OdeTrigger::NextEventId();
+                pAction->DispatchOccurrence(pTrigger, NULL, &frameMeta, NULL);
+            }
+            pAction->GetMetrics(&metrics);
+            
+            THEN( "Each Occurrence is counted" )
+            {
+                REQUIRE( metrics.invocations == 10 );
+                REQUIRE( metrics.execution_time_ns >= metrics.max_execution_time_ns );
+                REQUIRE( metrics.async_dropped == 0 );
+            }
+            THEN( "All counters are zero once reset" )
+            {
+                pAction->ResetMetrics();
+                pAction->GetMetrics(&metrics);
+                
+                REQUIRE( metrics.invocations == 0 );
+                REQUIRE( metrics.execution_time_ns == 0 );
+                REQUIRE( metrics.max_execution_time_ns == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A BatchCallbackOdeAction calls the client once per batch", "[OdeAction]" )
+{
+    GIVEN( "A new BatchCallbackOdeAction added to two Triggers" ) 
+    {
+        uint classId(1);
+        uint limit(0);
+        BatchCallbackData clientData;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger1 = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-1", classId, limit);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger2 = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("trigger-2", classId, limit);
+
+        DSL_ODE_ACTION_CALLBACK_BATCH_PTR pAction = 
+            DSL_ODE_ACTION_CALLBACK_BATCH_NEW("ode-action", 
+                ode_batch_occurrences_handler_cb, &clientData);
+                
+        REQUIRE( pTrigger1->AddAction(pAction) == true );
+        REQUIRE( pTrigger2->AddAction(pAction) == true );
+        REQUIRE( pAction->IsAsyncCapable() == false );
+        REQUIRE( pAction->GetTriggerName(0) == NULL );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = 123456789;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = 77; 
+        objectMeta.confidence = 0.5;
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+
+        WHEN( "Occurrences from both Triggers are handled within a batch" )
+        {
+            pAction->HandleOccurrence(pTrigger2, NULL, &frameMeta, &objectMeta);
+            pAction->HandleOccurrence(pTrigger1, NULL, &frameMeta, &objectMeta);
+            pAction->HandleOccurrence(pTrigger2, NULL, &frameMeta, NULL);
+            
+            THEN( "The client is called once with all records on post process of the batch" )
+            {
+                REQUIRE( clientData.calls == 0 );
+                
+                pTrigger1->PostProcessBatch();
+                pTrigger2->PostProcessBatch();
+                REQUIRE( clientData.calls == 1 );
+                REQUIRE( clientData.records.size() == 3 );
+                
+                REQUIRE( clientData.records[0].trigger_index == 0 );
+                REQUIRE( clientData.records[0].source_id == 2 );
+                REQUIRE( clientData.records[0].frame_num == 444 );
+                REQUIRE( clientData.records[0].ntp_timestamp == 123456789 );
+                REQUIRE( clientData.records[0].class_id == classId );
+                REQUIRE( clientData.records[0].object_id == 77 );
+                REQUIRE( clientData.records[0].confidence == 0.5 );
+                REQUIRE( clientData.records[0].left == 10 );
+                REQUIRE( clientData.records[0].top == 20 );
+                REQUIRE( clientData.records[0].width == 200 );
+                REQUIRE( clientData.records[0].height == 100 );
+                REQUIRE( clientData.records[0].is_object == true );
+                REQUIRE( clientData.records[1].trigger_index == 1 );
+                REQUIRE( clientData.records[2].trigger_index == 0 );
+                REQUIRE( clientData.records[2].is_object == false );
+                REQUIRE( clientData.records[2].class_id == -1 );
+                REQUIRE( clientData.records[2].object_id == UINT64_MAX );
+                
+                REQUIRE( std::wstring(pAction->GetTriggerName(0)) == L"trigger-2" );
+                REQUIRE( std::wstring(pAction->GetTriggerName(1)) == L"trigger-1" );
+                REQUIRE( pAction->GetTriggerName(2) == NULL );
+                
+                // batches without occurrences are not reported
+                pTrigger1->PostProcessBatch();
+                REQUIRE( clientData.calls == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "ODE Actions that update the buffer's meta can not be made async", "[OdeAction]" )
+{
+    GIVEN( "A new FillFrameOdeAction and a new PrintOdeAction" ) 
+    {
+        DSL_ODE_ACTION_FILL_FRAME_PTR pFillAction = 
+            DSL_ODE_ACTION_FILL_FRAME_NEW("fill-action", 0.0, 0.0, 0.0, 0.0);
+
+        DSL_ODE_ACTION_PRINT_PTR pPrintAction = 
+            DSL_ODE_ACTION_PRINT_NEW("print-action");
+
+        WHEN( "Async execution is enabled for each" )
+        {
+            bool fillResult = pFillAction->SetAsyncSettings(true, 
+                DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST);
+            bool printResult = pPrintAction->SetAsyncSettings(true, 
+                DSL_ODE_ACTION_OVERFLOW_DROP_NEWEST);
+            
+            THEN( "Only the PrintOdeAction is updated" )
+            {
+                REQUIRE( pFillAction->IsAsyncCapable() == false );
+                REQUIRE( fillResult == false );
+                REQUIRE( printResult == true );
+
+                bool enabled(false);
+                uint overflowPolicy(0);
+                pFillAction->GetAsyncSettings(&enabled, &overflowPolicy);
+                REQUIRE( enabled == false );
+            }
+        }
+        WHEN( "An invalid overflow policy is used" )
+        {
+            THEN( "The settings are rejected" )
+            {
+                REQUIRE( pPrintAction->SetAsyncSettings(true, 
+                    DSL_ODE_ACTION_OVERFLOW_BLOCK+1) == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CaptureFrameOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new CaptureFrameOdeAction" ) 
@@ -357,6 +750,92 @@ SCENARIO( "A HideOdeAction handles an ODE Occurence correctly", "[OdeAction]" )
     }
 }
 
+SCENARIO( "A JournalOdeAction appends a record for each ODE Occurrence", "[OdeAction]" )
+{
+    GIVEN( "A new JournalOdeAction" ) 
+    {
+        uint classId(1);
+        std::string filePath("./test-journal-action.dslj");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("first-occurrence", classId, 0);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = 77; 
+
+        WHEN( "The Action handles a number of Occurrences" )
+        {
+            {
+                DSL_ODE_ACTION_JOURNAL_PTR pAction = 
+                    DSL_ODE_ACTION_JOURNAL_NEW("ode-action", filePath.c_str(), 1024*1024, 0);
+                    
+                for (uint i = 0; i < 10; i++)
+                {
+                    OdeTrigger::NextEventId();
+                    pAction->HandleOccurrence(pTrigger, NULL, &frameMeta, &objectMeta);
+                }
+                REQUIRE( pAction->GetFileCount() == 1 );
+            }
+            THEN( "The journal contains a record for each Occurrence" )
+            {
+                std::vector<dsl_ode_occurrence_record> records;
+                OdeJournalReader journalReader(filePath.c_str());
+                REQUIRE( journalReader.IsValid() );
+                REQUIRE( journalReader.Scan("first-occurrence", 2, 0, UINT64_MAX,
+                    [&](const dsl_ode_occurrence_record& record)
+                    {
+                        records.push_back(record);
+                    }) == 10 );
+                REQUIRE( records[0].frame_num == 444 );
+                REQUIRE( records[0].object_id == 77 );
+                REQUIRE( records[9].event_id == records[0].event_id + 9 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A JournalOdeAction sustains a high occurrence rate", "[.][benchmark][OdeAction]" )
+{
+    GIVEN( "A new JournalOdeAction rotating every 64 MB" ) 
+    {
+        uint classId(1);
+        std::string filePath("./test-journal-benchmark.dslj");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("first-occurrence", classId, 0);
+        DSL_ODE_ACTION_JOURNAL_PTR pAction = 
+            DSL_ODE_ACTION_JOURNAL_NEW("ode-action", filePath.c_str(), 64*1024*1024, 2);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+
+        WHEN( "One million Occurrences are handled" )
+        {
+            THEN( "The time per Occurrence is a small fraction of a microsecond" )
+            {
+                BENCHMARK( "1M Occurrences" )
+                {
+                    for (uint i = 0; i < 1000000; i++)
+                    {
+                        frameMeta.frame_num = i;
+                        pAction->HandleOccurrence(pTrigger, NULL, &frameMeta, &objectMeta);
+                    }
+                    return pAction->GetFileCount();
+                };
+            }
+        }
+    }
+}
+
 SCENARIO( "A new LogOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new LogOdeAction" ) 
@@ -125,3 +125,133 @@ SCENARIO( "An OdeArea's background color can be Set/Get", "[OdeArea]" )
         }
     }
 }
+
+SCENARIO( "An OdeAreaIndex finds overlaps the same as testing every Area", "[OdeArea]" )
+{
+    GIVEN( "A set of random Area rectangles and a new OdeAreaIndex" ) 
+    {
+        std::srand(1234);
+        
+        auto randomRect = [](uint maxSize)
+        {
+            NvOSD_RectParams rect{0};
+            rect.left = std::rand() % 1920;
+            rect.top = std::rand() % 1080;
+            rect.width = 1 + std::rand() % maxSize;
+            rect.height = 1 + std::rand() % maxSize;
+            return rect;
+        };
+        
+        std::vector<NvOSD_RectParams> areas;
+        for (uint i = 0; i < 200; i++)
+        {
+            areas.push_back(randomRect(100));
+        }
+        OdeAreaIndex areaIndex;
+
+        WHEN( "The OdeAreaIndex is built" )
+        {
+            areaIndex.Build(areas);
+            
+            THEN( "Every query returns the same result as the linear search" )
+            {
+                REQUIRE( areaIndex.Size() == areas.size() );
+                
+                for (uint i = 0; i < 5000; i++)
+                {
+                    NvOSD_RectParams rect = randomRect(300);
+                    
+                    bool expected(false);
+                    for (const auto& area: areas)
+                    {
+                        if (OdeAreaIndex::DoesOverlap(rect, area))
+                        {
+                            expected = true;
+                            break;
+                        }
+                    }
+                    REQUIRE( areaIndex.Overlaps(rect) == expected );
+                }
+            }
+        }
+        WHEN( "The OdeAreaIndex is queried with rectangles of negative width and height" )
+        {
+            areaIndex.Build(areas);
+            
+            THEN( "Every query returns the same result as the linear search" )
+            {
+                for (uint i = 0; i < 5000; i++)
+                {
+                    NvOSD_RectParams rect = randomRect(300);
+                    rect.width = -rect.width;
+                    if (i % 2)
+                    {
+                        rect.height = -rect.height;
+                    }
+                    bool expected(false);
+                    for (const auto& area: areas)
+                    {
+                        if (OdeAreaIndex::DoesOverlap(rect, area))
+                        {
+                            expected = true;
+                            break;
+                        }
+                    }
+                    REQUIRE( areaIndex.Overlaps(rect) == expected );
+                }
+            }
+        }
+        WHEN( "The OdeAreaIndex is rebuilt with no Areas" )
+        {
+            areaIndex.Build(areas);
+            areaIndex.Build(std::vector<NvOSD_RectParams>());
+            
+            THEN( "No query overlaps" )
+            {
+                REQUIRE( areaIndex.Size() == 0 );
+                REQUIRE( areaIndex.Overlaps(randomRect(300)) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeArea's frame display is claimed once per Source and frame", "[OdeArea]" )
+{
+    GIVEN( "A new OdeArea" ) 
+    {
+        DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW("ode-area", 10, 10, 100, 100, true);
+
+        WHEN( "A frame is claimed for a Source" )
+        {
+            REQUIRE( pOdeArea->ClaimFrameDisplay(1, 0) == true );
+            
+            THEN( "The same or an earlier frame can't be claimed again" )
+            {
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 0) == false );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 1) == true );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 1) == false );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 0) == false );
+            }
+            THEN( "Each Source is claimed independently" )
+            {
+                REQUIRE( pOdeArea->ClaimFrameDisplay(0, 0) == true );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(2, 0) == true );
+            }
+        }
+        WHEN( "A frame is claimed for a Source beyond the reserved Sources" )
+        {
+            REQUIRE( pOdeArea->ClaimFrameDisplay(1, 5) == true );
+            REQUIRE( pOdeArea->ClaimFrameDisplay(DSL_ODE_AREA_INITIAL_SOURCES*4, 5) == true );
+            
+            THEN( "The per-source state is grown with the existing claims kept" )
+            {
+                REQUIRE( pOdeArea->ClaimFrameDisplay(DSL_ODE_AREA_INITIAL_SOURCES*4, 5) == false );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 5) == false );
+                
+                pOdeArea->ReserveSources(DSL_ODE_AREA_INITIAL_SOURCES*16);
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 5) == false );
+                REQUIRE( pOdeArea->ClaimFrameDisplay(1, 6) == true );
+            }
+        }
+    }
+}
@@ -0,0 +1,201 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeBatch.h"
+#include "DslOdeTrigger.h"
+
+using namespace DSL;
+
+/**
+ * Fills a batch with random Frames and Objects, including values on and around
+ * the criteria thresholds used by the tests below.
+ */
+static void random_batch(OdeObjectBatch& batch, std::vector<NvDsFrameMeta>& frames,
+    std::vector<NvDsObjectMeta>& objects, uint frameCount, uint objectsPerFrame)
+{
+    frames.assign(frameCount, NvDsFrameMeta{0});
+    objects.assign(frameCount*objectsPerFrame, NvDsObjectMeta{0});
+    
+    batch.Clear();
+    for (uint frame = 0; frame < frameCount; frame++)
+    {
+        frames[frame].source_id = std::rand() % 4;
+        frames[frame].bInferDone = std::rand() % 2;
+        batch.AddFrame(&frames[frame]);
+        
+        for (uint i = 0; i < objectsPerFrame; i++)
+        {
+            NvDsObjectMeta& objectMeta = objects[frame*objectsPerFrame + i];
+            objectMeta.class_id = (std::rand() % 5) - 1;
+            objectMeta.confidence = ((std::rand() % 120) - 10) / 100.0;
+            objectMeta.rect_params.left = std::rand() % 1920;
+            objectMeta.rect_params.top = std::rand() % 1080;
+            objectMeta.rect_params.width = std::rand() % 300;
+            objectMeta.rect_params.height = std::rand() % 300;
+            batch.AddObject(&objectMeta);
+        }
+    }
+}
+
+static OdeTriggerCriteria random_criteria()
+{
+    OdeTriggerCriteria criteria{0};
+    criteria.classId = (std::rand() % 2) ? DSL_ODE_ANY_CLASS : std::rand() % 4;
+    criteria.sourceId = (std::rand() % 2) ? DSL_ODE_ANY_SOURCE : std::rand() % 4;
+    criteria.minConfidence = (std::rand() % 2) ? 0 : (std::rand() % 100) / 100.0;
+    criteria.minWidth = (std::rand() % 2) ? 0 : std::rand() % 300;
+    criteria.minHeight = (std::rand() % 2) ? 0 : std::rand() % 300;
+    criteria.maxWidth = (std::rand() % 2) ? 0 : std::rand() % 300;
+    criteria.maxHeight = (std::rand() % 2) ? 0 : std::rand() % 300;
+    criteria.inferDoneOnly = std::rand() % 2;
+    return criteria;
+}
+
+SCENARIO( "An OdeObjectBatch gathers Frames and Objects correctly", "[OdeObjectBatch]" )
+{
+    GIVEN( "A new OdeObjectBatch" ) 
+    {
+        OdeObjectBatch batch;
+        std::vector<NvDsFrameMeta> frames;
+        std::vector<NvDsObjectMeta> objects;
+
+        WHEN( "Frames and Objects are added" )
+        {
+            random_batch(batch, frames, objects, 3, 5);
+            
+            THEN( "The per Object arrays are filled correctly" )
+            {
+                REQUIRE( batch.m_objectCount == 15 );
+                REQUIRE( batch.m_frameMetas.size() == 3 );
+                REQUIRE( batch.m_frameFirstObject.size() == 4 );
+                REQUIRE( batch.m_frameFirstObject[3] == 15 );
+                REQUIRE( batch.m_classIds.size() % DSL_ODE_BATCH_KERNEL_WIDTH == 0 );
+                
+                for (uint frame = 0; frame < 3; frame++)
+                {
+                    REQUIRE( batch.m_frameFirstObject[frame] == frame*5 );
+                    for (uint i = frame*5; i < (frame+1)*5; i++)
+                    {
+                        REQUIRE( batch.m_objectMetas[i] == &objects[i] );
+                        REQUIRE( batch.m_frameIndices[i] == frame );
+                        REQUIRE( batch.m_sourceIds[i] == frames[frame].source_id );
+                        REQUIRE( batch.m_classIds[i] == objects[i].class_id );
+                        REQUIRE( batch.m_widths[i] == objects[i].rect_params.width );
+                    }
+                }
+            }
+        }
+        WHEN( "The OdeObjectBatch is cleared" )
+        {
+            random_batch(batch, frames, objects, 3, 5);
+            batch.Clear();
+            
+            THEN( "The Frames and Objects are removed" )
+            {
+                REQUIRE( batch.m_objectCount == 0 );
+                REQUIRE( batch.m_frameMetas.size() == 0 );
+                REQUIRE( batch.m_objectMetas.size() == 0 );
+                REQUIRE( batch.m_frameFirstObject.size() == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The vector criteria kernel matches the scalar kernel", "[OdeObjectBatch]" )
+{
+    GIVEN( "Random batches and random criteria" ) 
+    {
+        std::srand(5678);
+        
+        OdeObjectBatch batch;
+        std::vector<NvDsFrameMeta> frames;
+        std::vector<NvDsObjectMeta> objects;
+
+        WHEN( "Each batch is evaluated by both kernels" )
+        {
+            THEN( "The masks are identical" )
+            {
+                for (uint i = 0; i < 500; i++)
+                {
+                    // odd sizes to exercise the batch tail
+                    random_batch(batch, frames, objects, 1 + std::rand() % 8, std::rand() % 40);
+                    OdeTriggerCriteria criteria = random_criteria();
+                    
+                    std::vector<uint64_t> vectorMask, scalarMask;
+                    batch.EvaluateCriteria(criteria, vectorMask);
+                    batch.EvaluateCriteriaScalar(criteria, scalarMask);
+                    
+                    REQUIRE( vectorMask == scalarMask );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "The criteria mask matches an OdeTrigger's criteria check", "[OdeObjectBatch]" )
+{
+    GIVEN( "A new OdeTrigger and a random batch" ) 
+    {
+        std::srand(8765);
+        
+        OdeObjectBatch batch;
+        std::vector<NvDsFrameMeta> frames;
+        std::vector<NvDsObjectMeta> objects;
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_CLASS, 0);
+
+        WHEN( "The OdeTrigger's criteria are updated" )
+        {
+            THEN( "Only the Objects in the mask are detected by the OdeTrigger" )
+            {
+                for (uint i = 0; i < 100; i++)
+                {
+                    random_batch(batch, frames, objects, 4, 10);
+                    OdeTriggerCriteria criteria = random_criteria();
+                    
+                    pOdeTrigger->SetClassId(criteria.classId);
+                    pOdeTrigger->SetSourceId(criteria.sourceId);
+                    pOdeTrigger->SetMinConfidence(criteria.minConfidence);
+                    pOdeTrigger->SetMinDimensions(criteria.minWidth, criteria.minHeight);
+                    pOdeTrigger->SetMaxDimensions(criteria.maxWidth, criteria.maxHeight);
+                    pOdeTrigger->SetInferDoneOnlySetting(criteria.inferDoneOnly);
+                    
+                    std::vector<uint64_t> mask;
+                    pOdeTrigger->EvaluateMinCriteria(batch, mask);
+                    
+                    for (uint object = 0; object < batch.m_objectCount; object++)
+                    {
+                        NvDsFrameMeta* pFrameMeta = batch.m_frameMetas[batch.m_frameIndices[object]];
+                        
+                        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, pFrameMeta, 
+                            batch.m_objectMetas[object]) == OdeObjectBatch::IsSet(mask, object) );
+                    }
+                }
+            }
+        }
+    }
+}
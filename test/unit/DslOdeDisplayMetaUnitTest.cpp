@@ -0,0 +1,200 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslOdeDisplayMeta.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+static NvOSD_RectParams testRect(uint i)
+{
+    NvOSD_RectParams rectParams{0};
+    rectParams.left = i;
+    rectParams.top = i;
+    rectParams.width = 10;
+    rectParams.height = 10;
+    return rectParams;
+}
+
+static uint testDisplayMetaCount(NvDsFrameMeta* pFrameMeta, 
+    uint* rectCount, uint* labelCount, uint* lineCount)
+{
+    *rectCount = *labelCount = *lineCount = 0;
+    
+    for (NvDsMetaList* pMeta = pFrameMeta->display_meta_list; pMeta != NULL; pMeta = pMeta->next)
+    {
+        NvDsDisplayMeta* pDisplayMeta = (NvDsDisplayMeta*) (pMeta->data);
+        *rectCount += pDisplayMeta->num_rects;
+        *labelCount += pDisplayMeta->num_labels;
+        *lineCount += pDisplayMeta->num_lines;
+    }
+    return g_list_length(pFrameMeta->display_meta_list);
+}
+
+SCENARIO( "An OdeDisplayMetaBuilder packs the elements of each frame into display meta", "[OdeDisplayMeta]" )
+{
+    GIVEN( "A batch of two frames and a new OdeDisplayMetaBuilder" ) 
+    {
+        GstBuffer* pBuffer = TestBatchBufferNew(2);
+        NvDsFrameMeta* pFirstFrameMeta = TestFrameMetaAdd(pBuffer, 0, 1);
+        NvDsFrameMeta* pSecondFrameMeta = TestFrameMetaAdd(pBuffer, 1, 1);
+        
+        OdeDisplayMetaBuilder displayMetaBuilder;
+        NvOSD_TextParams textParams{0};
+        NvOSD_LineParams lineParams{0};
+        
+        uint rectCount(0), labelCount(0), lineCount(0);
+
+        WHEN( "Elements are added to both frames while building" )
+        {
+            displayMetaBuilder.Begin(pBuffer);
+            
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META*2 + 1; i++)
+            {
+                std::string text = "label-" + std::to_string(i);
+                OdeDisplayMetaBuilder::AddLabel(pBuffer, pFirstFrameMeta, 
+                    textParams, text.c_str(), text.size());
+            }
+            for (uint i = 0; i < 5; i++)
+            {
+                OdeDisplayMetaBuilder::AddRect(pBuffer, pFirstFrameMeta, testRect(i));
+                OdeDisplayMetaBuilder::AddRect(pBuffer, pSecondFrameMeta, testRect(i));
+            }
+            OdeDisplayMetaBuilder::AddLine(pBuffer, pSecondFrameMeta, lineParams);
+            
+            THEN( "Nothing is added to the frames until flushed" )
+            {
+                REQUIRE( testDisplayMetaCount(pFirstFrameMeta, 
+                    &rectCount, &labelCount, &lineCount) == 0 );
+                REQUIRE( displayMetaBuilder.Flush() == 4 );
+            }
+            THEN( "The elements are packed into as few display meta as possible on flush" )
+            {
+                REQUIRE( displayMetaBuilder.Flush() == 4 );
+                
+                REQUIRE( testDisplayMetaCount(pFirstFrameMeta, 
+                    &rectCount, &labelCount, &lineCount) == 3 );
+                REQUIRE( rectCount == 5 );
+                REQUIRE( labelCount == MAX_ELEMENTS_IN_DISPLAY_META*2 + 1 );
+                REQUIRE( lineCount == 0 );
+                
+                NvDsDisplayMeta* pDisplayMeta = 
+                    (NvDsDisplayMeta*) pFirstFrameMeta->display_meta_list->data;
+                REQUIRE( std::string(pDisplayMeta->text_params[0].display_text) == "label-0" );
+                
+                REQUIRE( testDisplayMetaCount(pSecondFrameMeta, 
+                    &rectCount, &labelCount, &lineCount) == 1 );
+                REQUIRE( rectCount == 5 );
+                REQUIRE( labelCount == 0 );
+                REQUIRE( lineCount == 1 );
+            }
+        }
+        WHEN( "Elements are added with no builder current" )
+        {
+            OdeDisplayMetaBuilder::AddRect(pBuffer, pFirstFrameMeta, testRect(0));
+            OdeDisplayMetaBuilder::AddRect(pBuffer, pFirstFrameMeta, testRect(1));
+            
+            THEN( "Each element is added to the frame immediately" )
+            {
+                REQUIRE( testDisplayMetaCount(pFirstFrameMeta, 
+                    &rectCount, &labelCount, &lineCount) == 2 );
+                REQUIRE( rectCount == 2 );
+            }
+        }
+        WHEN( "Elements are added for a different buffer while building" )
+        {
+            GstBuffer* pOtherBuffer = TestBatchBufferNew(1);
+            NvDsFrameMeta* pOtherFrameMeta = TestFrameMetaAdd(pOtherBuffer, 0, 1);
+            
+            displayMetaBuilder.Begin(pBuffer);
+            OdeDisplayMetaBuilder::AddRect(pOtherBuffer, pOtherFrameMeta, testRect(0));
+            
+            THEN( "The elements are added to the other frame immediately" )
+            {
+                REQUIRE( testDisplayMetaCount(pOtherFrameMeta, 
+                    &rectCount, &labelCount, &lineCount) == 1 );
+                REQUIRE( displayMetaBuilder.Flush() == 0 );
+            }
+            gst_buffer_unref(pOtherBuffer);
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "Benchmark display meta coalescing for busy frames", "[.][benchmark][OdeDisplayMeta]" )
+{
+    GIVEN( "A batch of 16 frames with 64 labels and 16 rectangles per frame to display" ) 
+    {
+        OdeDisplayMetaBuilder displayMetaBuilder;
+        NvOSD_TextParams textParams{0};
+        
+        WHEN( "The elements are added with and without the builder" )
+        {
+            THEN( "The per-batch time is reported, including the batch meta release" )
+            {
+                BENCHMARK( "one display meta per element" )
+                {
+                    GstBuffer* pBuffer = TestBatchBufferNew(16);
+                    for (uint frame = 0; frame < 16; frame++)
+                    {
+                        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, frame, 1);
+                        for (uint i = 0; i < 64; i++)
+                        {
+                            OdeDisplayMetaBuilder::AddLabel(pBuffer, pFrameMeta, 
+                                textParams, "trigger = 1", 11);
+                        }
+                        for (uint i = 0; i < 16; i++)
+                        {
+                            OdeDisplayMetaBuilder::AddRect(pBuffer, pFrameMeta, testRect(i));
+                        }
+                    }
+                    gst_buffer_unref(pBuffer);
+                    return pBuffer;
+                };
+                BENCHMARK( "display meta builder" )
+                {
+                    GstBuffer* pBuffer = TestBatchBufferNew(16);
+                    displayMetaBuilder.Begin(pBuffer);
+                    for (uint frame = 0; frame < 16; frame++)
+                    {
+                        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, frame, 1);
+                        for (uint i = 0; i < 64; i++)
+                        {
+                            OdeDisplayMetaBuilder::AddLabel(pBuffer, pFrameMeta, 
+                                textParams, "trigger = 1", 11);
+                        }
+                        for (uint i = 0; i < 16; i++)
+                        {
+                            OdeDisplayMetaBuilder::AddRect(pBuffer, pFrameMeta, testRect(i));
+                        }
+                    }
+                    uint displayMetaCount = displayMetaBuilder.Flush();
+                    gst_buffer_unref(pBuffer);
+                    return displayMetaCount;
+                };
+            }
+        }
+    }
+}
@@ -24,6 +24,8 @@ THE SOFTWARE.
 
 #include "catch.hpp"
 #include "DslOdeHandlerBintr.h"
+#include "DslOdeAction.h"
+#include "DslTestBatchMeta.hpp"
 
 using namespace DSL;
 
@@ -156,3 +158,505 @@ SCENARIO( "A OdeHandlerBintr can add and remove a DetectionEvent", "[OdeHandlerB
     }
 }
 
+SCENARIO( "An OdeHandlerBintr dispatches Objects to Triggers by Class Id", "[OdeHandlerBintr]" )
+{
+    GIVEN( "A new OdeHandlerBintr with Triggers for specific and any Class Id" ) 
+    {
+        std::string odeHandlerName = "ode-handler";
+
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW(odeHandlerName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pClassZeroTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("class-0", 0, 0);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pClassTwoTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("class-2", 2, 0);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pAnyClassTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("any-class", DSL_ODE_ANY_CLASS, 0);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pLargeClassTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("large-class", 
+                DSL_ODE_HANDLER_MAX_DISPATCH_CLASS_ID + 1, 0);
+
+        REQUIRE( pOdeHandlerBintr->AddChild(pClassZeroTrigger) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pClassTwoTrigger) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pAnyClassTrigger) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pLargeClassTrigger) == true );
+
+        GstBuffer* pBuffer = TestBatchBufferNew(1);
+        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, 0, 1);
+        
+        TestObjectMetaAdd(pFrameMeta, 0, 1, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 1, 2, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 2, 3, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 2, 4, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, DSL_ODE_HANDLER_MAX_DISPATCH_CLASS_ID + 1, 
+            5, 10, 10, 100, 100, 0.9);
+
+        WHEN( "The batch is handled" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "Each Trigger is checked against the Objects of its Class Id only" )
+            {
+                REQUIRE( pClassZeroTrigger->m_triggered == 1 );
+                REQUIRE( pClassTwoTrigger->m_triggered == 2 );
+                REQUIRE( pAnyClassTrigger->m_triggered == 5 );
+                REQUIRE( pLargeClassTrigger->m_triggered == 1 );
+            }
+        }
+        WHEN( "A Trigger's Class Id is updated after the Trigger is added" )
+        {
+            pClassZeroTrigger->SetClassId(1);
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "The dispatch table is updated before the batch is handled" )
+            {
+                REQUIRE( pClassZeroTrigger->m_triggered == 1 );
+                REQUIRE( pClassTwoTrigger->m_triggered == 2 );
+            }
+        }
+        WHEN( "A Trigger is removed" )
+        {
+            REQUIRE( pOdeHandlerBintr->RemoveChild(pAnyClassTrigger) == true );
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "The removed Trigger is no longer checked" )
+            {
+                REQUIRE( pAnyClassTrigger->m_triggered == 0 );
+                REQUIRE( pClassTwoTrigger->m_triggered == 2 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "An OdeHandlerBintr adds each batch to its Triggers' metrics", "[OdeHandlerBintr]" )
+{
+    GIVEN( "A new OdeHandlerBintr with an Occurrence Trigger and an Action" ) 
+    {
+        std::string odeHandlerName = "ode-handler";
+
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW(odeHandlerName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pClassTwoTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("class-2", 2, 0);
+        DSL_ODE_ACTION_CALLBACK_PTR pAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW("callback", 
+                [](uint64_t, const wchar_t*, void*, void*, void*, void*){}, NULL);
+            
+        REQUIRE( pClassTwoTrigger->AddAction(pAction) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pClassTwoTrigger) == true );
+
+        GstBuffer* pBuffer = TestBatchBufferNew(2);
+        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, 0, 1);
+        TestObjectMetaAdd(pFrameMeta, 0, 1, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 2, 2, 10, 10, 100, 100, 0.9);
+        pFrameMeta = TestFrameMetaAdd(pBuffer, 1, 1);
+        TestObjectMetaAdd(pFrameMeta, 1, 3, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 2, 4, 10, 10, 100, 100, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 2, 5, 10, 10, 100, 100, 0.9);
+        
+        dsl_ode_trigger_metrics triggerMetrics;
+        dsl_ode_action_metrics actionMetrics;
+
+        WHEN( "The batch is handled twice" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            pClassTwoTrigger->GetMetrics(&triggerMetrics);
+            pAction->GetMetrics(&actionMetrics);
+            
+            THEN( "The Trigger's and Action's metrics count both batches" )
+            {
+                REQUIRE( triggerMetrics.batches == 2 );
+                REQUIRE( triggerMetrics.objects_evaluated == 10 );
+                REQUIRE( triggerMetrics.objects_passed == 6 );
+                REQUIRE( triggerMetrics.occurrences == 6 );
+                REQUIRE( triggerMetrics.evaluation_time_ns > 0 );
+                
+                uint64_t histogramTotal(0);
+                for (uint i = 0; i < DSL_ODE_METRICS_HISTOGRAM_BUCKETS; i++)
+                {
+                    histogramTotal += triggerMetrics.evaluation_time_histogram[i];
+                }
+                REQUIRE( histogramTotal == 2 );
+                
+                REQUIRE( actionMetrics.invocations == 6 );
+                REQUIRE( actionMetrics.execution_time_ns >= actionMetrics.max_execution_time_ns );
+            }
+        }
+        WHEN( "The Trigger's metrics are reset after the batch is handled" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            pClassTwoTrigger->ResetMetrics();
+            
+            pClassTwoTrigger->GetMetrics(&triggerMetrics);
+            
+            THEN( "The Trigger's metrics are zero and its triggered count is unchanged" )
+            {
+                REQUIRE( triggerMetrics.batches == 0 );
+                REQUIRE( triggerMetrics.objects_evaluated == 0 );
+                REQUIRE( triggerMetrics.occurrences == 0 );
+                REQUIRE( triggerMetrics.evaluation_time_ns == 0 );
+                REQUIRE( pClassTwoTrigger->m_triggered == 3 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "Benchmark the per-object cost of OdeHandlerBintr Trigger dispatch", "[.][benchmark][OdeHandlerBintr]" )
+{
+    GIVEN( "An OdeHandlerBintr with 40 Triggers across 10 Class Ids" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+
+        // same Triggers, held in a map as the Handler held them before the dispatch table
+        std::map<std::string, DSL_BASE_PTR> odeTriggers;
+        
+        for (uint i = 0; i < 40; i++)
+        {
+            std::string name = "trigger-" + std::to_string(i);
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = DSL_ODE_TRIGGER_SUMMATION_NEW(name.c_str(), 
+                (i%4) ? i%10 : DSL_ODE_ANY_CLASS, 0);
+            REQUIRE( pOdeHandlerBintr->AddChild(pOdeTrigger) == true );
+            odeTriggers[name] = pOdeTrigger;
+        }
+
+        // 30 streams with 20 objects each
+        GstBuffer* pBuffer = TestBatchBufferNew(30);
+        for (uint source = 0; source < 30; source++)
+        {
+            NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, source, 1);
+            for (uint object = 0; object < 20; object++)
+            {
+                TestObjectMetaAdd(pFrameMeta, object%10, object, 
+                    object*10, object*10, 50, 50, 0.9);
+            }
+        }
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+
+        WHEN( "The batch is handled with and without the Class Id dispatch table" )
+        {
+            THEN( "The per-batch time is reported for 600 objects" )
+            {
+                BENCHMARK( "map iteration with dynamic_pointer_cast per object" )
+                {
+                    for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+                        pFrameMetaList != NULL; pFrameMetaList = pFrameMetaList->next)
+                    {
+                        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+                        for (const auto &imap: odeTriggers)
+                        {
+                            std::dynamic_pointer_cast<OdeTrigger>(imap.second)->
+                                PreProcessFrame(pBuffer, pFrameMeta);
+                        }
+                        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; 
+                            pMeta != NULL; pMeta = pMeta->next)
+                        {
+                            for (const auto &imap: odeTriggers)
+                            {
+                                std::dynamic_pointer_cast<OdeTrigger>(imap.second)->
+                                    CheckForOccurrence(pBuffer, pFrameMeta, 
+                                        (NvDsObjectMeta*) (pMeta->data));
+                            }
+                        }
+                        for (const auto &imap: odeTriggers)
+                        {
+                            std::dynamic_pointer_cast<OdeTrigger>(imap.second)->
+                                PostProcessFrame(pBuffer, pFrameMeta);
+                        }
+                    }
+                    return pBatchMeta->num_frames_in_batch;
+                };
+                BENCHMARK( "Class Id dispatch table" )
+                {
+                    return pOdeHandlerBintr->HandlePadBuffer(pBuffer);
+                };
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "An OdeHandlerBintr's worker count can be updated", "[OdeHandlerBintr]" )
+{
+    GIVEN( "A new OdeHandlerBintr" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+
+        REQUIRE( pOdeHandlerBintr->GetWorkerCount() == 1 );
+
+        WHEN( "A valid worker count is set" )
+        {
+            REQUIRE( pOdeHandlerBintr->SetWorkerCount(4) == true );
+            
+            THEN( "The new worker count is returned on get" )
+            {
+                REQUIRE( pOdeHandlerBintr->GetWorkerCount() == 4 );
+            }
+        }
+        WHEN( "An invalid worker count is set" )
+        {
+            REQUIRE( pOdeHandlerBintr->SetWorkerCount(0) == false );
+            REQUIRE( pOdeHandlerBintr->SetWorkerCount(DSL_ODE_WORKER_POOL_MAX_WORKERS + 1) == false );
+            
+            THEN( "The worker count is unchanged" )
+            {
+                REQUIRE( pOdeHandlerBintr->GetWorkerCount() == 1 );
+            }
+        }
+    }
+}
+
+/**
+ * @brief Occurrence recorded by the order test's callback, in invocation order
+ */
+struct TestOccurrence
+{
+    const wchar_t* trigger;
+    void* frameMeta;
+    void* objectMeta;
+};
+
+static void test_occurrence_recorder(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    static_cast<std::vector<TestOccurrence>*>(client_data)->push_back(
+        {trigger, frame_meta, object_meta});
+}
+
+SCENARIO( "An OdeHandlerBintr invokes Triggers in the same order for any worker count", "[OdeHandlerBintr]" )
+{
+    GIVEN( "An OdeHandlerBintr with Triggers using Areas and limits, and a batch of 8 frames" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+        
+        std::vector<TestOccurrence> occurrences;
+        DSL_ODE_ACTION_CALLBACK_PTR pOdeAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW("recorder", test_occurrence_recorder, &occurrences);
+        DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW("area", 0, 0, 200, 1080, false);
+
+        std::vector<DSL_ODE_TRIGGER_PTR> odeTriggers;
+        for (uint i = 0; i < 6; i++)
+        {
+            std::string name = "trigger-" + std::to_string(i);
+            
+            // the Any Class Occurrence Trigger is limited to fewer events than in the batch
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = (i%2) 
+                ? (DSL_ODE_TRIGGER_PTR)DSL_ODE_TRIGGER_OCCURRENCE_NEW(name.c_str(), 
+                    (i%3) ? i%3 : DSL_ODE_ANY_CLASS, (i%3) ? 0 : 10)
+                : (DSL_ODE_TRIGGER_PTR)DSL_ODE_TRIGGER_ABSENCE_NEW(name.c_str(), i, 0);
+            REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );
+            if (i < 2)
+            {
+                REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );
+            }
+            REQUIRE( pOdeHandlerBintr->AddChild(pOdeTrigger) == true );
+            odeTriggers.push_back(pOdeTrigger);
+        }
+
+        GstBuffer* pBuffer = TestBatchBufferNew(8);
+        for (uint source = 0; source < 8; source++)
+        {
+            NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, source, 1);
+            for (uint object = 0; object < 10; object++)
+            {
+                TestObjectMetaAdd(pFrameMeta, (object+source)%4, object, 
+                    object*100, 100, 50, 50, 0.9);
+            }
+        }
+
+        WHEN( "The batch is handled with one worker and with four workers" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            std::vector<TestOccurrence> serialOccurrences(occurrences);
+            
+            occurrences.clear();
+            for (const auto& pOdeTrigger: odeTriggers)
+            {
+                pOdeTrigger->Reset();
+            }
+            REQUIRE( pOdeHandlerBintr->SetWorkerCount(4) == true );
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "The Actions are invoked with the same occurrences in the same order" )
+            {
+                REQUIRE( serialOccurrences.size() > 0 );
+                REQUIRE( occurrences.size() == serialOccurrences.size() );
+                for (uint i = 0; i < occurrences.size(); i++)
+                {
+                    REQUIRE( occurrences[i].trigger == serialOccurrences[i].trigger );
+                    REQUIRE( occurrences[i].frameMeta == serialOccurrences[i].frameMeta );
+                    REQUIRE( occurrences[i].objectMeta == serialOccurrences[i].objectMeta );
+                }
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+/**
+ * Client data for the Area removal callback, the Area is removed 
+ * from the Trigger when the callback is invoked.
+ */
+struct TestAreaRemoval
+{
+    DSL_ODE_TRIGGER_PTR pOdeTrigger;
+    DSL_ODE_AREA_PTR pOdeArea;
+};
+
+static void test_area_remover(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    TestAreaRemoval* pAreaRemoval = static_cast<TestAreaRemoval*>(client_data);
+    pAreaRemoval->pOdeTrigger->RemoveArea(pAreaRemoval->pOdeArea);
+}
+
+SCENARIO( "An OdeHandlerBintr re-evaluates the batch when an Action changes a Trigger's Areas", "[OdeHandlerBintr]" )
+{
+    GIVEN( "A Trigger with an Area, and a Trigger with an Action that removes the Area" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+        
+        DSL_ODE_TRIGGER_PTR pAreaTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW("area-trigger", 0, 0);
+        DSL_ODE_TRIGGER_PTR pRemoveTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW("remove-trigger", 1, 0);
+        DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW("area", 0, 0, 200, 1080, false);
+        
+        TestAreaRemoval areaRemoval{pAreaTrigger, pOdeArea};
+        DSL_ODE_ACTION_CALLBACK_PTR pOdeAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW("remover", test_area_remover, &areaRemoval);
+            
+        REQUIRE( pAreaTrigger->AddArea(pOdeArea) == true );
+        REQUIRE( pRemoveTrigger->AddAction(pOdeAction) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pAreaTrigger) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pRemoveTrigger) == true );
+
+        // Each frame has one Object inside and one outside of the Area. 
+        // The first frame's last Object triggers the removal of the Area.
+        GstBuffer* pBuffer = TestBatchBufferNew(2);
+        for (uint source = 0; source < 2; source++)
+        {
+            NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, source, 1);
+            TestObjectMetaAdd(pFrameMeta, 0, 1, 10, 100, 50, 50, 0.9);
+            TestObjectMetaAdd(pFrameMeta, 0, 2, 500, 100, 50, 50, 0.9);
+            if (source == 0)
+            {
+                TestObjectMetaAdd(pFrameMeta, 1, 3, 500, 100, 50, 50, 0.9);
+            }
+        }
+
+        WHEN( "The batch is handled" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "The frames after the removal are checked without the Area" )
+            {
+                REQUIRE( pRemoveTrigger->m_triggered == 1 );
+                REQUIRE( pAreaTrigger->m_triggered == 3 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "An OdeHandlerBintr re-evaluates the rest of the frame when an Action changes a Trigger's Areas", "[OdeHandlerBintr]" )
+{
+    GIVEN( "A Trigger with an Area, and a Trigger with an Action that removes the Area" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+        
+        DSL_ODE_TRIGGER_PTR pAreaTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW("area-trigger", 0, 0);
+        DSL_ODE_TRIGGER_PTR pRemoveTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW("remove-trigger", 1, 0);
+        DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW("area", 0, 0, 200, 1080, false);
+        
+        TestAreaRemoval areaRemoval{pAreaTrigger, pOdeArea};
+        DSL_ODE_ACTION_CALLBACK_PTR pOdeAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW("remover", test_area_remover, &areaRemoval);
+            
+        REQUIRE( pAreaTrigger->AddArea(pOdeArea) == true );
+        REQUIRE( pRemoveTrigger->AddAction(pOdeAction) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pAreaTrigger) == true );
+        REQUIRE( pOdeHandlerBintr->AddChild(pRemoveTrigger) == true );
+
+        // The frame's first Object triggers the removal of the Area, followed 
+        // by one Object inside and two outside of the Area.
+        GstBuffer* pBuffer = TestBatchBufferNew(1);
+        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, 0, 1);
+        TestObjectMetaAdd(pFrameMeta, 1, 1, 500, 100, 50, 50, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 0, 2, 10, 100, 50, 50, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 0, 3, 500, 100, 50, 50, 0.9);
+        TestObjectMetaAdd(pFrameMeta, 0, 4, 800, 100, 50, 50, 0.9);
+
+        WHEN( "The batch is handled" )
+        {
+            REQUIRE( pOdeHandlerBintr->HandlePadBuffer(pBuffer) == true );
+            
+            THEN( "The Objects after the removal are checked without the Area" )
+            {
+                REQUIRE( pRemoveTrigger->m_triggered == 1 );
+                REQUIRE( pAreaTrigger->m_triggered == 3 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "Benchmark OdeHandlerBintr scaling from 1 to N workers", "[.][benchmark][OdeHandlerBintr]" )
+{
+    GIVEN( "An OdeHandlerBintr with 32 Triggers, each with 16 Areas" ) 
+    {
+        DSL_ODE_HANDLER_PTR pOdeHandlerBintr = DSL_ODE_HANDLER_NEW("ode-handler");
+
+        std::vector<DSL_ODE_AREA_PTR> odeAreas;
+        for (uint i = 0; i < 16; i++)
+        {
+            std::string name = "area-" + std::to_string(i);
+            odeAreas.push_back(DSL_ODE_AREA_NEW(name.c_str(), 
+                (i%4)*480 + 100, (i/4)*270 + 60, 20, 20, false));
+        }
+        for (uint i = 0; i < 32; i++)
+        {
+            std::string name = "trigger-" + std::to_string(i);
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = DSL_ODE_TRIGGER_SUMMATION_NEW(name.c_str(), 
+                (i%4) ? i%10 : DSL_ODE_ANY_CLASS, 0);
+            for (const auto& pOdeArea: odeAreas)
+            {
+                REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );
+            }
+            REQUIRE( pOdeHandlerBintr->AddChild(pOdeTrigger) == true );
+        }
+
+        // 32 streams with 100 objects each, spread over the frame
+        GstBuffer* pBuffer = TestBatchBufferNew(32);
+        for (uint source = 0; source < 32; source++)
+        {
+            NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, source, 1);
+            for (uint object = 0; object < 100; object++)
+            {
+                TestObjectMetaAdd(pFrameMeta, object%10, object, 
+                    (object*197)%1880, (object*113)%1040, 40, 40, 0.9);
+            }
+        }
+
+        WHEN( "The batch is handled with an increasing number of workers" )
+        {
+            THEN( "The per-batch time is reported for 3200 objects at each worker count" )
+            {
+                uint maxWorkers = std::min(std::max(g_get_num_processors(), 1u), 
+                    (uint)DSL_ODE_WORKER_POOL_MAX_WORKERS);
+                    
+                for (uint workers = 1; workers <= maxWorkers; workers *= 2)
+                {
+                    REQUIRE( pOdeHandlerBintr->SetWorkerCount(workers) == true );
+                    
+                    BENCHMARK( std::to_string(workers) + " worker(s)" )
+                    {
+                        return pOdeHandlerBintr->HandlePadBuffer(pBuffer);
+                    };
+                }
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
@@ -0,0 +1,304 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeJournal.h"
+
+#include <unistd.h>
+
+using namespace DSL;
+
+/**
+ * Writes a number of records to a journal, alternating between two
+ * Triggers and four sources, with the NTP timestamp set to the record number.
+ */
+static void write_journal_records(OdeJournalWriter& journalWriter, uint count)
+{
+    for (uint i = 0; i < count; i++)
+    {
+        dsl_ode_occurrence_record* pRecord = journalWriter.ClaimRecord();
+        REQUIRE( pRecord != NULL );
+        
+        *pRecord = {0};
+        pRecord->event_id = i+1;
+        pRecord->trigger_index = i % 2;
+        pRecord->source_id = i % 4;
+        pRecord->ntp_timestamp = i;
+        pRecord->class_id = 1;
+        pRecord->is_object = true;
+        journalWriter.CommitRecord();
+    }
+}
+
+SCENARIO( "An OdeJournalWriter rotates to a new file when full", "[OdeJournal]" )
+{
+    GIVEN( "A new OdeJournalWriter with capacity for 100 records per file" ) 
+    {
+        std::string filePath("./test-journal.dslj");
+        
+        WHEN( "250 records are written" )
+        {
+            {
+                OdeJournalWriter journalWriter(filePath.c_str(), 
+                    sizeof(OdeJournalHeader) + 100*sizeof(dsl_ode_occurrence_record));
+                REQUIRE( journalWriter.GetCapacity() == 100 );
+                
+                journalWriter.AddTriggerName(0, "trigger-0");
+                journalWriter.AddTriggerName(1, "trigger-1");
+                write_journal_records(journalWriter, 250);
+                
+                REQUIRE( journalWriter.GetFileCount() == 3 );
+            }
+            THEN( "All records are read back from the three files" )
+            {
+                OdeJournalReader journalReader0(filePath.c_str());
+                OdeJournalReader journalReader1((filePath + ".1").c_str());
+                OdeJournalReader journalReader2((filePath + ".2").c_str());
+                REQUIRE( journalReader0.IsValid() );
+                REQUIRE( journalReader1.IsValid() );
+                REQUIRE( journalReader2.IsValid() );
+                
+                uint64_t lastEventId(0);
+                auto checkOrder = [&](const dsl_ode_occurrence_record& record)
+                {
+                    REQUIRE( record.event_id == lastEventId+1 );
+                    lastEventId = record.event_id;
+                };
+                REQUIRE( journalReader0.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, checkOrder) == 100 );
+                REQUIRE( journalReader1.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, checkOrder) == 100 );
+                REQUIRE( journalReader2.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, checkOrder) == 50 );
+                
+                // Trigger names are copied to each new file
+                REQUIRE( journalReader2.GetTriggerName(1) == "trigger-1" );
+                REQUIRE( journalReader2.GetTriggerName(2) == "" );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalWriter deletes the oldest file when the maximum is exceeded", "[OdeJournal]" )
+{
+    GIVEN( "A new OdeJournalWriter with capacity for 100 records per file and 2 files" ) 
+    {
+        std::string filePath("./test-journal-max-files.dslj");
+        
+        WHEN( "450 records are written" )
+        {
+            {
+                OdeJournalWriter journalWriter(filePath.c_str(), 
+                    sizeof(OdeJournalHeader) + 100*sizeof(dsl_ode_occurrence_record), 2);
+                
+                write_journal_records(journalWriter, 450);
+                
+                REQUIRE( journalWriter.GetFileCount() == 5 );
+            }
+            THEN( "Only the last two files remain" )
+            {
+                REQUIRE( access(filePath.c_str(), F_OK) != 0 );
+                REQUIRE( access((filePath + ".1").c_str(), F_OK) != 0 );
+                REQUIRE( access((filePath + ".2").c_str(), F_OK) != 0 );
+                
+                OdeJournalReader journalReader3((filePath + ".3").c_str());
+                OdeJournalReader journalReader4((filePath + ".4").c_str());
+                REQUIRE( journalReader3.IsValid() );
+                REQUIRE( journalReader4.IsValid() );
+                REQUIRE( journalReader3.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, nullptr) == 100 );
+                REQUIRE( journalReader4.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, nullptr) == 50 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalWriter waits for claimed records to be committed before rotating", "[OdeJournal]" )
+{
+    GIVEN( "A new OdeJournalWriter with capacity for 100 records per file" ) 
+    {
+        std::string filePath("./test-journal-in-flight.dslj");
+        
+        WHEN( "A record is held while another thread writes enough records to rotate twice" )
+        {
+            uint fileCountWhileHeld(0);
+            {
+                OdeJournalWriter journalWriter(filePath.c_str(), 
+                    sizeof(OdeJournalHeader) + 100*sizeof(dsl_ode_occurrence_record));
+                
+                dsl_ode_occurrence_record* pHeldRecord = journalWriter.ClaimRecord();
+                REQUIRE( pHeldRecord != NULL );
+                
+                std::thread writerThread([&journalWriter]()
+                {
+                    write_journal_records(journalWriter, 250);
+                });
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                fileCountWhileHeld = journalWriter.GetFileCount();
+                
+                *pHeldRecord = {0};
+                pHeldRecord->event_id = 1000;
+                journalWriter.CommitRecord();
+                writerThread.join();
+                
+                REQUIRE( journalWriter.GetFileCount() == 3 );
+            }
+            THEN( "The first rotation waits until the held record is committed" )
+            {
+                REQUIRE( fileCountWhileHeld == 1 );
+                
+                OdeJournalReader journalReader0(filePath.c_str());
+                REQUIRE( journalReader0.IsValid() );
+                
+                uint64_t heldRecords(0);
+                REQUIRE( journalReader0.Scan(NULL, DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, 
+                    [&](const dsl_ode_occurrence_record& record)
+                    {
+                        heldRecords += (record.event_id == 1000);
+                    }) == 100 );
+                REQUIRE( heldRecords == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalWriter throws an exception when the first file can't be created", "[OdeJournal]" )
+{
+    GIVEN( "A file path in a directory that does not exist" ) 
+    {
+        std::string filePath("./no-such-dir/test-journal.dslj");
+        
+        WHEN( "A new OdeJournalWriter is created" )
+        {
+            THEN( "A runtime error is thrown" )
+            {
+                REQUIRE_THROWS_AS( OdeJournalWriter(filePath.c_str(), 
+                    sizeof(OdeJournalHeader) + 100*sizeof(dsl_ode_occurrence_record)), 
+                    std::runtime_error );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalReader filters records correctly", "[OdeJournal]" )
+{
+    GIVEN( "A journal file with 100 records" ) 
+    {
+        std::string filePath("./test-journal.dslj");
+        std::string csvFilePath("./test-journal.csv");
+        {
+            OdeJournalWriter journalWriter(filePath.c_str(), 1024*1024);
+            journalWriter.AddTriggerName(0, "trigger-0");
+            journalWriter.AddTriggerName(1, "trigger-1");
+            write_journal_records(journalWriter, 100);
+        }
+        OdeJournalReader journalReader(filePath.c_str());
+        REQUIRE( journalReader.IsValid() );
+        
+        WHEN( "The records are filtered by Trigger, source and time" )
+        {
+            THEN( "Only the matching records are scanned" )
+            {
+                REQUIRE( journalReader.Scan("trigger-1", DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, nullptr) == 50 );
+                REQUIRE( journalReader.Scan("unknown", DSL_ODE_ANY_SOURCE, 0, UINT64_MAX, nullptr) == 0 );
+                REQUIRE( journalReader.Scan(NULL, 3, 0, UINT64_MAX, nullptr) == 25 );
+                REQUIRE( journalReader.Scan(NULL, DSL_ODE_ANY_SOURCE, 10, 19, nullptr) == 10 );
+                
+                // trigger-0 records are on sources 0 and 2 only
+                REQUIRE( journalReader.Scan("trigger-0", 1, 0, UINT64_MAX, nullptr) == 0 );
+                REQUIRE( journalReader.Scan("trigger-0", 2, 0, 49, nullptr) == 12 );
+            }
+        }
+        WHEN( "The records are converted to CSV" )
+        {
+            REQUIRE( journalReader.WriteCsv(csvFilePath.c_str(), 
+                "trigger-1", DSL_ODE_ANY_SOURCE, 0, UINT64_MAX) == 50 );
+            
+            THEN( "The CSV file has a header line and one line per record" )
+            {
+                std::ifstream csvFile(csvFilePath);
+                std::string line;
+                uint lines(0);
+                std::getline(csvFile, line);
+                REQUIRE( line.find("event_id,trigger") == 0 );
+                while (std::getline(csvFile, line))
+                {
+                    REQUIRE( line.find(",trigger-1,") != std::string::npos );
+                    lines++;
+                }
+                REQUIRE( lines == 50 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalReader rejects a file that is not a journal", "[OdeJournal]" )
+{
+    GIVEN( "A file that is not a journal" ) 
+    {
+        std::string filePath("./test-journal.txt");
+        {
+            std::ofstream textFile(filePath);
+            textFile << std::string(8192, 'x');
+        }
+        
+        WHEN( "A new OdeJournalReader is created for the file" )
+        {
+            OdeJournalReader journalReader(filePath.c_str());
+            
+            THEN( "The Reader is invalid" )
+            {
+                REQUIRE( journalReader.IsValid() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeJournalWriter sustains a high record rate", "[.][benchmark][OdeJournal]" )
+{
+    GIVEN( "A new OdeJournalWriter rotating every 64 MB, keeping 2 files" ) 
+    {
+        std::string filePath("./test-journal-benchmark.dslj");
+        
+        OdeJournalWriter journalWriter(filePath.c_str(), 64*1024*1024, 2);
+        journalWriter.AddTriggerName(0, "trigger-0");
+
+        WHEN( "One million records are claimed and filled" )
+        {
+            THEN( "The time per record, including rotation, is a small fraction of a microsecond" )
+            {
+                BENCHMARK( "1M records" )
+                {
+                    for (uint i = 0; i < 1000000; i++)
+                    {
+                        dsl_ode_occurrence_record* pRecord = journalWriter.ClaimRecord();
+                        *pRecord = {0};
+                        pRecord->event_id = i+1;
+                        pRecord->source_id = i % 4;
+                        pRecord->ntp_timestamp = i;
+                        journalWriter.CommitRecord();
+                    }
+                    return journalWriter.GetFileCount();
+                };
+            }
+        }
+    }
+}
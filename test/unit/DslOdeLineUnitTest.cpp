@@ -0,0 +1,259 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeLine.h"
+
+using namespace DSL;
+
+SCENARIO( "A new OdeLine is created correctly", "[OdeLine]" )
+{
+    GIVEN( "Attributes for a new OdeLine" ) 
+    {
+        std::string odeLineName("ode-line");
+        uint x1(100), y1(200), x2(300), y2(400);
+        bool display(true);
+
+        WHEN( "A new OdeLine is created" )
+        {
+            DSL_ODE_LINE_PTR pOdeLine = 
+                DSL_ODE_LINE_NEW(odeLineName.c_str(), x1, y1, x2, y2, display);
+
+            THEN( "The OdeLine's memebers are setup and returned correctly" )
+            {
+                std::string retName = pOdeLine->GetCStrName();
+                REQUIRE( odeLineName == retName );
+
+                uint retX1(0), retY1(0), retX2(0), retY2(0);
+                bool retDisplay(false);
+                pOdeLine->GetLine(&retX1, &retY1, &retX2, &retY2, &retDisplay);
+                REQUIRE( retX1 == x1 );
+                REQUIRE( retY1 == y1 );
+                REQUIRE( retX2 == x2 );
+                REQUIRE( retY2 == y2 );
+                REQUIRE( retDisplay == display );
+
+                double retRed(0), retGreen(0), retBlue(0), retAlpha(0);
+                pOdeLine->GetColor(&retRed, &retGreen, &retBlue, &retAlpha);
+                REQUIRE( retRed == 1.0 );
+                REQUIRE( retGreen == 1.0 );
+                REQUIRE( retBlue == 1.0 );
+                REQUIRE( retAlpha == 0.8 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeLine's line segment and color can be Set/Get", "[OdeLine]" )
+{
+    GIVEN( "A new OdeLine" ) 
+    {
+        DSL_ODE_LINE_PTR pOdeLine = DSL_ODE_LINE_NEW("ode-line", 0, 0, 10, 10, false);
+        uint64_t updateCount = OdeLine::s_updateCount;
+
+        WHEN( "The OdeLine's line segment and color are set" )
+        {
+            pOdeLine->SetLine(5, 6, 7, 8, true);
+            pOdeLine->SetColor(0.1, 0.2, 0.3, 0.4);
+
+            THEN( "The new values are returned and the update count is incremented" )
+            {
+                uint retX1(0), retY1(0), retX2(0), retY2(0);
+                bool retDisplay(false);
+                pOdeLine->GetLine(&retX1, &retY1, &retX2, &retY2, &retDisplay);
+                REQUIRE( retX1 == 5 );
+                REQUIRE( retY1 == 6 );
+                REQUIRE( retX2 == 7 );
+                REQUIRE( retY2 == 8 );
+                REQUIRE( retDisplay == true );
+
+                double retRed(0), retGreen(0), retBlue(0), retAlpha(0);
+                pOdeLine->GetColor(&retRed, &retGreen, &retBlue, &retAlpha);
+                REQUIRE( retRed == 0.1 );
+                REQUIRE( retGreen == 0.2 );
+                REQUIRE( retBlue == 0.3 );
+                REQUIRE( retAlpha == 0.4 );
+                
+                REQUIRE( OdeLine::s_updateCount == updateCount + 2 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeLine detects directional crossings", "[OdeLine]" )
+{
+    GIVEN( "A horizontal line from left to right across the frame" ) 
+    {
+        DSL_ODE_LINE_PTR pOdeLine = DSL_ODE_LINE_NEW("ode-line", 100, 500, 900, 500, false);
+        OdeLineMovements movements;
+        std::vector<int8_t> crossings;
+        
+        WHEN( "Objects move across, along, and beyond the end of the line" )
+        {
+            movements.Add(500, 400, 500, 600);  // down across
+            movements.Add(500, 600, 500, 400);  // up across
+            movements.Add(500, 400, 500, 450);  // down, short of the line
+            movements.Add(200, 400, 800, 400);  // along, above the line
+            movements.Add(950, 400, 950, 600);  // down, beyond the end of the line
+            movements.Add(500, 400, 500, 500);  // down, onto the line
+            movements.Add(500, 500, 500, 600);  // down, off of the line
+            movements.Add(500, 500, 500, 500);  // stationary on the line
+            
+            OdeLine::CheckCrossings(pOdeLine->m_lineParams, movements, crossings);
+            
+            THEN( "Only the movements across the line are crossings, left side above" )
+            {
+                REQUIRE( crossings == std::vector<int8_t>({1, -1, 0, 0, 0, 0, 1, 0}) );
+            }
+        }
+    }
+}
+
+/**
+ * Brute force crossing test with double precision and explicit branches, 
+ * for comparison with OdeLine::CheckCrossings
+ */
+static int test_line_crossing(const NvOSD_LineParams& line, 
+    double x0, double y0, double x1, double y1)
+{
+    double dx = (double)line.x2 - line.x1;
+    double dy = (double)line.y2 - line.y1;
+    double fromSide = dx*(y0 - line.y1) - dy*(x0 - line.x1);
+    double toSide = dx*(y1 - line.y1) - dy*(x1 - line.x1);
+    
+    bool fromRight = fromSide > 0;
+    bool toRight = toSide > 0;
+    if (fromRight == toRight)
+    {
+        return 0;
+    }
+    double mx = x1 - x0;
+    double my = y1 - y0;
+    double startSide = mx*(line.y1 - y0) - my*(line.x1 - x0);
+    double endSide = mx*(line.y2 - y0) - my*(line.x2 - x0);
+    if ((startSide > 0) == (endSide > 0))
+    {
+        return 0;
+    }
+    return toRight ? 1 : -1;
+}
+
+SCENARIO( "An OdeLine matches a brute force crossing test over random movements", "[OdeLine]" )
+{
+    GIVEN( "Random lines and movements on integer coordinates" ) 
+    {
+        std::srand(97531);
+        NvOSD_LineParams line = {0};
+        OdeLineMovements movements;
+        std::vector<int8_t> crossings;
+        
+        WHEN( "The crossings are tested with both methods" )
+        {
+            THEN( "The results are the same" )
+            {
+                for (uint i = 0; i < 100; i++)
+                {
+                    line.x1 = std::rand() % 1920;
+                    line.y1 = std::rand() % 1080;
+                    line.x2 = std::rand() % 1920;
+                    line.y2 = std::rand() % 1080;
+                    
+                    movements.Clear();
+                    for (uint j = 0; j < 1000; j++)
+                    {
+                        float x0 = std::rand() % 1920;
+                        float y0 = std::rand() % 1080;
+                        movements.Add(x0, y0, 
+                            x0 + std::rand() % 201 - 100, y0 + std::rand() % 201 - 100);
+                    }
+                    OdeLine::CheckCrossings(line, movements, crossings);
+                    
+                    for (uint j = 0; j < movements.Size(); j++)
+                    {
+                        REQUIRE( crossings[j] == test_line_crossing(line, movements.x0[j], 
+                            movements.y0[j], movements.x1[j], movements.y1[j]) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "Benchmark the batched crossing test against a test per Object", "[.][benchmark][OdeLine]" )
+{
+    GIVEN( "Four lines and a frame of 1,000 Object movements" ) 
+    {
+        std::srand(8642);
+        std::vector<NvOSD_LineParams> lines(4);
+        for (auto& line: lines)
+        {
+            line.x1 = std::rand() % 1920;
+            line.y1 = std::rand() % 1080;
+            line.x2 = std::rand() % 1920;
+            line.y2 = std::rand() % 1080;
+        }
+        OdeLineMovements movements;
+        for (uint j = 0; j < 1000; j++)
+        {
+            float x0 = std::rand() % 1920;
+            float y0 = std::rand() % 1080;
+            movements.Add(x0, y0, x0 + std::rand() % 41 - 20, y0 + std::rand() % 41 - 20);
+        }
+        std::vector<int8_t> crossings;
+        
+        WHEN( "The crossings are tested" )
+        {
+            THEN( "The batched test is faster" )
+            {
+                BENCHMARK( "Batched, 4 lines x 1000 Objects" )
+                {
+                    int total(0);
+                    for (auto& line: lines)
+                    {
+                        OdeLine::CheckCrossings(line, movements, crossings);
+                        for (auto crossing: crossings)
+                        {
+                            total += crossing;
+                        }
+                    }
+                    return total;
+                };
+                BENCHMARK( "Per Object, 4 lines x 1000 Objects" )
+                {
+                    int total(0);
+                    for (uint j = 0; j < movements.Size(); j++)
+                    {
+                        for (auto& line: lines)
+                        {
+                            total += test_line_crossing(line, movements.x0[j], 
+                                movements.y0[j], movements.x1[j], movements.y1[j]);
+                        }
+                    }
+                    return total;
+                };
+            }
+        }
+    }
+}
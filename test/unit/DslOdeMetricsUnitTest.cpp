@@ -0,0 +1,121 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslOdeMetrics.h"
+
+using namespace DSL;
+
+SCENARIO( "OdeTriggerMetrics accumulates each batch added", "[OdeMetrics]" )
+{
+    GIVEN( "A new OdeTriggerMetrics" ) 
+    {
+        OdeTriggerMetrics triggerMetrics;
+        dsl_ode_trigger_metrics metrics;
+        
+        WHEN( "Batches are added" )
+        {
+            triggerMetrics.AddBatch(10, 4, 2, 500);
+            triggerMetrics.AddBatch(20, 6, 3, 3000);
+            triggerMetrics.Get(&metrics);
+            
+            THEN( "The counters are the sum of the batches" )
+            {
+                REQUIRE( metrics.batches == 2 );
+                REQUIRE( metrics.objects_evaluated == 30 );
+                REQUIRE( metrics.objects_passed == 10 );
+                REQUIRE( metrics.occurrences == 5 );
+                REQUIRE( metrics.evaluation_time_ns == 3500 );
+                REQUIRE( metrics.evaluation_time_histogram[0] == 1 );
+                REQUIRE( metrics.evaluation_time_histogram[2] == 1 );
+            }
+            THEN( "All counters are zero once reset" )
+            {
+                triggerMetrics.Reset();
+                triggerMetrics.Get(&metrics);
+                
+                REQUIRE( metrics.batches == 0 );
+                REQUIRE( metrics.objects_evaluated == 0 );
+                REQUIRE( metrics.objects_passed == 0 );
+                REQUIRE( metrics.occurrences == 0 );
+                REQUIRE( metrics.evaluation_time_ns == 0 );
+                for (uint i = 0; i < DSL_ODE_METRICS_HISTOGRAM_BUCKETS; i++)
+                {
+                    REQUIRE( metrics.evaluation_time_histogram[i] == 0 );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "OdeTriggerMetrics buckets evaluation times by powers of two microseconds", "[OdeMetrics]" )
+{
+    GIVEN( "A range of evaluation times" ) 
+    {
+        THEN( "Each time is in the correct bucket" )
+        {
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(0) == 0 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(999) == 0 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(1000) == 1 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(1999) == 1 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(2000) == 2 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(1000000) == 10 );
+            REQUIRE( OdeTriggerMetrics::HistogramBucket(UINT64_MAX) == 
+                DSL_ODE_METRICS_HISTOGRAM_BUCKETS-1 );
+        }
+    }
+}
+
+SCENARIO( "OdeActionMetrics accumulates each invocation added", "[OdeMetrics]" )
+{
+    GIVEN( "A new OdeActionMetrics" ) 
+    {
+        OdeActionMetrics actionMetrics;
+        dsl_ode_action_metrics metrics = {0};
+        
+        WHEN( "Invocations are added" )
+        {
+            actionMetrics.AddInvocation(300);
+            actionMetrics.AddInvocation(700);
+            actionMetrics.AddInvocation(100);
+            actionMetrics.Get(&metrics);
+            
+            THEN( "The counters and maximum time are correct" )
+            {
+                REQUIRE( metrics.invocations == 3 );
+                REQUIRE( metrics.execution_time_ns == 1100 );
+                REQUIRE( metrics.max_execution_time_ns == 700 );
+            }
+            THEN( "All counters are zero once reset" )
+            {
+                actionMetrics.Reset();
+                actionMetrics.Get(&metrics);
+                
+                REQUIRE( metrics.invocations == 0 );
+                REQUIRE( metrics.execution_time_ns == 0 );
+                REQUIRE( metrics.max_execution_time_ns == 0 );
+            }
+        }
+    }
+}
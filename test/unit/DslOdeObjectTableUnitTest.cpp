@@ -0,0 +1,125 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeObjectTable.h"
+
+using namespace DSL;
+
+SCENARIO( "An OdeObjectTable finds, inserts, and erases entries correctly", "[OdeObjectTable]" )
+{
+    GIVEN( "A new OdeObjectTable" ) 
+    {
+        OdeObjectTable<uint> table(16);
+        
+        REQUIRE( table.Size() == 0 );
+        REQUIRE( table.Capacity() == 16 );
+
+        WHEN( "Entries are inserted for two Sources" )
+        {
+            bool inserted(false);
+            for (uint i = 0; i < 100; i++)
+            {
+                table.FindOrInsert(i % 2, i, &inserted) = i;
+                REQUIRE( inserted == true );
+            }
+            THEN( "Each entry is found under its own Source" )
+            {
+                REQUIRE( table.Size() == 100 );
+                for (uint i = 0; i < 100; i++)
+                {
+                    REQUIRE( table.Find(i % 2, i) != NULL );
+                    REQUIRE( *table.Find(i % 2, i) == i );
+                    REQUIRE( table.Find((i + 1) % 2, i) == NULL );
+                }
+                REQUIRE( table.FindOrInsert(0, 0, &inserted) == 0 );
+                REQUIRE( inserted == false );
+            }
+            THEN( "Erased entries are no longer found and the rest remain" )
+            {
+                for (uint i = 0; i < 100; i += 3)
+                {
+                    REQUIRE( table.Erase(i % 2, i) == true );
+                }
+                REQUIRE( table.Erase(0, 0) == false );
+                for (uint i = 0; i < 100; i++)
+                {
+                    REQUIRE( (table.Find(i % 2, i) == NULL) == (i % 3 == 0) );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeObjectTable's EraseIf amortizes the sweep over inserts", "[OdeObjectTable]" )
+{
+    GIVEN( "A full OdeObjectTable" ) 
+    {
+        OdeObjectTable<uint> table(64);
+        
+        bool inserted(false);
+        uint objectId(0);
+        while (!table.IsFull())
+        {
+            table.FindOrInsert(0, objectId, &inserted) = objectId;
+            objectId++;
+        }
+        uint size(table.Size());
+
+        WHEN( "A sweep removes at least a quarter of the entries" )
+        {
+            uint erased = table.EraseIf([](uint sourceId, uint64_t objectId, uint& value)
+                {return value % 2 == 0;});
+                
+            THEN( "The capacity is unchanged and only the matched entries are removed" )
+            {
+                REQUIRE( erased == (size + 1) / 2 );
+                REQUIRE( table.Size() == size - erased );
+                REQUIRE( table.Capacity() == 64 );
+                for (uint i = 0; i < objectId; i++)
+                {
+                    REQUIRE( (table.Find(0, i) == NULL) == (i % 2 == 0) );
+                }
+            }
+        }
+        WHEN( "A sweep removes less than a quarter of the entries" )
+        {
+            uint erased = table.EraseIf([](uint sourceId, uint64_t objectId, uint& value)
+                {return value == 0;});
+                
+            THEN( "The capacity is doubled so that the next inserts don't sweep again" )
+            {
+                REQUIRE( erased == 1 );
+                REQUIRE( table.Size() == size - 1 );
+                REQUIRE( table.Capacity() == 128 );
+                REQUIRE( table.IsFull() == false );
+                for (uint i = 1; i < objectId; i++)
+                {
+                    REQUIRE( *table.Find(0, i) == i );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,302 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeTrackStore.h"
+
+using namespace DSL;
+
+SCENARIO( "An OdeTrackStore records when each Object is first and last seen", "[OdeTrackStore]" )
+{
+    GIVEN( "A new OdeTrackStore with a maximum age of two frames" ) 
+    {
+        OdeTrackStore store(2);
+        
+        REQUIRE( store.Size() == 0 );
+        REQUIRE( store.Find(1) == NULL );
+        
+        WHEN( "An Object is seen on two consecutive frames" )
+        {
+            bool inserted(false);
+            
+            store.NewFrame();
+            store.Touch(1, 10, 1000, &inserted);
+            REQUIRE( inserted == true );
+            
+            store.NewFrame();
+            OdeTrack& track = store.Touch(1, 11, 2000, &inserted);
+            REQUIRE( inserted == false );
+            
+            THEN( "The track holds the first and last frame and timestamp" )
+            {
+                REQUIRE( store.Size() == 1 );
+                REQUIRE( store.Find(1) == &track );
+                REQUIRE( track.objectId == 1 );
+                REQUIRE( track.firstFrame == 10 );
+                REQUIRE( track.firstTimeNs == 1000 );
+                REQUIRE( track.lastFrame == 11 );
+                REQUIRE( track.lastTimeNs == 2000 );
+                REQUIRE( track.triggered == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrackStore expires the Objects not seen within the maximum age", "[OdeTrackStore]" )
+{
+    GIVEN( "An OdeTrackStore with a maximum age of two frames and three Objects" ) 
+    {
+        OdeTrackStore store(2);
+        bool inserted(false);
+        std::vector<uint64_t> expired;
+        auto collect = [&](OdeTrack& track){expired.push_back(track.objectId);};
+        
+        store.NewFrame();
+        store.Touch(1, 0, 0, &inserted);
+        store.Touch(2, 0, 0, &inserted);
+        store.Touch(3, 0, 0, &inserted);
+        
+        WHEN( "Only the second Object is seen on the following frames" )
+        {
+            store.NewFrame();
+            store.Touch(2, 1, 0, &inserted);
+            REQUIRE( store.Expire(collect) == 0 );
+            
+            store.NewFrame();
+            store.Touch(2, 2, 0, &inserted);
+            REQUIRE( store.Expire(collect) == 0 );
+            
+            store.NewFrame();
+            store.Touch(2, 3, 0, &inserted);
+            
+            THEN( "The first and third Objects expire, oldest first, after two unseen frames" )
+            {
+                REQUIRE( store.Expire(collect) == 2 );
+                REQUIRE( expired == std::vector<uint64_t>({1, 3}) );
+                REQUIRE( store.Size() == 1 );
+                REQUIRE( store.Find(1) == NULL );
+                REQUIRE( store.Find(2) != NULL );
+                REQUIRE( store.Find(3) == NULL );
+            }
+        }
+        WHEN( "An expired Object is seen again" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                store.NewFrame();
+            }
+            REQUIRE( store.Expire(collect) == 3 );
+            REQUIRE( store.Size() == 0 );
+            
+            OdeTrack& track = store.Touch(1, 3, 3000, &inserted);
+            
+            THEN( "A new track is added, reusing a freed entry" )
+            {
+                REQUIRE( inserted == true );
+                REQUIRE( track.firstFrame == 3 );
+                REQUIRE( track.firstTimeNs == 3000 );
+                REQUIRE( store.Size() == 1 );
+            }
+        }
+        WHEN( "The store is cleared" )
+        {
+            store.Clear();
+            
+            THEN( "All tracks are removed" )
+            {
+                REQUIRE( store.Size() == 0 );
+                REQUIRE( store.Find(2) == NULL );
+                REQUIRE( store.Expire(collect) == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrackStore matches a brute force store over random Objects", "[OdeTrackStore]" )
+{
+    GIVEN( "An OdeTrackStore and a std::map of the last frame each Object was seen" ) 
+    {
+        std::srand(2468);
+        uint maxAge(5);
+        OdeTrackStore store(maxAge, 4);
+        std::map<uint64_t, uint64_t> lastSeen;
+        
+        WHEN( "Random Objects are seen over many frames" )
+        {
+            THEN( "The live tracks and expired tracks always match" )
+            {
+                for (uint64_t frame = 1; frame <= 2000; frame++)
+                {
+                    store.NewFrame();
+                    uint objects = std::rand() % 40;
+                    for (uint i = 0; i < objects; i++)
+                    {
+                        uint64_t objectId = std::rand() % 200;
+                        bool inserted(false);
+                        OdeTrack& track = store.Touch(objectId, frame, frame*1000, &inserted);
+                        REQUIRE( inserted == (lastSeen.find(objectId) == lastSeen.end()) );
+                        REQUIRE( track.objectId == objectId );
+                        REQUIRE( track.lastFrame == frame );
+                        lastSeen[objectId] = frame;
+                    }
+                    std::vector<uint64_t> expected;
+                    for (auto it = lastSeen.begin(); it != lastSeen.end();)
+                    {
+                        if (frame - it->second > maxAge)
+                        {
+                            expected.push_back(it->first);
+                            it = lastSeen.erase(it);
+                        }
+                        else
+                        {
+                            it++;
+                        }
+                    }
+                    std::vector<uint64_t> expired;
+                    store.Expire([&](OdeTrack& track)
+                    {
+                        REQUIRE( frame - track.lastFrame > maxAge );
+                        expired.push_back(track.objectId);
+                    });
+                    std::sort(expired.begin(), expired.end());
+                    REQUIRE( expired == expected );
+                    REQUIRE( store.Size() == lastSeen.size() );
+                    
+                    for (auto& imap: lastSeen)
+                    {
+                        OdeTrack* pTrack = store.Find(imap.first);
+                        REQUIRE( pTrack != NULL );
+                        REQUIRE( pTrack->lastFrame == imap.second );
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Sees 5,000 concurrent Objects per frame, replacing one in fifty with a
+ * new Object each frame, and expires the Objects replaced.
+ */
+static uint test_track_churn(OdeTrackStore& store, uint64_t& frame, uint64_t& nextId, 
+    std::vector<uint64_t>& objectIds)
+{
+    uint expired(0);
+    for (uint i = 0; i < 100; i++, frame++)
+    {
+        store.NewFrame();
+        for (uint j = frame % 50; j < objectIds.size(); j += 50)
+        {
+            objectIds[j] = nextId++;
+        }
+        bool inserted(false);
+        for (auto objectId: objectIds)
+        {
+            store.Touch(objectId, frame, frame*33000000, &inserted);
+        }
+        expired += store.Expire([](OdeTrack& track){});
+    }
+    return expired;
+}
+
+SCENARIO( "An OdeTrackStore's memory is bounded by the number of live tracks", "[OdeTrackStore]" )
+{
+    GIVEN( "An OdeTrackStore with 5,000 concurrent Objects" ) 
+    {
+        OdeTrackStore store(10);
+        std::vector<uint64_t> objectIds(5000);
+        uint64_t frame(0), nextId(0);
+        for (auto& objectId: objectIds)
+        {
+            objectId = nextId++;
+        }
+        test_track_churn(store, frame, nextId, objectIds);
+        size_t memoryUsed = store.GetMemoryUsed();
+        
+        WHEN( "Objects are continually replaced over many frames" )
+        {
+            uint expired(0);
+            for (uint i = 0; i < 20; i++)
+            {
+                expired += test_track_churn(store, frame, nextId, objectIds);
+            }
+            
+            THEN( "Lost Objects are expired and no more memory is allocated" )
+            {
+                REQUIRE( expired == 20*100*100 );
+                REQUIRE( store.Size() == 5000 + 100*10 );
+                REQUIRE( store.GetMemoryUsed() == memoryUsed );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrackStore updates 5,000 concurrent tracks per source", "[.][benchmark][OdeTrackStore]" )
+{
+    GIVEN( "OdeTrackStores for increasing numbers of sources" ) 
+    {
+        WHEN( "5,000 concurrent Objects per source are replaced one in fifty per frame" )
+        {
+            THEN( "The time and memory per source are constant" )
+            {
+                for (uint sources: {1, 4, 16})
+                {
+                    std::vector<OdeTrackStore> stores(sources, OdeTrackStore(30));
+                    std::vector<std::vector<uint64_t>> objectIds(sources, 
+                        std::vector<uint64_t>(5000));
+                    uint64_t frame(0), nextId(0);
+                    for (auto& ids: objectIds)
+                    {
+                        for (auto& objectId: ids)
+                        {
+                            objectId = nextId++;
+                        }
+                    }
+                    
+                    BENCHMARK( "100 frames, " + std::to_string(sources) + " sources" )
+                    {
+                        uint expired(0);
+                        for (uint i = 0; i < sources; i++)
+                        {
+                            uint64_t sourceFrame(frame);
+                            expired += test_track_churn(stores[i], 
+                                sourceFrame, nextId, objectIds[i]);
+                        }
+                        frame += 100;
+                        return expired;
+                    };
+                    size_t memoryUsed(0);
+                    for (auto& store: stores)
+                    {
+                        memoryUsed += store.GetMemoryUsed();
+                    }
+                    WARN( sources << " sources, " << stores[0].Size() 
+                        << " tracks per source, " << memoryUsed / sources 
+                        << " bytes per source" );
+                }
+            }
+        }
+    }
+}
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "DslOdeTrigger.h"
 #include "DslOdeAction.h"
 #include "DslOdeArea.h"
+#include "DslTestBatchMeta.hpp"
 
 using namespace DSL;
 
@@ -455,6 +456,178 @@ SCENARIO( "An OdeTrigger checks its InferDoneOnly setting ", "[OdeTrigger]" )
     }
 }
 
+/**
+ * Unspecialized check of the Object filters, testing every filter 
+ * whether set or not, as OdeTrigger did before specializing its checks.
+ */
+static bool generic_criteria_check(const OdeTriggerCriteria& criteria,
+    NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+{
+    if ((criteria.classId != DSL_ODE_ANY_CLASS) and (criteria.classId != pObjectMeta->class_id))
+    {
+        return false;
+    }
+    if ((criteria.sourceId != DSL_ODE_ANY_SOURCE) and (criteria.sourceId != pFrameMeta->source_id))
+    {
+        return false;
+    }
+    if ((pObjectMeta->confidence > 0) and (pObjectMeta->confidence < criteria.minConfidence))
+    {
+        return false;
+    }
+    if ((criteria.minWidth and pObjectMeta->rect_params.width < criteria.minWidth) or
+        (criteria.minHeight and pObjectMeta->rect_params.height < criteria.minHeight))
+    {
+        return false;
+    }
+    if ((criteria.maxWidth and pObjectMeta->rect_params.width > criteria.maxWidth) or
+        (criteria.maxHeight and pObjectMeta->rect_params.height > criteria.maxHeight))
+    {
+        return false;
+    }
+    if (criteria.inferDoneOnly and !pFrameMeta->bInferDone)
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Sets random criteria on a Trigger, for only the filters in a mask
+ */
+static OdeTriggerCriteria set_random_criteria(DSL_ODE_TRIGGER_PTR pOdeTrigger, uint filters)
+{
+    OdeTriggerCriteria criteria{0};
+    criteria.classId = (filters & DSL_ODE_CRITERIA_CLASS) ? std::rand() % 4 : DSL_ODE_ANY_CLASS;
+    criteria.sourceId = (filters & DSL_ODE_CRITERIA_SOURCE) ? std::rand() % 4 : DSL_ODE_ANY_SOURCE;
+    criteria.minConfidence = (filters & DSL_ODE_CRITERIA_CONFIDENCE) ? (1 + std::rand() % 99) / 100.0 : 0;
+    criteria.minWidth = (filters & DSL_ODE_CRITERIA_MIN_WIDTH) ? 1 + std::rand() % 300 : 0;
+    criteria.minHeight = (filters & DSL_ODE_CRITERIA_MIN_HEIGHT) ? 1 + std::rand() % 300 : 0;
+    criteria.maxWidth = (filters & DSL_ODE_CRITERIA_MAX_WIDTH) ? 1 + std::rand() % 300 : 0;
+    criteria.maxHeight = (filters & DSL_ODE_CRITERIA_MAX_HEIGHT) ? 1 + std::rand() % 300 : 0;
+    criteria.inferDoneOnly = (filters & DSL_ODE_CRITERIA_INFER_DONE);
+    
+    pOdeTrigger->SetClassId(criteria.classId);
+    pOdeTrigger->SetSourceId(criteria.sourceId);
+    pOdeTrigger->SetMinConfidence(criteria.minConfidence);
+    pOdeTrigger->SetMinDimensions(criteria.minWidth, criteria.minHeight);
+    pOdeTrigger->SetMaxDimensions(criteria.maxWidth, criteria.maxHeight);
+    pOdeTrigger->SetInferDoneOnlySetting(criteria.inferDoneOnly);
+    
+    return criteria;
+}
+
+SCENARIO( "An OdeTrigger specializes its criteria check when a filter is set", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger for any class" ) 
+    {
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_CLASS, 0);
+            
+        NvDsFrameMeta frameMeta = {0};
+        frameMeta.bInferDone = false;  
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 1;
+        objectMeta.confidence = 0.5;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        REQUIRE( pOdeTrigger->GetCriteriaFilters() == 0 );
+        
+        WHEN( "Each filter is set and then cleared" )
+        {
+            THEN( "The filters and the check are updated with each setter" )
+            {
+                pOdeTrigger->SetClassId(2);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_CLASS );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetClassId(DSL_ODE_ANY_CLASS);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == 0 );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+                
+                pOdeTrigger->SetSourceId(1);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_SOURCE );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetSourceId(DSL_ODE_ANY_SOURCE);
+                
+                pOdeTrigger->SetMinConfidence(0.6);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_CONFIDENCE );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetMinConfidence(0);
+                
+                pOdeTrigger->SetMinDimensions(0, 101);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_MIN_HEIGHT );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetMinDimensions(201, 0);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_MIN_WIDTH );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetMinDimensions(0, 0);
+                
+                pOdeTrigger->SetMaxDimensions(199, 100);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == 
+                    (DSL_ODE_CRITERIA_MAX_WIDTH | DSL_ODE_CRITERIA_MAX_HEIGHT) );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetMaxDimensions(0, 0);
+                
+                pOdeTrigger->SetInferDoneOnlySetting(true);
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == DSL_ODE_CRITERIA_INFER_DONE );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->SetInferDoneOnlySetting(false);
+
+                REQUIRE( pOdeTrigger->GetCriteriaFilters() == 0 );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "Each specialized criteria check matches the generic check", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and random Objects" ) 
+    {
+        std::srand(4321);
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_CLASS, 0);
+            
+        std::vector<NvDsFrameMeta> frames(4, NvDsFrameMeta{0});
+        for (uint i = 0; i < frames.size(); i++)
+        {
+            frames[i].source_id = i;
+            frames[i].bInferDone = i % 2;
+        }
+        std::vector<NvDsObjectMeta> objects(200, NvDsObjectMeta{0});
+        for (auto& objectMeta: objects)
+        {
+            objectMeta.class_id = (std::rand() % 5) - 1;
+            objectMeta.confidence = ((std::rand() % 120) - 10) / 100.0;
+            objectMeta.rect_params.width = std::rand() % 300;
+            objectMeta.rect_params.height = std::rand() % 300;
+        }
+
+        WHEN( "The OdeTrigger's criteria are set for every combination of filters" )
+        {
+            THEN( "The OdeTrigger detects the same Objects as the generic check" )
+            {
+                for (uint filters = 0; filters <= DSL_ODE_CRITERIA_ALL; filters++)
+                {
+                    OdeTriggerCriteria criteria = set_random_criteria(pOdeTrigger, filters);
+                    REQUIRE( pOdeTrigger->GetCriteriaFilters() == filters );
+                    
+                    for (uint i = 0; i < objects.size(); i++)
+                    {
+                        NvDsFrameMeta* pFrameMeta = &frames[i % frames.size()];
+                        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, pFrameMeta, &objects[i]) ==
+                            generic_criteria_check(criteria, pFrameMeta, &objects[i]) );
+                    }
+                }
+            }
+        }
+    }
+}
+
 SCENARIO( "A OdeTrigger checks for Area overlap correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeTrigger with maximum criteria" ) 
@@ -649,6 +822,147 @@ static boolean ode_check_for_occurrence_cb(void* buffer,
     return true;
 }
 
+static void intersection_recorder_cb(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    ((std::vector<void*>*)client_data)->push_back(object_meta);
+}
+
+/**
+ * Brute-force pairwise intersection, the reference for the Intersection Trigger
+ */
+static void intersection_pairwise(std::vector<NvDsObjectMeta>& objects, 
+    std::vector<void*>& occurrences)
+{
+    auto inRange = [](int value, int min, int max)
+    {
+        return (value >= min) && (value <= max);
+    };
+    for (uint i = 0; i < objects.size(); i++) 
+    {
+        for (uint j = i+1; j < objects.size() ; j++) 
+        {
+            NvOSD_RectParams& a = objects[i].rect_params;
+            NvOSD_RectParams& b = objects[j].rect_params;
+            
+            if ((inRange(a.left, b.left, b.left + b.width) or inRange(b.left, a.left, a.left + a.width)) and
+                (inRange(a.top, b.top, b.top + b.height) or inRange(b.top, a.top, a.top + a.height)))
+            {
+                occurrences.push_back(&objects[i]);
+                occurrences.push_back(&objects[j]);
+            }
+        }
+    }
+}
+
+static void intersection_random_objects(std::vector<NvDsObjectMeta>& objects, 
+    uint count, uint classId)
+{
+    objects.resize(count);
+    for (auto& objectMeta: objects)
+    {
+        objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.rect_params.left = (std::rand() % 19200) / 10.0;
+        objectMeta.rect_params.top = (std::rand() % 10800) / 10.0;
+        objectMeta.rect_params.width = (std::rand() % 2000) / 10.0;
+        objectMeta.rect_params.height = (std::rand() % 2000) / 10.0;
+    }
+}
+
+SCENARIO( "An Intersection OdeTrigger finds the same intersections as the pairwise test", "[OdeTrigger]" )
+{
+    GIVEN( "A new Intersection OdeTrigger with a recording Callback Action" ) 
+    {
+        std::srand(4321);
+        
+        std::string odeTriggerName("intersection");
+        uint classId(1);
+        uint limit(0);
+        
+        std::vector<void*> occurrences;
+
+        DSL_ODE_TRIGGER_INTERSECTION_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_INTERSECTION_NEW(odeTriggerName.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CALLBACK_PTR pOdeAction = 
+            DSL_ODE_ACTION_CALLBACK_NEW("callback", intersection_recorder_cb, &occurrences);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 2;
+
+        WHEN( "Frames of random Objects are processed" )
+        {
+            THEN( "The Actions are invoked for the same pairs in the same order" )
+            {
+                for (uint frame = 0; frame < 100; frame++)
+                {
+                    std::vector<NvDsObjectMeta> objects;
+                    intersection_random_objects(objects, std::rand() % 100, classId);
+                    
+                    std::vector<void*> expected;
+                    intersection_pairwise(objects, expected);
+                    
+                    occurrences.clear();
+                    frameMeta.frame_num = frame;
+                    for (auto& objectMeta: objects)
+                    {
+                        pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                    }
+                    REQUIRE( pOdeTrigger->PostProcessFrame(NULL, &frameMeta) == expected.size()/2 );
+                    REQUIRE( occurrences == expected );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An Intersection OdeTrigger scales with the number of Objects", "[.][benchmark][OdeTrigger]" )
+{
+    GIVEN( "A new Intersection OdeTrigger" ) 
+    {
+        std::srand(4321);
+        
+        uint classId(1);
+
+        DSL_ODE_TRIGGER_INTERSECTION_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_INTERSECTION_NEW("intersection", classId, 0);
+
+        NvDsFrameMeta frameMeta =  {0};
+
+        WHEN( "Frames of 10 to 400 random Objects are processed" )
+        {
+            THEN( "The sweep is faster than the pairwise test for dense frames" )
+            {
+                for (uint objectCount: {10, 50, 200, 400})
+                {
+                    std::vector<NvDsObjectMeta> objects;
+                    intersection_random_objects(objects, objectCount, classId);
+                    
+                    std::string name = std::to_string(objectCount) + " Objects";
+                    
+                    BENCHMARK( "Pairwise test, " + name )
+                    {
+                        std::vector<void*> occurrences;
+                        intersection_pairwise(objects, occurrences);
+                        return occurrences.size();
+                    };
+                    BENCHMARK( "Intersection Trigger, " + name )
+                    {
+                        for (auto& objectMeta: objects)
+                        {
+                            pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                        }
+                        return pOdeTrigger->PostProcessFrame(NULL, &frameMeta);
+                    };
+                }
+            }
+        }
+    }
+}
+
 SCENARIO( "A Custom OdeTrigger checks for and handles Occurrence correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new CustomOdeTrigger with client occurrence checker" ) 
@@ -804,3 +1118,979 @@ SCENARIO( "A MinimumOdeTrigger handle ODE Occurrence correctly", "[OdeTrigger]"
         }
     }
 }
+
+SCENARIO( "A Window OdeTrigger triggers once each time its aggregate crosses the threshold", "[OdeTrigger]" )
+{
+    GIVEN( "A new Window OdeTrigger for the sum over 3 seconds in 1 second buckets" ) 
+    {
+        DSL_ODE_TRIGGER_WINDOW_PTR pOdeTrigger = DSL_ODE_TRIGGER_WINDOW_NEW("window", 
+            DSL_ODE_ANY_CLASS, 0, DSL_ODE_WINDOW_AGGREGATE_SUM, DSL_ODE_WINDOW_CROSSING_ABOVE, 
+            10, 3000, 1000);
+            
+        REQUIRE( pOdeTrigger->GetTimestamp() == DSL_ODE_WINDOW_TIMESTAMP_PTS );
+
+        NvDsFrameMeta frameMeta = {0};
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 1;
+
+        // Processes one frame, 500 ms after the last, with a given object count
+        auto processFrame = [&](uint count)
+        {
+            frameMeta.buf_pts += 500000000;
+            pOdeTrigger->PreProcessFrame(NULL, &frameMeta);
+            for (uint i = 0; i < count; i++)
+            {
+                pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+            }
+            return pOdeTrigger->PostProcessFrame(NULL, &frameMeta);
+        };
+        
+        WHEN( "The windowed sum rises above the threshold" )
+        {
+            REQUIRE( processFrame(3) == 0 );
+            REQUIRE( processFrame(3) == 0 );
+            REQUIRE( processFrame(3) == 0 );
+            
+            THEN( "The Trigger triggers once while the sum remains above the threshold" )
+            {
+                REQUIRE( processFrame(3) == 1 );
+                REQUIRE( processFrame(3) == 0 );
+                REQUIRE( processFrame(3) == 0 );
+                REQUIRE( pOdeTrigger->m_triggered == 1 );
+            }
+        }
+        WHEN( "The windowed sum falls below the threshold, and rises above it again" )
+        {
+            for (uint i = 0; i < 6; i++)
+            {
+                processFrame(3);
+            }
+            REQUIRE( pOdeTrigger->m_triggered == 1 );
+            
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( processFrame(0) == 0 );
+            }
+            
+            THEN( "The Trigger triggers on the second crossing" )
+            {
+                REQUIRE( processFrame(6) == 0 );
+                REQUIRE( processFrame(6) == 1 );
+                REQUIRE( pOdeTrigger->m_triggered == 2 );
+            }
+        }
+        WHEN( "The timestamp is changed" )
+        {
+            processFrame(6);
+            pOdeTrigger->SetTimestamp(DSL_ODE_WINDOW_TIMESTAMP_NTP);
+            REQUIRE( pOdeTrigger->GetTimestamp() == DSL_ODE_WINDOW_TIMESTAMP_NTP );
+            
+            THEN( "The window is cleared before the next frame is added" )
+            {
+                REQUIRE( processFrame(6) == 0 );
+                REQUIRE( processFrame(6) == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "Tracked Object OdeTriggers trigger on new, lost and dwelling Objects", "[OdeTrigger]" )
+{
+    GIVEN( "New Track, Lost Track and Dwell OdeTriggers, lost after two frames" ) 
+    {
+        DSL_ODE_TRIGGER_NEW_TRACK_PTR pNewTrackTrigger = 
+            DSL_ODE_TRIGGER_NEW_TRACK_NEW("new-track", DSL_ODE_ANY_CLASS, 0, 2);
+        DSL_ODE_TRIGGER_LOST_TRACK_PTR pLostTrackTrigger = 
+            DSL_ODE_TRIGGER_LOST_TRACK_NEW("lost-track", DSL_ODE_ANY_CLASS, 0, 2);
+        DSL_ODE_TRIGGER_DWELL_PTR pDwellTrigger = 
+            DSL_ODE_TRIGGER_DWELL_NEW("dwell", DSL_ODE_ANY_CLASS, 0, 1000, 2);
+            
+        std::vector<DSL_ODE_TRIGGER_PTR> triggers = 
+            {pNewTrackTrigger, pLostTrackTrigger, pDwellTrigger};
+
+        NvDsFrameMeta frameMeta = {0};
+        frameMeta.source_id = 1;
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 1;
+
+        // Processes one frame, 500 ms after the last, with the given Object Ids
+        auto processFrame = [&](std::vector<uint64_t> objectIds)
+        {
+            frameMeta.frame_num++;
+            frameMeta.buf_pts += 500000000;
+            for (auto& pTrigger: triggers)
+            {
+                pTrigger->PreProcessFrame(NULL, &frameMeta);
+                for (auto objectId: objectIds)
+                {
+                    objectMeta.object_id = objectId;
+                    pTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                }
+                pTrigger->PostProcessFrame(NULL, &frameMeta);
+            }
+        };
+        
+        WHEN( "Two Objects are seen on consecutive frames" )
+        {
+            processFrame({1, 2});
+            processFrame({1, 2});
+            
+            THEN( "The New Track Trigger triggers once for each Object" )
+            {
+                REQUIRE( pNewTrackTrigger->m_triggered == 2 );
+                REQUIRE( pNewTrackTrigger->GetTrackCount(1) == 2 );
+                REQUIRE( pNewTrackTrigger->GetTrackCount(0) == 0 );
+                REQUIRE( pLostTrackTrigger->m_triggered == 0 );
+                REQUIRE( pDwellTrigger->m_triggered == 0 );
+            }
+        }
+        WHEN( "Two Objects are seen for 1.5 seconds" )
+        {
+            processFrame({1, 2});
+            processFrame({1, 2});
+            processFrame({1, 2});
+            REQUIRE( pDwellTrigger->m_triggered == 2 );
+            
+            THEN( "The Dwell Trigger triggers once for each Object" )
+            {
+                processFrame({1, 2});
+                REQUIRE( pDwellTrigger->m_triggered == 2 );
+            }
+        }
+        WHEN( "Untracked Objects are seen for 1.5 seconds" )
+        {
+            processFrame({UNTRACKED_OBJECT_ID, UNTRACKED_OBJECT_ID});
+            processFrame({UNTRACKED_OBJECT_ID});
+            processFrame({UNTRACKED_OBJECT_ID});
+            processFrame({});
+            processFrame({});
+            
+            THEN( "No tracks are added, and none of the Triggers trigger" )
+            {
+                REQUIRE( pNewTrackTrigger->GetTrackCount(1) == 0 );
+                REQUIRE( pNewTrackTrigger->m_triggered == 0 );
+                REQUIRE( pLostTrackTrigger->m_triggered == 0 );
+                REQUIRE( pDwellTrigger->m_triggered == 0 );
+            }
+        }
+        WHEN( "One of two Objects is not seen for two frames" )
+        {
+            processFrame({1, 2});
+            processFrame({1});
+            processFrame({1});
+            REQUIRE( pLostTrackTrigger->m_triggered == 0 );
+            processFrame({1});
+            
+            THEN( "The Lost Track Trigger triggers once for the lost Object" )
+            {
+                REQUIRE( pLostTrackTrigger->m_triggered == 1 );
+                REQUIRE( pLostTrackTrigger->GetTrackCount(1) == 1 );
+                
+                processFrame({1, 2});
+                REQUIRE( pNewTrackTrigger->m_triggered == 3 );
+                REQUIRE( pLostTrackTrigger->m_triggered == 1 );
+            }
+        }
+    }
+}
+
+static void test_trigger_enabler(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    static_cast<OdeTrigger*>(client_data)->SetEnabled(true);
+}
+
+SCENARIO( "A Tracked Object OdeTrigger enabled by an Action mid-frame handles the frame's Objects", "[OdeTrigger]" )
+{
+    GIVEN( "A disabled New Track OdeTrigger, and a Trigger with an Action that enables it" ) 
+    {
+        DSL_ODE_TRIGGER_NEW_TRACK_PTR pNewTrackTrigger = 
+            DSL_ODE_TRIGGER_NEW_TRACK_NEW("new-track", DSL_ODE_ANY_CLASS, 0, 2);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pEnableTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("enable-trigger", DSL_ODE_ANY_CLASS, 1);
+        DSL_ODE_ACTION_CALLBACK_PTR pOdeAction = DSL_ODE_ACTION_CALLBACK_NEW(
+            "enabler", test_trigger_enabler, pNewTrackTrigger.get());
+            
+        REQUIRE( pEnableTrigger->AddAction(pOdeAction) == true );
+        pNewTrackTrigger->SetEnabled(false);
+
+        NvDsFrameMeta frameMeta = {0};
+        frameMeta.source_id = 3;
+        frameMeta.frame_num = 1;
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 1;
+        objectMeta.object_id = 1;
+
+        WHEN( "The Trigger is enabled after the frame is pre-processed" )
+        {
+            pNewTrackTrigger->PreProcessFrame(NULL, &frameMeta);
+            pEnableTrigger->PreProcessFrame(NULL, &frameMeta);
+            REQUIRE( pEnableTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+            REQUIRE( pNewTrackTrigger->GetEnabled() == true );
+            
+            THEN( "The Object is tracked on the source that was never pre-processed" )
+            {
+                REQUIRE( pNewTrackTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+                pNewTrackTrigger->PostProcessFrame(NULL, &frameMeta);
+                REQUIRE( pNewTrackTrigger->GetTrackCount(3) == 1 );
+                REQUIRE( pNewTrackTrigger->m_triggered == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Line Crossing OdeTrigger counts and triggers on directional crossings", "[OdeTrigger]" )
+{
+    GIVEN( "A new Line Crossing OdeTrigger for left to right crossings of a horizontal line" ) 
+    {
+        DSL_ODE_TRIGGER_LINE_CROSSING_PTR pOdeTrigger = DSL_ODE_TRIGGER_LINE_CROSSING_NEW(
+            "line-crossing", DSL_ODE_ANY_CLASS, 0, DSL_ODE_LINE_DIRECTION_LEFT_TO_RIGHT, 
+            DSL_ODE_LINE_POINT_BOTTOM_CENTER, 2);
+        DSL_ODE_LINE_PTR pOdeLine = DSL_ODE_LINE_NEW("line", 0, 500, 1000, 500, false);
+        
+        REQUIRE( pOdeTrigger->AddLine(pOdeLine) == true );
+        REQUIRE( pOdeTrigger->AddLine(pOdeLine) == false );
+
+        NvDsFrameMeta frameMeta = {0};
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = 1;
+        objectMeta.object_id = 1;
+        objectMeta.rect_params.left = 400;
+        objectMeta.rect_params.width = 100;
+        objectMeta.rect_params.height = 100;
+
+        // Processes one frame with the Object's bottom edge at a given position
+        auto processFrame = [&](float bottom)
+        {
+            frameMeta.frame_num++;
+            objectMeta.rect_params.top = bottom - 100;
+            pOdeTrigger->PreProcessFrame(NULL, &frameMeta);
+            pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+            return pOdeTrigger->PostProcessFrame(NULL, &frameMeta);
+        };
+        
+        WHEN( "The Object moves down across the line, and back up" )
+        {
+            REQUIRE( processFrame(450) == 0 );
+            REQUIRE( processFrame(480) == 0 );
+            REQUIRE( processFrame(520) == 1 );
+            REQUIRE( processFrame(560) == 0 );
+            REQUIRE( processFrame(490) == 0 );
+            
+            THEN( "Both crossings are counted, and only the left to right crossing triggers" )
+            {
+                uint64_t leftToRight(0), rightToLeft(0);
+                REQUIRE( pOdeTrigger->GetCounts("line", &leftToRight, &rightToLeft) == true );
+                REQUIRE( leftToRight == 1 );
+                REQUIRE( rightToLeft == 1 );
+                REQUIRE( pOdeTrigger->m_triggered == 1 );
+                
+                pOdeTrigger->ResetCounts();
+                REQUIRE( pOdeTrigger->GetCounts("line", &leftToRight, &rightToLeft) == true );
+                REQUIRE( leftToRight == 0 );
+                REQUIRE( rightToLeft == 0 );
+            }
+        }
+        WHEN( "The Object is first seen below the line" )
+        {
+            REQUIRE( processFrame(520) == 0 );
+            
+            THEN( "No crossing is counted" )
+            {
+                uint64_t leftToRight(99), rightToLeft(99);
+                REQUIRE( pOdeTrigger->GetCounts("line", &leftToRight, &rightToLeft) == true );
+                REQUIRE( leftToRight == 0 );
+                REQUIRE( rightToLeft == 0 );
+            }
+        }
+        WHEN( "The Trigger is enabled after the frame is pre-processed" )
+        {
+            REQUIRE( processFrame(450) == 0 );
+            pOdeTrigger->SetEnabled(false);
+            frameMeta.frame_num++;
+            objectMeta.rect_params.top = 480 - 100;
+            pOdeTrigger->PreProcessFrame(NULL, &frameMeta);
+            pOdeTrigger->SetEnabled(true);
+            pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+            REQUIRE( pOdeTrigger->PostProcessFrame(NULL, &frameMeta) == 0 );
+            
+            THEN( "The Object's movement is not recorded until the next frame" )
+            {
+                REQUIRE( processFrame(520) == 1 );
+                
+                uint64_t leftToRight(0), rightToLeft(0);
+                REQUIRE( pOdeTrigger->GetCounts("line", &leftToRight, &rightToLeft) == true );
+                REQUIRE( leftToRight == 1 );
+                REQUIRE( rightToLeft == 0 );
+            }
+        }
+        WHEN( "The Line is removed" )
+        {
+            REQUIRE( pOdeTrigger->RemoveLine(pOdeLine) == true );
+            REQUIRE( pOdeTrigger->RemoveLine(pOdeLine) == false );
+            
+            THEN( "Crossings are no longer detected" )
+            {
+                uint64_t leftToRight(0), rightToLeft(0);
+                REQUIRE( pOdeTrigger->GetCounts("line", &leftToRight, &rightToLeft) == false );
+                REQUIRE( processFrame(450) == 0 );
+                REQUIRE( processFrame(550) == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger reads consistent criteria while a client updates them", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and a client thread updating its minimum criteria" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), classId, limit);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        objectMeta.confidence = 0.5; 
+        
+        // Each of the two settings fails the Object on one dimension only. 
+        // A torn read, mixing the two, would be the only way to pass.
+        pOdeTrigger->SetMinDimensions(0, 500);
+        
+        std::atomic<bool> done(false);
+
+        WHEN( "The OdeTrigger checks Objects while the client alternates the settings" )
+        {
+            std::thread client([&]()
+            {
+                for (uint i = 0; i < 100000; i++)
+                {
+                    if (i % 2)
+                    {
+                        pOdeTrigger->SetMinDimensions(0, 500);
+                    }
+                    else
+                    {
+                        pOdeTrigger->SetMinDimensions(500, 0);
+                    }
+                }
+                done = true;
+            });
+            
+            uint occurrences(0);
+            while (!done)
+            {
+                // synthetic batch of 16 frames
+                for (uint frame = 0; frame < 16; frame++)
+                {
+                    frameMeta.frame_num++;
+                    if (pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta))
+                    {
+                        occurrences++;
+                    }
+                }
+            }
+            client.join();
+            
+            THEN( "No occurrence is ever detected from a partially updated criteria" )
+            {
+                REQUIRE( occurrences == 0 );
+                REQUIRE( pOdeTrigger->m_triggered == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger updates its Area index when Areas are added and removed", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and two Areas" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), classId, limit);
+
+        DSL_ODE_AREA_PTR pOdeArea1 =
+            DSL_ODE_AREA_NEW("ode-area-1", 0, 0, 10, 10, false);
+        DSL_ODE_AREA_PTR pOdeArea2 =
+            DSL_ODE_AREA_NEW("ode-area-2", 300, 300, 100, 100, false);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.rect_params.left = 200;
+        objectMeta.rect_params.top = 200;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 200;
+
+        REQUIRE( pOdeTrigger->AddArea(pOdeArea1) == true );        
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+
+        WHEN( "An overlapping Area is added" )
+        {
+            REQUIRE( pOdeTrigger->AddArea(pOdeArea2) == true );        
+            
+            THEN( "The OdeTrigger is detected, until the Area is removed" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+                
+                REQUIRE( pOdeTrigger->RemoveArea(pOdeArea2) == true );        
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == false );
+            }
+        }
+        WHEN( "All Areas are removed" )
+        {
+            pOdeTrigger->RemoveAllAreas();
+            
+            THEN( "The OdeTrigger is detected without the Area criteria" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger's Area overlap test scales with the number of Areas", "[.][benchmark][OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and a frame of Objects" ) 
+    {
+        std::srand(1234);
+        
+        uint classId(1);
+        
+        std::vector<NvDsObjectMeta> objects(20);
+        for (auto& objectMeta: objects)
+        {
+            objectMeta = {0};
+            objectMeta.class_id = classId;
+            objectMeta.rect_params.left = std::rand() % 1800;
+            objectMeta.rect_params.top = std::rand() % 1000;
+            objectMeta.rect_params.width = 20 + std::rand() % 100;
+            objectMeta.rect_params.height = 20 + std::rand() % 100;
+        }
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 0;
+        
+        WHEN( "Objects are checked against 1 to 1000 Areas" )
+        {
+            THEN( "The index is faster than testing every Area" )
+            {
+                for (uint areaCount: {1, 10, 100, 1000})
+                {
+                    DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+                        DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", classId, 0);
+                        
+                    std::vector<NvOSD_RectParams> areas;
+                    for (uint i = 0; i < areaCount; i++)
+                    {
+                        std::string areaName = "area-" + std::to_string(i);
+                        
+                        // Small shelf-spot sized Areas spread over the frame
+                        DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW(areaName.c_str(),
+                            std::rand() % 1900, std::rand() % 1060, 20, 20, false);
+                        pOdeTrigger->AddArea(pOdeArea);
+                        areas.push_back(pOdeArea->m_rectParams);
+                    }
+                    
+                    std::string name = std::to_string(areaCount) + " Areas";
+                    
+                    BENCHMARK( "Linear search, " + name )
+                    {
+                        uint occurrences(0);
+                        for (auto& objectMeta: objects)
+                        {
+                            for (const auto& area: areas)
+                            {
+                                if (OdeAreaIndex::DoesOverlap(objectMeta.rect_params, area))
+                                {
+                                    occurrences++;
+                                    break;
+                                }
+                            }
+                        }
+                        return occurrences;
+                    };
+                    BENCHMARK( "Area index, " + name )
+                    {
+                        uint occurrences(0);
+                        for (auto& objectMeta: objects)
+                        {
+                            if (pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta))
+                            {
+                                occurrences++;
+                            }
+                        }
+                        return occurrences;
+                    };
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger checks its minimum frame count correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a minimum frame count of 3 of 5 frames" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), classId, limit);
+            
+        REQUIRE( pOdeTrigger->SetMinFrameCount(3, 5) == true );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = classId;
+        objectMeta1.object_id = 1; 
+
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = classId;
+        objectMeta2.object_id = 2; 
+
+        WHEN( "An Object is seen on consecutive frames" )
+        {
+            THEN( "The OdeTrigger is detected from the third frame" )
+            {
+                frameMeta.frame_num = 1;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == false );
+                frameMeta.frame_num = 2;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == false );
+                frameMeta.frame_num = 3;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == true );
+            }
+        }
+        WHEN( "An Object is seen on frames spread beyond the window" )
+        {
+            THEN( "The OdeTrigger is only detected when 3 of the last 5 frames are seen" )
+            {
+                frameMeta.frame_num = 10;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == false );
+                frameMeta.frame_num = 12;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == false );
+                frameMeta.frame_num = 15;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == false );
+                frameMeta.frame_num = 16;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == true );
+            }
+        }
+        WHEN( "Two Objects are seen on alternating frames" )
+        {
+            THEN( "Each Object is counted independently" )
+            {
+                for (uint frame = 1; frame <= 4; frame++)
+                {
+                    frameMeta.frame_num = frame;
+                    REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == (frame >= 3) );
+                    if (frame % 2)
+                    {
+                        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta2) == false );
+                    }
+                }
+                frameMeta.frame_num = 5;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta2) == true );
+            }
+        }
+        WHEN( "Untracked Objects are seen on a single frame" )
+        {
+            objectMeta1.object_id = UNTRACKED_OBJECT_ID; 
+            objectMeta2.object_id = UNTRACKED_OBJECT_ID; 
+            
+            THEN( "Each Object is detected without a frame history" )
+            {
+                frameMeta.frame_num = 1;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta1) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta2) == true );
+            }
+        }
+        WHEN( "The minimum frame count is set out of range" )
+        {
+            THEN( "The set fails and the previous values are kept" )
+            {
+                REQUIRE( pOdeTrigger->SetMinFrameCount(6, 5) == false );
+                REQUIRE( pOdeTrigger->SetMinFrameCount(1, DSL_ODE_TRIGGER_MAX_FRAME_COUNT_D+1) == false );
+                
+                uint minFrameCountN(0), minFrameCountD(0);
+                pOdeTrigger->GetMinFrameCount(&minFrameCountN, &minFrameCountD);
+                REQUIRE( minFrameCountN == 3 );
+                REQUIRE( minFrameCountD == 5 );
+            }
+        }
+    }
+}
+
+/**
+ * Occurrence Trigger with access to the capacity of its frame history table
+ */
+class TestFrameHistoryOdeTrigger : public OccurrenceOdeTrigger
+{
+public:
+    TestFrameHistoryOdeTrigger(const char* name, uint classId, uint limit)
+        : OccurrenceOdeTrigger(name, classId, limit)
+    {};
+    
+    uint GetFrameHistoryCapacity()
+    {
+        return m_frameHistories.Capacity();
+    }
+};
+
+SCENARIO( "An OdeTrigger evicts the frame histories of a restarted Source", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a minimum frame count, and 30 Objects seen at frame 1000" ) 
+    {
+        uint classId(1);
+        
+        std::shared_ptr<TestFrameHistoryOdeTrigger> pOdeTrigger = 
+            std::shared_ptr<TestFrameHistoryOdeTrigger>(
+                new TestFrameHistoryOdeTrigger("occurrence", classId, 0));
+            
+        REQUIRE( pOdeTrigger->SetMinFrameCount(3, 5) == true );
+
+        NvDsFrameMeta frameMeta = {0};
+        frameMeta.frame_num = 1000;
+        
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        
+        uint64_t objectId(1);
+        for (; objectId <= 30; objectId++)
+        {
+            objectMeta.object_id = objectId;
+            pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+        }
+        uint capacity = pOdeTrigger->GetFrameHistoryCapacity();
+
+        WHEN( "The Source restarts from frame 1 with new Objects" )
+        {
+            frameMeta.frame_num = 1;
+            for (; objectId <= 60; objectId++)
+            {
+                objectMeta.object_id = objectId;
+                pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+            }
+            
+            THEN( "The histories from before the restart are evicted instead of growing the table" )
+            {
+                REQUIRE( pOdeTrigger->GetFrameHistoryCapacity() == capacity );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger's minimum frame count scales to 10k live tracks", "[.][benchmark][OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a minimum frame count and 10 sources of 1000 tracked Objects" ) 
+    {
+        uint classId(1);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", classId, 0);
+            
+        std::vector<NvDsFrameMeta> frames(10);
+        std::vector<NvDsObjectMeta> objects(1000);
+        for (uint i = 0; i < objects.size(); i++)
+        {
+            objects[i] = {0};
+            objects[i].class_id = classId;
+        }
+        for (uint source = 0; source < frames.size(); source++)
+        {
+            frames[source] = {0};
+            frames[source].source_id = source;
+        }
+        uint64_t nextObjectId(0);
+
+        WHEN( "Batches are processed with 1% of the tracks replaced each frame" )
+        {
+            THEN( "The time per batch stays bounded" )
+            {
+                pOdeTrigger->SetMinFrameCount(5, 10);
+                
+                BENCHMARK( "10 frames of 1000 tracked Objects" )
+                {
+                    uint occurrences(0);
+                    for (auto& frameMeta: frames)
+                    {
+                        frameMeta.frame_num++;
+                        for (uint i = 0; i < objects.size(); i++)
+                        {
+                            // Tracks come and go, so the table must evict to stay bounded
+                            if (i % 100 == frameMeta.frame_num % 100)
+                            {
+                                objects[i].object_id = nextObjectId++;
+                            }
+                            if (pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objects[i]))
+                            {
+                                occurrences++;
+                            }
+                        }
+                    }
+                    return occurrences;
+                };
+            }
+        }
+    }
+}
+
+/**
+ * Log function used while benchmarking with logging enabled, so that the 
+ * messages are formatted but not written to the console.
+ */
+static void benchmark_null_log_function(GstDebugCategory* category, GstDebugLevel level, 
+    const gchar* file, const gchar* function, gint line, GObject* object, 
+    GstDebugMessage* message, gpointer user_data)
+{
+}
+
+SCENARIO( "Benchmark the cost of logging in GetName and the minimum criteria check", "[.][benchmark][OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and 1000 Objects that meet its minimum criteria" ) 
+    {
+        uint classId(1);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", classId, 0);
+            
+        NvDsFrameMeta frameMeta = {0};
+        std::vector<NvDsObjectMeta> objects(1000);
+        for (auto& objectMeta: objects)
+        {
+            objectMeta = {0};
+            objectMeta.class_id = classId;
+        }
+        GstDebugLevel threshold = gst_debug_category_get_threshold(GST_CAT_DSL);
+
+        WHEN( "Logging is disabled for the DSL category" )
+        {
+            gst_debug_category_set_threshold(GST_CAT_DSL, GST_LEVEL_NONE);
+            
+            THEN( "A disabled level costs a single branch" )
+            {
+                BENCHMARK( "1000 calls to GetName - logging disabled" )
+                {
+                    size_t length(0);
+                    for (uint i = 0; i < 1000; i++)
+                    {
+                        length += pOdeTrigger->GetName().size();
+                    }
+                    return length;
+                };
+                BENCHMARK( "1000 minimum criteria checks - logging disabled" )
+                {
+                    uint occurrences(0);
+                    for (auto& objectMeta: objects)
+                    {
+                        occurrences += pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                    }
+                    return occurrences;
+                };
+            }
+            gst_debug_category_set_threshold(GST_CAT_DSL, threshold);
+        }
+        WHEN( "Logging is enabled at the DEBUG level for the DSL category" )
+        {
+            gst_debug_remove_log_function(gst_debug_log_default);
+            gst_debug_add_log_function(benchmark_null_log_function, NULL, NULL);
+            gst_debug_category_set_threshold(GST_CAT_DSL, GST_LEVEL_DEBUG);
+            
+            THEN( "Each LOG_FUNC formats and logs its entry and exit" )
+            {
+                BENCHMARK( "1000 calls to GetName - logging enabled" )
+                {
+                    size_t length(0);
+                    for (uint i = 0; i < 1000; i++)
+                    {
+                        length += pOdeTrigger->GetName().size();
+                    }
+                    return length;
+                };
+                BENCHMARK( "1000 minimum criteria checks - logging enabled" )
+                {
+                    uint occurrences(0);
+                    for (auto& objectMeta: objects)
+                    {
+                        occurrences += pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                    }
+                    return occurrences;
+                };
+            }
+            gst_debug_category_set_threshold(GST_CAT_DSL, threshold);
+            gst_debug_remove_log_function(benchmark_null_log_function);
+            gst_debug_add_log_function(gst_debug_log_default, NULL, NULL);
+        }
+    }
+}
+
+SCENARIO( "Benchmark the specialized criteria check against the generic check", "[.][benchmark][OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and 1000 random Objects" ) 
+    {
+        std::srand(1234);
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", DSL_ODE_ANY_CLASS, 0);
+            
+        NvDsFrameMeta frameMeta = {0};
+        frameMeta.bInferDone = true;
+        
+        std::vector<NvDsObjectMeta> objects(1000, NvDsObjectMeta{0});
+        for (auto& objectMeta: objects)
+        {
+            objectMeta.class_id = std::rand() % 4;
+            objectMeta.confidence = (std::rand() % 100) / 100.0;
+            objectMeta.rect_params.width = std::rand() % 300;
+            objectMeta.rect_params.height = std::rand() % 300;
+        }
+        std::vector<std::pair<std::string, uint>> cases = {
+            {"no filters", 0},
+            {"class id", DSL_ODE_CRITERIA_CLASS},
+            {"class id and min dimensions", 
+                DSL_ODE_CRITERIA_CLASS | DSL_ODE_CRITERIA_MIN_WIDTH | DSL_ODE_CRITERIA_MIN_HEIGHT},
+            {"all filters", DSL_ODE_CRITERIA_ALL}};
+
+        WHEN( "The OdeTrigger's criteria are set" )
+        {
+            THEN( "Only the filters set are checked for each Object" )
+            {
+                for (auto& ci: cases)
+                {
+                    OdeTriggerCriteria criteria = set_random_criteria(pOdeTrigger, ci.second);
+                    
+                    BENCHMARK( "1000 generic criteria checks, " + ci.first )
+                    {
+                        uint passed(0);
+                        for (auto& objectMeta: objects)
+                        {
+                            passed += generic_criteria_check(criteria, &frameMeta, &objectMeta);
+                        }
+                        return passed;
+                    };
+                    BENCHMARK( "1000 minimum criteria checks, " + ci.first )
+                    {
+                        uint occurrences(0);
+                        for (auto& objectMeta: objects)
+                        {
+                            occurrences += pOdeTrigger->CheckForOccurrence(NULL, &frameMeta, &objectMeta);
+                        }
+                        return occurrences;
+                    };
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "The displayed Areas of a frame are added with a single display meta", "[OdeTrigger]" )
+{
+    GIVEN( "Two Triggers sharing three displayed Areas and one hidden Area" ) 
+    {
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pFirstTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("first-trigger", DSL_ODE_ANY_CLASS, 0);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pSecondTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("second-trigger", DSL_ODE_ANY_CLASS, 0);
+
+        for (uint i = 0; i < 4; i++)
+        {
+            std::string name = "area-" + std::to_string(i);
+            DSL_ODE_AREA_PTR pOdeArea = DSL_ODE_AREA_NEW(name.c_str(), 
+                i*100, 0, 50, 50, (i < 3));
+            REQUIRE( pFirstTrigger->AddArea(pOdeArea) == true );
+            REQUIRE( pSecondTrigger->AddArea(pOdeArea) == true );
+        }
+        GstBuffer* pBuffer = TestBatchBufferNew(1);
+        NvDsFrameMeta* pFrameMeta = TestFrameMetaAdd(pBuffer, 0, 0);
+
+        WHEN( "Both Triggers pre-process the frame while building the display meta" )
+        {
+            OdeDisplayMetaBuilder displayMetaBuilder;
+            displayMetaBuilder.Begin(pBuffer);
+            
+            pFirstTrigger->PreProcessFrame(pBuffer, pFrameMeta);
+            pSecondTrigger->PreProcessFrame(pBuffer, pFrameMeta);
+            
+            REQUIRE( displayMetaBuilder.Flush() == 1 );
+            
+            THEN( "One display meta is added with the displayed Areas of the first Trigger" )
+            {
+                REQUIRE( g_list_length(pFrameMeta->display_meta_list) == 1 );
+                
+                NvDsDisplayMeta* pDisplayMeta = 
+                    (NvDsDisplayMeta*)pFrameMeta->display_meta_list->data;
+                REQUIRE( pDisplayMeta->num_rects == 3 );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "OdeTrigger event ids are unique across streaming threads", "[OdeTrigger]" )
+{
+    GIVEN( "A number of threads assigning event ids concurrently" ) 
+    {
+        uint threadCount(4);
+        uint eventCount(10000);
+        std::vector<std::vector<uint64_t>> eventIds(threadCount);
+        std::vector<bool> currentIdsCorrect(threadCount, true);
+
+        WHEN( "Each thread assigns a number of event ids" )
+        {
+            std::vector<std::thread> threads;
+            for (uint i = 0; i < threadCount; i++)
+            {
+                threads.push_back(std::thread([&, i]()
+                {
+                    for (uint j = 0; j < eventCount; j++)
+                    {
+                        uint64_t eventId = OdeTrigger::NextEventId();
+                        if (OdeTrigger::s_eventId != eventId)
+                        {
+                            currentIdsCorrect[i] = false;
+                        }
+                        eventIds[i].push_back(eventId);
+                    }
+                }));
+            }
+            for (auto& thread: threads)
+            {
+                thread.join();
+            }
+            
+            THEN( "No event id is assigned twice and each thread sees its own id" )
+            {
+                std::vector<uint64_t> allEventIds;
+                for (uint i = 0; i < threadCount; i++)
+                {
+                    REQUIRE( currentIdsCorrect[i] == true );
+                    REQUIRE( std::is_sorted(eventIds[i].begin(), eventIds[i].end()) );
+                    allEventIds.insert(allEventIds.end(), 
+                        eventIds[i].begin(), eventIds[i].end());
+                }
+                std::sort(allEventIds.begin(), allEventIds.end());
+                REQUIRE( std::adjacent_find(allEventIds.begin(), 
+                    allEventIds.end()) == allEventIds.end() );
+                REQUIRE( allEventIds.size() == threadCount*eventCount );
+            }
+        }
+    }
+}
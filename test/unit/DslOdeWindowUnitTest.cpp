@@ -0,0 +1,230 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeWindow.h"
+
+using namespace DSL;
+
+/**
+ * Brute force window over all frames added, for comparison with OdeWindow
+ */
+struct TestWindowFrame
+{
+    int64_t bucket;
+    uint count;
+};
+
+static double test_window_aggregate(const std::vector<TestWindowFrame>& frames, 
+    uint bucketCount, uint aggregate)
+{
+    uint64_t sum(0), count(0);
+    uint min(UINT32_MAX), max(0);
+    int64_t current = frames.back().bucket;
+    
+    for (auto& frame: frames)
+    {
+        if (frame.bucket > current - bucketCount)
+        {
+            sum += frame.count;
+            count++;
+            min = std::min(min, frame.count);
+            max = std::max(max, frame.count);
+        }
+    }
+    switch (aggregate)
+    {
+    case DSL_ODE_WINDOW_AGGREGATE_SUM :
+        return sum;
+    case DSL_ODE_WINDOW_AGGREGATE_AVERAGE :
+        return (double)sum / count;
+    case DSL_ODE_WINDOW_AGGREGATE_MIN :
+        return min;
+    }
+    return max;
+}
+
+SCENARIO( "An OdeWindow aggregates the frames in its window", "[OdeWindow]" )
+{
+    GIVEN( "A new OdeWindow of three buckets" ) 
+    {
+        OdeWindow window(3);
+        
+        REQUIRE( window.GetSum() == 0 );
+        REQUIRE( window.GetFrames() == 0 );
+        REQUIRE( window.GetAggregate(DSL_ODE_WINDOW_AGGREGATE_AVERAGE) == 0 );
+        REQUIRE( window.GetMin() == 0 );
+        REQUIRE( window.GetMax() == 0 );
+        
+        WHEN( "Frames are added to consecutive buckets" )
+        {
+            window.AddFrame(10, 4);
+            window.AddFrame(10, 2);
+            window.AddFrame(11, 7);
+            window.AddFrame(12, 3);
+            
+            THEN( "All frames are in the window" )
+            {
+                REQUIRE( window.GetSum() == 16 );
+                REQUIRE( window.GetFrames() == 4 );
+                REQUIRE( window.GetAggregate(DSL_ODE_WINDOW_AGGREGATE_AVERAGE) == 4 );
+                REQUIRE( window.GetMin() == 2 );
+                REQUIRE( window.GetMax() == 7 );
+            }
+        }
+        WHEN( "The window moves past the oldest bucket" )
+        {
+            window.AddFrame(10, 1);
+            window.AddFrame(11, 7);
+            window.AddFrame(12, 3);
+            window.AddFrame(13, 5);
+            
+            THEN( "The frames in the oldest bucket are dropped" )
+            {
+                REQUIRE( window.GetSum() == 15 );
+                REQUIRE( window.GetFrames() == 3 );
+                REQUIRE( window.GetMin() == 3 );
+                REQUIRE( window.GetMax() == 7 );
+            }
+        }
+        WHEN( "The window moves past all buckets" )
+        {
+            window.AddFrame(10, 1);
+            window.AddFrame(11, 7);
+            window.AddFrame(20, 3);
+            
+            THEN( "Only the current frame is in the window" )
+            {
+                REQUIRE( window.GetSum() == 3 );
+                REQUIRE( window.GetFrames() == 1 );
+                REQUIRE( window.GetMin() == 3 );
+                REQUIRE( window.GetMax() == 3 );
+            }
+        }
+        WHEN( "A frame is added with an earlier bucket" )
+        {
+            window.AddFrame(10, 1);
+            window.AddFrame(11, 7);
+            window.AddFrame(5, 2);
+            
+            THEN( "The window is cleared first" )
+            {
+                REQUIRE( window.GetSum() == 2 );
+                REQUIRE( window.GetFrames() == 1 );
+                REQUIRE( window.GetMax() == 2 );
+            }
+        }
+        WHEN( "The window is cleared" )
+        {
+            window.AddFrame(10, 1);
+            window.Clear();
+            
+            THEN( "The window is empty" )
+            {
+                REQUIRE( window.GetSum() == 0 );
+                REQUIRE( window.GetFrames() == 0 );
+                REQUIRE( window.GetMin() == 0 );
+                REQUIRE( window.GetMax() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeWindow matches a brute force window over random frames", "[OdeWindow]" )
+{
+    GIVEN( "Random bucket counts and random frames" ) 
+    {
+        std::srand(2468);
+
+        WHEN( "Each frame is added" )
+        {
+            THEN( "All aggregates match the brute force window" )
+            {
+                for (uint i = 0; i < 50; i++)
+                {
+                    uint bucketCount = 1 + std::rand() % 16;
+                    OdeWindow window(bucketCount);
+                    
+                    std::vector<TestWindowFrame> frames;
+                    int64_t bucket(std::rand() % 100);
+                    
+                    for (uint j = 0; j < 500; j++)
+                    {
+                        // Mostly several frames per bucket, with occasional gaps
+                        uint step = std::rand() % 10;
+                        bucket += (step < 6) ? 0 : (step < 9) ? 1 : std::rand() % 20;
+                        
+                        TestWindowFrame frame{bucket, (uint)(std::rand() % 30)};
+                        frames.push_back(frame);
+                        window.AddFrame(frame.bucket, frame.count);
+                        
+                        for (uint aggregate = DSL_ODE_WINDOW_AGGREGATE_SUM; 
+                            aggregate <= DSL_ODE_WINDOW_AGGREGATE_MAX; aggregate++)
+                        {
+                            REQUIRE( window.GetAggregate(aggregate) == 
+                                Approx(test_window_aggregate(frames, bucketCount, aggregate)) );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeWindow updates in constant time per frame", "[.][benchmark][OdeWindow]" )
+{
+    GIVEN( "Windows of increasing bucket counts" ) 
+    {
+        std::srand(1357);
+        std::vector<uint> counts(10000);
+        for (auto& count: counts)
+        {
+            count = std::rand() % 50;
+        }
+        
+        WHEN( "10,000 frames are added at 30 frames per bucket" )
+        {
+            THEN( "The time per frame is independent of the window size" )
+            {
+                for (uint bucketCount: {16, 256, DSL_ODE_WINDOW_BUCKETS_MAX})
+                {
+                    OdeWindow window(bucketCount);
+                    int64_t frame(0);
+                    
+                    BENCHMARK( "10000 frames, " + std::to_string(bucketCount) + " buckets" )
+                    {
+                        double aggregate(0);
+                        for (auto count: counts)
+                        {
+                            window.AddFrame(frame++ / 30, count);
+                            aggregate += window.GetAggregate(DSL_ODE_WINDOW_AGGREGATE_MAX);
+                        }
+                        return aggregate;
+                    };
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslOdeWorkerPool.h"
+
+using namespace DSL;
+
+SCENARIO( "A new OdeWorkerPool is created correctly", "[OdeWorkerPool]" )
+{
+    GIVEN( "A range of worker counts" ) 
+    {
+        WHEN( "The OdeWorkerPools are created" )
+        {
+            OdeWorkerPool onePool(1);
+            OdeWorkerPool fourPool(4);
+            OdeWorkerPool zeroPool(0);
+            OdeWorkerPool maxPool(DSL_ODE_WORKER_POOL_MAX_WORKERS + 1);
+            
+            THEN( "The worker counts are clamped to the valid range" )
+            {
+                REQUIRE( onePool.GetWorkerCount() == 1 );
+                REQUIRE( fourPool.GetWorkerCount() == 4 );
+                REQUIRE( zeroPool.GetWorkerCount() == 1 );
+                REQUIRE( maxPool.GetWorkerCount() == DSL_ODE_WORKER_POOL_MAX_WORKERS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeWorkerPool with one worker runs each iteration in order", "[OdeWorkerPool]" )
+{
+    GIVEN( "A new OdeWorkerPool with one worker" ) 
+    {
+        OdeWorkerPool workerPool(1);
+        
+        std::vector<uint> iterations;
+        std::thread::id callingThread = std::this_thread::get_id();
+        bool onCallingThread(true);
+        
+        WHEN( "ParallelFor is called" )
+        {
+            workerPool.ParallelFor(100, [&](uint iteration)
+            {
+                iterations.push_back(iteration);
+                onCallingThread &= (std::this_thread::get_id() == callingThread);
+            });
+            
+            THEN( "Each iteration is run once, in order, on the calling thread" )
+            {
+                REQUIRE( iterations.size() == 100 );
+                for (uint i = 0; i < 100; i++)
+                {
+                    REQUIRE( iterations[i] == i );
+                }
+                REQUIRE( onCallingThread == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeWorkerPool with multiple workers runs each iteration once", "[OdeWorkerPool]" )
+{
+    GIVEN( "A new OdeWorkerPool with four workers" ) 
+    {
+        OdeWorkerPool workerPool(4);
+        
+        WHEN( "ParallelFor is called repeatedly with different iteration counts" )
+        {
+            THEN( "Each iteration is run exactly once for each call" )
+            {
+                for (uint count: {0, 1, 2, 3, 4, 5, 17, 64, 1000})
+                {
+                    std::vector<std::atomic<uint>> runs(count);
+                    for (auto& run: runs)
+                    {
+                        run.store(0);
+                    }
+                    workerPool.ParallelFor(count, [&](uint iteration)
+                    {
+                        runs[iteration]++;
+                    });
+                    for (auto& run: runs)
+                    {
+                        REQUIRE( run.load() == 1 );
+                    }
+                }
+            }
+        }
+        WHEN( "The iterations are unbalanced" )
+        {
+            std::vector<std::atomic<uint>> runs(64);
+            for (auto& run: runs)
+            {
+                run.store(0);
+            }
+            
+            // The first worker's range is slow, the others steal from it
+            workerPool.ParallelFor(64, [&](uint iteration)
+            {
+                if (iteration < 16)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+                runs[iteration]++;
+            });
+            
+            THEN( "Each iteration is still run exactly once" )
+            {
+                for (auto& run: runs)
+                {
+                    REQUIRE( run.load() == 1 );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,276 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslElementr.h"
+#include "DslPadProbetr.h"
+#include "DslTestBatchMeta.hpp"
+
+using namespace DSL;
+
+static std::atomic<uint> handlerCallCount(0);
+
+static boolean batch_meta_handler_cb1(void* batch_meta, void* user_data)
+{
+    handlerCallCount++;
+    return true;
+}
+
+static boolean batch_meta_handler_cb2(void* batch_meta, void* user_data)
+{
+    handlerCallCount++;
+    return true;
+}
+
+static boolean batch_meta_handler_remove_self_cb(void* batch_meta, void* user_data)
+{
+    handlerCallCount++;
+    return false;
+}
+
+static boolean batch_meta_handler_remove_other_cb(void* batch_meta, void* user_data)
+{
+    handlerCallCount++;
+    static_cast<PadProbetr*>(user_data)->RemoveBatchMetaHandler(batch_meta_handler_cb1);
+    return true;
+}
+
+static std::atomic<uint> handlerInUseViolations(0);
+
+static boolean batch_meta_handler_counter_cb(void* batch_meta, void* user_data)
+{
+    (*static_cast<std::atomic<uint>*>(user_data))++;
+    return true;
+}
+
+static boolean batch_meta_handler_in_use_cb(void* batch_meta, void* user_data)
+{
+    // user data must remain in use until the handler is removed
+    if (!static_cast<std::atomic<bool>*>(user_data)->load())
+    {
+        handlerInUseViolations++;
+    }
+    return true;
+}
+
+SCENARIO( "A PadProbetr calls its Batch Meta Handlers in the order added", "[PadProbetr]" )
+{
+    GIVEN( "A PadProbetr with two Batch Meta Handlers" )
+    {
+        DSL_ELEMENT_PTR pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "test-queue");
+        DSL_PAD_PROBE_PTR pPadProbe = DSL_PAD_PROBE_NEW("test-probe", "src", pQueue);
+        
+        REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_cb1, NULL) == true );
+        REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_cb2, NULL) == true );
+        REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_cb1, NULL) == false );
+
+        GstBuffer* pBuffer = (GstBuffer*)0x1;
+        GstPadProbeInfo info{};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+        handlerCallCount = 0;
+
+        WHEN( "The Pad Probe is handled" )
+        {
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            
+            THEN( "Both Handlers are called" )
+            {
+                REQUIRE( handlerCallCount == 2 );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_cb1) == true );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_cb2) == true );
+            }
+        }
+        WHEN( "A Handler is removed" )
+        {
+            REQUIRE( pPadProbe->RemoveBatchMetaHandler(batch_meta_handler_cb1) == true );
+            REQUIRE( pPadProbe->RemoveBatchMetaHandler(batch_meta_handler_cb1) == false );
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            
+            THEN( "Only the remaining Handler is called" )
+            {
+                REQUIRE( handlerCallCount == 1 );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_cb1) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PadProbetr's Batch Meta Handlers can remove themselves and others", "[PadProbetr]" )
+{
+    GIVEN( "A PadProbetr and a Pad Probe buffer" )
+    {
+        DSL_ELEMENT_PTR pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "test-queue");
+        DSL_PAD_PROBE_PTR pPadProbe = DSL_PAD_PROBE_NEW("test-probe", "src", pQueue);
+
+        GstBuffer* pBuffer = (GstBuffer*)0x1;
+        GstPadProbeInfo info{};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+        handlerCallCount = 0;
+
+        WHEN( "A Handler returns false while others follow it" )
+        {
+            REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_remove_self_cb, NULL) == true );
+            REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_cb1, NULL) == true );
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            
+            THEN( "The Handler is removed after the first probe and the others are still called" )
+            {
+                REQUIRE( handlerCallCount == 3 );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_remove_self_cb) == false );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_cb1) == true );
+            }
+        }
+        WHEN( "A Handler removes another Handler from within the Pad Probe" )
+        {
+            REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_remove_other_cb, 
+                pPadProbe.get()) == true );
+            REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_cb1, NULL) == true );
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+            
+            THEN( "The removed Handler is not called, even by the probe in progress" )
+            {
+                REQUIRE( handlerCallCount == 2 );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_cb1) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A removed Batch Meta Handler is not called once removal returns", "[PadProbetr]" )
+{
+    GIVEN( "A PadProbetr handling Pad Probes on a streaming thread" )
+    {
+        DSL_ELEMENT_PTR pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "test-queue");
+        DSL_PAD_PROBE_PTR pPadProbe = DSL_PAD_PROBE_NEW("test-probe", "src", pQueue);
+        
+        // called first by each probe, counting the probes started
+        std::atomic<uint> probeCount(0);
+        REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_counter_cb, 
+            &probeCount) == true );
+
+        const uint iterations(1000);
+        std::atomic<bool> inUse[iterations];
+        handlerInUseViolations = 0;
+
+        std::atomic<bool> streaming(true);
+        std::thread streamingThread([&]()
+        {
+            GstPadProbeInfo info{};
+            info.type = GST_PAD_PROBE_TYPE_BUFFER;
+            info.data = (GstBuffer*)0x1;
+            while (streaming)
+            {
+                pPadProbe->HandlePadProbe(NULL, &info);
+            }
+        });
+
+        WHEN( "A client thread repeatedly adds and removes a Handler with user data" )
+        {
+            for (uint i = 0; i < iterations; i++)
+            {
+                inUse[i] = true;
+                REQUIRE( pPadProbe->AddBatchMetaHandler(batch_meta_handler_in_use_cb, 
+                    &inUse[i]) == true );
+                std::this_thread::yield();
+                REQUIRE( pPadProbe->RemoveBatchMetaHandler(batch_meta_handler_in_use_cb) == true );
+                
+                // Removal doesn't wait for a call in progress, so wait for the 
+                // next probe to start before the user data is released
+                uint probes = probeCount;
+                while (probeCount < probes + 2)
+                {
+                    std::this_thread::yield();
+                }
+                inUse[i] = false;
+            }
+            streaming = false;
+            streamingThread.join();
+            
+            THEN( "The Handler is never called by a probe started after removal" )
+            {
+                REQUIRE( handlerInUseViolations == 0 );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_in_use_cb) == false );
+                REQUIRE( pPadProbe->IsChild(batch_meta_handler_counter_cb) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PadProbetr writes Kitti output while enabled", "[PadProbetr]" )
+{
+    GIVEN( "A PadProbetr with Kitti output enabled for source files" )
+    {
+        std::string kittiOutputDir("./test-kitti-output");
+        mkdir(kittiOutputDir.c_str(), 0755);
+        std::string kittiFilePath = kittiOutputDir + "/00.txt";
+        
+        DSL_ELEMENT_PTR pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "test-queue");
+        DSL_PAD_PROBE_PTR pPadProbe = DSL_PAD_PROBE_NEW("test-probe", "src", pQueue);
+        
+        REQUIRE( pPadProbe->SetKittiOutputMode(DSL_KITTI_OUTPUT_MODE_SOURCE_FILES+1, 0) == false );
+        REQUIRE( pPadProbe->SetKittiOutputMode(DSL_KITTI_OUTPUT_MODE_SOURCE_FILES, 0) == true );
+        REQUIRE( pPadProbe->SetKittiOutputEnabled(true, kittiOutputDir.c_str()) == true );
+        
+        TestBatchMetaParams params = TestBatchMetaParamsDefault();
+        params.sourceCount = 1;
+        params.objectsPerFrame = 4;
+        TestBatchMetaGenerator generator(params);
+
+        WHEN( "Batches are handled before and after Kitti output is disabled" )
+        {
+            for (uint i = 0; i < 10; i++)
+            {
+                if (i == 5)
+                {
+                    REQUIRE( pPadProbe->SetKittiOutputEnabled(false, "") == true );
+                }
+                GstBuffer* pBuffer = generator.Next();
+                GstPadProbeInfo info{};
+                info.type = GST_PAD_PROBE_TYPE_BUFFER;
+                info.data = pBuffer;
+                REQUIRE( pPadProbe->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_PASS );
+                gst_buffer_unref(pBuffer);
+            }
+            
+            THEN( "Only the batches handled while enabled are written" )
+            {
+                std::ifstream kittiFile(kittiFilePath);
+                REQUIRE( kittiFile.is_open() == true );
+                
+                uint lineCount(0);
+                std::string line;
+                while (std::getline(kittiFile, line))
+                {
+                    lineCount++;
+                }
+                REQUIRE( lineCount == 5*params.objectsPerFrame );
+                REQUIRE( std::remove(kittiFilePath.c_str()) == 0 );
+            }
+        }
+    }
+}
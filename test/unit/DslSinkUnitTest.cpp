@@ -1058,6 +1058,7 @@ SCENARIO( "A new ImageSinkBintr is created correctly",  "[ImageSinkBintr]" )
                 REQUIRE( pSinkBintr->GetFrameCaptureInterval() == 0 );
                 REQUIRE( pSinkBintr->GetFrameCaptureEnabled() == false );
                 REQUIRE( pSinkBintr->GetObjectCaptureEnabled() == false );
+                REQUIRE( pSinkBintr->GetCapturesDropped() == 0 );
             }
         }
     }